@@ -0,0 +1,98 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/support/libfirm.pc.in"
+  "/root/repo/support/libfirmConfig.cmake.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-ExactVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCygwin.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMsys.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPerl.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "libfirmConfig.cmake"
+  "libfirmConfigVersion.cmake"
+  "libfirm.pc"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/firm.dir/DependInfo.cmake"
+  "CMakeFiles/check.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.compact_graph.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.deq.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.dom_passes.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.dom_update.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.elf_object.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.execfreq.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.globalmap.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.ident_bench.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.irgwalk_bench.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.irio_binary.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.jit_amd64.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.loop_vectorize.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.block_layout.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.funcorder.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.lower_switch.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.nan_payload.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.out_edges.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.parallel_backend.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.pipeline.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.profile_roundtrip.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.rbitset.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.sc_val_from_bits.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.slp_vectorize.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.snprintf.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.strcalc.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.strcalc_bench.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.tarval_calc.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.tarval_float.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.tarval_floatops.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.tarval_from_to.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.tarval_is_long.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.valuetable.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.vector_mode.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.strcalc_bench8.dir/DependInfo.cmake"
+  "CMakeFiles/unittests.irgwalk_bench_split.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.block_layout.dir/unittests/block_layout.c.o"
+  "CMakeFiles/unittests.block_layout.dir/unittests/block_layout.c.o.d"
+  "unittests.block_layout"
+  "unittests.block_layout.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.block_layout.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.compact_graph.dir/unittests/compact_graph.c.o"
+  "CMakeFiles/unittests.compact_graph.dir/unittests/compact_graph.c.o.d"
+  "unittests.compact_graph"
+  "unittests.compact_graph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.compact_graph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.deq.dir/unittests/deq.c.o"
+  "CMakeFiles/unittests.deq.dir/unittests/deq.c.o.d"
+  "unittests.deq"
+  "unittests.deq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.deq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.dom_passes.dir/unittests/dom_passes.c.o"
+  "CMakeFiles/unittests.dom_passes.dir/unittests/dom_passes.c.o.d"
+  "unittests.dom_passes"
+  "unittests.dom_passes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.dom_passes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.dom_update.dir/unittests/dom_update.c.o"
+  "CMakeFiles/unittests.dom_update.dir/unittests/dom_update.c.o.d"
+  "unittests.dom_update"
+  "unittests.dom_update.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.dom_update.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.elf_object.dir/unittests/elf_object.c.o"
+  "CMakeFiles/unittests.elf_object.dir/unittests/elf_object.c.o.d"
+  "unittests.elf_object"
+  "unittests.elf_object.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.elf_object.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
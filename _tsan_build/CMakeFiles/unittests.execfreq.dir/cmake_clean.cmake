@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.execfreq.dir/unittests/execfreq.c.o"
+  "CMakeFiles/unittests.execfreq.dir/unittests/execfreq.c.o.d"
+  "unittests.execfreq"
+  "unittests.execfreq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.execfreq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.funcorder.dir/unittests/funcorder.c.o"
+  "CMakeFiles/unittests.funcorder.dir/unittests/funcorder.c.o.d"
+  "unittests.funcorder"
+  "unittests.funcorder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.funcorder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.ident_bench.dir/unittests/ident_bench.c.o"
+  "CMakeFiles/unittests.ident_bench.dir/unittests/ident_bench.c.o.d"
+  "unittests.ident_bench"
+  "unittests.ident_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.ident_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.irgwalk_bench.dir/unittests/irgwalk_bench.c.o"
+  "CMakeFiles/unittests.irgwalk_bench.dir/unittests/irgwalk_bench.c.o.d"
+  "unittests.irgwalk_bench"
+  "unittests.irgwalk_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.irgwalk_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
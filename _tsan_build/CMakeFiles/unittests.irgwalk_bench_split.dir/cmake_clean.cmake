@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.irgwalk_bench_split.dir/ir/ir/irnode.c.o"
+  "CMakeFiles/unittests.irgwalk_bench_split.dir/ir/ir/irnode.c.o.d"
+  "CMakeFiles/unittests.irgwalk_bench_split.dir/unittests/irgwalk_bench.c.o"
+  "CMakeFiles/unittests.irgwalk_bench_split.dir/unittests/irgwalk_bench.c.o.d"
+  "unittests.irgwalk_bench_split"
+  "unittests.irgwalk_bench_split.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.irgwalk_bench_split.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.irio_binary.dir/unittests/irio_binary.c.o"
+  "CMakeFiles/unittests.irio_binary.dir/unittests/irio_binary.c.o.d"
+  "unittests.irio_binary"
+  "unittests.irio_binary.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.irio_binary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.jit_amd64.dir/unittests/jit_amd64.c.o"
+  "CMakeFiles/unittests.jit_amd64.dir/unittests/jit_amd64.c.o.d"
+  "unittests.jit_amd64"
+  "unittests.jit_amd64.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.jit_amd64.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.loop_vectorize.dir/unittests/loop_vectorize.c.o"
+  "CMakeFiles/unittests.loop_vectorize.dir/unittests/loop_vectorize.c.o.d"
+  "unittests.loop_vectorize"
+  "unittests.loop_vectorize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.loop_vectorize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.lower_switch.dir/unittests/lower_switch.c.o"
+  "CMakeFiles/unittests.lower_switch.dir/unittests/lower_switch.c.o.d"
+  "unittests.lower_switch"
+  "unittests.lower_switch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.lower_switch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
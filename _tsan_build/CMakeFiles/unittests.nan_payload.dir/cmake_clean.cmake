@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.nan_payload.dir/unittests/nan_payload.c.o"
+  "CMakeFiles/unittests.nan_payload.dir/unittests/nan_payload.c.o.d"
+  "unittests.nan_payload"
+  "unittests.nan_payload.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.nan_payload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
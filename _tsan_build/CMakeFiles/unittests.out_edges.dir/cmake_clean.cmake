@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.out_edges.dir/unittests/out_edges.c.o"
+  "CMakeFiles/unittests.out_edges.dir/unittests/out_edges.c.o.d"
+  "unittests.out_edges"
+  "unittests.out_edges.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.out_edges.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
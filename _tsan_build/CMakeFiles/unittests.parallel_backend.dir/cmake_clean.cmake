@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.parallel_backend.dir/unittests/parallel_backend.c.o"
+  "CMakeFiles/unittests.parallel_backend.dir/unittests/parallel_backend.c.o.d"
+  "unittests.parallel_backend"
+  "unittests.parallel_backend.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.parallel_backend.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.pipeline.dir/unittests/pipeline.c.o"
+  "CMakeFiles/unittests.pipeline.dir/unittests/pipeline.c.o.d"
+  "unittests.pipeline"
+  "unittests.pipeline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.pipeline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
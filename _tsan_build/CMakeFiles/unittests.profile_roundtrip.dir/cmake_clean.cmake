@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.profile_roundtrip.dir/unittests/profile_roundtrip.c.o"
+  "CMakeFiles/unittests.profile_roundtrip.dir/unittests/profile_roundtrip.c.o.d"
+  "unittests.profile_roundtrip"
+  "unittests.profile_roundtrip.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.profile_roundtrip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.slp_vectorize.dir/unittests/slp_vectorize.c.o"
+  "CMakeFiles/unittests.slp_vectorize.dir/unittests/slp_vectorize.c.o.d"
+  "unittests.slp_vectorize"
+  "unittests.slp_vectorize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.slp_vectorize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
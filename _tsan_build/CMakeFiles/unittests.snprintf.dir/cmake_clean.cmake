@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.snprintf.dir/unittests/snprintf.c.o"
+  "CMakeFiles/unittests.snprintf.dir/unittests/snprintf.c.o.d"
+  "unittests.snprintf"
+  "unittests.snprintf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.snprintf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.strcalc.dir/unittests/strcalc.c.o"
+  "CMakeFiles/unittests.strcalc.dir/unittests/strcalc.c.o.d"
+  "unittests.strcalc"
+  "unittests.strcalc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.strcalc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
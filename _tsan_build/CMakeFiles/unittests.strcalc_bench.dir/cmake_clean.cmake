@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.strcalc_bench.dir/unittests/strcalc_bench.c.o"
+  "CMakeFiles/unittests.strcalc_bench.dir/unittests/strcalc_bench.c.o.d"
+  "unittests.strcalc_bench"
+  "unittests.strcalc_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.strcalc_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
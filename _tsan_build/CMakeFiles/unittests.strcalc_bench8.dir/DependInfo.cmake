@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ir/tv/strcalc.c" "CMakeFiles/unittests.strcalc_bench8.dir/ir/tv/strcalc.c.o" "gcc" "CMakeFiles/unittests.strcalc_bench8.dir/ir/tv/strcalc.c.o.d"
+  "/root/repo/unittests/strcalc_bench.c" "CMakeFiles/unittests.strcalc_bench8.dir/unittests/strcalc_bench.c.o" "gcc" "CMakeFiles/unittests.strcalc_bench8.dir/unittests/strcalc_bench.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_tsan_build/CMakeFiles/firm.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
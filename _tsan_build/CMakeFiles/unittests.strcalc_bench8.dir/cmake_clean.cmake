@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.strcalc_bench8.dir/ir/tv/strcalc.c.o"
+  "CMakeFiles/unittests.strcalc_bench8.dir/ir/tv/strcalc.c.o.d"
+  "CMakeFiles/unittests.strcalc_bench8.dir/unittests/strcalc_bench.c.o"
+  "CMakeFiles/unittests.strcalc_bench8.dir/unittests/strcalc_bench.c.o.d"
+  "unittests.strcalc_bench8"
+  "unittests.strcalc_bench8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.strcalc_bench8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
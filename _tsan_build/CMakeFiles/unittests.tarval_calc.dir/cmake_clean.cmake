@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.tarval_calc.dir/unittests/tarval_calc.c.o"
+  "CMakeFiles/unittests.tarval_calc.dir/unittests/tarval_calc.c.o.d"
+  "unittests.tarval_calc"
+  "unittests.tarval_calc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.tarval_calc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.tarval_float.dir/unittests/tarval_float.c.o"
+  "CMakeFiles/unittests.tarval_float.dir/unittests/tarval_float.c.o.d"
+  "unittests.tarval_float"
+  "unittests.tarval_float.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.tarval_float.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
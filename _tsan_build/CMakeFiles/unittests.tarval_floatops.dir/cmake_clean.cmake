@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.tarval_floatops.dir/unittests/tarval_floatops.c.o"
+  "CMakeFiles/unittests.tarval_floatops.dir/unittests/tarval_floatops.c.o.d"
+  "unittests.tarval_floatops"
+  "unittests.tarval_floatops.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.tarval_floatops.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.tarval_from_to.dir/unittests/tarval_from_to.c.o"
+  "CMakeFiles/unittests.tarval_from_to.dir/unittests/tarval_from_to.c.o.d"
+  "unittests.tarval_from_to"
+  "unittests.tarval_from_to.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.tarval_from_to.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
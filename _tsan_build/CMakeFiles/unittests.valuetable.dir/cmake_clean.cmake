@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.valuetable.dir/unittests/valuetable.c.o"
+  "CMakeFiles/unittests.valuetable.dir/unittests/valuetable.c.o.d"
+  "unittests.valuetable"
+  "unittests.valuetable.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.valuetable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
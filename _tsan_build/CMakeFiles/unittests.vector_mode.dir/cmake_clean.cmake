@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unittests.vector_mode.dir/unittests/vector_mode.c.o"
+  "CMakeFiles/unittests.vector_mode.dir/unittests/vector_mode.c.o.d"
+  "unittests.vector_mode"
+  "unittests.vector_mode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unittests.vector_mode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,76 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_tsan_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test-unittests.compact_graph "unittests.compact_graph")
+set_tests_properties(test-unittests.compact_graph PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.deq "unittests.deq")
+set_tests_properties(test-unittests.deq PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.dom_passes "unittests.dom_passes")
+set_tests_properties(test-unittests.dom_passes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.dom_update "unittests.dom_update")
+set_tests_properties(test-unittests.dom_update PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.elf_object "unittests.elf_object")
+set_tests_properties(test-unittests.elf_object PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.execfreq "unittests.execfreq")
+set_tests_properties(test-unittests.execfreq PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.globalmap "unittests.globalmap")
+set_tests_properties(test-unittests.globalmap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.ident_bench "unittests.ident_bench")
+set_tests_properties(test-unittests.ident_bench PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.irgwalk_bench "unittests.irgwalk_bench")
+set_tests_properties(test-unittests.irgwalk_bench PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.irio_binary "unittests.irio_binary")
+set_tests_properties(test-unittests.irio_binary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.jit_amd64 "unittests.jit_amd64")
+set_tests_properties(test-unittests.jit_amd64 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.loop_vectorize "unittests.loop_vectorize")
+set_tests_properties(test-unittests.loop_vectorize PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.block_layout "unittests.block_layout")
+set_tests_properties(test-unittests.block_layout PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.funcorder "unittests.funcorder")
+set_tests_properties(test-unittests.funcorder PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.lower_switch "unittests.lower_switch")
+set_tests_properties(test-unittests.lower_switch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.nan_payload "unittests.nan_payload")
+set_tests_properties(test-unittests.nan_payload PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.out_edges "unittests.out_edges")
+set_tests_properties(test-unittests.out_edges PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.parallel_backend "unittests.parallel_backend")
+set_tests_properties(test-unittests.parallel_backend PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.pipeline "unittests.pipeline")
+set_tests_properties(test-unittests.pipeline PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.profile_roundtrip "unittests.profile_roundtrip")
+set_tests_properties(test-unittests.profile_roundtrip PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.rbitset "unittests.rbitset")
+set_tests_properties(test-unittests.rbitset PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.sc_val_from_bits "unittests.sc_val_from_bits")
+set_tests_properties(test-unittests.sc_val_from_bits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.slp_vectorize "unittests.slp_vectorize")
+set_tests_properties(test-unittests.slp_vectorize PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.snprintf "unittests.snprintf")
+set_tests_properties(test-unittests.snprintf PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.strcalc "unittests.strcalc")
+set_tests_properties(test-unittests.strcalc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.strcalc_bench "unittests.strcalc_bench")
+set_tests_properties(test-unittests.strcalc_bench PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.tarval_calc "unittests.tarval_calc")
+set_tests_properties(test-unittests.tarval_calc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.tarval_float "unittests.tarval_float")
+set_tests_properties(test-unittests.tarval_float PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.tarval_floatops "unittests.tarval_floatops")
+set_tests_properties(test-unittests.tarval_floatops PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.tarval_from_to "unittests.tarval_from_to")
+set_tests_properties(test-unittests.tarval_from_to PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.tarval_is_long "unittests.tarval_is_long")
+set_tests_properties(test-unittests.tarval_is_long PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.valuetable "unittests.valuetable")
+set_tests_properties(test-unittests.valuetable PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.vector_mode "unittests.vector_mode")
+set_tests_properties(test-unittests.vector_mode PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;502;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.strcalc_bench8 "unittests.strcalc_bench8")
+set_tests_properties(test-unittests.strcalc_bench8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;509;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test-unittests.irgwalk_bench_split "unittests.irgwalk_bench_split")
+set_tests_properties(test-unittests.irgwalk_bench_split PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;515;add_test;/root/repo/CMakeLists.txt;0;")
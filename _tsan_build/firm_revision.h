@@ -0,0 +1 @@
+#define libfirm_VERSION_REVISION "e349043fcff41559d8a5d02182c6c1d3253eb67f-dirty"
@@ -0,0 +1,942 @@
+/**
+ * @file
+ * @brief Generated functions to emit code for assembler ir nodes.
+ * @note  DO NOT EDIT THIS FILE, your changes will be lost.
+ *         Edit /root/repo/ir/be/amd64/amd64_spec.pl instead.
+ *         created by: /root/repo/ir/be/scripts/generate_emitter.pl /root/repo/ir/be/amd64/amd64_spec.pl /root/repo/_tsan_build/gen/ir/be/amd64
+ * @date  Sat Oct 17 10:40:01 2026
+ */
+#include "gen_amd64_emitter.h"
+
+#include "beemithlp.h"
+#include "gen_amd64_new_nodes.h"
+#include "amd64_emitter.h"
+
+static void emit_amd64_add(ir_node const *const node)
+{
+	amd64_emitf(node, "add%M %AM");
+}
+
+static void enc_amd64_add(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_binop(node, 0);
+}
+
+static void emit_amd64_addp(ir_node const *const node)
+{
+	amd64_emitf(node, "addp%MX %AM");
+}
+
+static void enc_amd64_addp(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_packed_binop(node, 0x58);
+}
+
+static void emit_amd64_adds(ir_node const *const node)
+{
+	amd64_emitf(node, "adds%MX %AM");
+}
+
+static void enc_amd64_adds(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_scalar_binop(node, 0x58);
+}
+
+static void emit_amd64_and(ir_node const *const node)
+{
+	amd64_emitf(node, "and%M %AM");
+}
+
+static void enc_amd64_and(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_binop(node, 4);
+}
+
+static void emit_amd64_bsf(ir_node const *const node)
+{
+	amd64_emitf(node, "bsf%M %AM, %D0");
+}
+
+static void enc_amd64_bsf(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_0f_unop_reg(node, 0xBC);
+}
+
+static void emit_amd64_bsr(ir_node const *const node)
+{
+	amd64_emitf(node, "bsr%M %AM, %D0");
+}
+
+static void enc_amd64_bsr(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_0f_unop_reg(node, 0xBD);
+}
+
+static void emit_amd64_call(ir_node const *const node)
+{
+	amd64_emitf(node, "call %*AM");
+}
+
+static void emit_amd64_cltd(ir_node const *const node)
+{
+	amd64_emitf(node, "cltd");
+}
+
+static void enc_amd64_cltd(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_simple(0x99);
+}
+
+static void emit_amd64_cmp(ir_node const *const node)
+{
+	amd64_emitf(node, "cmp%M %AM");
+}
+
+static void enc_amd64_cmp(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_binop(node, 7);
+}
+
+static void emit_amd64_cmpxchg(ir_node const *const node)
+{
+	amd64_emitf(node, "lock cmpxchg%M %AM");
+}
+
+static void emit_amd64_cqto(ir_node const *const node)
+{
+	amd64_emitf(node, "cqto");
+}
+
+static void emit_amd64_cvtsd2ss(ir_node const *const node)
+{
+	amd64_emitf(node, "cvtsd2ss %AM, %^D0");
+}
+
+static void emit_amd64_cvtsi2sd(ir_node const *const node)
+{
+	amd64_emitf(node, "cvtsi2sd %AM, %^D0");
+}
+
+static void emit_amd64_cvtsi2ss(ir_node const *const node)
+{
+	amd64_emitf(node, "cvtsi2ss %AM, %^D0");
+}
+
+static void emit_amd64_cvtss2sd(ir_node const *const node)
+{
+	amd64_emitf(node, "cvtss2sd %AM, %^D0");
+}
+
+static void emit_amd64_cvttsd2si(ir_node const *const node)
+{
+	amd64_emitf(node, "cvttsd2si %AM, %D0");
+}
+
+static void emit_amd64_cvttss2si(ir_node const *const node)
+{
+	amd64_emitf(node, "cvttss2si %AM, %D0");
+}
+
+static void emit_amd64_div(ir_node const *const node)
+{
+	amd64_emitf(node, "div%M %AM");
+}
+
+static void enc_amd64_div(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_unop(node, 6);
+}
+
+static void emit_amd64_divp(ir_node const *const node)
+{
+	amd64_emitf(node, "divp%MX %AM");
+}
+
+static void enc_amd64_divp(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_packed_binop(node, 0x5E);
+}
+
+static void emit_amd64_divs(ir_node const *const node)
+{
+	amd64_emitf(node, "divs%MX %AM");
+}
+
+static void enc_amd64_divs(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_scalar_binop(node, 0x5E);
+}
+
+static void emit_amd64_fadd(ir_node const *const node)
+{
+	amd64_emitf(node, "fadd%FP %AF");
+}
+
+static void enc_amd64_fadd(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_fbinop(node, 0);
+}
+
+static void emit_amd64_fchs(ir_node const *const node)
+{
+	amd64_emitf(node, "fchs");
+}
+
+static void enc_amd64_fchs(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_fsimple(0xE0);
+}
+
+static void emit_amd64_fdiv(ir_node const *const node)
+{
+	amd64_emitf(node, "fdiv%FR%FP %AF");
+}
+
+static void enc_amd64_fdiv(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_fbinop(node, 6);
+}
+
+static void emit_amd64_fdup(ir_node const *const node)
+{
+	amd64_emitf(node, "fld %F0");
+}
+
+static void enc_amd64_fdup(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_fop_reg(node, 0xD9, 0xC0);
+}
+
+static void emit_amd64_fild(ir_node const *const node)
+{
+	amd64_emitf(node, "fild%M %AM");
+}
+
+static void emit_amd64_fisttp(ir_node const *const node)
+{
+	amd64_emitf(node, "fisttp%M %AM");
+}
+
+static void emit_amd64_fld(ir_node const *const node)
+{
+	amd64_emitf(node, "fld%FM %AM");
+}
+
+static void emit_amd64_fld1(ir_node const *const node)
+{
+	amd64_emitf(node, "fld1");
+}
+
+static void enc_amd64_fld1(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_fsimple(0xE8);
+}
+
+static void emit_amd64_fldz(ir_node const *const node)
+{
+	amd64_emitf(node, "fldz");
+}
+
+static void enc_amd64_fldz(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_fsimple(0xEE);
+}
+
+static void emit_amd64_fmul(ir_node const *const node)
+{
+	amd64_emitf(node, "fmul%FP %AF");
+}
+
+static void enc_amd64_fmul(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_fbinop(node, 1);
+}
+
+static void emit_amd64_fpop(ir_node const *const node)
+{
+	amd64_emitf(node, "fstp %F0");
+}
+
+static void enc_amd64_fpop(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_fop_reg(node, 0xDD, 0xD8);
+}
+
+static void emit_amd64_fst(ir_node const *const node)
+{
+	amd64_emitf(node, "fst%FP%FM %AM");
+}
+
+static void emit_amd64_fstp(ir_node const *const node)
+{
+	amd64_emitf(node, "fstp%FM %AM");
+}
+
+static void emit_amd64_fsub(ir_node const *const node)
+{
+	amd64_emitf(node, "fsub%FR%FP %AF");
+}
+
+static void enc_amd64_fsub(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_fbinop(node, 4);
+}
+
+static void emit_amd64_fucomi(ir_node const *const node)
+{
+	amd64_emitf(node, "fucom%FPi %F0");
+}
+
+static void emit_amd64_fxch(ir_node const *const node)
+{
+	amd64_emitf(node, "fxch %F0");
+}
+
+static void enc_amd64_fxch(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_fop_reg(node, 0xD9, 0xC8);
+}
+
+static void emit_amd64_haddpd(ir_node const *const node)
+{
+	amd64_emitf(node, "haddpd %AM");
+}
+
+static void enc_amd64_haddpd(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_binop(node, 0x66, 0x7C);
+}
+
+static void emit_amd64_idiv(ir_node const *const node)
+{
+	amd64_emitf(node, "idiv%M %AM");
+}
+
+static void enc_amd64_idiv(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_unop(node, 7);
+}
+
+static void emit_amd64_ijmp(ir_node const *const node)
+{
+	amd64_emitf(node, "jmp %*AM");
+}
+
+static void emit_amd64_imul(ir_node const *const node)
+{
+	amd64_emitf(node, "imul%M %AM");
+}
+
+static void emit_amd64_imul_1op(ir_node const *const node)
+{
+	amd64_emitf(node, "imul%M %AM");
+}
+
+static void enc_amd64_imul_1op(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_unop(node, 5);
+}
+
+static void emit_amd64_lea(ir_node const *const node)
+{
+	amd64_emitf(node, "lea%M %A, %D0");
+}
+
+static void emit_amd64_leave(ir_node const *const node)
+{
+	amd64_emitf(node, "leave");
+}
+
+static void enc_amd64_leave(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_simple(0xC9);
+}
+
+static void emit_amd64_mov_imm(ir_node const *const node)
+{
+	amd64_emitf(node, "mov%M $%C, %D0");
+}
+
+static void emit_amd64_mov_store(ir_node const *const node)
+{
+	amd64_emitf(node, "mov%M %AM");
+}
+
+static void emit_amd64_movd(ir_node const *const node)
+{
+	amd64_emitf(node, "movd %AM, %D0");
+}
+
+static void emit_amd64_movd_gp_xmm(ir_node const *const node)
+{
+	amd64_emitf(node, "movd %S0, %D0");
+}
+
+static void emit_amd64_movd_xmm_gp(ir_node const *const node)
+{
+	amd64_emitf(node, "movd %S0, %D0");
+}
+
+static void emit_amd64_movdqa(ir_node const *const node)
+{
+	amd64_emitf(node, "movdqa %AM, %D0");
+}
+
+static void emit_amd64_movdqu(ir_node const *const node)
+{
+	amd64_emitf(node, "movdqu %AM, %D0");
+}
+
+static void emit_amd64_movdqu_store(ir_node const *const node)
+{
+	amd64_emitf(node, "movdqu %^S0, %A");
+}
+
+static void emit_amd64_movs(ir_node const *const node)
+{
+	amd64_emitf(node, "movs%Mq %AM, %^D0");
+}
+
+static void emit_amd64_movs_store_xmm(ir_node const *const node)
+{
+	amd64_emitf(node, "movs%MX %^S0, %A");
+}
+
+static void emit_amd64_movs_xmm(ir_node const *const node)
+{
+	amd64_emitf(node, "movs%MX %AM, %D0");
+}
+
+static void emit_amd64_mul(ir_node const *const node)
+{
+	amd64_emitf(node, "mul%M %AM");
+}
+
+static void enc_amd64_mul(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_unop(node, 4);
+}
+
+static void emit_amd64_mulp(ir_node const *const node)
+{
+	amd64_emitf(node, "mulp%MX %AM");
+}
+
+static void enc_amd64_mulp(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_packed_binop(node, 0x59);
+}
+
+static void emit_amd64_muls(ir_node const *const node)
+{
+	amd64_emitf(node, "muls%MX %AM");
+}
+
+static void enc_amd64_muls(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_scalar_binop(node, 0x59);
+}
+
+static void emit_amd64_neg(ir_node const *const node)
+{
+	amd64_emitf(node, "neg%M %AM");
+}
+
+static void enc_amd64_neg(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_unop(node, 3);
+}
+
+static void emit_amd64_not(ir_node const *const node)
+{
+	amd64_emitf(node, "not%M %AM");
+}
+
+static void enc_amd64_not(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_unop(node, 2);
+}
+
+static void emit_amd64_or(ir_node const *const node)
+{
+	amd64_emitf(node, "or%M %AM");
+}
+
+static void enc_amd64_or(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_binop(node, 1);
+}
+
+static void emit_amd64_padd(ir_node const *const node)
+{
+	amd64_emitf(node, "padd%MP %AM");
+}
+
+static void enc_amd64_padd(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_element_binop(node, 0xFC, 0xD4);
+}
+
+static void emit_amd64_pand(ir_node const *const node)
+{
+	amd64_emitf(node, "pand %AM");
+}
+
+static void enc_amd64_pand(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_binop(node, 0x66, 0xDB);
+}
+
+static void emit_amd64_pmullw(ir_node const *const node)
+{
+	amd64_emitf(node, "pmullw %AM");
+}
+
+static void enc_amd64_pmullw(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_binop(node, 0x66, 0xD5);
+}
+
+static void emit_amd64_pop_am(ir_node const *const node)
+{
+	amd64_emitf(node, "pop%M %A");
+}
+
+static void emit_amd64_por(ir_node const *const node)
+{
+	amd64_emitf(node, "por %AM");
+}
+
+static void enc_amd64_por(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_binop(node, 0x66, 0xEB);
+}
+
+static void emit_amd64_psub(ir_node const *const node)
+{
+	amd64_emitf(node, "psub%MP %AM");
+}
+
+static void enc_amd64_psub(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_element_binop(node, 0xF8, 0xFB);
+}
+
+static void emit_amd64_punpcklbw(ir_node const *const node)
+{
+	amd64_emitf(node, "punpcklbw %AM");
+}
+
+static void enc_amd64_punpcklbw(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_binop(node, 0x66, 0x60);
+}
+
+static void emit_amd64_punpckldq(ir_node const *const node)
+{
+	amd64_emitf(node, "punpckldq %AM");
+}
+
+static void enc_amd64_punpckldq(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_binop(node, 0x66, 0x62);
+}
+
+static void emit_amd64_punpcklqdq(ir_node const *const node)
+{
+	amd64_emitf(node, "punpcklqdq %AM");
+}
+
+static void enc_amd64_punpcklqdq(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_binop(node, 0x66, 0x6C);
+}
+
+static void emit_amd64_punpcklwd(ir_node const *const node)
+{
+	amd64_emitf(node, "punpcklwd %AM");
+}
+
+static void enc_amd64_punpcklwd(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_binop(node, 0x66, 0x61);
+}
+
+static void emit_amd64_push_am(ir_node const *const node)
+{
+	amd64_emitf(node, "push%M %A");
+}
+
+static void emit_amd64_push_reg(ir_node const *const node)
+{
+	amd64_emitf(node, "push%M %^S2");
+}
+
+static void emit_amd64_pxor(ir_node const *const node)
+{
+	amd64_emitf(node, "pxor %AM");
+}
+
+static void enc_amd64_pxor(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_binop(node, 0x66, 0xEF);
+}
+
+static void emit_amd64_pxor_0(ir_node const *const node)
+{
+	amd64_emitf(node, "pxor %^D0, %^D0");
+}
+
+static void emit_amd64_ret(ir_node const *const node)
+{
+	amd64_emitf(node, "ret");
+}
+
+static void enc_amd64_ret(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_simple(0xC3);
+}
+
+static void emit_amd64_sar(ir_node const *const node)
+{
+	amd64_emitf(node, "sar%M %SO");
+}
+
+static void enc_amd64_sar(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_shiftop(node, 7);
+}
+
+static void emit_amd64_sbb(ir_node const *const node)
+{
+	amd64_emitf(node, "sbb%M %AM");
+}
+
+static void enc_amd64_sbb(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_binop(node, 3);
+}
+
+static void emit_amd64_setcc(ir_node const *const node)
+{
+	amd64_emitf(node, "set%P0 %D0");
+}
+
+static void emit_amd64_shl(ir_node const *const node)
+{
+	amd64_emitf(node, "shl%M %SO");
+}
+
+static void enc_amd64_shl(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_shiftop(node, 4);
+}
+
+static void emit_amd64_shr(ir_node const *const node)
+{
+	amd64_emitf(node, "shr%M %SO");
+}
+
+static void enc_amd64_shr(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_shiftop(node, 5);
+}
+
+static void emit_amd64_sub(ir_node const *const node)
+{
+	amd64_emitf(node, "sub%M %AM");
+}
+
+static void enc_amd64_sub(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_binop(node, 5);
+}
+
+static void emit_amd64_sub_sp(ir_node const *const node)
+{
+	amd64_emitf(node, "subq %AM\nmovq %%rsp, %D1");
+}
+
+static void emit_amd64_subp(ir_node const *const node)
+{
+	amd64_emitf(node, "subp%MX %AM");
+}
+
+static void enc_amd64_subp(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_packed_binop(node, 0x5C);
+}
+
+static void emit_amd64_subpd(ir_node const *const node)
+{
+	amd64_emitf(node, "subpd %AM");
+}
+
+static void enc_amd64_subpd(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_binop(node, 0x66, 0x5C);
+}
+
+static void emit_amd64_subs(ir_node const *const node)
+{
+	amd64_emitf(node, "subs%MX %AM");
+}
+
+static void enc_amd64_subs(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_scalar_binop(node, 0x5C);
+}
+
+static void emit_amd64_test(ir_node const *const node)
+{
+	amd64_emitf(node, "test%M %AM");
+}
+
+static void emit_amd64_ucomis(ir_node const *const node)
+{
+	amd64_emitf(node, "ucomis%MX %AM");
+}
+
+static void enc_amd64_ucomis(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_packed_binop(node, 0x2E);
+}
+
+static void emit_amd64_xor(ir_node const *const node)
+{
+	amd64_emitf(node, "xor%M %AM");
+}
+
+static void enc_amd64_xor(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_binop(node, 6);
+}
+
+static void emit_amd64_xor_0(ir_node const *const node)
+{
+	amd64_emitf(node, "xor%M %3D0, %3D0");
+}
+
+static void emit_amd64_xorp(ir_node const *const node)
+{
+	amd64_emitf(node, "xorp%MX %AM");
+}
+
+static void enc_amd64_xorp(ir_node const *const node)
+{
+	(void)node; /* avoid potential warning */
+	amd64_enc_xmm_packed_binop(node, 0x57);
+}
+
+static void emit_amd64_xorp_0(ir_node const *const node)
+{
+	amd64_emitf(node, "xorp%MX %^D0, %^D0");
+}
+
+
+
+void amd64_register_spec_emitters(void)
+{
+	be_set_emitter(op_amd64_add, emit_amd64_add);
+	be_set_emitter(op_amd64_addp, emit_amd64_addp);
+	be_set_emitter(op_amd64_adds, emit_amd64_adds);
+	be_set_emitter(op_amd64_and, emit_amd64_and);
+	be_set_emitter(op_amd64_bsf, emit_amd64_bsf);
+	be_set_emitter(op_amd64_bsr, emit_amd64_bsr);
+	be_set_emitter(op_amd64_call, emit_amd64_call);
+	be_set_emitter(op_amd64_cltd, emit_amd64_cltd);
+	be_set_emitter(op_amd64_cmp, emit_amd64_cmp);
+	be_set_emitter(op_amd64_cmpxchg, emit_amd64_cmpxchg);
+	be_set_emitter(op_amd64_cqto, emit_amd64_cqto);
+	be_set_emitter(op_amd64_cvtsd2ss, emit_amd64_cvtsd2ss);
+	be_set_emitter(op_amd64_cvtsi2sd, emit_amd64_cvtsi2sd);
+	be_set_emitter(op_amd64_cvtsi2ss, emit_amd64_cvtsi2ss);
+	be_set_emitter(op_amd64_cvtss2sd, emit_amd64_cvtss2sd);
+	be_set_emitter(op_amd64_cvttsd2si, emit_amd64_cvttsd2si);
+	be_set_emitter(op_amd64_cvttss2si, emit_amd64_cvttss2si);
+	be_set_emitter(op_amd64_div, emit_amd64_div);
+	be_set_emitter(op_amd64_divp, emit_amd64_divp);
+	be_set_emitter(op_amd64_divs, emit_amd64_divs);
+	be_set_emitter(op_amd64_fadd, emit_amd64_fadd);
+	be_set_emitter(op_amd64_fchs, emit_amd64_fchs);
+	be_set_emitter(op_amd64_fdiv, emit_amd64_fdiv);
+	be_set_emitter(op_amd64_fdup, emit_amd64_fdup);
+	be_set_emitter(op_amd64_fild, emit_amd64_fild);
+	be_set_emitter(op_amd64_fisttp, emit_amd64_fisttp);
+	be_set_emitter(op_amd64_fld, emit_amd64_fld);
+	be_set_emitter(op_amd64_fld1, emit_amd64_fld1);
+	be_set_emitter(op_amd64_fldz, emit_amd64_fldz);
+	be_set_emitter(op_amd64_fmul, emit_amd64_fmul);
+	be_set_emitter(op_amd64_fpop, emit_amd64_fpop);
+	be_set_emitter(op_amd64_fst, emit_amd64_fst);
+	be_set_emitter(op_amd64_fstp, emit_amd64_fstp);
+	be_set_emitter(op_amd64_fsub, emit_amd64_fsub);
+	be_set_emitter(op_amd64_fucomi, emit_amd64_fucomi);
+	be_set_emitter(op_amd64_fxch, emit_amd64_fxch);
+	be_set_emitter(op_amd64_haddpd, emit_amd64_haddpd);
+	be_set_emitter(op_amd64_idiv, emit_amd64_idiv);
+	be_set_emitter(op_amd64_ijmp, emit_amd64_ijmp);
+	be_set_emitter(op_amd64_imul, emit_amd64_imul);
+	be_set_emitter(op_amd64_imul_1op, emit_amd64_imul_1op);
+	be_set_emitter(op_amd64_lea, emit_amd64_lea);
+	be_set_emitter(op_amd64_leave, emit_amd64_leave);
+	be_set_emitter(op_amd64_mov_imm, emit_amd64_mov_imm);
+	be_set_emitter(op_amd64_mov_store, emit_amd64_mov_store);
+	be_set_emitter(op_amd64_movd, emit_amd64_movd);
+	be_set_emitter(op_amd64_movd_gp_xmm, emit_amd64_movd_gp_xmm);
+	be_set_emitter(op_amd64_movd_xmm_gp, emit_amd64_movd_xmm_gp);
+	be_set_emitter(op_amd64_movdqa, emit_amd64_movdqa);
+	be_set_emitter(op_amd64_movdqu, emit_amd64_movdqu);
+	be_set_emitter(op_amd64_movdqu_store, emit_amd64_movdqu_store);
+	be_set_emitter(op_amd64_movs, emit_amd64_movs);
+	be_set_emitter(op_amd64_movs_store_xmm, emit_amd64_movs_store_xmm);
+	be_set_emitter(op_amd64_movs_xmm, emit_amd64_movs_xmm);
+	be_set_emitter(op_amd64_mul, emit_amd64_mul);
+	be_set_emitter(op_amd64_mulp, emit_amd64_mulp);
+	be_set_emitter(op_amd64_muls, emit_amd64_muls);
+	be_set_emitter(op_amd64_neg, emit_amd64_neg);
+	be_set_emitter(op_amd64_not, emit_amd64_not);
+	be_set_emitter(op_amd64_or, emit_amd64_or);
+	be_set_emitter(op_amd64_padd, emit_amd64_padd);
+	be_set_emitter(op_amd64_pand, emit_amd64_pand);
+	be_set_emitter(op_amd64_pmullw, emit_amd64_pmullw);
+	be_set_emitter(op_amd64_pop_am, emit_amd64_pop_am);
+	be_set_emitter(op_amd64_por, emit_amd64_por);
+	be_set_emitter(op_amd64_psub, emit_amd64_psub);
+	be_set_emitter(op_amd64_punpcklbw, emit_amd64_punpcklbw);
+	be_set_emitter(op_amd64_punpckldq, emit_amd64_punpckldq);
+	be_set_emitter(op_amd64_punpcklqdq, emit_amd64_punpcklqdq);
+	be_set_emitter(op_amd64_punpcklwd, emit_amd64_punpcklwd);
+	be_set_emitter(op_amd64_push_am, emit_amd64_push_am);
+	be_set_emitter(op_amd64_push_reg, emit_amd64_push_reg);
+	be_set_emitter(op_amd64_pxor, emit_amd64_pxor);
+	be_set_emitter(op_amd64_pxor_0, emit_amd64_pxor_0);
+	be_set_emitter(op_amd64_ret, emit_amd64_ret);
+	be_set_emitter(op_amd64_sar, emit_amd64_sar);
+	be_set_emitter(op_amd64_sbb, emit_amd64_sbb);
+	be_set_emitter(op_amd64_setcc, emit_amd64_setcc);
+	be_set_emitter(op_amd64_shl, emit_amd64_shl);
+	be_set_emitter(op_amd64_shr, emit_amd64_shr);
+	be_set_emitter(op_amd64_sub, emit_amd64_sub);
+	be_set_emitter(op_amd64_sub_sp, emit_amd64_sub_sp);
+	be_set_emitter(op_amd64_subp, emit_amd64_subp);
+	be_set_emitter(op_amd64_subpd, emit_amd64_subpd);
+	be_set_emitter(op_amd64_subs, emit_amd64_subs);
+	be_set_emitter(op_amd64_test, emit_amd64_test);
+	be_set_emitter(op_amd64_ucomis, emit_amd64_ucomis);
+	be_set_emitter(op_amd64_xor, emit_amd64_xor);
+	be_set_emitter(op_amd64_xor_0, emit_amd64_xor_0);
+	be_set_emitter(op_amd64_xorp, emit_amd64_xorp);
+	be_set_emitter(op_amd64_xorp_0, emit_amd64_xorp_0);
+
+}
+
+void amd64_register_spec_binary_emitters(void)
+{
+	be_set_emitter(op_amd64_add, enc_amd64_add);
+	be_set_emitter(op_amd64_addp, enc_amd64_addp);
+	be_set_emitter(op_amd64_adds, enc_amd64_adds);
+	be_set_emitter(op_amd64_and, enc_amd64_and);
+	be_set_emitter(op_amd64_bsf, enc_amd64_bsf);
+	be_set_emitter(op_amd64_bsr, enc_amd64_bsr);
+	be_set_emitter(op_amd64_cltd, enc_amd64_cltd);
+	be_set_emitter(op_amd64_cmp, enc_amd64_cmp);
+	be_set_emitter(op_amd64_div, enc_amd64_div);
+	be_set_emitter(op_amd64_divp, enc_amd64_divp);
+	be_set_emitter(op_amd64_divs, enc_amd64_divs);
+	be_set_emitter(op_amd64_fadd, enc_amd64_fadd);
+	be_set_emitter(op_amd64_fchs, enc_amd64_fchs);
+	be_set_emitter(op_amd64_fdiv, enc_amd64_fdiv);
+	be_set_emitter(op_amd64_fdup, enc_amd64_fdup);
+	be_set_emitter(op_amd64_fld1, enc_amd64_fld1);
+	be_set_emitter(op_amd64_fldz, enc_amd64_fldz);
+	be_set_emitter(op_amd64_fmul, enc_amd64_fmul);
+	be_set_emitter(op_amd64_fpop, enc_amd64_fpop);
+	be_set_emitter(op_amd64_fsub, enc_amd64_fsub);
+	be_set_emitter(op_amd64_fxch, enc_amd64_fxch);
+	be_set_emitter(op_amd64_haddpd, enc_amd64_haddpd);
+	be_set_emitter(op_amd64_idiv, enc_amd64_idiv);
+	be_set_emitter(op_amd64_imul_1op, enc_amd64_imul_1op);
+	be_set_emitter(op_amd64_leave, enc_amd64_leave);
+	be_set_emitter(op_amd64_mul, enc_amd64_mul);
+	be_set_emitter(op_amd64_mulp, enc_amd64_mulp);
+	be_set_emitter(op_amd64_muls, enc_amd64_muls);
+	be_set_emitter(op_amd64_neg, enc_amd64_neg);
+	be_set_emitter(op_amd64_not, enc_amd64_not);
+	be_set_emitter(op_amd64_or, enc_amd64_or);
+	be_set_emitter(op_amd64_padd, enc_amd64_padd);
+	be_set_emitter(op_amd64_pand, enc_amd64_pand);
+	be_set_emitter(op_amd64_pmullw, enc_amd64_pmullw);
+	be_set_emitter(op_amd64_por, enc_amd64_por);
+	be_set_emitter(op_amd64_psub, enc_amd64_psub);
+	be_set_emitter(op_amd64_punpcklbw, enc_amd64_punpcklbw);
+	be_set_emitter(op_amd64_punpckldq, enc_amd64_punpckldq);
+	be_set_emitter(op_amd64_punpcklqdq, enc_amd64_punpcklqdq);
+	be_set_emitter(op_amd64_punpcklwd, enc_amd64_punpcklwd);
+	be_set_emitter(op_amd64_pxor, enc_amd64_pxor);
+	be_set_emitter(op_amd64_ret, enc_amd64_ret);
+	be_set_emitter(op_amd64_sar, enc_amd64_sar);
+	be_set_emitter(op_amd64_sbb, enc_amd64_sbb);
+	be_set_emitter(op_amd64_shl, enc_amd64_shl);
+	be_set_emitter(op_amd64_shr, enc_amd64_shr);
+	be_set_emitter(op_amd64_sub, enc_amd64_sub);
+	be_set_emitter(op_amd64_subp, enc_amd64_subp);
+	be_set_emitter(op_amd64_subpd, enc_amd64_subpd);
+	be_set_emitter(op_amd64_subs, enc_amd64_subs);
+	be_set_emitter(op_amd64_ucomis, enc_amd64_ucomis);
+	be_set_emitter(op_amd64_xor, enc_amd64_xor);
+	be_set_emitter(op_amd64_xorp, enc_amd64_xorp);
+
+}
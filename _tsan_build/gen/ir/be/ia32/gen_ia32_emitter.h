@@ -0,0 +1,15 @@
+/**
+ * @file
+ * @brief Function prototypes for the emitter functions.
+ * @note  DO NOT EDIT THIS FILE, your changes will be lost.
+ *         Edit /root/repo/ir/be/ia32/ia32_spec.pl instead.
+ *         created by: /root/repo/ir/be/scripts/generate_emitter.pl /root/repo/ir/be/ia32/ia32_spec.pl /root/repo/_tsan_build/gen/ir/be/ia32
+ * @date  Sat Oct 17 10:40:02 2026
+ */
+#ifndef FIRM_BE_IA32_GEN_IA32_EMITTER_H
+#define FIRM_BE_IA32_GEN_IA32_EMITTER_H
+
+void ia32_register_spec_emitters(void);
+void ia32_register_spec_binary_emitters(void);
+
+#endif
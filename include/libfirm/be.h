@@ -103,6 +103,13 @@ FIRM_API void be_set_after_transform_func(after_transform_func func);
  */
 FIRM_API void be_main(FILE *output, const char *compilation_unit_name);
 
+/**
+ * Like be_main() but writes an ELF relocatable object file instead of
+ * assembly. @p output must have been opened in binary mode.
+ * @returns 0 on success, non-zero if the target cannot produce object files
+ */
+FIRM_API int be_main_object(FILE *output, const char *compilation_unit_name);
+
 /**
  * parse assembler constraint strings and returns flags (so the frontend knows
  * which operands are inputs/outputs and whether memory is required)
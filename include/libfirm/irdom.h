@@ -13,6 +13,7 @@
 #ifndef FIRM_ANA_IRDOM_H
 #define FIRM_ANA_IRDOM_H
 
+#include <stddef.h>
 #include "firm_types.h"
 
 #include "begin.h"
@@ -192,6 +193,67 @@ FIRM_API void compute_doms(ir_graph *irg);
  */
 FIRM_API void compute_postdoms(ir_graph *irg);
 
+/**
+ * Updates the dominance information after a control flow edge from block
+ * @p from to block @p to was added to the graph.
+ *
+ * Only the part of the dominator tree below the nearest common dominator of
+ * @p from and @p to is recomputed. Blocks which become reachable by the new
+ * edge are added to the tree. Each change of the control flow has to be
+ * announced right after it was made, so that the dominance information
+ * matches the graph except for this change. Does nothing if the dominance
+ * information of the graph is not consistent.
+ * Post dominance information is not updated.
+ */
+FIRM_API void dom_insert_edge(ir_node *from, ir_node *to);
+
+/**
+ * Updates the dominance information after the control flow edge from block
+ * @p from to block @p to was removed from the graph.
+ *
+ * Only the part of the dominator tree below the immediate dominator of @p to
+ * is recomputed, blocks which become unreachable get a dominator depth of -1.
+ * The same rules as for dom_insert_edge() apply.
+ */
+FIRM_API void dom_delete_edge(ir_node *from, ir_node *to);
+
+/**
+ * Updates the dominance information after the new block @p block was placed
+ * in front of the block @p succ: All predecessors of @p block were
+ * predecessors of @p succ before and @p block jumps to @p succ only.
+ *
+ * This is the case when a critical edge is split or when the upper half of a
+ * block is split off. Unlike dom_insert_edge() this does not recompute any
+ * part of the dominator tree. The same rules as for dom_insert_edge() apply.
+ */
+FIRM_API void dom_insert_block(ir_node *block, ir_node *succ);
+
+/**
+ * Updates the dominance information before the block @p block is merged
+ * into the block @p into with exchange(). The blocks must be joined by a
+ * control flow edge which is either the only one into the lower block or the
+ * only one out of the upper block.
+ *
+ * The blocks dominated by @p block are dominated by @p into afterwards,
+ * nothing is recomputed. Unlike the other updates this one has to be
+ * announced before the change, as @p block is gone afterwards.
+ */
+FIRM_API void dom_merge_block(ir_node *block, ir_node *into);
+
+/**
+ * Recomputes the dominance information of the blocks dominated by @p block
+ * after the control flow between them changed in more than a few edges, for
+ * example when a loop was duplicated.
+ *
+ * The immediate dominator of @p block must be the same as before. Edges
+ * may only have been changed from blocks dominated by @p block or from the
+ * @p n_new_blocks blocks @p new_blocks, which were created since the
+ * dominance information was computed. Otherwise the same rules as for
+ * dom_insert_edge() apply.
+ */
+FIRM_API void dom_update_subtree(ir_node *block, ir_node *const *new_blocks,
+                                 size_t n_new_blocks);
+
 /**
  * Compute the dominance frontiers for a given graph.
  * The information is freed automatically when dominance info is freed.
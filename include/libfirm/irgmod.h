@@ -69,7 +69,8 @@ FIRM_API void collect_new_phi_node(ir_node *node);
  * that all Proj nodes are accessible by the link field of the nodes
  * producing the Tuple. This can be established by
  * collect_phiprojs_and_start_block_nodes(). part_block() conserves
- * this property.
+ * this property. Consistent dominance information is updated with
+ * dom_insert_block().
  *
  * @param node   The node were to break the block
  */
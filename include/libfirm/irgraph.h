@@ -77,7 +77,7 @@
  * - n_loc           An int giving the number of local variables in this
  *                   procedure.  This is needed for ir construction.
  *
- * - value_table     This hash table (pset) is used for global value numbering
+ * - value_table     This hash table is used for global value numbering
  *                   for optimizing use in iropt.c.
  *
  * - visited         A int used as flag to traverse the ir_graph.
@@ -462,6 +462,19 @@ FIRM_API void *get_irg_loc_description(ir_graph *irg, int n);
 /** Returns the last irn index for this graph. */
 FIRM_API unsigned get_irg_last_idx(const ir_graph *irg);
 
+/**
+ * Returns the number of bytes held by the obstacks of a graph: its nodes,
+ * including dead ones, its out arrays and its out edges.
+ */
+FIRM_API size_t get_irg_memory_used(ir_graph *irg);
+
+/**
+ * Returns the number of bytes the calling thread allocated for nodes so far.
+ * The difference of two calls is the node memory allocated by a phase in
+ * between, which is kept until the graph is freed or compacted.
+ */
+FIRM_API size_t ir_get_node_memory_allocated(void);
+
 /** @} */
 
 #include "end.h"
@@ -51,6 +51,27 @@ FIRM_API void irg_walk(ir_node *node, irg_walk_func *pre, irg_walk_func *post,
 FIRM_API void irg_walk_core(ir_node *node, irg_walk_func *pre,
                             irg_walk_func *post, void *env);
 
+/**
+ * Traversal modes of the node walkers.
+ */
+typedef enum irg_walk_mode_t {
+	irg_walk_mode_default,  /**< Plain depth first traversal. */
+	irg_walk_mode_prefetch, /**< Prefetch the predecessors of a node when
+	                             entering it. Helps on large graphs whose
+	                             nodes do not fit into the cache. */
+} irg_walk_mode_t;
+
+/**
+ * Selects the traversal mode of irg_walk() and the walkers built on it.
+ * The visit order is the same in all modes.
+ */
+FIRM_API void set_irg_walk_mode(irg_walk_mode_t mode);
+
+/**
+ * Returns the traversal mode of the node walkers.
+ */
+FIRM_API irg_walk_mode_t get_irg_walk_mode(void);
+
 /**
  * Walks over all reachable nodes in the ir graph.
  *
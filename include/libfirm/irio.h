@@ -52,6 +52,41 @@ FIRM_API int ir_import(const char *filename);
  */
 FIRM_API int ir_import_file(FILE *input, const char *inputname);
 
+/**
+ * Exports the whole irp to the given file in a compact binary form.
+ * The file contains the same data as the one written by ir_export(), each
+ * ir graph is stored in a section of its own which is found through an
+ * index at the end of the file.
+ *
+ * @param filename  the name of the resulting file
+ * @return  0 if no errors occured, other values in case of errors
+ */
+FIRM_API int ir_export_binary(const char *filename);
+
+/**
+ * Imports a file written by ir_export_binary().
+ * The file is mapped into memory instead of being read.
+ *
+ * @param filename  the name of the file
+ * @returns 0 if no errors occured, other values in case of errors
+ */
+FIRM_API int ir_import_binary(const char *filename);
+
+/**
+ * Imports a file written by ir_export_binary() without reading its ir
+ * graphs. Each method gets a stub graph, which is read from the file when
+ * it is first returned by get_irp_irg() or get_entity_irg(). Graphs
+ * discarded before, for example by garbage_collect_entities(), are never
+ * read. The file stays mapped while stub graphs refer to it.
+ * If the program was lowered for the target before it was exported, the
+ * backend reads each graph when it generates its code and turns it back
+ * into a stub afterwards.
+ *
+ * @param filename  the name of the file
+ * @returns 0 if no errors occured, other values in case of errors
+ */
+FIRM_API int ir_import_binary_lazy(const char *filename);
+
 /** @} */
 
 #include "end.h"
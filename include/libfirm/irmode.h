@@ -99,6 +99,15 @@ FIRM_API ir_mode *new_float_mode(const char *name,
  */
 FIRM_API ir_mode *new_non_arithmetic_mode(const char *name, unsigned bit_size);
 
+/**
+ * Creates a new vector mode for values made of @p n_elements elements of mode
+ * @p element_mode, which has to be an integer or floating point mode.
+ * Arithmetic will be set to irma_none, operations on vector modes work on each
+ * element separately.
+ */
+FIRM_API ir_mode *new_vector_mode(const char *name, ir_mode *element_mode,
+                                  unsigned n_elements);
+
 /** Returns the ident* of the mode */
 FIRM_API ident *get_mode_ident(const ir_mode *mode);
 
@@ -276,6 +285,15 @@ FIRM_API int mode_is_num(const ir_mode *mode);
  */
 FIRM_API int mode_is_data(const ir_mode *mode);
 
+/** Returns 1 if @p mode is a vector mode, 0 otherwise */
+FIRM_API int mode_is_vector(const ir_mode *mode);
+
+/** Returns the mode of the elements of the vector mode @p mode. */
+FIRM_API ir_mode *get_vector_element_mode(const ir_mode *mode);
+
+/** Returns the number of elements of the vector mode @p mode. */
+FIRM_API unsigned get_vector_n_elements(const ir_mode *mode);
+
 /**
  * Returns true if a value of mode @p sm can be converted to mode @p lm without
  * loss.
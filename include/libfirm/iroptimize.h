@@ -444,6 +444,25 @@ FIRM_API void do_loop_unrolling(ir_graph *irg);
  */
 FIRM_API void unroll_loops(ir_graph *irg, unsigned factor, unsigned maxsize);
 
+/**
+ * Vectorizes counted loops, which access consecutive array elements, with the
+ * vector operations of the target. The remaining iterations run in the
+ * original loop. Does nothing if the target has no vector operations.
+ *
+ * @param irg       the IR-graph to optimize
+ */
+FIRM_API void vectorize_loops(ir_graph *irg);
+
+/**
+ * Packs isomorphic operations of a block, which compute the values of Stores
+ * to consecutive addresses, into vector operations of the target. Best run
+ * after optimize_load_store() and combine_memops(). Does nothing if the
+ * target has no vector operations.
+ *
+ * @param irg       the IR-graph to optimize
+ */
+FIRM_API void slp_vectorize(ir_graph *irg);
+
 /**
  * Perform loop peeling on a given graph.
  */
@@ -480,6 +499,20 @@ FIRM_API void garbage_collect_entities(void);
  */
 FIRM_API void dead_node_elimination(ir_graph *irg);
 
+/**
+ * Compacts a graph by copying its reachable nodes to a new obstack like
+ * dead_node_elimination() does, but in an order that suits the cache: the
+ * blocks in reverse postorder, each followed by its nodes in the order the
+ * graph walker reaches them. Node indices get assigned in the same order.
+ *
+ * Use it as graph pass at points of a pipeline which leave many dead nodes
+ * behind; get_irg_memory_used() tells how much memory the graph holds.
+ * The graph must not be under construction or scheduled by the backend.
+ *
+ * @param irg  The graph to compact.
+ */
+FIRM_API void compact_graph(ir_graph *irg);
+
 /**
  * Code Placement.
  *
@@ -527,6 +560,49 @@ FIRM_API ir_tarval *computed_value_Cmp_Confirm(ir_node *left, ir_node *right,
  */
 FIRM_API ir_entity *create_compilerlib_entity(char const *name, ir_type *mt);
 
+/**
+ * A sequence of optimization passes run over all graphs of the program.
+ *
+ * Graph passes run concurrently on different graphs if more than one thread
+ * is requested. They must not create modes, types or entities and must not
+ * reserve program wide resources. Program passes run alone, all graph passes
+ * added before them have finished on every graph when they start.
+ */
+typedef struct ir_pipeline_t ir_pipeline_t;
+
+/** Creates an empty pass pipeline. */
+FIRM_API ir_pipeline_t *new_ir_pipeline(void);
+
+/** Frees a pass pipeline. */
+FIRM_API void free_ir_pipeline(ir_pipeline_t *pipeline);
+
+/** Appends a pass run on each graph in any order. */
+FIRM_API void ir_pipeline_add_graph_pass(ir_pipeline_t *pipeline, opt_ptr pass);
+
+/**
+ * Appends a pass run on each graph after it ran on all graphs directly
+ * called by that graph. Graphs calling each other recursively are processed
+ * together by one thread.
+ */
+FIRM_API void ir_pipeline_add_callgraph_pass(ir_pipeline_t *pipeline,
+                                             opt_ptr pass);
+
+/**
+ * Appends a pass run once on the whole program, for example
+ * inline_functions() or optimize_funccalls().
+ */
+FIRM_API void ir_pipeline_add_prog_pass(ir_pipeline_t *pipeline,
+                                        void (*pass)(void));
+
+/**
+ * Runs all passes of @p pipeline in order.
+ *
+ * Consecutive graph passes are distributed over @p n_threads threads
+ * including the calling one. The passes run in one thread if hooks are
+ * registered, as hook callbacks are not expected to be thread-safe.
+ */
+FIRM_API void ir_pipeline_run(ir_pipeline_t *pipeline, unsigned n_threads);
+
 /** @} */
 
 #include "end.h"
@@ -72,6 +72,15 @@ FIRM_API unsigned be_get_function_size(ir_jit_function_t const *function);
  */
 FIRM_API void be_emit_function(char *buffer, ir_jit_function_t *function);
 
+/**
+ * Emit \p function into freshly allocated executable memory and resolve
+ * symbols and relocations. The memory is released when \p segment is
+ * destroyed.
+ * @return address of the first instruction, or NULL on failure
+ */
+FIRM_API void *be_jit_load_function(ir_jit_segment_t *segment,
+                                    ir_jit_function_t *function);
+
 /** @} */
 
 #include "end.h"
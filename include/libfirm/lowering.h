@@ -78,11 +78,13 @@ FIRM_API void lower_CopyB(ir_graph *irg, unsigned max_small_size,
                           unsigned min_large_size, int allow_misalignments);
 
 /**
- * Lowers all Switches (Cond nodes with non-boolean mode) depending on spare_size.
- * They will either remain the same or be converted into if-cascades.
+ * Lowers all Switches. The cases are partitioned into dense ranges, which
+ * remain table switches, cases within a machine word tested with bit masks
+ * and single cases. A binary search tree weighted by the execution
+ * frequencies of the targets dispatches to these clusters.
  *
  * @param irg        The ir graph to be lowered.
- * @param small_switch  If switch has <= cases then change it to an if-cascade.
+ * @param small_switch  Table switches need more than this many cases.
  * @param spare_size Allowed spare size for table switches in machine words.
  *                   (Default in edgfe: 128)
  * @param selector_mode mode which must be used for Switch selector
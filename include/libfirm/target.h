@@ -97,6 +97,12 @@ FIRM_API ir_mode *ir_target_float_arithmetic_mode(void);
  */
 FIRM_API float_int_conversion_overflow_style_t ir_target_float_int_overflow_style(void);
 
+/**
+ * Returns the size of the vector registers of the target in bytes or 0 if the
+ * target does not support vector modes.
+ */
+FIRM_API unsigned ir_target_vector_size(void);
+
 /**
  * @}
  */
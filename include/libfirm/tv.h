@@ -312,6 +312,21 @@ FIRM_API void tarval_set_wrap_on_overflow(int wrap_on_overflow);
  */
 FIRM_API int tarval_get_wrap_on_overflow(void);
 
+/** Statistics about the hash table used to unify tarvals. */
+typedef struct tarval_statistics_t {
+	unsigned long long lookups;    /**< number of tarval lookups */
+	unsigned long long hits;       /**< lookups that found an existing tarval */
+	unsigned long long probes;     /**< additional buckets probed by lookups */
+	unsigned           max_probes; /**< longest probe sequence of a lookup */
+	size_t             n_tarvals;  /**< number of distinct tarvals */
+} tarval_statistics_t;
+
+/**
+ * Fills @p stats with statistics about the tarval hash table since the
+ * tarval module was initialized.
+ */
+FIRM_API void tarval_get_statistics(tarval_statistics_t *stats);
+
 /**
  * Compares two tarvals
  *
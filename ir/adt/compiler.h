@@ -45,12 +45,24 @@
  */
 #define ENUMBF(type)  __extension__ type
 
+/**
+ * Storage class for variables holding the state of a running phase. Such
+ * state is kept per thread, so independent graphs may be processed
+ * concurrently.
+ */
+#define THREAD_LOCAL __thread
+
 #else
 #define LIKELY(x)   x
 #define UNLIKELY(x) x
 #define PURE
 #define UNUSED
 #define ENUMBF(type)  unsigned
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#define THREAD_LOCAL _Thread_local
+#else
+#define THREAD_LOCAL
+#endif
 #endif
 
 /**
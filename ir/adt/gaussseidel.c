@@ -118,7 +118,7 @@ void gs_matrix_set(gs_matrix_t *m, unsigned row, unsigned col, double val)
 
 	/* We haven't found the entry, so we must create a new one.
 	 * Is there enough space? */
-	if (the_row->n_cols <= the_row->c_cols)
+	if (the_row->n_cols >= the_row->c_cols)
 		alloc_cols(the_row, the_row->c_cols + 16);
 
 	/* Shift right-most entries to the right by one */
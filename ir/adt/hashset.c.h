@@ -46,6 +46,9 @@
  *  <li><b>SetRangeEmpty(ptr,count)</b> Efficiently sets a range of elements to
  *                                      the Null value</li>
  *  <li><b>ADDITIONAL_DATA<b>   Additional fields appended to the hashset struct</li>
+ *  <li><b>CountProbes(self,num_probes,found)</b> Called at the end of each
+ *                              insert/find with the number of additional
+ *                              buckets probed (for statistics)</li>
  * </ul>
  */
 #ifdef HashSet
@@ -139,6 +142,10 @@
 }
 #endif /* SetRangeEmpty */
 
+#ifndef CountProbes
+#define CountProbes(self,num_probes,found) ((void)0)
+#endif /* CountProbes */
+
 #ifndef HT_OCCUPANCY_FLT
 /** how full before we double size */
 #define HT_OCCUPANCY_FLT(x) ((x)/2)
@@ -209,6 +216,7 @@ static inline FindReturnValue insert_nogrow(HashSet *self, KeyType key)
 			InitData(self, EntryGetValue(*nentry), key);
 			EntrySetHash(*nentry, hash);
 			self->num_elements++;
+			CountProbes(self, num_probes, false);
 			return GetFindReturnValue(*nentry, false);
 		}
 		if (EntryIsDeleted(*entry)) {
@@ -217,6 +225,7 @@ static inline FindReturnValue insert_nogrow(HashSet *self, KeyType key)
 		} else if (EntryGetHash(self, *entry) == hash) {
 			if (KeysEqual(self, GetKey(EntryGetValue(*entry)), key)) {
 				// Value already in the set, return it
+				CountProbes(self, num_probes, true);
 				return GetFindReturnValue(*entry, true);
 			}
 		}
@@ -419,6 +428,7 @@ FindReturnValue hashset_find(const HashSet *self, ConstKeyType key)
 		HashSetEntry *entry = & self->entries[bucknum];
 
 		if (EntryIsEmpty(*entry)) {
+			CountProbes(self, num_probes, false);
 			return NullReturnValue;
 		}
 		if (EntryIsDeleted(*entry)) {
@@ -426,6 +436,7 @@ FindReturnValue hashset_find(const HashSet *self, ConstKeyType key)
 		} else if (EntryGetHash(self, *entry) == hash) {
 			if (KeysEqual(self, GetKey(EntryGetValue(*entry)), key)) {
 				// found the value
+				CountProbes(self, num_probes, true);
 				return GetFindReturnValue(*entry, true);
 			}
 		}
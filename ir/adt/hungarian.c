@@ -40,8 +40,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-DEBUG_ONLY(static firm_dbg_module_t *dbg;)
-
 struct hungarian_problem_t {
 	unsigned      num_rows;      /**< number of rows */
 	unsigned      num_cols;      /**< number of columns */
@@ -52,6 +50,7 @@ struct hungarian_problem_t {
 	                                  the right side */
 	unsigned     *missing_right; /**< bitset: right side nodes having no edge to
 	                              the left side */
+	DEBUG_ONLY(firm_dbg_module_t *dbg;)
 };
 
 static void hungarian_dump_f(FILE *const f, const unsigned *const cost,
@@ -81,7 +80,7 @@ hungarian_problem_t *hungarian_new(unsigned const num_rows,
 {
 	hungarian_problem_t *p = XMALLOCZ(hungarian_problem_t);
 
-	FIRM_DBG_REGISTER(dbg, "firm.hungarian");
+	FIRM_DBG_REGISTER(p->dbg, "firm.hungarian");
 
 	/* Is the number of cols  not equal to number of rows ?
 	 * If yes, expand with 0 - cols / 0 - cols */
@@ -179,7 +178,7 @@ int hungarian_solve(hungarian_problem_t *const p, unsigned *const assignment,
 	memset(assignment, -1, num_rows * sizeof(assignment[0]));
 
 	/* Begin subtract column minima in order to start with lots of zeros 12 */
-	DBG((dbg, LEVEL_1, "Using heuristic\n"));
+	DBG((p->dbg, LEVEL_1, "Using heuristic\n"));
 
 	for (unsigned c = 0; c < num_cols; ++c) {
 		unsigned col_mininum = cost[0*num_cols + c];
@@ -222,12 +221,12 @@ int hungarian_solve(hungarian_problem_t *const p, unsigned *const assignment,
 
 			col_mate[r] = c;
 			row_mate[c] = r;
-			DBG((dbg, LEVEL_1, "matching col %u == row %u\n", c, r));
+			DBG((p->dbg, LEVEL_1, "matching col %u == row %u\n", c, r));
 			goto row_done;
 		}
 
 		col_mate[r] = ~0u;
-		DBG((dbg, LEVEL_1, "node %u: unmatched row %u\n", unmatched, r));
+		DBG((p->dbg, LEVEL_1, "node %u: unmatched row %u\n", unmatched, r));
 		unchosen_row[unmatched++] = r;
 row_done: ;
 	}
@@ -240,7 +239,7 @@ row_done: ;
 	unsigned t = unmatched;
 	for (;;) {
 		unsigned q = 0;
-		DBG((dbg, LEVEL_1, "Matched %u rows.\n", num_rows - t));
+		DBG((p->dbg, LEVEL_1, "Matched %u rows.\n", num_rows - t));
 
 		unsigned breakthru_c;
 		unsigned breakthru_r;
@@ -265,7 +264,7 @@ row_done: ;
 
 							slack[c]      = 0;
 							parent_row[c] = r;
-							DBG((dbg, LEVEL_1, "node %u: row %u == col %u -- row %u\n", t, row_mate[c], c, r));
+							DBG((p->dbg, LEVEL_1, "node %u: row %u == col %u -- row %u\n", t, row_mate[c], c, r));
 							unchosen_row[t++] = row_mate[c];
 						} else {
 							slack[c]     = del;
@@ -293,7 +292,7 @@ row_done: ;
 					if (slack[c] == 0) {
 						/* Begin look at a new zero 22 */
 						unsigned r = slack_row[c];
-						DBG((dbg, LEVEL_1, "Decreasing uncovered elements by %d produces zero at [%u, %u]\n", s, r, c));
+						DBG((p->dbg, LEVEL_1, "Decreasing uncovered elements by %d produces zero at [%u, %u]\n", s, r, c));
 						if (row_mate[c] == ~0u) {
 							for (unsigned j = c + 1; j < num_cols; ++j) {
 								if (slack[j] == 0)
@@ -304,7 +303,7 @@ row_done: ;
 							goto breakthru;
 						} else {
 							parent_row[c] = r;
-							DBG((dbg, LEVEL_1, "node %u: row %u == col %u -- row %u\n", t, row_mate[c], c, r));
+							DBG((p->dbg, LEVEL_1, "node %u: row %u == col %u -- row %u\n", t, row_mate[c], c, r));
 							unchosen_row[t++] = row_mate[c];
 						}
 						/* End look at a new zero 22 */
@@ -317,7 +316,7 @@ row_done: ;
 		}
 breakthru:
 		/* Begin update the matching 20 */
-		DBG((dbg, LEVEL_1, "Breakthrough at node %u of %u.\n", q, t));
+		DBG((p->dbg, LEVEL_1, "Breakthrough at node %u of %u.\n", q, t));
 		unsigned r = breakthru_r;
 		unsigned c = breakthru_c;
 		for (;;) {
@@ -325,7 +324,7 @@ breakthru:
 			col_mate[r] = c;
 			row_mate[c] = r;
 
-			DBG((dbg, LEVEL_1, "rematching col %u == row %u\n", c, r));
+			DBG((p->dbg, LEVEL_1, "rematching col %u == row %u\n", c, r));
 			if (j == ~0u)
 				break;
 
@@ -346,7 +345,7 @@ breakthru:
 		t = 0;
 		for (unsigned r = 0; r < num_rows; ++r) {
 			if (col_mate[r] == ~0u) {
-				DBG((dbg, LEVEL_1, "node %u: unmatched row %u\n", t, r));
+				DBG((p->dbg, LEVEL_1, "node %u: unmatched row %u\n", t, r));
 				unchosen_row[t++] = r;
 			}
 		}
@@ -416,7 +415,7 @@ done:
 	for (unsigned c = 0; c < num_cols; ++c)
 		res_cost -= col_inc[c];
 
-	DBG((dbg, LEVEL_1, "Cost is %d\n", res_cost));
+	DBG((p->dbg, LEVEL_1, "Cost is %d\n", res_cost));
 
 ret:
 	if (final_cost != NULL)
@@ -204,7 +204,7 @@ static bitinfo *get_bitinfo_recursive(ir_node const *const irn)
 	return b;
 }
 
-static bitinfo *(*get_bitinfo_func)(ir_node const*) = &get_bitinfo_null;
+static THREAD_LOCAL bitinfo *(*get_bitinfo_func)(ir_node const*) = &get_bitinfo_null;
 
 bitinfo *get_bitinfo(ir_node const *const irn)
 {
@@ -870,9 +870,13 @@ static void verify_constbits(ir_graph *const irg)
 }
 #endif
 
-void constbits_analyze(ir_graph *const irg)
+void firm_init_constbits(void)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.ana.constbits");
+}
+
+void constbits_analyze(ir_graph *const irg)
+{
 	DB((dbg, LEVEL_1, "---> activating constbits for %+F\n", irg));
 
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
@@ -28,6 +28,11 @@ bitinfo *get_bitinfo(ir_node const *irn);
  */
 bitinfo const *try_get_bitinfo(ir_node const *irn);
 
+/**
+ * One-time initialization of the constbits analysis.
+ */
+void firm_init_constbits(void);
+
 /**
  * Compute value range fixpoint aka which bits of value are constant zero/one.
  * The result is available via @see get_bitinfo.
@@ -24,11 +24,19 @@
  * no path to the end node, which produces undesired results (0, infinite
  * execution frequencies). We alleviate that by adding artificial edges from
  * kept blocks with a path to end.
+ *
+ * Blocks are visited in reverse postorder, so the frequency of a block can be
+ * expressed in terms of the frequencies of its forward predecessors. Only the
+ * sources of backedges and the end block remain as unknowns of the linear
+ * equation system. The in-factors are kept as sparse rows over these unknowns.
+ * Small systems are solved exactly by a QR decomposition, big ones by
+ * Gauss-Seidel iteration.
  */
 #include "execfreq_t.h"
 
+#include "array.h"
 #include "dfs_t.h"
-#include "gaussjordan.h"
+#include "gaussseidel.h"
 #include "hashptr.h"
 #include "iredges_t.h"
 #include "irgraph_t.h"
@@ -53,6 +61,11 @@
 
 #define MAX_INT_FREQ 1000000
 
+#define SEIDEL_TOLERANCE      1e-12
+#define SEIDEL_MAX_ITERATIONS 20000
+
+unsigned ir_execfreq_dense_limit = 256;
+
 static hook_entry_t hook;
 
 typedef struct {
@@ -265,9 +278,9 @@ static double get_cf_probability(const ir_node *bb, int pos,
 	return cur/sum;
 }
 
-static double *freqs;
-static double  min_non_zero;
-static double  max_freq;
+static THREAD_LOCAL double *freqs;
+static THREAD_LOCAL double  min_non_zero;
+static THREAD_LOCAL double  max_freq;
 
 static void collect_freqs(ir_node *node, void *data)
 {
@@ -358,38 +371,190 @@ static void block_walk_no_keeps(ir_node *block)
 	}
 }
 
+/** An entry of a sparse row of the in-factor matrix. */
+typedef struct sparse_entry_t {
+	unsigned col; /**< number of the unknown */
+	double   val;
+} sparse_entry_t;
+
 /**
- * Computes (matrix row r_acc) += (matrix row r_x) * weight.
+ * The in-factors of all blocks. The row of a block expresses its frequency as
+ * a linear combination of the unknowns of the equation system.
  */
-static void add_weighted(square_matrix *mat, unsigned r_acc, unsigned r_x,
-                         double weight)
+typedef struct in_factors_t {
+	sparse_entry_t *entries;   /**< entries of all rows */
+	unsigned       *row_begin; /**< first entry of each row */
+	unsigned       *row_len;   /**< number of entries of each row */
+	double         *acc;       /**< accumulator for the row being built */
+	int            *acc_pos;   /**< position of an unknown in row_cols or -1 */
+	unsigned       *row_cols;  /**< unknowns used in the row being built */
+} in_factors_t;
+
+static void in_factors_init(in_factors_t *const f, unsigned const n_rows,
+                            unsigned const n_cols)
+{
+	f->entries   = NEW_ARR_F(sparse_entry_t, 0);
+	f->row_begin = NEW_ARR_FZ(unsigned, n_rows);
+	f->row_len   = NEW_ARR_FZ(unsigned, n_rows);
+	f->acc       = NEW_ARR_FZ(double, n_cols);
+	f->acc_pos   = NEW_ARR_F(int, n_cols);
+	f->row_cols  = NEW_ARR_F(unsigned, 0);
+	for (unsigned c = 0; c < n_cols; ++c)
+		f->acc_pos[c] = -1;
+}
+
+static void in_factors_free(in_factors_t *const f)
+{
+	DEL_ARR_F(f->entries);
+	DEL_ARR_F(f->row_begin);
+	DEL_ARR_F(f->row_len);
+	DEL_ARR_F(f->acc);
+	DEL_ARR_F(f->acc_pos);
+	DEL_ARR_F(f->row_cols);
+}
+
+/** Computes (row being built) += weight * (unknown col). */
+static void in_factors_add(in_factors_t *const f, unsigned const col,
+                           double const weight)
+{
+	if (f->acc_pos[col] < 0) {
+		f->acc_pos[col] = ARR_LEN(f->row_cols);
+		ARR_APP1(unsigned, f->row_cols, col);
+	}
+	f->acc[col] += weight;
+}
+
+/** Computes (row being built) += weight * (row of block idx). */
+static void in_factors_add_row(in_factors_t *const f, unsigned const idx,
+                               double const weight)
 {
-	for (unsigned c = 0; c < mat->size; c++) {
-		double val = getm(mat, r_acc, c);
-		val += getm(mat, r_x, c) * weight;
-		setm(mat, r_acc, c, val);
+	sparse_entry_t const *const row = &f->entries[f->row_begin[idx]];
+	for (unsigned i = 0, n = f->row_len[idx]; i < n; ++i) {
+		in_factors_add(f, row[i].col, row[i].val * weight);
 	}
 }
 
+/** Stores the row being built as row of block idx. */
+static void in_factors_finish_row(in_factors_t *const f, unsigned const idx)
+{
+	unsigned const n = ARR_LEN(f->row_cols);
+	f->row_begin[idx] = ARR_LEN(f->entries);
+	f->row_len[idx]   = n;
+	for (unsigned i = 0; i < n; ++i) {
+		unsigned       const col   = f->row_cols[i];
+		sparse_entry_t const entry = { .col = col, .val = f->acc[col] };
+		ARR_APP1(sparse_entry_t, f->entries, entry);
+		f->acc[col]     = 0.0;
+		f->acc_pos[col] = -1;
+	}
+	ARR_SHRINKLEN(f->row_cols, 0);
+}
+
 /**
- * Computes the row-th entry of mat . vec.
+ * Computes the frequency of block idx from the values of the unknowns.
  *
- * The elements in vec must be finite unless mat has a 0 at the
- * corresponding position.
+ * The values must be finite.
  */
-static double mat_dot_vec_entry(square_matrix *mat, double *vec, int row)
+static double in_factors_dot(in_factors_t const *const f, unsigned const idx,
+                             double const *const x)
 {
-	double acc = 0.0;
-	for (unsigned i = 0; i < mat->size; i++) {
-		double val = getm(mat, row, i);
-		if (val == 0)
-			continue;
-		assert(isfinite(vec[i]));
-		acc += val * vec[i];
+	sparse_entry_t const *const row = &f->entries[f->row_begin[idx]];
+	double                      acc = 0.0;
+	for (unsigned i = 0, n = f->row_len[idx]; i < n; ++i) {
+		assert(isfinite(x[row[i].col]));
+		acc += row[i].val * x[row[i].col];
 	}
 	return acc;
 }
 
+static int cmp_sparse_entry(void const *const a, void const *const b)
+{
+	sparse_entry_t const *const ea = (sparse_entry_t const*)a;
+	sparse_entry_t const *const eb = (sparse_entry_t const*)b;
+	return QSORT_CMP(ea->col, eb->col);
+}
+
+/**
+ * Solves the equation system exactly by computing the nullspace of the
+ * matrix with a QR decomposition.
+ */
+static bool solve_dense(in_factors_t const *const f,
+                        unsigned const *const lgs_to_mat, double *const x)
+{
+	unsigned       const lgs_size   = ARR_LEN(lgs_to_mat);
+	square_matrix *const lgs_matrix = mat_create(lgs_size);
+	memset(lgs_matrix->entries, 0,
+	       lgs_size * lgs_size * sizeof(lgs_matrix->entries[0]));
+
+	for (unsigned r = 0; r < lgs_size; ++r) {
+		unsigned              const idx = lgs_to_mat[r];
+		sparse_entry_t const *const row = &f->entries[f->row_begin[idx]];
+		for (unsigned i = 0, n = f->row_len[idx]; i < n; ++i) {
+			setm(lgs_matrix, r, row[i].col, row[i].val);
+		}
+		/* RHS of the equation */
+		setm(lgs_matrix, r, r, getm(lgs_matrix, r, r) - 1.0);
+	}
+
+	nullspace(lgs_matrix, x);
+	free(lgs_matrix);
+	return true;
+}
+
+/**
+ * Solves the equation system by Gauss-Seidel iteration.
+ *
+ * Returns false if the iteration did not converge.
+ */
+static bool solve_sparse(in_factors_t *const f,
+                         unsigned const *const lgs_to_mat, double *const x)
+{
+	unsigned     const lgs_size = ARR_LEN(lgs_to_mat);
+	gs_matrix_t *const mat      = gs_new_matrix(lgs_size, 0);
+	bool               valid    = true;
+
+	for (unsigned r = 0; r < lgs_size; ++r) {
+		unsigned        const idx  = lgs_to_mat[r];
+		sparse_entry_t *const row  = &f->entries[f->row_begin[idx]];
+		unsigned        const n    = f->row_len[idx];
+		double                diag = -1.0;
+		/* Insert in column order, so each entry is appended to its row. */
+		QSORT(row, n, cmp_sparse_entry);
+		for (unsigned i = 0; i < n; ++i) {
+			if (row[i].col == r)
+				diag += row[i].val;
+			else
+				gs_matrix_set(mat, r, row[i].col, row[i].val);
+		}
+		/* A cycle which is never left. */
+		if (diag == 0.0) {
+			valid = false;
+			goto end;
+		}
+		gs_matrix_set(mat, r, r, diag);
+		x[r] = 1.0;
+	}
+
+	valid = false;
+	for (unsigned i = 0; i < SEIDEL_MAX_ITERATIONS; ++i) {
+		double const dev = gs_matrix_gauss_seidel(mat, x);
+		double       sum = 0.0;
+		for (unsigned r = 0; r < lgs_size; ++r) {
+			sum += fabs(x[r]);
+		}
+		if (!isfinite(sum))
+			break;
+		if (dev <= SEIDEL_TOLERANCE * sum) {
+			valid = true;
+			break;
+		}
+	}
+
+end:
+	gs_delete_matrix(mat);
+	return valid;
+}
+
 /**
  * Fallback solution 1: Use loop weight.
  *
@@ -453,24 +618,6 @@ void ir_estimate_execfreq(ir_graph *irg)
 
 	unsigned       size   = dfs_get_n_nodes(dfs);
 
-	/* It is undesirable to allocate more than 2GB for the matrix */
-	if (size*size*sizeof(double) > 1 << 30) {
-		if (!fallback_loop_weight(dfs, loop_weight)) {
-			fallback_all_ones(dfs);
-		}
-		dfs_free(dfs);
-		return;
-	}
-
-
-	square_matrix *in_fac = mat_create(size);
-	for (unsigned r = 0; r < size; r++) {
-		for (unsigned c = 0; c < size; c++) {
-			setm(in_fac, r, c, 0.0);
-		}
-	}
-
-
 	ir_node *const start_block = get_irg_start_block(irg);
 	ir_node *const end_block   = get_irg_end_block(irg);
 	const int      end_idx     = size - dfs_get_post_num(dfs, end_block) - 1;
@@ -495,11 +642,37 @@ void ir_estimate_execfreq(ir_graph *irg)
 		}
 	}
 
-	double const inv_loop_weight = 1.0 / loop_weight;
 	/* lgs_to_mat[i] is the index of the block represented by the
-	 * i-th row/column in the LGS matrix. */
-	int *lgs_to_mat = NEW_ARR_F(int, 0);
+	 * i-th unknown of the LGS.
+	 * mat_to_lgs[i] is the number of the unknown of block i, or
+	 * -1 if the block can be solved by simple substitution. */
+	unsigned *lgs_to_mat = NEW_ARR_F(unsigned, 0);
+	int      *mat_to_lgs = NEW_ARR_F(int, size);
+	for (unsigned x = 0; x < size; x++) {
+		mat_to_lgs[x] = -1;
+	}
+	for (unsigned idx = 0; idx < size; ++idx) {
+		ir_node const *const bb = dfs_get_post_num_node(dfs, size-idx-1);
+		if (bb == end_block)
+			continue;
 
+		for (int i = get_Block_n_cfgpreds(bb) - 1; i >= 0; --i) {
+			ir_node *const pred     = get_Block_cfgpred_block(bb, i);
+			unsigned const pred_idx = size - dfs_get_post_num(dfs, pred) - 1;
+			if (pred_idx >= idx && mat_to_lgs[pred_idx] < 0) {
+				mat_to_lgs[pred_idx] = ARR_LEN(lgs_to_mat);
+				ARR_APP1(unsigned, lgs_to_mat, pred_idx);
+			}
+		}
+	}
+	mat_to_lgs[end_idx] = ARR_LEN(lgs_to_mat);
+	ARR_APP1(unsigned, lgs_to_mat, end_idx);
+	unsigned const lgs_size = ARR_LEN(lgs_to_mat);
+
+	in_factors_t in_fac;
+	in_factors_init(&in_fac, size, lgs_size);
+
+	double const inv_loop_weight = 1.0 / loop_weight;
 	for (unsigned idx = 0; idx < size; ++idx) {
 		ir_node const *const bb = dfs_get_post_num_node(dfs, size-idx-1);
 		/* The end block is handled properly later, when all the kept blocks
@@ -514,24 +687,23 @@ void ir_estimate_execfreq(ir_graph *irg)
 			bool     const pred_visited   = pred_idx < idx;
 
 			if (pred_visited) {
-				add_weighted(in_fac, idx, pred_idx, cf_probability);
+				in_factors_add_row(&in_fac, pred_idx, cf_probability);
 			} else {
-				ARR_APP1(int, lgs_to_mat, pred_idx);
-				setm(in_fac, idx, pred_idx, cf_probability);
+				in_factors_add(&in_fac, mat_to_lgs[pred_idx], cf_probability);
 			}
 		}
 
 		if (bb == start_block)
-			setm(in_fac, idx, end_idx, 1.0);
+			in_factors_add(&in_fac, mat_to_lgs[end_idx], 1.0);
+		in_factors_finish_row(&in_fac, idx);
 	}
 
 	/* handle end block */
-	ARR_APP1(int, lgs_to_mat, end_idx);
 	for (int i = get_Block_n_cfgpreds(end_block) - 1; i >= 0; --i) {
 		ir_node *const pred           = get_Block_cfgpred_block(end_block, i);
 		int      const pred_idx       = size - dfs_get_post_num(dfs, pred) - 1;
 		double   const cf_probability = get_cf_probability(end_block, i, inv_loop_weight);
-		add_weighted(in_fac, end_idx, pred_idx, cf_probability);
+		in_factors_add_row(&in_fac, pred_idx, cf_probability);
 	}
 
 	/* add artifical edges from "kept blocks without a path to end"
@@ -544,110 +716,57 @@ void ir_estimate_execfreq(ir_graph *irg)
 		double sum      = get_sum_succ_factors(keep, inv_loop_weight);
 		double fac      = KEEP_FAC/sum;
 		int    keep_idx = size - dfs_get_post_num(dfs, keep)-1;
-		add_weighted(in_fac, end_idx, keep_idx, fac);
-	}
-
-	/* mat_to_lgs[i] is the index of node i in the LGS matrix, or
-	 * -1 if the node can be solved by simple substitution. */
-	int *mat_to_lgs = NEW_ARR_F(int, size);
-	for (unsigned x = 0; x < size; x++) {
-		mat_to_lgs[x] = -1;
-	}
-	for (unsigned b = 0; b < ARR_LEN(lgs_to_mat); b++) {
-		mat_to_lgs[lgs_to_mat[b]] = b;
-	}
-
-#ifdef DEBUG
-	/* Check that all values in in_fac are only given in terms of nodes with backedges */
-	for (int y = 0; y < size; y++) {
-		if (mat_to_lgs[y] == -1)
-			continue;
-		for (int x = 0; x < size; x++) {
-			if (getm(in_fac, x, y) != 0)
-				panic("expect entry at (%d, %d) to be 0", x, y);
-		}
-	}
-#endif
-
-	/* Build the LGS matrix with only the indices in lgs_to_mat. */
-	unsigned lgs_size = ARR_LEN(lgs_to_mat);
-	square_matrix *lgs_matrix = mat_create(lgs_size);
-	double *lgs_x = NEW_ARR_F(double, size);
-
-	for (unsigned x = 0; x < lgs_size; x++) {
-		int bx = lgs_to_mat[x];
-		for (unsigned y = 0; y < lgs_size; y++) {
-			int by = lgs_to_mat[y];
-			double val = getm(in_fac, bx, by);
-			setm(lgs_matrix, x, y, val);
-		}
-		/* RHS of the equation */
-		double val = getm(lgs_matrix, x, x);
-		val -= 1.0;
-		setm(lgs_matrix, x, x, val);
+		in_factors_add_row(&in_fac, keep_idx, fac);
 	}
+	in_factors_finish_row(&in_fac, end_idx);
 
+	double *lgs_x      = NEW_ARR_F(double, lgs_size);
+	bool    valid_freq;
 	if (lgs_size == 1) {
-		lgs_x[0] = 1.0;
+		lgs_x[0]   = 1.0;
+		valid_freq = true;
+	} else if (lgs_size <= ir_execfreq_dense_limit) {
+		valid_freq = solve_dense(&in_fac, lgs_to_mat, lgs_x);
 	} else {
-		nullspace(lgs_matrix, lgs_x);
+		valid_freq = solve_sparse(&in_fac, lgs_to_mat, lgs_x);
 	}
 
-	/* compute the normalization factor.
-	 * 1.0 / exec freq of end block.
-	 */
-	double  end_freq   = lgs_x[mat_to_lgs[end_idx]];
-	double  norm       = end_freq != 0.0 ? 1.0 / end_freq : 1.0;
-	double *freqs      = NEW_ARR_F(double, size);
-	bool    valid_freq = true;
-
-	/* First get the frequency for the nodes which were
-	 * explicitly computed. */
-	for (unsigned idx = size; idx-- > 0; ) {
-		ir_node *const bb = dfs_get_post_num_node(dfs, size - idx - 1);
+	if (valid_freq) {
+		/* compute the normalization factor.
+		 * 1.0 / exec freq of end block. A failed solver leaves lgs_x
+		 * partially unwritten, so only look at it here.
+		 */
+		double end_freq = lgs_x[mat_to_lgs[end_idx]];
+		double norm     = end_freq != 0.0 ? 1.0 / end_freq : 1.0;
+
+		for (unsigned idx = size; idx-- > 0; ) {
+			ir_node *const bb = dfs_get_post_num_node(dfs, size - idx - 1);
 
-		if (mat_to_lgs[idx] != -1) {
-			double freq = lgs_x[mat_to_lgs[idx]] * norm;
+			double freq;
+			if (mat_to_lgs[idx] != -1) {
+				/* The nodes which were explicitly computed. */
+				freq = lgs_x[mat_to_lgs[idx]] * norm;
+			} else {
+				/* Get the rest of the frequencies using the in-factors. */
+				freq = in_factors_dot(&in_fac, idx, lgs_x) * norm;
+			}
 			/* Check for inf, nan and negative values. */
 			if (isinf(freq) || !(freq >= 0)) {
 				valid_freq = false;
 				break;
 			}
 			set_block_execfreq(bb, freq);
-			freqs[idx] = freq;
-		} else {
-			freqs[idx] = nan("");
-		}
-	}
-
-	if (valid_freq) {
-		/* Now get the rest of the frequencies using the factors in in_fac */
-		for (unsigned idx = size; idx-- > 0; ) {
-			ir_node *const bb = dfs_get_post_num_node(dfs, size - idx - 1);
-
-			if (mat_to_lgs[idx] == -1) {
-				double freq = mat_dot_vec_entry(in_fac, freqs, idx);
-				/* Check for inf, nan and negative values. */
-				if (isinf(freq) || freq < 0) {
-					valid_freq = false;
-					break;
-				}
-				set_block_execfreq(bb, freq);
-			}
 		}
 	}
 
-	DEL_ARR_F(freqs);
-
 	/* Fallbacks in case some frequencies were invalid */
 	if (!valid_freq && !fallback_loop_weight(dfs, loop_weight)) {
 		fallback_all_ones(dfs);
 	}
 
 	free_properties_and_dfs(irg, dfs);
+	in_factors_free(&in_fac);
 	DEL_ARR_F(lgs_to_mat);
 	DEL_ARR_F(mat_to_lgs);
-	free(in_fac);
-	free(lgs_matrix);
 	DEL_ARR_F(lgs_x);
 }
@@ -20,6 +20,13 @@ void exit_execfreq(void);
 
 void set_block_execfreq(ir_node *block, double freq);
 
+/**
+ * Maximum number of unknowns for which the execution frequency equations are
+ * solved exactly by a dense QR decomposition. Bigger systems are solved
+ * iteratively.
+ */
+extern unsigned ir_execfreq_dense_limit;
+
 typedef struct ir_execfreq_int_factors {
 	double min_non_zero;
 	double m;
@@ -17,6 +17,8 @@
 #include "irgraph_t.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "irnodehashmap.h"
+#include "irnodeset.h"
 #include "irouts_t.h"
 #include "util.h"
 #include "xmalloc.h"
@@ -46,6 +48,8 @@ static inline const ir_dom_info *get_pdom_info_const(const ir_node *block)
 	return &block->attr.block.pdom;
 }
 
+static void assure_dom_tree_pre_nums(ir_graph *irg);
+
 ir_node *get_Block_idom(const ir_node *block)
 {
 	assert(irg_has_properties(get_irn_irg(block), IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE));
@@ -138,11 +142,13 @@ void set_Block_postdom_depth(ir_node *block, int depth)
 
 unsigned get_Block_dom_tree_pre_num(const ir_node *block)
 {
+	assure_dom_tree_pre_nums(get_irn_irg(block));
 	return get_dom_info_const(block)->tree_pre_num;
 }
 
 unsigned get_Block_dom_max_subtree_pre_num(const ir_node *block)
 {
+	assure_dom_tree_pre_nums(get_irn_irg(block));
 	return get_dom_info_const(block)->max_subtree_pre_num;
 }
 
@@ -159,6 +165,7 @@ unsigned get_Block_pdom_max_subtree_pre_num(const ir_node *block)
 int block_dominates(const ir_node *a, const ir_node *b)
 {
 	assert(irg_has_properties(get_irn_irg(a), IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE));
+	assure_dom_tree_pre_nums(get_irn_irg(a));
 	const ir_dom_info *ai = get_dom_info_const(a);
 	const ir_dom_info *bi = get_dom_info_const(b);
 	return bi->tree_pre_num - ai->tree_pre_num
@@ -311,6 +318,21 @@ static void assign_tree_dom_pre_order_max(ir_node *block, void *data)
 	assert(bi->max_subtree_pre_num >= bi->tree_pre_num);
 }
 
+/**
+ * Assigns new tree pre-order numbers if the dominator tree was changed by an
+ * incremental update since they were assigned last.
+ */
+static void assure_dom_tree_pre_nums(ir_graph *irg)
+{
+	if (!irg->dom_tree_changed)
+		return;
+	irg->dom_tree_changed = false;
+
+	unsigned tree_pre_order = 0;
+	dom_tree_walk(get_irg_start_block(irg), assign_tree_dom_pre_order,
+	              assign_tree_dom_pre_order_max, &tree_pre_order);
+}
+
 static void assign_tree_postdom_pre_order(ir_node *block, void *data)
 {
 	unsigned    *num = (unsigned*)data;
@@ -600,11 +622,537 @@ void compute_doms(ir_graph *irg)
 	add_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
 
 	/* Do a walk over the tree and assign the tree pre orders. */
+	irg->dom_tree_changed = false;
 	unsigned tree_pre_order = 0;
 	dom_tree_walk(get_irg_start_block(irg), assign_tree_dom_pre_order,
 	              assign_tree_dom_pre_order_max, &tree_pre_order);
 }
 
+/** Returns whether a block is part of the dominator tree. Blocks which are
+ * unreachable have a depth of -1, blocks created after the dominance
+ * information was computed a depth of 0. */
+static bool is_in_dom_tree(const ir_node *block)
+{
+	return get_Block_dom_depth(block) > 0;
+}
+
+/** Returns the nearest common dominator of two blocks in the dominator tree,
+ * without using the (maybe outdated) tree pre-order numbers. */
+static ir_node *dom_tree_nca(ir_node *a, ir_node *b)
+{
+	while (a != b) {
+		if (get_Block_dom_depth(a) < get_Block_dom_depth(b))
+			b = get_dom_info(b)->idom;
+		else
+			a = get_dom_info(a)->idom;
+	}
+	return a;
+}
+
+/** Returns whether block @p a dominates block @p b, without using the (maybe
+ * outdated) tree pre-order numbers. */
+static bool dom_tree_dominates(ir_node *a, ir_node *b)
+{
+	while (get_Block_dom_depth(b) > get_Block_dom_depth(a))
+		b = get_dom_info(b)->idom;
+	return a == b;
+}
+
+/**
+ * Collects the control flow predecessor blocks of @p block into @p preds.
+ * Like compute_doms() the keep-alive edges of the End node count as control
+ * flow edges into the End block.
+ */
+static void collect_pred_blocks(ir_node *block, ir_node ***preds)
+{
+	ARR_SHRINKLEN(*preds, 0);
+	for (int i = 0, arity = get_Block_n_cfgpreds(block); i < arity; ++i) {
+		ir_node *const pred = skip_Tuple(get_Block_cfgpred(block, i));
+		if (!is_Bad(pred))
+			ARR_APP1(ir_node*, *preds, get_nodes_block(pred));
+	}
+
+	ir_graph *const irg = get_irn_irg(block);
+	if (block == get_irg_end_block(irg)) {
+		foreach_irn_in(get_irg_end(irg), i, pred) {
+			if (is_Block(pred))
+				ARR_APP1(ir_node*, *preds, pred);
+		}
+	}
+}
+
+/** Removes a block from the list of blocks dominated by its immediate
+ * dominator. */
+static void remove_dominated(ir_node *block)
+{
+	ir_dom_info *const bi   = get_dom_info(block);
+	ir_node    **      link = &get_dom_info(bi->idom)->first;
+	while (*link != block)
+		link = &get_dom_info(*link)->next;
+	*link    = bi->next;
+	bi->idom = NULL;
+	bi->next = NULL;
+}
+
+static void add_dom_depth(ir_node *block, void *data)
+{
+	get_dom_info(block)->dom_depth += *(int const*)data;
+}
+
+/** Invalidates the information derived from the dominator tree after an
+ * incremental update. */
+static void dom_tree_updated(ir_graph *irg)
+{
+	irg->dom_tree_changed = true;
+	ir_free_dominance_frontiers(irg);
+}
+
+/** A block of the part of the graph the dominator tree is recomputed for. */
+typedef struct dom_region_block_t {
+	ir_node      *block;
+	ir_node     **succs; /**< successors inside the region (flexible array) */
+	tmp_dom_info *tdi;   /**< set when the block is reached from the root */
+} dom_region_block_t;
+
+/** The part of the graph the dominator tree is recomputed for. */
+typedef struct dom_region_t {
+	ir_nodehashmap_t     blocks;   /**< maps blocks to dom_region_block_t */
+	dom_region_block_t **list;     /**< all blocks (flexible array) */
+	struct obstack       obst;
+	tmp_dom_info        *tdi_list;
+	int                  used;
+} dom_region_t;
+
+static dom_region_block_t *get_region_block(const dom_region_t *region,
+                                            const ir_node *block)
+{
+	return ir_nodehashmap_get(dom_region_block_t, &region->blocks, block);
+}
+
+static void add_region_block(ir_node *block, void *data)
+{
+	dom_region_t       *region = (dom_region_t*)data;
+	dom_region_block_t *rb     = OALLOCZ(&region->obst, dom_region_block_t);
+	rb->block = block;
+	rb->succs = NEW_ARR_F(ir_node*, 0);
+	ir_nodehashmap_insert(&region->blocks, block, rb);
+	ARR_APP1(dom_region_block_t*, region->list, rb);
+}
+
+/**
+ * Numbers the blocks of the region in depth first order along the control
+ * flow, like init_tmp_dom_info() does for the whole graph.
+ */
+static void init_region_dom_info(dom_region_t *region, dom_region_block_t *rb,
+                                 tmp_dom_info *parent)
+{
+	if (rb->tdi != NULL)
+		return;
+
+	tmp_dom_info *tdi = &region->tdi_list[region->used++];
+	rb->tdi = tdi;
+
+	tdi->block       = rb->block;
+	tdi->semi        = tdi;
+	tdi->parent      = parent;
+	tdi->label       = tdi;
+	tdi->ancestor    = NULL;
+	tdi->dom         = NULL;
+	tdi->bucket      = NULL;
+	tdi->unreachable = 0;
+
+	for (size_t i = ARR_LEN(rb->succs); i-- != 0;) {
+		dom_region_block_t *succ = get_region_block(region, rb->succs[i]);
+		init_region_dom_info(region, succ, tdi);
+	}
+}
+
+/**
+ * Recomputes the dominator subtree of @p root with the algorithm of
+ * compute_doms(). The immediate dominator of @p root must not have changed,
+ * so all blocks reachable from Start through the subtree are dominated by
+ * @p root and only the edges inside the subtree matter. @p new_blocks are
+ * blocks outside of the dominator tree which became reachable through the
+ * subtree.
+ */
+static void recompute_dom_subtree(ir_node *root, ir_node **new_blocks)
+{
+	dom_region_t region;
+	ir_nodehashmap_init(&region.blocks);
+	obstack_init(&region.obst);
+	region.list = NEW_ARR_F(dom_region_block_t*, 0);
+	region.used = 0;
+
+	dom_tree_walk(root, add_region_block, NULL, &region);
+	if (new_blocks != NULL) {
+		for (size_t i = 0, n = ARR_LEN(new_blocks); i < n; ++i)
+			add_region_block(new_blocks[i], &region);
+	}
+
+	/* Collect the control flow edges inside the region. */
+	size_t    const n_blocks = ARR_LEN(region.list);
+	ir_node **      preds    = NEW_ARR_F(ir_node*, 0);
+	for (size_t i = 0; i < n_blocks; ++i) {
+		dom_region_block_t *rb = region.list[i];
+		collect_pred_blocks(rb->block, &preds);
+		for (size_t j = 0, n = ARR_LEN(preds); j < n; ++j) {
+			dom_region_block_t *pred = get_region_block(&region, preds[j]);
+			if (pred != NULL)
+				ARR_APP1(ir_node*, pred->succs, rb->block);
+		}
+	}
+
+	region.tdi_list = XMALLOCN(tmp_dom_info, n_blocks);
+	init_region_dom_info(&region, get_region_block(&region, root), NULL);
+
+	for (int i = region.used; i-- > 1; ) {  /* Don't iterate the root. */
+		tmp_dom_info *w = &region.tdi_list[i];
+
+		/* Step 2 */
+		collect_pred_blocks(w->block, &preds);
+		for (size_t j = 0, n = ARR_LEN(preds); j < n; ++j) {
+			dom_region_block_t *pred = get_region_block(&region, preds[j]);
+			if (pred == NULL || pred->tdi == NULL)
+				continue;   /* unreachable */
+
+			const tmp_dom_info *u = dom_eval(pred->tdi);
+			if (u->semi < w->semi)
+				w->semi = u->semi;
+		}
+
+		w->bucket = w->semi->bucket;
+		w->semi->bucket = w;
+
+		dom_link(w->parent, w);
+
+		/* Step 3 */
+		while (w->parent->bucket) {
+			tmp_dom_info *v = w->parent->bucket;
+			w->parent->bucket = v->bucket;
+			v->bucket         = NULL;
+
+			tmp_dom_info *u = dom_eval(v);
+			if (u->semi < v->semi)
+				v->dom = u;
+			else
+				v->dom = w->parent;
+		}
+	}
+
+	/* Detach the old subtree, the root keeps its place in the tree. Blocks
+	 * not reached anymore are unreachable now. */
+	for (size_t i = 0; i < n_blocks; ++i) {
+		dom_region_block_t *rb = region.list[i];
+		ir_dom_info        *bi = get_dom_info(rb->block);
+		bi->first = NULL;
+		if (rb->block == root)
+			continue;
+		bi->idom = NULL;
+		bi->next = NULL;
+		if (rb->tdi == NULL) {
+			set_Block_dom_pre_num(rb->block, -1);
+			set_Block_dom_depth(rb->block, -1);
+		}
+	}
+
+	/* Step 4 */
+	for (int i = 1; i < region.used; i++) {
+		tmp_dom_info *w = &region.tdi_list[i];
+		if (w->dom != w->semi)
+			w->dom = w->dom->dom;
+		set_Block_idom(w->block, w->dom->block);
+		set_Block_dom_depth(w->block, get_Block_dom_depth(w->dom->block) + 1);
+	}
+
+	/* clean up */
+	for (size_t i = 0; i < n_blocks; ++i)
+		DEL_ARR_F(region.list[i]->succs);
+	DEL_ARR_F(preds);
+	DEL_ARR_F(region.list);
+	free(region.tdi_list);
+	obstack_free(&region.obst, NULL);
+	ir_nodehashmap_destroy(&region.blocks);
+}
+
+/**
+ * Collects the blocks outside of the dominator tree reachable from @p block,
+ * which is not in the tree either. Returns them as flexible array and the
+ * nearest common dominator of @p root and all blocks of the tree they jump
+ * to in @p root.
+ */
+static ir_node **collect_new_blocks(ir_node *block, ir_node **root)
+{
+	/* There are no out edges for blocks outside the tree, so first find the
+	 * successors of all such blocks by walking the whole graph backwards. */
+	ir_graph        *irg   = get_irn_irg(block);
+	ir_nodehashmap_t succs;
+	ir_nodeset_t     visited;
+	ir_nodehashmap_init(&succs);
+	ir_nodeset_init(&visited);
+
+	ir_node **preds = NEW_ARR_F(ir_node*, 0);
+	ir_node **stack = NEW_ARR_F(ir_node*, 0);
+	ir_node  *end   = get_irg_end_block(irg);
+	ir_nodeset_insert(&visited, end);
+	ARR_APP1(ir_node*, stack, end);
+	while (ARR_LEN(stack) > 0) {
+		ir_node *b = stack[ARR_LEN(stack) - 1];
+		ARR_SHRINKLEN(stack, ARR_LEN(stack) - 1);
+		collect_pred_blocks(b, &preds);
+		for (size_t i = 0, n = ARR_LEN(preds); i < n; ++i) {
+			ir_node *pred = preds[i];
+			if (!is_in_dom_tree(pred)) {
+				ir_node **pred_succs = ir_nodehashmap_get(ir_node*, &succs, pred);
+				if (pred_succs == NULL)
+					pred_succs = NEW_ARR_F(ir_node*, 0);
+				ARR_APP1(ir_node*, pred_succs, b);
+				ir_nodehashmap_insert(&succs, pred, pred_succs);
+			}
+			if (ir_nodeset_insert(&visited, pred))
+				ARR_APP1(ir_node*, stack, pred);
+		}
+	}
+
+	/* Now collect the blocks reachable from block. */
+	ir_nodeset_destroy(&visited);
+	ir_nodeset_init(&visited);
+	ir_node **new_blocks = NEW_ARR_F(ir_node*, 0);
+	ir_nodeset_insert(&visited, block);
+	ARR_APP1(ir_node*, new_blocks, block);
+	for (size_t i = 0; i < ARR_LEN(new_blocks); ++i) {
+		ir_node **block_succs = ir_nodehashmap_get(ir_node*, &succs,
+		                                           new_blocks[i]);
+		if (block_succs == NULL)
+			continue;
+		for (size_t j = 0, n = ARR_LEN(block_succs); j < n; ++j) {
+			ir_node *succ = block_succs[j];
+			if (is_in_dom_tree(succ))
+				*root = dom_tree_nca(*root, succ);
+			else if (ir_nodeset_insert(&visited, succ))
+				ARR_APP1(ir_node*, new_blocks, succ);
+		}
+	}
+
+	ir_nodehashmap_iterator_t iter;
+	ir_nodehashmap_entry_t    entry;
+	foreach_ir_nodehashmap(&succs, entry, iter) {
+		DEL_ARR_F((ir_node**)entry.data);
+	}
+	DEL_ARR_F(stack);
+	DEL_ARR_F(preds);
+	ir_nodeset_destroy(&visited);
+	ir_nodehashmap_destroy(&succs);
+	return new_blocks;
+}
+
+void dom_insert_edge(ir_node *from, ir_node *to)
+{
+	ir_graph *irg = get_irn_irg(from);
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return;
+	/* edges out of unreachable code change nothing */
+	if (!is_in_dom_tree(from))
+		return;
+
+	if (is_in_dom_tree(to)) {
+		/* The new immediate dominator of to is the nearest common dominator
+		 * of from and the old one. Only if it changes, other blocks in the
+		 * subtree of the nearest common dominator may change as well. */
+		ir_node *nca = dom_tree_nca(from, to);
+		if (get_Block_dom_depth(to) <= get_Block_dom_depth(nca) + 1)
+			return;
+		recompute_dom_subtree(nca, NULL);
+	} else {
+		ir_node  *root       = from;
+		ir_node **new_blocks = collect_new_blocks(to, &root);
+		recompute_dom_subtree(root, new_blocks);
+		DEL_ARR_F(new_blocks);
+	}
+	dom_tree_updated(irg);
+}
+
+void dom_delete_edge(ir_node *from, ir_node *to)
+{
+	ir_graph *irg = get_irn_irg(from);
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return;
+	/* Edges out of unreachable code and back edges change nothing. In the
+	 * latter case all paths through the edge already passed to. */
+	if (!is_in_dom_tree(from) || !is_in_dom_tree(to)
+	    || dom_tree_dominates(to, from))
+		return;
+
+	/* Nothing changes if there is another edge from the same block. Else to
+	 * stays reachable if it has a reachable predecessor it does not
+	 * dominate, as the removed edge is not on the paths to it. */
+	ir_node **preds     = NEW_ARR_F(ir_node*, 0);
+	bool      reachable = false;
+	collect_pred_blocks(to, &preds);
+	for (size_t i = 0, n = ARR_LEN(preds); i < n; ++i) {
+		ir_node *pred = preds[i];
+		if (pred == from) {
+			DEL_ARR_F(preds);
+			return;
+		}
+		if (is_in_dom_tree(pred) && !dom_tree_dominates(to, pred))
+			reachable = true;
+	}
+	DEL_ARR_F(preds);
+
+	if (reachable) {
+		/* All paths through the edge pass the immediate dominator of to,
+		 * whose dominators stay the same. */
+		recompute_dom_subtree(get_dom_info(to)->idom, NULL);
+	} else {
+		/* The subtree of to becomes unreachable, which may change the
+		 * dominators of all blocks it jumps to. Finding them needs the
+		 * successors of the subtree, so recompute the whole tree instead. */
+		recompute_dom_subtree(get_irg_start_block(irg), NULL);
+	}
+	dom_tree_updated(irg);
+}
+
+void dom_insert_block(ir_node *block, ir_node *succ)
+{
+	ir_graph *irg = get_irn_irg(block);
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return;
+
+	/* block is dominated by the nearest common dominator of its reachable
+	 * predecessors, it is the new Start block if it has none. */
+	ir_node **preds = NEW_ARR_F(ir_node*, 0);
+	ir_node  *idom  = NULL;
+	collect_pred_blocks(block, &preds);
+	for (size_t i = 0, n = ARR_LEN(preds); i < n; ++i) {
+		if (is_in_dom_tree(preds[i]))
+			idom = idom == NULL ? preds[i] : dom_tree_nca(idom, preds[i]);
+	}
+
+	memset(get_dom_info(block), 0, sizeof(ir_dom_info));
+	set_Block_dom_pre_num(block, -1);
+	if (idom == NULL && block != get_irg_start_block(irg)) {
+		/* the predecessors of succ we got are unreachable */
+		set_Block_dom_depth(block, -1);
+		DEL_ARR_F(preds);
+		return;
+	}
+	set_Block_idom(block, idom);
+	set_Block_dom_depth(block, idom != NULL ? get_Block_dom_depth(idom) + 1 : 1);
+
+	/* block becomes the immediate dominator of succ if all other edges into
+	 * succ come from blocks dominated by succ. Otherwise nothing changes for
+	 * succ, as its predecessors still have the same nearest common
+	 * dominator. */
+	assert(is_in_dom_tree(succ));
+	bool dominates_succ = true;
+	collect_pred_blocks(succ, &preds);
+	for (size_t i = 0, n = ARR_LEN(preds); i < n; ++i) {
+		ir_node *pred = preds[i];
+		if (pred != block && is_in_dom_tree(pred)
+		    && !dom_tree_dominates(succ, pred))
+			dominates_succ = false;
+	}
+	DEL_ARR_F(preds);
+
+	if (dominates_succ) {
+		if (get_dom_info(succ)->idom != NULL)
+			remove_dominated(succ);
+		set_Block_idom(succ, block);
+		int delta = get_Block_dom_depth(block) + 1 - get_Block_dom_depth(succ);
+		if (delta != 0)
+			dom_tree_walk(succ, add_dom_depth, NULL, &delta);
+	}
+	dom_tree_updated(irg);
+}
+
+/**
+ * Makes the nearest common dominator of the reachable predecessors the
+ * immediate dominator of the End block again, after the blocks it is kept
+ * alive by or returned from changed. A block @p replaced which is about to be
+ * exchanged counts as @p replacement. The End block has no successors, so
+ * no other block depends on it.
+ */
+static void update_end_block_idom(ir_graph *irg, ir_node *replaced,
+                                  ir_node *replacement)
+{
+	ir_node *const end_block = get_irg_end_block(irg);
+	if (!is_in_dom_tree(end_block))
+		return;
+
+	ir_node **preds = NEW_ARR_F(ir_node*, 0);
+	ir_node  *idom  = NULL;
+	collect_pred_blocks(end_block, &preds);
+	for (size_t i = 0, n = ARR_LEN(preds); i < n; ++i) {
+		ir_node *pred = preds[i] == replaced ? replacement : preds[i];
+		if (is_in_dom_tree(pred))
+			idom = idom == NULL ? pred : dom_tree_nca(idom, pred);
+	}
+	DEL_ARR_F(preds);
+
+	if (idom == NULL || idom == get_dom_info(end_block)->idom)
+		return;
+	remove_dominated(end_block);
+	set_Block_idom(end_block, idom);
+	set_Block_dom_depth(end_block, get_Block_dom_depth(idom) + 1);
+}
+
+void dom_merge_block(ir_node *block, ir_node *into)
+{
+	ir_graph *irg = get_irn_irg(block);
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return;
+
+	/* Every path through the edge between the blocks passes both of them,
+	 * so the merged block dominates the blocks either of them dominated
+	 * and keeps the place of the upper one. The blocks dominated by block
+	 * move up to its immediate dominator, which is into itself if into is
+	 * the upper block. */
+	ir_node *const idom = is_in_dom_tree(block) ? get_dom_info(block)->idom
+	                                            : NULL;
+	if (idom != NULL) {
+		remove_dominated(block);
+		ir_dom_info *const bi    = get_dom_info(block);
+		int               delta = -1;
+		for (ir_node *child = bi->first, *next; child != NULL; child = next) {
+			next = get_dom_info(child)->next;
+			dom_tree_walk(child, add_dom_depth, NULL, &delta);
+			set_Block_idom(child, idom);
+		}
+		bi->first = NULL;
+	}
+	set_Block_dom_depth(block, -1);
+
+	/* If into is the lower block, the edges from block to End move to a
+	 * block which may be dominated by fewer blocks. */
+	if (idom != into)
+		update_end_block_idom(irg, block, into);
+	dom_tree_updated(irg);
+}
+
+void dom_update_subtree(ir_node *block, ir_node *const *new_blocks,
+                        size_t n_new_blocks)
+{
+	ir_graph *irg = get_irn_irg(block);
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return;
+
+	/* new blocks may be copies which carry the information of the original */
+	ir_node **blocks = NEW_ARR_F(ir_node*, n_new_blocks);
+	for (size_t i = 0; i < n_new_blocks; ++i) {
+		ir_node *const new_block = new_blocks[i];
+		memset(get_dom_info(new_block), 0, sizeof(ir_dom_info));
+		set_Block_dom_pre_num(new_block, -1);
+		blocks[i] = new_block;
+	}
+	recompute_dom_subtree(block, blocks);
+	DEL_ARR_F(blocks);
+
+	ir_node *const end_block = get_irg_end_block(irg);
+	if (is_in_dom_tree(end_block) && !dom_tree_dominates(block, end_block))
+		update_end_block_idom(irg, NULL, NULL);
+	dom_tree_updated(irg);
+}
+
 static void update_pdom_semi(tmp_dom_info *tdi_list, tmp_dom_info *w,
                              ir_node *succ_block)
 {
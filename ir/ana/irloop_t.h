@@ -107,7 +107,7 @@ static inline unsigned _get_loop_depth(const ir_loop *loop)
 /* Uses temporary information to get the loop */
 static inline ir_loop *_get_irn_loop(const ir_node *n)
 {
-	return n->loop;
+	return n->cold->loop;
 }
 
 #endif
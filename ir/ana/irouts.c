@@ -20,20 +20,20 @@
 
 unsigned get_irn_n_outs(const ir_node *node)
 {
-	return node->o.out->n_edges;
+	return node->cold->o.out->n_edges;
 }
 
 ir_node *get_irn_out(const ir_node *def, unsigned pos)
 {
 	assert(pos < get_irn_n_outs(def));
-	return def->o.out->edges[pos].use;
+	return def->cold->o.out->edges[pos].use;
 }
 
 ir_node *get_irn_out_ex(const ir_node *def, unsigned pos, int *in_pos)
 {
 	assert(pos < get_irn_n_outs(def));
-	*in_pos = def->o.out->edges[pos].pos;
-	return def->o.out->edges[pos].use;
+	*in_pos = def->cold->o.out->edges[pos].pos;
+	return def->cold->o.out->edges[pos].use;
 }
 
 unsigned get_Block_n_cfg_outs(const ir_node *bl)
@@ -234,13 +234,13 @@ static void count_outs_node(ir_node *n)
 		return;
 
 	/* initialize our counter */
-	n->o.n_outs = 0;
+	n->cold->o.n_outs = 0;
 
 	int start = is_Block(n) ? 0 : -1;
 	for (int i = start, irn_arity = get_irn_arity(n); i < irn_arity; ++i) {
 		ir_node *def = get_irn_n(n, i);
 		count_outs_node(def);
-		++def->o.n_outs;
+		++def->cold->o.n_outs;
 	}
 }
 
@@ -254,7 +254,7 @@ static void count_outs(ir_graph *irg)
 	foreach_irn_in(get_irg_anchor(irg), i, n) {
 		if (irn_visited_else_mark(n))
 			continue;
-		n->o.n_outs = 0;
+		n->cold->o.n_outs = 0;
 	}
 }
 
@@ -264,9 +264,9 @@ static void set_out_edges_node(ir_node *node, struct obstack *obst)
 		return;
 
 	/* Allocate my array */
-	unsigned n_outs = node->o.n_outs;
-	node->o.out          = OALLOCF(obst, ir_def_use_edges, edges, n_outs);
-	node->o.out->n_edges = 0;
+	unsigned n_outs = node->cold->o.n_outs;
+	node->cold->o.out          = OALLOCF(obst, ir_def_use_edges, edges, n_outs);
+	node->cold->o.out->n_edges = 0;
 
 	/* add def->use edges from my predecessors to me */
 	int start = is_Block(node) ? 0 : -1;
@@ -277,9 +277,9 @@ static void set_out_edges_node(ir_node *node, struct obstack *obst)
 		set_out_edges_node(def, obst);
 
 		/* Remember this Def-Use edge */
-		unsigned pos = def->o.out->n_edges++;
-		def->o.out->edges[pos].use = node;
-		def->o.out->edges[pos].pos = i;
+		unsigned pos = def->cold->o.out->n_edges++;
+		def->cold->o.out->edges[pos].use = node;
+		def->cold->o.out->edges[pos].pos = i;
 	}
 }
 
@@ -294,8 +294,8 @@ static void set_out_edges(ir_graph *irg)
 	foreach_irn_in(get_irg_anchor(irg), i, n) {
 		if (irn_visited_else_mark(n))
 			continue;
-		n->o.out          = OALLOCF(obst, ir_def_use_edges, edges, 0);
-		n->o.out->n_edges = 0;
+		n->cold->o.out          = OALLOCF(obst, ir_def_use_edges, edges, 0);
+		n->cold->o.out->n_edges = 0;
 	}
 }
 
@@ -325,7 +325,7 @@ void assure_irg_outs(ir_graph *irg)
 static void reset_outs(ir_node *node, void *unused)
 {
 	(void)unused;
-	node->o.out = NULL;
+	node->cold->o.out = NULL;
 }
 #endif
 
@@ -11,6 +11,7 @@
 #include "amd64_bearch_t.h"
 
 #include "amd64_emitter.h"
+#include "amd64_encode.h"
 #include "amd64_finish.h"
 #include "amd64_new_nodes.h"
 #include "amd64_optimize.h"
@@ -600,7 +601,7 @@ int amd64_get_sp_change(ir_node *const node)
 /**
  * Called immediately before emit phase.
  */
-static void amd64_finish_and_emit(ir_graph *irg)
+static void amd64_finish_graph(ir_graph *irg)
 {
 	amd64_irg_data_t const *const irg_data = amd64_get_irg_data(irg);
 	bool                    const omit_fp  = irg_data->omit_fp;
@@ -633,15 +634,14 @@ static void amd64_finish_and_emit(ir_graph *irg)
 	amd64_simulate_graph_x87(irg);
 
 	amd64_peephole_optimization(irg);
-
-	/* emit code */
-	be_timer_push(T_EMIT);
-	amd64_emit_function(irg);
-	be_timer_pop(T_EMIT);
 }
 
 static void amd64_finish(void)
 {
+	if (amd64_constants != NULL) {
+		pmap_destroy(amd64_constants);
+		amd64_constants = NULL;
+	}
 	amd64_free_opcodes();
 }
 
@@ -652,6 +652,43 @@ static const regalloc_if_t amd64_regalloc_if = {
 	.new_reload  = amd64_new_reload,
 };
 
+static bool lower_for_emit(ir_graph *const irg, const unsigned *const sp_is_non_ssa)
+{
+	if (!be_step_first(irg))
+		return false;
+
+	struct obstack *obst = be_get_be_obst(irg);
+	be_birg_from_irg(irg)->isa_link = OALLOCZ(obst, amd64_irg_data_t);
+
+	be_birg_from_irg(irg)->non_ssa_regs = sp_is_non_ssa;
+	amd64_select_instructions(irg);
+
+	be_step_schedule(irg);
+
+	be_timer_push(T_RA_PREPARATION);
+	be_sched_fix_flags(irg, &amd64_reg_classes[CLASS_amd64_flags], NULL,
+	                   NULL, NULL);
+	be_timer_pop(T_RA_PREPARATION);
+
+	be_step_regalloc(irg, &amd64_regalloc_if);
+
+	amd64_finish_graph(irg);
+	return true;
+}
+
+static void amd64_compile_graph(ir_graph *const irg, void *const data)
+{
+	unsigned const *const sp_is_non_ssa = (unsigned const*)data;
+	if (!lower_for_emit(irg, sp_is_non_ssa))
+		return;
+
+	be_timer_push(T_EMIT);
+	amd64_emit_function(irg);
+	be_timer_pop(T_EMIT);
+
+	be_step_last(irg);
+}
+
 static void amd64_generate_code(FILE *output, const char *cup_name)
 {
 	amd64_constants = pmap_create();
@@ -659,32 +696,33 @@ static void amd64_generate_code(FILE *output, const char *cup_name)
 	unsigned *const sp_is_non_ssa = rbitset_alloca(N_AMD64_REGISTERS);
 	rbitset_set(sp_is_non_ssa, REG_RSP);
 
-	foreach_irp_irg(i, irg) {
-		if (!be_step_first(irg))
-			continue;
-
-		struct obstack *obst = be_get_be_obst(irg);
-		be_birg_from_irg(irg)->isa_link = OALLOCZ(obst, amd64_irg_data_t);
-
-		be_birg_from_irg(irg)->non_ssa_regs = sp_is_non_ssa;
-		amd64_select_instructions(irg);
+	be_compile_graphs(amd64_compile_graph, sp_is_non_ssa);
 
-		be_step_schedule(irg);
+	be_finish();
+	pmap_destroy(amd64_constants);
+	amd64_constants = NULL;
+}
 
-		be_timer_push(T_RA_PREPARATION);
-		be_sched_fix_flags(irg, &amd64_reg_classes[CLASS_amd64_flags], NULL,
-		                   NULL, NULL);
-		be_timer_pop(T_RA_PREPARATION);
+static ir_jit_function_t *amd64_jit_compile(ir_jit_segment_t *const segment,
+                                            ir_graph *const irg)
+{
+	/* Constants are shared between all functions compiled until
+	 * amd64_finish(). */
+	if (amd64_constants == NULL)
+		amd64_constants = pmap_create();
 
-		be_step_regalloc(irg, &amd64_regalloc_if);
+	unsigned *const sp_is_non_ssa = rbitset_alloca(N_AMD64_REGISTERS);
+	rbitset_set(sp_is_non_ssa, REG_RSP);
 
-		amd64_finish_and_emit(irg);
+	if (!lower_for_emit(irg, sp_is_non_ssa))
+		return NULL;
 
-		be_step_last(irg);
-	}
+	be_timer_push(T_EMIT);
+	ir_jit_function_t *const res = amd64_emit_jit(segment, irg);
+	be_timer_pop(T_EMIT);
 
-	be_finish();
-	pmap_destroy(amd64_constants);
+	be_step_last(irg);
+	return res;
 }
 
 static const ir_settings_arch_dep_t amd64_arch_dep = {
@@ -768,6 +806,41 @@ static void amd64_init_types(void)
 	ir_platform.va_list_type = amd64_build_va_list_type();
 }
 
+/** SSE2 has packed operations for both float modes and for some integer
+ * element sizes. Only 128 bit vectors are supported: 256 bit AVX2 vectors
+ * need VEX encodings, ymm registers with their own spill slots and
+ * vzeroupper at calls, which the backend does not have yet. */
+static bool amd64_vector_op_supported(ir_op const *const op,
+                                      ir_mode const *const mode)
+{
+	if (get_mode_size_bits(mode) != 128)
+		return false;
+	ir_mode *const element_mode = get_vector_element_mode(mode);
+	bool     const is_float     = mode_is_float(element_mode);
+	if (is_float && get_mode_size_bits(element_mode) > 64)
+		return false;
+
+	switch (get_op_code(op)) {
+	case iro_Add:
+	case iro_Load:
+	case iro_Pack:
+	case iro_Phi:
+	case iro_Store:
+	case iro_Sub:
+		return true;
+	case iro_And:
+	case iro_Eor:
+	case iro_Or:
+		return !is_float;
+	case iro_Div:
+		return is_float;
+	case iro_Mul:
+		return is_float || get_mode_size_bits(element_mode) == 16;
+	default:
+		return false;
+	}
+}
+
 static void amd64_init(void)
 {
 	amd64_init_types();
@@ -779,6 +852,8 @@ static void amd64_init(void)
 	ir_target.experimental = "the amd64 backend is experimental and unfinished (consider the ia32 backend)";
 	ir_target.fast_unaligned_memaccess = true;
 	ir_target.float_int_overflow       = ir_overflow_indefinite;
+	ir_target.vector_size              = 16;
+	ir_target.vector_op_supported      = amd64_vector_op_supported;
 }
 
 static unsigned amd64_get_op_estimated_cost(const ir_node *node)
@@ -823,6 +898,9 @@ arch_isa_if_t const amd64_isa_if = {
 	.init                  = amd64_init,
 	.finish                = amd64_finish,
 	.generate_code         = amd64_generate_code,
+	.jit_compile           = amd64_jit_compile,
+	.emit_function         = amd64_emit_jit_function,
+	.elf_target            = &amd64_elf_target,
 	.lower_for_target      = amd64_lower_for_target,
 	.additional_reg_names  = amd64_additional_reg_names,
 	.handle_intrinsics     = amd64_handle_intrinsics,
@@ -30,9 +30,9 @@
 #include "platform_t.h"
 #include <inttypes.h>
 
-static bool omit_fp;
-static int  frame_type_size;
-static int  callframe_offset;
+static THREAD_LOCAL bool omit_fp;
+static THREAD_LOCAL int  frame_type_size;
+static THREAD_LOCAL int  callframe_offset;
 
 static char get_gp_size_suffix(x86_insn_size_t const size)
 {
@@ -72,6 +72,20 @@ static void amd64_emit_xmm_size_suffix(x86_insn_size_t const size)
 	be_emit_char(get_xmm_size_suffix(size));
 }
 
+static char get_vector_element_suffix(x86_insn_size_t const size)
+{
+	switch (size) {
+	case X86_SIZE_8:  return 'b';
+	case X86_SIZE_16: return 'w';
+	case X86_SIZE_32: return 'd';
+	case X86_SIZE_64: return 'q';
+	case X86_SIZE_80:
+	case X86_SIZE_128:
+		break;
+	}
+	panic("invalid insn mode");
+}
+
 static char get_x87_size_suffix(x86_insn_size_t const size)
 {
 	switch (size) {
@@ -477,6 +491,9 @@ emit_R:
 				if (*fmt == 'X') {
 					++fmt;
 					amd64_emit_xmm_size_suffix(attr->size);
+				} else if (*fmt == 'P') {
+					++fmt;
+					be_emit_char(get_vector_element_suffix(attr->size));
 				} else {
 					amd64_emit_insn_size_suffix(attr->size);
 				}
@@ -868,7 +885,10 @@ void amd64_emit_function(ir_graph *irg)
 		be_dwarf_callframe_spilloffset(&amd64_registers[REG_RBP], -16);
 	}
 
+	size_t const n_hot = be_emit_init_cold_part(irg, blk_sched);
 	for (size_t i = 0, n = ARR_LEN(blk_sched); i < n; ++i) {
+		if (i == n_hot)
+			be_gas_begin_cold_part(entity);
 		ir_node *block = blk_sched[i];
 		amd64_gen_block(block);
 	}
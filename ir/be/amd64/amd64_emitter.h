@@ -10,6 +10,7 @@
 #ifndef FIRM_BE_AMD64_AMD64_EMITTER_H
 #define FIRM_BE_AMD64_AMD64_EMITTER_H
 
+#include "amd64_encode.h"
 #include "firm_types.h"
 
 /**
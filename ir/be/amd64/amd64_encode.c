@@ -0,0 +1,1718 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       amd64 binary encoding/emission
+ */
+#include "amd64_encode.h"
+
+#include "amd64_bearch_t.h"
+#include "amd64_emitter.h"
+#include "amd64_new_nodes.h"
+#include "array.h"
+#include "bearch.h"
+#include "beblocksched.h"
+#include "beemithlp.h"
+#include "begnuas.h"
+#include "beelf.h"
+#include "bejit.h"
+#include "besched.h"
+#include "bitfiddle.h"
+#include "entity_t.h"
+#include "gen_amd64_emitter.h"
+#include "gen_amd64_regalloc_if.h"
+#include "irnodehashmap.h"
+#include "panic.h"
+#include "platform_t.h"
+#include "pmap.h"
+#include "tv.h"
+#include "util.h"
+#include <stdint.h>
+#include <string.h>
+
+typedef enum local_fragment_kind_t {
+	LOCAL_JUMP_TABLE, /**< jump table of a switch */
+	LOCAL_CONSTANT,   /**< constant with a tarval initializer */
+	LOCAL_STUB,       /**< jmp *slot(%rip) followed by the 64bit slot */
+} local_fragment_kind_t;
+
+/**
+ * Data emitted behind the code of the function because it has no address
+ * outside of it.
+ */
+typedef struct local_fragment_t {
+	local_fragment_kind_t kind;
+	ir_entity            *entity;
+	ir_node const        *node;   /**< the switch for jump tables */
+} local_fragment_t;
+
+static THREAD_LOCAL ir_nodehashmap_t  block_fragmentnum;
+static THREAD_LOCAL pmap             *data_fragmentnum;
+static THREAD_LOCAL pmap             *stub_fragmentnum;
+static THREAD_LOCAL local_fragment_t *local_fragments;
+static THREAD_LOCAL unsigned          n_block_fragments;
+
+enum OpSize {
+	OP_8          = 0x00, /* 8bit operation. */
+	OP_16_32      = 0x01, /* 16/32/64bit operation. */
+	OP_MEM_SRC    = 0x02, /* The memory operand is in the source position. */
+	OP_16_32_IMM8 = 0x03, /* 16/32/64bit operation with sign extended 8bit immediate. */
+	OP_EAX        = 0x04, /* Short form of instruction with al/ax/eax/rax as operand. */
+};
+
+/** The mod encoding of the ModR/M */
+enum Mod {
+	MOD_IND          = 0x00, /**< [reg1] */
+	MOD_IND_BYTE_OFS = 0x40, /**< [reg1 + byte ofs] */
+	MOD_IND_WORD_OFS = 0x80, /**< [reg1 + word ofs] */
+	MOD_REG          = 0xC0  /**< reg1 */
+};
+
+typedef enum enc_flags_t {
+	ENC_NONE     = 0,
+	ENC_W        = 1U << 0, /**< 64bit operand size (REX.W) */
+	ENC_BYTE_REG = 1U << 1, /**< the reg field is an 8bit register */
+	ENC_BYTE_RM  = 1U << 2, /**< the r/m field is an 8bit register */
+} enc_flags_t;
+ENUM_BITSET(enc_flags_t)
+
+/** create R/M encoding for ModR/M */
+static uint8_t ENC_RM(unsigned const regnum)
+{
+	return regnum & 0x07;
+}
+
+/** create REG encoding for ModR/M */
+static uint8_t ENC_REG(unsigned const regnum)
+{
+	return (regnum & 0x07) << 3;
+}
+
+/** create encoding for a SIB byte */
+static uint8_t ENC_SIB(uint8_t scale, uint8_t index, uint8_t base)
+{
+	return scale << 6 | (index & 0x07) << 3 | (base & 0x07);
+}
+
+static bool is_8bit_val(int64_t const val)
+{
+	return -128 <= val && val < 128;
+}
+
+static bool is_8bit_imm(x86_imm32_t const *const imm)
+{
+	return !imm->entity && is_8bit_val(imm->offset);
+}
+
+/** Returns the encoding for a condition code. */
+static uint8_t cc2enc(x86_condition_code_t const cc)
+{
+	return cc & 0x0F;
+}
+
+static uint8_t size_prefix(x86_insn_size_t const size)
+{
+	return size == X86_SIZE_16 ? 0x66 : 0;
+}
+
+static enc_flags_t gp_flags(x86_insn_size_t const size)
+{
+	switch (size) {
+	case X86_SIZE_8:   return ENC_BYTE_RM;
+	case X86_SIZE_64:  return ENC_W;
+	case X86_SIZE_16:
+	case X86_SIZE_32:
+	case X86_SIZE_80:
+	case X86_SIZE_128: return ENC_NONE;
+	}
+	panic("invalid insn size");
+}
+
+static enc_flags_t byte_reg_flag(x86_insn_size_t const size)
+{
+	return size == X86_SIZE_8 ? ENC_BYTE_REG : ENC_NONE;
+}
+
+/** Number of bytes of an immediate of an instruction with size @p size. */
+static unsigned imm_bytes(x86_insn_size_t const size)
+{
+	switch (size) {
+	case X86_SIZE_8:  return 1;
+	case X86_SIZE_16: return 2;
+	case X86_SIZE_32:
+	case X86_SIZE_64: return 4;
+	case X86_SIZE_80:
+	case X86_SIZE_128:
+		break;
+	}
+	panic("invalid insn size");
+}
+
+/** Registers 4-7 are spl..dil with a REX prefix and ah..bh without one. */
+static bool needs_rex_for_byte(unsigned const regnum)
+{
+	return 4 <= regnum && regnum < 8;
+}
+
+static void enc_rex(enc_flags_t const flags, unsigned const reg,
+                    unsigned const index, unsigned const base)
+{
+	uint8_t rex = 0x40;
+	if (flags & ENC_W) rex |= 0x08;
+	if (reg   & 0x08)  rex |= 0x04;
+	if (index & 0x08)  rex |= 0x02;
+	if (base  & 0x08)  rex |= 0x01;
+	if (rex != 0x40
+	 || (flags & ENC_BYTE_REG && needs_rex_for_byte(reg))
+	 || (flags & ENC_BYTE_RM  && needs_rex_for_byte(base)))
+		be_emit8(rex);
+}
+
+static void enc_prefix(uint8_t const prefix)
+{
+	if (prefix != 0)
+		be_emit8(prefix);
+}
+
+/** Emit a one byte or a 0x0F escaped two byte opcode. */
+static void enc_opcode(unsigned const opcode)
+{
+	if (opcode > 0xFF)
+		be_emit8(opcode >> 8);
+	be_emit8(opcode);
+}
+
+/** Emit an opcode with the register number in the lower 3 bits. */
+static void enc_opcode_reg(uint8_t const prefix, enc_flags_t const flags,
+                           uint8_t const opcode, unsigned const reg)
+{
+	enc_prefix(prefix);
+	enc_rex(flags, 0, 0, reg);
+	be_emit8(opcode | ENC_RM(reg));
+}
+
+/**
+ * Emit an instruction with a register in the r/m field.
+ *
+ * @param reg  content of the reg field: a register or an opcode extension
+ */
+static void enc_rr(uint8_t const prefix, enc_flags_t const flags,
+                   unsigned const opcode, unsigned const reg, unsigned const rm)
+{
+	enc_prefix(prefix);
+	enc_rex(flags, reg, 0, rm);
+	enc_opcode(opcode);
+	be_emit8(MOD_REG | ENC_REG(reg) | ENC_RM(rm));
+}
+
+static unsigned new_local_fragment(local_fragment_kind_t const kind,
+                                   ir_entity *const entity,
+                                   ir_node const *const node)
+{
+	unsigned         const num      = n_block_fragments + ARR_LEN(local_fragments);
+	local_fragment_t const fragment = {
+		.kind   = kind,
+		.entity = entity,
+		.node   = node,
+	};
+	ARR_APP1(local_fragment_t, local_fragments, fragment);
+	return num;
+}
+
+static bool is_local_constant(ir_entity const *const entity)
+{
+	if (get_entity_kind(entity) != IR_ENTITY_NORMAL
+	 || be_jit_get_entity_addr(entity) != (void const*)-1
+	 || get_entity_visibility(entity) != ir_visibility_private
+	 || !(get_entity_linkage(entity) & IR_LINKAGE_CONSTANT))
+		return false;
+	ir_initializer_t const *const init = get_entity_initializer(entity);
+	return init && get_initializer_kind(init) == IR_INITIALIZER_TARVAL;
+}
+
+/**
+ * Returns the fragment containing @p entity, if the entity is emitted
+ * together with the function, 0 otherwise.
+ */
+static unsigned get_data_fragment(ir_entity *const entity)
+{
+	unsigned num = PTR_TO_INT(pmap_get(void, data_fragmentnum, entity));
+	if (num == 0 && is_local_constant(entity)) {
+		num = new_local_fragment(LOCAL_CONSTANT, entity, NULL);
+		pmap_insert(data_fragmentnum, entity, INT_TO_PTR(num));
+	}
+	return num;
+}
+
+/**
+ * Returns the stub fragment for @p entity. Calls and GOT references go
+ * through the stub, so the entity may be anywhere in the address space.
+ */
+static unsigned get_stub_fragment(ir_entity *const entity)
+{
+	unsigned num = PTR_TO_INT(pmap_get(void, stub_fragmentnum, entity));
+	if (num == 0) {
+		num = new_local_fragment(LOCAL_STUB, entity, NULL);
+		pmap_insert(stub_fragmentnum, entity, INT_TO_PTR(num));
+	}
+	return num;
+}
+
+/** Offset of the address slot in a stub. */
+#define STUB_SLOT_OFFSET 6
+
+static unsigned get_block_fragment(ir_node const *const block)
+{
+	return PTR_TO_INT(ir_nodehashmap_get(void, &block_fragmentnum, block));
+}
+
+/** Emit an absolute 32bit value or address. */
+static void enc_imm32(x86_imm32_t const *const imm)
+{
+	ir_entity *const entity = imm->entity;
+	int32_t    const offset = imm->offset;
+	if (entity == NULL) {
+		be_emit32(offset);
+		return;
+	}
+
+	if (imm->kind != X86_IMM_ADDR)
+		panic("unsupported relocation kind %s for %+F",
+		      x86_get_immediate_kind_str(imm->kind), entity);
+	unsigned const fragment_num = get_data_fragment(entity);
+	if (fragment_num != 0) {
+		be_emit_reloc_fragment(4, X86_IMM_ADDR, fragment_num, offset);
+	} else {
+		be_emit_reloc_entity(4, X86_IMM_ADDR, entity, offset);
+	}
+}
+
+/**
+ * Emit a displacement relative to the end of the instruction. @p imm_size is
+ * the number of immediate bytes following the displacement.
+ */
+static void enc_pcrel32(x86_imm32_t const *const imm, unsigned const imm_size)
+{
+	ir_entity *const entity = imm->entity;
+	int32_t    const offset = imm->offset - 4 - (int32_t)imm_size;
+	if (entity == NULL) {
+		be_emit32(imm->offset);
+		return;
+	}
+
+	switch ((x86_immediate_kind_t)imm->kind) {
+	case X86_IMM_ADDR:
+	case X86_IMM_PCREL: {
+		unsigned const fragment_num = get_data_fragment(entity);
+		if (fragment_num != 0) {
+			be_emit_reloc_fragment(4, X86_IMM_PCREL, fragment_num, offset);
+		} else {
+			be_emit_reloc_entity(4, X86_IMM_PCREL, entity, offset);
+		}
+		return;
+	}
+	case X86_IMM_GOTPCREL: {
+		if (be_jit_is_relocatable()) {
+			be_emit_reloc_entity(4, X86_IMM_GOTPCREL, entity, offset);
+			return;
+		}
+		/* The slot of the stub serves as GOT entry. */
+		unsigned const fragment_num = get_stub_fragment(entity);
+		be_emit_reloc_fragment(4, X86_IMM_PCREL, fragment_num,
+		                       offset + STUB_SLOT_OFFSET);
+		return;
+	}
+	default:
+		break;
+	}
+	panic("unsupported relocation kind %s for %+F",
+	      x86_get_immediate_kind_str(imm->kind), entity);
+}
+
+static void enc_imm(x86_imm32_t const *const imm, x86_insn_size_t const size)
+{
+	switch (size) {
+	case X86_SIZE_8:  be_emit8(imm->offset);  return;
+	case X86_SIZE_16: be_emit16(imm->offset); return;
+	case X86_SIZE_32:
+	case X86_SIZE_64: enc_imm32(imm);         return;
+	case X86_SIZE_80:
+	case X86_SIZE_128:
+		break;
+	}
+	panic("invalid insn size");
+}
+
+static void enc_segment(x86_segment_selector_t const segment)
+{
+	switch (segment) {
+	case X86_SEGMENT_DEFAULT:                 return;
+	case X86_SEGMENT_CS:      be_emit8(0x2E); return;
+	case X86_SEGMENT_SS:      be_emit8(0x36); return;
+	case X86_SEGMENT_DS:      be_emit8(0x3E); return;
+	case X86_SEGMENT_ES:      be_emit8(0x26); return;
+	case X86_SEGMENT_FS:      be_emit8(0x64); return;
+	case X86_SEGMENT_GS:      be_emit8(0x65); return;
+	}
+	panic("invalid segment");
+}
+
+static unsigned get_addr_reg(ir_node const *const node, unsigned const pos)
+{
+	return arch_get_irn_register_in(node, pos)->encoding;
+}
+
+/**
+ * Emit the ModR/M byte, SIB byte and displacement of an address mode.
+ *
+ * @param reg       content of the reg field: a register or an opcode extension
+ * @param imm_size  number of immediate bytes following the address
+ */
+static void enc_mod_am(unsigned const reg, ir_node const *const node,
+                       x86_addr_t const *const addr, unsigned const imm_size)
+{
+	x86_imm32_t const *const imm = &addr->immediate;
+	switch ((x86_addr_variant_t)addr->variant) {
+	case X86_ADDR_JUST_IMM:
+		if (imm->entity != NULL && get_data_fragment(imm->entity) != 0) {
+			/* Data emitted with the function is addressed relative to the
+			 * instruction pointer, so the code may be loaded anywhere. */
+			goto rip_relative;
+		}
+		/* Use a SIB byte without base and index, as the plain disp32
+		 * encoding is instruction pointer relative in 64bit mode. */
+		be_emit8(MOD_IND | ENC_REG(reg) | ENC_RM(0x04));
+		be_emit8(ENC_SIB(0, 0x04, 0x05));
+		enc_imm32(imm);
+		return;
+
+	case X86_ADDR_RIP:
+rip_relative:
+		be_emit8(MOD_IND | ENC_REG(reg) | ENC_RM(0x05));
+		enc_pcrel32(imm, imm_size);
+		return;
+
+	case X86_ADDR_INDEX: {
+		unsigned const index = get_addr_reg(node, addr->index_input);
+		be_emit8(MOD_IND | ENC_REG(reg) | ENC_RM(0x04));
+		be_emit8(ENC_SIB(addr->log_scale, index, 0x05));
+		enc_imm32(imm);
+		return;
+	}
+
+	case X86_ADDR_BASE:
+	case X86_ADDR_BASE_INDEX: {
+		unsigned const base = get_addr_reg(node, addr->base_input);
+
+		/* set the mod part depending on displacement */
+		unsigned mod;
+		if (imm->entity != NULL) {
+			mod = MOD_IND_WORD_OFS;
+		} else if (imm->offset == 0 && ENC_RM(base) != 0x05) {
+			/* rbp/r13 without offset is the encoding for rip relative
+			 * addressing or no base. */
+			mod = MOD_IND;
+		} else if (is_8bit_val(imm->offset)) {
+			mod = MOD_IND_BYTE_OFS;
+		} else {
+			mod = MOD_IND_WORD_OFS;
+		}
+
+		if (addr->variant == X86_ADDR_BASE_INDEX) {
+			unsigned const index = get_addr_reg(node, addr->index_input);
+			be_emit8(mod | ENC_REG(reg) | ENC_RM(0x04));
+			be_emit8(ENC_SIB(addr->log_scale, index, base));
+		} else if (ENC_RM(base) == 0x04) {
+			/* rsp/r12 as base needs a SIB byte, index rsp means no index. */
+			be_emit8(mod | ENC_REG(reg) | ENC_RM(0x04));
+			be_emit8(ENC_SIB(0, 0x04, base));
+		} else {
+			be_emit8(mod | ENC_REG(reg) | ENC_RM(base));
+		}
+
+		/* emit displacement */
+		if (mod == MOD_IND_BYTE_OFS) {
+			be_emit8(imm->offset);
+		} else if (mod == MOD_IND_WORD_OFS) {
+			enc_imm32(imm);
+		}
+		return;
+	}
+
+	case X86_ADDR_INVALID:
+	case X86_ADDR_REG:
+		break;
+	}
+	panic("invalid address mode variant");
+}
+
+/**
+ * Emit an instruction with a memory operand.
+ *
+ * @param reg       content of the reg field: a register or an opcode extension
+ * @param imm_size  number of immediate bytes following the address
+ */
+static void enc_am(uint8_t const prefix, enc_flags_t const flags,
+                   unsigned const opcode, unsigned const reg,
+                   ir_node const *const node, x86_addr_t const *const addr,
+                   unsigned const imm_size)
+{
+	enc_segment((x86_segment_selector_t)addr->segment);
+	enc_prefix(prefix);
+
+	x86_addr_variant_t const variant = (x86_addr_variant_t)addr->variant;
+	unsigned const base  = x86_addr_variant_has_base(variant)
+		? get_addr_reg(node, addr->base_input) : 0;
+	unsigned const index = x86_addr_variant_has_index(variant)
+		? get_addr_reg(node, addr->index_input) : 0;
+	enc_rex(flags & ~ENC_BYTE_RM, reg, index, base);
+	enc_opcode(opcode);
+	enc_mod_am(reg, node, addr, imm_size);
+}
+
+/**
+ * Emit an instruction whose r/m operand is the register or memory operand
+ * of @p node (%AM in the emitter).
+ */
+static void enc_op_am(ir_node const *const node, uint8_t const prefix,
+                      enc_flags_t const flags, unsigned const opcode,
+                      unsigned const reg)
+{
+	amd64_addr_attr_t const *const attr = get_amd64_addr_attr_const(node);
+	switch ((amd64_op_mode_t)attr->base.op_mode) {
+	case AMD64_OP_REG: {
+		unsigned const rm = get_addr_reg(node, attr->addr.base_input);
+		enc_rr(prefix, flags, opcode, reg, rm);
+		return;
+	}
+	case AMD64_OP_ADDR:
+	case AMD64_OP_X87_ADDR_REG:
+		enc_am(prefix, flags, opcode, reg, node, &attr->addr, 0);
+		return;
+	default:
+		break;
+	}
+	panic("invalid op_mode for %+F", node);
+}
+
+static unsigned get_out_reg(ir_node const *const node, unsigned const pos)
+{
+	return arch_get_irn_register_out(node, pos)->encoding;
+}
+
+void amd64_enc_simple(uint8_t const opcode)
+{
+	be_emit8(opcode);
+}
+
+void amd64_enc_binop(ir_node const *const node, uint8_t const code)
+{
+	amd64_binop_addr_attr_t const *const attr
+		= get_amd64_binop_addr_attr_const(node);
+	x86_insn_size_t const size   = attr->base.base.size;
+	uint8_t         const prefix = size_prefix(size);
+	enc_flags_t     const flags  = gp_flags(size);
+	unsigned        const op     = size == X86_SIZE_8 ? OP_8 : OP_16_32;
+	x86_addr_t      const *const addr = &attr->base.addr;
+	switch ((amd64_op_mode_t)attr->base.base.op_mode) {
+	case AMD64_OP_REG_IMM: {
+		x86_imm32_t const *const imm = &attr->u.immediate;
+		unsigned           const reg = get_addr_reg(node, addr->base_input);
+		if (op != OP_8 && is_8bit_imm(imm)) {
+			/* Use the short form with 8bit sign extended immediate. */
+			enc_rr(prefix, flags, 0x80 | OP_16_32_IMM8, code, reg);
+			be_emit8(imm->offset);
+		} else if (reg == 0) {
+			enc_prefix(prefix);
+			enc_rex(flags, 0, 0, 0);
+			be_emit8(code << 3 | OP_EAX | op);
+			enc_imm(imm, size);
+		} else {
+			enc_rr(prefix, flags, 0x80 | op, code, reg);
+			enc_imm(imm, size);
+		}
+		return;
+	}
+	case AMD64_OP_REG_REG: {
+		unsigned const dst = get_addr_reg(node, addr->base_input);
+		unsigned const src = get_addr_reg(node, 1);
+		enc_rr(prefix, flags | byte_reg_flag(size), code << 3 | op, src, dst);
+		return;
+	}
+	case AMD64_OP_REG_ADDR: {
+		unsigned const reg = get_addr_reg(node, attr->u.reg_input);
+		enc_am(prefix, flags | byte_reg_flag(size),
+		       code << 3 | OP_MEM_SRC | op, reg, node, addr, 0);
+		return;
+	}
+	case AMD64_OP_ADDR_IMM: {
+		x86_imm32_t const *const imm = &attr->u.immediate;
+		if (op != OP_8 && is_8bit_imm(imm)) {
+			enc_am(prefix, flags, 0x80 | OP_16_32_IMM8, code, node, addr, 1);
+			be_emit8(imm->offset);
+		} else {
+			enc_am(prefix, flags, 0x80 | op, code, node, addr,
+			       imm_bytes(size));
+			enc_imm(imm, size);
+		}
+		return;
+	}
+	case AMD64_OP_ADDR_REG: {
+		unsigned const reg = get_addr_reg(node, attr->u.reg_input);
+		enc_am(prefix, flags | byte_reg_flag(size), code << 3 | op, reg, node,
+		       addr, 0);
+		return;
+	}
+	default:
+		break;
+	}
+	panic("invalid op_mode for %+F", node);
+}
+
+void amd64_enc_shiftop(ir_node const *const node, uint8_t const ext)
+{
+	amd64_shift_attr_t const *const attr   = get_amd64_shift_attr_const(node);
+	x86_insn_size_t           const size   = attr->base.size;
+	uint8_t                   const prefix = size_prefix(size);
+	enc_flags_t               const flags  = gp_flags(size);
+	unsigned                  const op     = size == X86_SIZE_8 ? OP_8 : OP_16_32;
+	unsigned                  const reg    = get_addr_reg(node, 0);
+	switch ((amd64_op_mode_t)attr->base.op_mode) {
+	case AMD64_OP_SHIFT_IMM:
+		if (attr->immediate == 1) {
+			enc_rr(prefix, flags, 0xD0 | op, ext, reg);
+		} else {
+			enc_rr(prefix, flags, 0xC0 | op, ext, reg);
+			be_emit8(attr->immediate);
+		}
+		return;
+	case AMD64_OP_SHIFT_REG:
+		enc_rr(prefix, flags, 0xD2 | op, ext, reg);
+		return;
+	default:
+		break;
+	}
+	panic("invalid op_mode for shiftop");
+}
+
+void amd64_enc_unop(ir_node const *const node, uint8_t const ext)
+{
+	x86_insn_size_t const size   = get_amd64_attr_const(node)->size;
+	unsigned        const opcode = size == X86_SIZE_8 ? 0xF6 : 0xF7;
+	enc_op_am(node, size_prefix(size), gp_flags(size), opcode, ext);
+}
+
+void amd64_enc_0f_unop_reg(ir_node const *const node, uint8_t const code)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	unsigned        const out  = get_out_reg(node, 0);
+	enc_op_am(node, size_prefix(size), gp_flags(size), 0x0F00 | code, out);
+}
+
+static void enc_cqto(ir_node const *const node)
+{
+	(void)node;
+	enc_rex(ENC_W, 0, 0, 0);
+	be_emit8(0x99);
+}
+
+static void enc_imul(ir_node const *const node)
+{
+	amd64_binop_addr_attr_t const *const attr
+		= get_amd64_binop_addr_attr_const(node);
+	x86_insn_size_t const size   = attr->base.base.size;
+	uint8_t         const prefix = size_prefix(size);
+	enc_flags_t     const flags  = gp_flags(size);
+	x86_addr_t      const *const addr = &attr->base.addr;
+	switch ((amd64_op_mode_t)attr->base.base.op_mode) {
+	case AMD64_OP_REG_IMM: {
+		x86_imm32_t const *const imm = &attr->u.immediate;
+		unsigned           const reg = get_addr_reg(node, addr->base_input);
+		if (is_8bit_imm(imm)) {
+			enc_rr(prefix, flags, 0x6B, reg, reg);
+			be_emit8(imm->offset);
+		} else {
+			enc_rr(prefix, flags, 0x69, reg, reg);
+			enc_imm(imm, size);
+		}
+		return;
+	}
+	case AMD64_OP_REG_REG: {
+		unsigned const dst = get_addr_reg(node, addr->base_input);
+		unsigned const src = get_addr_reg(node, 1);
+		enc_rr(prefix, flags, 0x0FAF, dst, src);
+		return;
+	}
+	case AMD64_OP_REG_ADDR: {
+		unsigned const reg = get_addr_reg(node, attr->u.reg_input);
+		enc_am(prefix, flags, 0x0FAF, reg, node, addr, 0);
+		return;
+	}
+	default:
+		break;
+	}
+	panic("invalid op_mode for %+F", node);
+}
+
+static void enc_test(ir_node const *const node)
+{
+	amd64_binop_addr_attr_t const *const attr
+		= get_amd64_binop_addr_attr_const(node);
+	x86_insn_size_t const size   = attr->base.base.size;
+	uint8_t         const prefix = size_prefix(size);
+	enc_flags_t     const flags  = gp_flags(size);
+	unsigned        const op     = size == X86_SIZE_8 ? OP_8 : OP_16_32;
+	x86_addr_t      const *const addr = &attr->base.addr;
+	switch ((amd64_op_mode_t)attr->base.base.op_mode) {
+	case AMD64_OP_REG_IMM: {
+		unsigned const reg = get_addr_reg(node, addr->base_input);
+		if (reg == 0) {
+			enc_prefix(prefix);
+			enc_rex(flags, 0, 0, 0);
+			be_emit8(0xA8 | op);
+		} else {
+			enc_rr(prefix, flags, 0xF6 | op, 0, reg);
+		}
+		enc_imm(&attr->u.immediate, size);
+		return;
+	}
+	case AMD64_OP_REG_REG: {
+		unsigned const dst = get_addr_reg(node, addr->base_input);
+		unsigned const src = get_addr_reg(node, 1);
+		enc_rr(prefix, flags | byte_reg_flag(size), 0x84 | op, src, dst);
+		return;
+	}
+	case AMD64_OP_REG_ADDR:
+	case AMD64_OP_ADDR_REG: {
+		unsigned const reg = get_addr_reg(node, attr->u.reg_input);
+		enc_am(prefix, flags | byte_reg_flag(size), 0x84 | op, reg, node, addr,
+		       0);
+		return;
+	}
+	case AMD64_OP_ADDR_IMM:
+		enc_am(prefix, flags, 0xF6 | op, 0, node, addr, imm_bytes(size));
+		enc_imm(&attr->u.immediate, size);
+		return;
+	default:
+		break;
+	}
+	panic("invalid op_mode for %+F", node);
+}
+
+static void enc_xor_0(ir_node const *const node)
+{
+	unsigned const out = get_out_reg(node, pn_amd64_xor_0_res);
+	enc_rr(0, ENC_NONE, 0x31, out, out); // xorl %out, %out
+}
+
+static void enc_mov_imm(ir_node const *const node)
+{
+	amd64_movimm_attr_t const *const attr = get_amd64_movimm_attr_const(node);
+	amd64_imm64_t       const *const imm  = &attr->immediate;
+	x86_insn_size_t            const size = attr->base.size;
+	unsigned                   const out  = get_out_reg(node, pn_amd64_mov_imm_res);
+	if (imm->kind == X86_IMM_ADDR) {
+		/* movabs works no matter where the entity ends up */
+		assert(size == X86_SIZE_64);
+		int32_t const offset = (int32_t)imm->offset;
+		if (offset != imm->offset)
+			panic("offset of %+F too large", imm->entity);
+		enc_opcode_reg(0, ENC_W, 0xB8, out);
+		be_emit_reloc_entity(8, AMD64_RELOCATION_ABS64, imm->entity, offset);
+		return;
+	} else if (imm->kind != X86_IMM_VALUE) {
+		panic("unsupported relocation kind %s for %+F",
+		      x86_get_immediate_kind_str(imm->kind), imm->entity);
+	}
+
+	int64_t const val = imm->offset;
+	switch (size) {
+	case X86_SIZE_8:
+		enc_opcode_reg(0, ENC_BYTE_RM, 0xB0, out);
+		be_emit8(val);
+		return;
+	case X86_SIZE_16:
+		enc_opcode_reg(0x66, ENC_NONE, 0xB8, out);
+		be_emit16(val);
+		return;
+	case X86_SIZE_32:
+		enc_opcode_reg(0, ENC_NONE, 0xB8, out);
+		be_emit32(val);
+		return;
+	case X86_SIZE_64:
+		if (val == (int32_t)val) {
+			enc_rr(0, ENC_W, 0xC7, 0, out);
+			be_emit32(val);
+		} else {
+			enc_opcode_reg(0, ENC_W, 0xB8, out);
+			be_emit32(val);
+			be_emit32((uint64_t)val >> 32);
+		}
+		return;
+	case X86_SIZE_80:
+	case X86_SIZE_128:
+		break;
+	}
+	panic("invalid insn size");
+}
+
+static void enc_movs(ir_node const *const node)
+{
+	unsigned opcode;
+	switch (get_amd64_attr_const(node)->size) {
+	case X86_SIZE_8:  opcode = 0x0FBE; break; // movsbq
+	case X86_SIZE_16: opcode = 0x0FBF; break; // movswq
+	case X86_SIZE_32: opcode = 0x63;   break; // movslq
+	default:
+		panic("invalid insn size");
+	}
+	enc_op_am(node, 0, ENC_W, opcode, get_out_reg(node, pn_amd64_movs_res));
+}
+
+static void enc_mov_gp(ir_node const *const node)
+{
+	unsigned const out = get_out_reg(node, pn_amd64_mov_gp_res);
+	switch (get_amd64_attr_const(node)->size) {
+	case X86_SIZE_8:  enc_op_am(node, 0, ENC_BYTE_RM, 0x0FB6, out); return;
+	case X86_SIZE_16: enc_op_am(node, 0, ENC_NONE,    0x0FB7, out); return;
+	case X86_SIZE_32: enc_op_am(node, 0, ENC_NONE,    0x8B,   out); return;
+	case X86_SIZE_64: enc_op_am(node, 0, ENC_W,       0x8B,   out); return;
+	case X86_SIZE_80:
+	case X86_SIZE_128:
+		break;
+	}
+	panic("invalid insn size");
+}
+
+static void enc_mov_store(ir_node const *const node)
+{
+	amd64_binop_addr_attr_t const *const attr
+		= get_amd64_binop_addr_attr_const(node);
+	x86_insn_size_t const size   = attr->base.base.size;
+	uint8_t         const prefix = size_prefix(size);
+	enc_flags_t     const flags  = gp_flags(size);
+	unsigned        const op     = size == X86_SIZE_8 ? OP_8 : OP_16_32;
+	x86_addr_t      const *const addr = &attr->base.addr;
+	switch ((amd64_op_mode_t)attr->base.base.op_mode) {
+	case AMD64_OP_ADDR_REG: {
+		unsigned const reg = get_addr_reg(node, attr->u.reg_input);
+		enc_am(prefix, flags | byte_reg_flag(size), 0x88 | op, reg, node, addr,
+		       0);
+		return;
+	}
+	case AMD64_OP_ADDR_IMM:
+		enc_am(prefix, flags, 0xC6 | op, 0, node, addr, imm_bytes(size));
+		enc_imm(&attr->u.immediate, size);
+		return;
+	default:
+		break;
+	}
+	panic("invalid op_mode for %+F", node);
+}
+
+static void enc_lea(ir_node const *const node)
+{
+	amd64_addr_attr_t const *const attr = get_amd64_addr_attr_const(node);
+	x86_insn_size_t          const size = attr->base.size;
+	unsigned                 const out  = get_out_reg(node, pn_amd64_lea_res);
+	enc_am(size_prefix(size), gp_flags(size), 0x8D, out, node, &attr->addr, 0);
+}
+
+static void enc_setcc(ir_node const *const node)
+{
+	x86_condition_code_t const cc  = get_amd64_cc_attr_const(node)->cc;
+	unsigned             const out = get_out_reg(node, pn_amd64_setcc_res);
+	enc_rr(0, ENC_BYTE_RM, 0x0F90 | cc2enc(cc), 0, out);
+}
+
+static void enc_cmpxchg(ir_node const *const node)
+{
+	amd64_binop_addr_attr_t const *const attr
+		= get_amd64_binop_addr_attr_const(node);
+	x86_insn_size_t const size = attr->base.base.size;
+	unsigned        const op   = size == X86_SIZE_8 ? OP_8 : OP_16_32;
+	unsigned        const reg  = get_addr_reg(node, attr->u.reg_input);
+	assert(attr->base.base.op_mode == AMD64_OP_ADDR_REG);
+	be_emit8(0xF0); // lock
+	enc_am(size_prefix(size), gp_flags(size) | byte_reg_flag(size),
+	       0x0FB0 | op, reg, node, &attr->base.addr, 0);
+}
+
+static void enc_push_am(ir_node const *const node)
+{
+	amd64_addr_attr_t const *const attr = get_amd64_addr_attr_const(node);
+	enc_am(0, ENC_NONE, 0xFF, 6, node, &attr->addr, 0);
+}
+
+static void enc_push_reg(ir_node const *const node)
+{
+	unsigned const reg = get_addr_reg(node, n_amd64_push_reg_val);
+	enc_opcode_reg(0, ENC_NONE, 0x50, reg);
+}
+
+static void enc_pop_am(ir_node const *const node)
+{
+	amd64_addr_attr_t const *const attr = get_amd64_addr_attr_const(node);
+	enc_am(0, ENC_NONE, 0x8F, 0, node, &attr->addr, 0);
+}
+
+static void enc_mov(unsigned const src, unsigned const dst)
+{
+	enc_rr(0, ENC_W, 0x89, src, dst); // movq %src, %dst
+}
+
+static void enc_sub_sp(ir_node const *const node)
+{
+	/* subq %in, %rsp */
+	amd64_enc_binop(node, 5);
+	/* movq %rsp, %addr */
+	enc_mov(amd64_registers[REG_RSP].encoding,
+	        get_out_reg(node, pn_amd64_sub_sp_addr));
+}
+
+static void enc_ijmp(ir_node const *const node)
+{
+	enc_op_am(node, 0, ENC_NONE, 0xFF, 4);
+}
+
+static void enc_call(ir_node const *const node)
+{
+	amd64_addr_attr_t const *const attr = get_amd64_addr_attr_const(node);
+	if (attr->base.op_mode == AMD64_OP_IMM32) {
+		x86_imm32_t const *const imm = &attr->addr.immediate;
+		if (imm->entity == NULL || imm->offset != 0)
+			panic("unsupported call target in %+F", node);
+		be_emit8(0xE8);
+		if (be_jit_is_relocatable()) {
+			be_emit_reloc_entity(4, X86_IMM_PCREL, imm->entity, -4);
+			return;
+		}
+		/* call the stub, which jumps to the real destination */
+		be_emit_reloc_fragment(4, X86_IMM_PCREL,
+		                       get_stub_fragment(imm->entity), -4);
+	} else {
+		enc_op_am(node, 0, ENC_NONE, 0xFF, 2);
+	}
+}
+
+static void enc_jmp(ir_node const *const cfop)
+{
+	ir_node const *const dest_block = be_emit_get_cfop_target(cfop);
+	be_emit_reloc_jump(AMD64_RELOCATION_JMP8, 2, AMD64_RELOCATION_JMP32, 5,
+	                   get_block_fragment(dest_block));
+}
+
+static void enc_jump(ir_node const *const node)
+{
+	if (!be_is_fallthrough(node))
+		enc_jmp(node);
+}
+
+static void enc_jcc(x86_condition_code_t const cc, ir_node const *const cfop)
+{
+	ir_node const *const dest_block = be_emit_get_cfop_target(cfop);
+	uint8_t        const enc        = cc2enc(cc);
+	be_emit_reloc_jump(AMD64_RELOCATION_JCC8 | enc, 2,
+	                   AMD64_RELOCATION_JCC32 | enc, 6,
+	                   get_block_fragment(dest_block));
+}
+
+static x86_condition_code_t determine_final_cc(ir_node const *const flags,
+                                               x86_condition_code_t cc)
+{
+	if (is_amd64_fucomi(flags)) {
+		amd64_x87_attr_t const *const attr = get_amd64_x87_attr_const(flags);
+		if (attr->x87.reverse)
+			cc = x86_invert_condition_code(cc);
+	}
+	return cc;
+}
+
+static void enc_amd64_jcc(ir_node const *const node)
+{
+	ir_node         const *const flags = get_irn_n(node, n_amd64_jcc_flags);
+	amd64_cc_attr_t const *const attr  = get_amd64_cc_attr_const(node);
+	x86_condition_code_t         cc    = determine_final_cc(flags, attr->cc);
+
+	be_cond_branch_projs_t projs = be_get_cond_branch_projs(node);
+
+	if (be_is_fallthrough(projs.t)) {
+		/* exchange both proj's so the second one can be omitted */
+		ir_node *const t = projs.t;
+		projs.t = projs.f;
+		projs.f = t;
+		cc      = x86_negate_condition_code(cc);
+	}
+
+	if (cc & x86_cc_float_parity_cases) {
+		/* Some floating point comparisons require a test of the parity flag,
+		 * which indicates that the result is unordered */
+		if (cc & x86_cc_negated) {
+			enc_jcc(x86_cc_parity, projs.t);
+		} else {
+			enc_jcc(x86_cc_parity, projs.f);
+		}
+	}
+
+	enc_jcc(cc, projs.t);
+	enc_jump(projs.f);
+}
+
+static void enc_jmp_switch(ir_node const *const node)
+{
+	/* The table itself was assigned a fragment in assign_local_fragments()
+	 * and is emitted behind the code. */
+	enc_op_am(node, 0, ENC_NONE, 0xFF, 4);
+}
+
+/**
+ * Emit movsb/w/d instructions to make the copy size divisible by 8.
+ */
+static void enc_copyB_prolog(unsigned const size)
+{
+	if (size & 1)
+		be_emit8(0xA4); // movsb
+	if (size & 2) {
+		be_emit8(0x66);
+		be_emit8(0xA5); // movsw
+	}
+	if (size & 4)
+		be_emit8(0xA5); // movsd
+}
+
+static void enc_copyB(ir_node const *const node)
+{
+	unsigned const size = get_amd64_copyb_attr_const(node)->size;
+	enc_copyB_prolog(size);
+	be_emit8(0xF3); // rep movsd
+	be_emit8(0xA5);
+}
+
+static void enc_copyB_i(ir_node const *const node)
+{
+	unsigned size = get_amd64_copyb_attr_const(node)->size;
+	enc_copyB_prolog(size);
+	size >>= 3;
+	while (size--) {
+		enc_rex(ENC_W, 0, 0, 0); // movsq
+		be_emit8(0xA5);
+	}
+}
+
+void amd64_enc_xmm_binop(ir_node const *const node, uint8_t const prefix,
+                         uint8_t const code)
+{
+	amd64_binop_addr_attr_t const *const attr
+		= get_amd64_binop_addr_attr_const(node);
+	x86_addr_t const *const addr = &attr->base.addr;
+	switch ((amd64_op_mode_t)attr->base.base.op_mode) {
+	case AMD64_OP_REG_REG: {
+		unsigned const dst = get_addr_reg(node, addr->base_input);
+		unsigned const src = get_addr_reg(node, 1);
+		enc_rr(prefix, ENC_NONE, 0x0F00 | code, dst, src);
+		return;
+	}
+	case AMD64_OP_REG_ADDR: {
+		unsigned const reg = get_addr_reg(node, attr->u.reg_input);
+		enc_am(prefix, ENC_NONE, 0x0F00 | code, reg, node, addr, 0);
+		return;
+	}
+	default:
+		break;
+	}
+	panic("invalid op_mode for %+F", node);
+}
+
+/** Prefix selecting the single (ss) or double (sd) precision variant. */
+static uint8_t xmm_scalar_prefix(x86_insn_size_t const size)
+{
+	switch (size) {
+	case X86_SIZE_32: return 0xF3;
+	case X86_SIZE_64: return 0xF2;
+	default:          break;
+	}
+	panic("invalid insn size");
+}
+
+/** Prefix selecting the single (ps) or double (pd) precision variant. */
+static uint8_t xmm_packed_prefix(x86_insn_size_t const size)
+{
+	switch (size) {
+	case X86_SIZE_32: return 0;
+	case X86_SIZE_64: return 0x66;
+	default:          break;
+	}
+	panic("invalid insn size");
+}
+
+void amd64_enc_xmm_scalar_binop(ir_node const *const node, uint8_t const code)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	amd64_enc_xmm_binop(node, xmm_scalar_prefix(size), code);
+}
+
+void amd64_enc_xmm_packed_binop(ir_node const *const node, uint8_t const code)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	amd64_enc_xmm_binop(node, xmm_packed_prefix(size), code);
+}
+
+/**
+ * Encode a packed integer operation. The byte, word and dword variants use
+ * consecutive opcodes starting at @p code, the qword variant uses @p code_64.
+ */
+void amd64_enc_xmm_element_binop(ir_node const *const node, uint8_t const code,
+                                 uint8_t const code_64)
+{
+	uint8_t op;
+	switch (get_amd64_attr_const(node)->size) {
+	case X86_SIZE_8:  op = code;     break;
+	case X86_SIZE_16: op = code + 1; break;
+	case X86_SIZE_32: op = code + 2; break;
+	case X86_SIZE_64: op = code_64;  break;
+	default:          panic("invalid insn size");
+	}
+	amd64_enc_xmm_binop(node, 0x66, op);
+}
+
+/** Encode an instruction loading the %AM operand into output register 0. */
+static void enc_xmm_load(ir_node const *const node, uint8_t const prefix,
+                         enc_flags_t const flags, uint8_t const code)
+{
+	enc_op_am(node, prefix, flags, 0x0F00 | code, get_out_reg(node, 0));
+}
+
+/** Encode an instruction storing input register 0 to the address. */
+static void enc_xmm_store(ir_node const *const node, uint8_t const prefix,
+                          uint8_t const code)
+{
+	amd64_addr_attr_t const *const attr = get_amd64_addr_attr_const(node);
+	unsigned                 const reg  = get_addr_reg(node, 0);
+	enc_am(prefix, ENC_NONE, 0x0F00 | code, reg, node, &attr->addr, 0);
+}
+
+static void enc_movs_xmm(ir_node const *const node)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	enc_xmm_load(node, xmm_scalar_prefix(size), ENC_NONE, 0x10);
+}
+
+static void enc_movs_store_xmm(ir_node const *const node)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	enc_xmm_store(node, xmm_scalar_prefix(size), 0x11);
+}
+
+static void enc_xorp_0(ir_node const *const node)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	unsigned        const out  = get_out_reg(node, pn_amd64_xorp_0_res);
+	enc_rr(xmm_packed_prefix(size), ENC_NONE, 0x0F57, out, out);
+}
+
+static void enc_pxor_0(ir_node const *const node)
+{
+	unsigned const out = get_out_reg(node, pn_amd64_pxor_0_res);
+	enc_rr(0x66, ENC_NONE, 0x0FEF, out, out);
+}
+
+static void enc_movd_xmm_gp(ir_node const *const node)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	unsigned        const in   = get_addr_reg(node, n_amd64_movd_xmm_gp_operand);
+	unsigned        const out  = get_out_reg(node, pn_amd64_movd_xmm_gp_res);
+	enc_rr(0x66, gp_flags(size), 0x0F7E, in, out);
+}
+
+static void enc_movd_gp_xmm(ir_node const *const node)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	unsigned        const in   = get_addr_reg(node, n_amd64_movd_gp_xmm_operand);
+	unsigned        const out  = get_out_reg(node, pn_amd64_movd_gp_xmm_res);
+	enc_rr(0x66, gp_flags(size), 0x0F6E, out, in);
+}
+
+static void enc_movd(ir_node const *const node)
+{
+	if (get_amd64_attr_const(node)->op_mode == AMD64_OP_REG) {
+		enc_xmm_load(node, 0x66, ENC_W, 0x6E); // movq %gp, %xmm
+	} else {
+		enc_xmm_load(node, 0xF3, ENC_NONE, 0x7E); // movq mem, %xmm
+	}
+}
+
+static void enc_cvtss2sd(ir_node const *const node)
+{
+	enc_xmm_load(node, 0xF3, ENC_NONE, 0x5A);
+}
+
+static void enc_cvtsd2ss(ir_node const *const node)
+{
+	enc_xmm_load(node, 0xF2, ENC_NONE, 0x5A);
+}
+
+static void enc_cvttsd2si(ir_node const *const node)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	enc_xmm_load(node, 0xF2, gp_flags(size), 0x2C);
+}
+
+static void enc_cvttss2si(ir_node const *const node)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	enc_xmm_load(node, 0xF3, gp_flags(size), 0x2C);
+}
+
+static void enc_cvtsi2ss(ir_node const *const node)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	enc_xmm_load(node, 0xF3, gp_flags(size), 0x2A);
+}
+
+static void enc_cvtsi2sd(ir_node const *const node)
+{
+	x86_insn_size_t const size = get_amd64_attr_const(node)->size;
+	enc_xmm_load(node, 0xF2, gp_flags(size), 0x2A);
+}
+
+static void enc_movdqa(ir_node const *const node)
+{
+	enc_xmm_load(node, 0x66, ENC_NONE, 0x6F);
+}
+
+static void enc_movdqu(ir_node const *const node)
+{
+	enc_xmm_load(node, 0xF3, ENC_NONE, 0x6F);
+}
+
+static void enc_movdqu_store(ir_node const *const node)
+{
+	enc_xmm_store(node, 0xF3, 0x7F);
+}
+
+void amd64_enc_fsimple(uint8_t const opcode)
+{
+	be_emit8(0xD9);
+	be_emit8(opcode);
+}
+
+void amd64_enc_fbinop(ir_node const *const node, uint8_t const op)
+{
+	x87_attr_t const *const x87 = amd64_get_x87_attr_const(node);
+	assert(!x87->pop || x87->res_in_reg);
+
+	/* Same encoding as GNU as, including its interpretation of the reversed
+	 * operations with st(i) as destination. */
+	uint8_t op0 = 0xD8;
+	if (x87->res_in_reg) op0 |= 0x04;
+	if (x87->pop)        op0 |= 0x02;
+	be_emit8(op0);
+
+	unsigned const ext = op + (x87->reverse ? 1 : 0);
+	be_emit8(MOD_REG | ENC_REG(ext) | ENC_RM(x87->reg->encoding));
+}
+
+void amd64_enc_fop_reg(ir_node const *const node, uint8_t const op0,
+                       uint8_t const op1)
+{
+	be_emit8(op0);
+	be_emit8(op1 + amd64_get_x87_attr_const(node)->reg->encoding);
+}
+
+static void enc_fucomi(ir_node const *const node)
+{
+	x87_attr_t const *const x87 = amd64_get_x87_attr_const(node);
+	be_emit8(x87->pop ? 0xDF : 0xDB); // fucom[p]i
+	be_emit8(0xE8 + x87->reg->encoding);
+}
+
+static void enc_x87_am(ir_node const *const node, uint8_t const opcode,
+                       uint8_t const ext)
+{
+	amd64_addr_attr_t const *const attr = get_amd64_addr_attr_const(node);
+	enc_am(0, ENC_NONE, opcode, ext, node, &attr->addr, 0);
+}
+
+static void enc_fld(ir_node const *const node)
+{
+	switch (get_amd64_attr_const(node)->size) {
+	case X86_SIZE_32: enc_x87_am(node, 0xD9, 0); return; // flds
+	case X86_SIZE_64: enc_x87_am(node, 0xDD, 0); return; // fldl
+	case X86_SIZE_80: enc_x87_am(node, 0xDB, 5); return; // fldt
+	case X86_SIZE_8:
+	case X86_SIZE_16:
+	case X86_SIZE_128:
+		break;
+	}
+	panic("unexpected insn size");
+}
+
+static void enc_fild(ir_node const *const node)
+{
+	switch (get_amd64_attr_const(node)->size) {
+	case X86_SIZE_16: enc_x87_am(node, 0xDF, 0); return; // filds
+	case X86_SIZE_32: enc_x87_am(node, 0xDB, 0); return; // fildl
+	case X86_SIZE_64: enc_x87_am(node, 0xDF, 5); return; // fildll
+	case X86_SIZE_8:
+	case X86_SIZE_80:
+	case X86_SIZE_128:
+		break;
+	}
+	panic("unexpected insn size");
+}
+
+static void enc_fisttp(ir_node const *const node)
+{
+	switch (get_amd64_attr_const(node)->size) {
+	case X86_SIZE_16: enc_x87_am(node, 0xDF, 1); return; // fisttps
+	case X86_SIZE_32: enc_x87_am(node, 0xDB, 1); return; // fisttpl
+	case X86_SIZE_64: enc_x87_am(node, 0xDD, 1); return; // fisttpll
+	case X86_SIZE_8:
+	case X86_SIZE_80:
+	case X86_SIZE_128:
+		break;
+	}
+	panic("unexpected insn size");
+}
+
+static void enc_fst_pop(ir_node const *const node, bool const pop)
+{
+	switch (get_amd64_attr_const(node)->size) {
+	case X86_SIZE_32: enc_x87_am(node, 0xD9, 2 + pop); return; // fst[p]s
+	case X86_SIZE_64: enc_x87_am(node, 0xDD, 2 + pop); return; // fst[p]l
+	case X86_SIZE_80:
+		/* There is only a pop variant for long double store. */
+		assert(pop);
+		enc_x87_am(node, 0xDB, 7); // fstpt
+		return;
+	case X86_SIZE_8:
+	case X86_SIZE_16:
+	case X86_SIZE_128:
+		break;
+	}
+	panic("unexpected insn size");
+}
+
+static void enc_fst(ir_node const *const node)
+{
+	enc_fst_pop(node, amd64_get_x87_attr_const(node)->pop);
+}
+
+static void enc_fstp(ir_node const *const node)
+{
+	enc_fst_pop(node, true);
+}
+
+static void enc_be_Copy(ir_node const *const node)
+{
+	arch_register_t const *const in  = arch_get_irn_register_in(node, 0);
+	arch_register_t const *const out = arch_get_irn_register_out(node, 0);
+	if (in == out)
+		return;
+
+	arch_register_class_t const *const cls = out->cls;
+	if (cls == &amd64_reg_classes[CLASS_amd64_gp]) {
+		enc_mov(in->encoding, out->encoding);
+	} else if (cls == &amd64_reg_classes[CLASS_amd64_xmm]) {
+		enc_rr(0x66, ENC_NONE, 0x0F28, out->encoding, in->encoding); // movapd
+	} else if (cls == &amd64_reg_classes[CLASS_amd64_x87]) {
+		/* nothing to do */
+	} else {
+		panic("move not supported for this register class");
+	}
+}
+
+static void enc_pxor(unsigned const src, unsigned const dst)
+{
+	enc_rr(0x66, ENC_NONE, 0x0FEF, dst, src);
+}
+
+static void enc_be_Perm(ir_node const *const node)
+{
+	arch_register_t const *const reg0 = arch_get_irn_register_out(node, 0);
+	arch_register_t const *const reg1 = arch_get_irn_register_out(node, 1);
+
+	arch_register_class_t const *const cls = reg0->cls;
+	assert(cls == reg1->cls && "Register class mismatch at Perm");
+
+	unsigned const enc0 = reg0->encoding;
+	unsigned const enc1 = reg1->encoding;
+	if (cls == &amd64_reg_classes[CLASS_amd64_gp]) {
+		if (enc0 == 0) {
+			enc_opcode_reg(0, ENC_W, 0x90, enc1); // xchgq %rax, %reg1
+		} else if (enc1 == 0) {
+			enc_opcode_reg(0, ENC_W, 0x90, enc0); // xchgq %reg0, %rax
+		} else {
+			enc_rr(0, ENC_W, 0x87, enc0, enc1); // xchgq %reg0, %reg1
+		}
+	} else if (cls == &amd64_reg_classes[CLASS_amd64_xmm]) {
+		enc_pxor(enc0, enc1);
+		enc_pxor(enc1, enc0);
+		enc_pxor(enc0, enc1);
+	} else {
+		panic("unexpected register class in be_Perm (%+F)", node);
+	}
+}
+
+static void enc_be_IncSP(ir_node const *const node)
+{
+	int offs = be_get_IncSP_offset(node);
+	if (offs == 0)
+		return;
+
+	unsigned ext;
+	if (offs > 0) {
+		ext = 5; /* sub */
+	} else {
+		ext = 0; /* add */
+		offs = -offs;
+	}
+
+	unsigned const reg = get_out_reg(node, 0);
+	if (is_8bit_val(offs)) {
+		enc_rr(0, ENC_W, 0x80 | OP_16_32_IMM8, ext, reg);
+		be_emit8(offs);
+	} else {
+		enc_rr(0, ENC_W, 0x80 | OP_16_32, ext, reg);
+		be_emit32(offs);
+	}
+}
+
+static void enc_be_Asm(ir_node const *const node)
+{
+	panic("inline assembly not supported in binary emitter (%+F)", node);
+}
+
+static void amd64_register_binary_emitters(void)
+{
+	be_init_emitters();
+
+	amd64_register_spec_binary_emitters();
+
+	be_set_emitter(op_amd64_call,           enc_call);
+	be_set_emitter(op_amd64_cmpxchg,        enc_cmpxchg);
+	be_set_emitter(op_amd64_copyB,          enc_copyB);
+	be_set_emitter(op_amd64_copyB_i,        enc_copyB_i);
+	be_set_emitter(op_amd64_cqto,           enc_cqto);
+	be_set_emitter(op_amd64_cvtsd2ss,       enc_cvtsd2ss);
+	be_set_emitter(op_amd64_cvtsi2sd,       enc_cvtsi2sd);
+	be_set_emitter(op_amd64_cvtsi2ss,       enc_cvtsi2ss);
+	be_set_emitter(op_amd64_cvtss2sd,       enc_cvtss2sd);
+	be_set_emitter(op_amd64_cvttsd2si,      enc_cvttsd2si);
+	be_set_emitter(op_amd64_cvttss2si,      enc_cvttss2si);
+	be_set_emitter(op_amd64_fild,           enc_fild);
+	be_set_emitter(op_amd64_fisttp,         enc_fisttp);
+	be_set_emitter(op_amd64_fld,            enc_fld);
+	be_set_emitter(op_amd64_fst,            enc_fst);
+	be_set_emitter(op_amd64_fstp,           enc_fstp);
+	be_set_emitter(op_amd64_fucomi,         enc_fucomi);
+	be_set_emitter(op_amd64_ijmp,           enc_ijmp);
+	be_set_emitter(op_amd64_imul,           enc_imul);
+	be_set_emitter(op_amd64_jcc,            enc_amd64_jcc);
+	be_set_emitter(op_amd64_jmp,            enc_jump);
+	be_set_emitter(op_amd64_jmp_switch,     enc_jmp_switch);
+	be_set_emitter(op_amd64_lea,            enc_lea);
+	be_set_emitter(op_amd64_mov_gp,         enc_mov_gp);
+	be_set_emitter(op_amd64_mov_imm,        enc_mov_imm);
+	be_set_emitter(op_amd64_mov_store,      enc_mov_store);
+	be_set_emitter(op_amd64_movd,           enc_movd);
+	be_set_emitter(op_amd64_movd_gp_xmm,    enc_movd_gp_xmm);
+	be_set_emitter(op_amd64_movd_xmm_gp,    enc_movd_xmm_gp);
+	be_set_emitter(op_amd64_movdqa,         enc_movdqa);
+	be_set_emitter(op_amd64_movdqu,         enc_movdqu);
+	be_set_emitter(op_amd64_movdqu_store,   enc_movdqu_store);
+	be_set_emitter(op_amd64_movs,           enc_movs);
+	be_set_emitter(op_amd64_movs_store_xmm, enc_movs_store_xmm);
+	be_set_emitter(op_amd64_movs_xmm,       enc_movs_xmm);
+	be_set_emitter(op_amd64_pop_am,         enc_pop_am);
+	be_set_emitter(op_amd64_push_am,        enc_push_am);
+	be_set_emitter(op_amd64_push_reg,       enc_push_reg);
+	be_set_emitter(op_amd64_pxor_0,         enc_pxor_0);
+	be_set_emitter(op_amd64_setcc,          enc_setcc);
+	be_set_emitter(op_amd64_sub_sp,         enc_sub_sp);
+	be_set_emitter(op_amd64_test,           enc_test);
+	be_set_emitter(op_amd64_xor_0,          enc_xor_0);
+	be_set_emitter(op_amd64_xorp_0,         enc_xorp_0);
+	be_set_emitter(op_be_Asm,               enc_be_Asm);
+	be_set_emitter(op_be_Copy,              enc_be_Copy);
+	be_set_emitter(op_be_CopyKeep,          enc_be_Copy);
+	be_set_emitter(op_be_IncSP,             enc_be_IncSP);
+	be_set_emitter(op_be_Perm,              enc_be_Perm);
+	be_set_emitter(op_be_Unknown,           be_emit_nothing);
+}
+
+static void gen_binary_block(ir_node *const block)
+{
+	unsigned const fragment_num = be_begin_fragment(0, 0);
+	assert(fragment_num == get_block_fragment(block));
+	(void)fragment_num;
+
+	sched_foreach(block, node) {
+		be_emit_node(node);
+	}
+
+	be_finish_fragment();
+}
+
+static void gen_jump_table(ir_node const *const node)
+{
+	amd64_switch_jmp_attr_t const *const attr
+		= get_amd64_switch_jmp_attr_const(node);
+	unsigned long         length;
+	ir_node const **const targets
+		= be_get_jump_table_targets(node, &attr->swtch, &length);
+
+	if (ir_platform.pic_style != BE_PIC_NONE) {
+		/* 32bit entries relative to the start of the table */
+		be_begin_fragment(2, 3);
+		for (unsigned long i = 0; i < length; ++i) {
+			ir_node const *const block = be_emit_get_cfop_target(targets[i]);
+			be_emit_reloc_fragment(4, X86_IMM_PCREL, get_block_fragment(block),
+			                       (int32_t)(i * 4));
+		}
+	} else {
+		be_begin_fragment(3, 7);
+		for (unsigned long i = 0; i < length; ++i) {
+			ir_node const *const block = be_emit_get_cfop_target(targets[i]);
+			be_emit_reloc_fragment(8, AMD64_RELOCATION_ABS64,
+			                       get_block_fragment(block), 0);
+		}
+	}
+	be_finish_fragment();
+
+	free(targets);
+}
+
+static void gen_constant(ir_entity const *const entity)
+{
+	ir_type  const *const type  = get_entity_type(entity);
+	unsigned        const size  = get_type_size(type);
+	unsigned        const align = get_type_alignment(type);
+	assert(is_po2_or_zero(align) && align <= 256);
+	be_begin_fragment(align > 1 ? log2_floor(align) : 0, align - 1);
+
+	ir_initializer_t const *const init = get_entity_initializer(entity);
+	ir_tarval              const *const tv   = get_initializer_tarval_value(init);
+	unsigned                const n_bytes
+		= get_mode_size_bytes(get_tarval_mode(tv));
+	assert(n_bytes <= size);
+	unsigned i = 0;
+	for (; i < n_bytes; ++i) {
+		be_emit8(get_tarval_sub_bits(tv, i));
+	}
+	for (; i < size; ++i) {
+		be_emit8(0);
+	}
+
+	be_finish_fragment();
+}
+
+static void gen_stub(ir_entity *const entity)
+{
+	be_begin_fragment(0, 0);
+	be_emit8(0xFF); // jmp *slot(%rip)
+	be_emit8(MOD_IND | ENC_REG(4) | ENC_RM(0x05));
+	be_emit32(0);
+	be_emit_reloc_entity(8, AMD64_RELOCATION_ABS64, entity, 0);
+	be_finish_fragment();
+}
+
+static void gen_local_fragment(local_fragment_t const *const fragment)
+{
+	switch (fragment->kind) {
+	case LOCAL_JUMP_TABLE: gen_jump_table(fragment->node); return;
+	case LOCAL_CONSTANT:   gen_constant(fragment->entity); return;
+	case LOCAL_STUB:       gen_stub(fragment->entity);     return;
+	}
+	panic("invalid local fragment kind");
+}
+
+/**
+ * Assign fragment numbers to the jump tables, as the instructions referencing
+ * a table may come before the switch.
+ */
+static void assign_jump_table_fragments(ir_node **const blk_sched)
+{
+	for (size_t i = 0, n = ARR_LEN(blk_sched); i < n; ++i) {
+		sched_foreach(blk_sched[i], node) {
+			if (!is_amd64_jmp_switch(node))
+				continue;
+			ir_entity const *const table
+				= get_amd64_switch_jmp_attr_const(node)->swtch.table_entity;
+			unsigned const num = new_local_fragment(LOCAL_JUMP_TABLE, NULL, node);
+			pmap_insert(data_fragmentnum, table, INT_TO_PTR(num));
+		}
+	}
+}
+
+ir_jit_function_t *amd64_emit_jit(ir_jit_segment_t *const segment,
+                                  ir_graph *const irg)
+{
+	amd64_register_binary_emitters();
+
+	ir_node **const blk_sched = be_create_block_schedule(irg);
+
+	be_jit_begin_function(segment);
+
+	/* we use links to point to target blocks */
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
+
+	be_emit_init_cf_links(blk_sched);
+
+	ir_nodehashmap_init(&block_fragmentnum);
+	size_t const n = ARR_LEN(blk_sched);
+	for (size_t i = 0; i < n; ++i) {
+		ir_nodehashmap_insert(&block_fragmentnum, blk_sched[i], INT_TO_PTR(i));
+	}
+	n_block_fragments = n;
+	data_fragmentnum  = pmap_create();
+	stub_fragmentnum  = pmap_create();
+	local_fragments   = NEW_ARR_F(local_fragment_t, 0);
+	assign_jump_table_fragments(blk_sched);
+
+	for (size_t i = 0; i < n; ++i) {
+		gen_binary_block(blk_sched[i]);
+	}
+	/* emitting the local fragments does not create new ones */
+	for (size_t i = 0; i < ARR_LEN(local_fragments); ++i) {
+		gen_local_fragment(&local_fragments[i]);
+	}
+
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+	ir_nodehashmap_destroy(&block_fragmentnum);
+	pmap_destroy(data_fragmentnum);
+	pmap_destroy(stub_fragmentnum);
+	DEL_ARR_F(local_fragments);
+
+	return be_jit_finish_function();
+}
+
+static void store32(char *const buffer, int32_t const value)
+{
+	memcpy(buffer, &value, 4);
+}
+
+static unsigned enc_jump_callback(char *const buffer, uint8_t const be_kind,
+                                  int32_t const offset)
+{
+	if (be_kind >= AMD64_RELOCATION_JCC32) {
+		buffer[0] = 0x0F;
+		buffer[1] = 0x80 | (be_kind & 0x0F);
+		store32(buffer + 2, offset - 6);
+		return 6;
+	} else if (be_kind >= AMD64_RELOCATION_JCC8) {
+		assert(is_8bit_val(offset - 2));
+		buffer[0] = 0x70 | (be_kind & 0x0F);
+		buffer[1] = offset - 2;
+		return 2;
+	} else if (be_kind == AMD64_RELOCATION_JMP32) {
+		buffer[0] = 0xE9;
+		store32(buffer + 1, offset - 5);
+		return 5;
+	} else {
+		assert(be_kind == AMD64_RELOCATION_JMP8);
+		assert(is_8bit_val(offset - 2));
+		buffer[0] = 0xEB;
+		buffer[1] = offset - 2;
+		return 2;
+	}
+}
+
+static unsigned enc_relocation_callback(char *const buffer,
+                                        uint8_t const be_kind,
+                                        ir_entity *const entity,
+                                        int32_t const offset)
+{
+	if (be_kind == AMD64_RELOCATION_JMP8 || be_kind == AMD64_RELOCATION_JMP32
+	 || be_kind >= AMD64_RELOCATION_JCC8) {
+		assert(entity == NULL);
+		return enc_jump_callback(buffer, be_kind, offset);
+	}
+
+	intptr_t addr;
+	if (entity == NULL) {
+		/* offset is relative to the relocation for code fragments */
+		addr = (intptr_t)buffer + offset;
+	} else {
+		intptr_t const entity_addr = (intptr_t)be_jit_get_entity_addr(entity);
+		if (entity_addr == (intptr_t)-1)
+			panic("Could not resolve address of entity %+F", entity);
+		addr = entity_addr + offset;
+	}
+
+	switch (be_kind) {
+	case AMD64_RELOCATION_ABS64: {
+		uint64_t const value = (uint64_t)addr;
+		memcpy(buffer, &value, 8);
+		return 8;
+	}
+	case X86_IMM_ADDR:
+	case X86_IMM_PCREL: {
+		if (be_kind == X86_IMM_PCREL)
+			addr -= (intptr_t)buffer;
+		int32_t const value = (int32_t)addr;
+		if ((intptr_t)value != addr)
+			panic("Overflow in relocation");
+		store32(buffer, value);
+		return 4;
+	}
+	}
+	panic("invalid relocation kind");
+}
+
+static const be_jit_emit_interface_t jit_emit_interface = {
+	.nops       = x86_enc_nops,
+	.relocation = enc_relocation_callback,
+};
+
+void amd64_emit_jit_function(char *const buffer,
+                             ir_jit_function_t *const function)
+{
+	be_jit_emit_memory(buffer, function, &jit_emit_interface);
+}
+
+enum {
+	R_X86_64_64       = 1,
+	R_X86_64_PC32     = 2,
+	R_X86_64_PLT32    = 4,
+	R_X86_64_GOTPCREL = 9,
+	R_X86_64_32       = 10,
+	R_X86_64_32S      = 11,
+};
+
+static uint32_t get_elf_relocation(uint8_t const be_kind,
+                                   ir_entity const *const entity,
+                                   unsigned *const size)
+{
+	*size = 4;
+	switch (be_kind) {
+	case AMD64_RELOCATION_ABS64:
+		*size = 8;
+		return R_X86_64_64;
+	case X86_IMM_ADDR:
+		return R_X86_64_32S;
+	case X86_IMM_PCREL:
+		/* code fragments are resolved by the emitter */
+		if (entity == NULL)
+			return 0;
+		return is_method_entity(entity) ? R_X86_64_PLT32 : R_X86_64_PC32;
+	case X86_IMM_GOTPCREL:
+		return R_X86_64_GOTPCREL;
+	default:
+		/* jumps */
+		return 0;
+	}
+}
+
+be_elf_target_t const amd64_elf_target = {
+	.machine          = 62, /* EM_X86_64 */
+	.elf64            = true,
+	.rela             = true,
+	.emit             = &jit_emit_interface,
+	.get_relocation   = get_elf_relocation,
+	.abs32_relocation = R_X86_64_32,
+	.abs64_relocation = R_X86_64_64,
+};
@@ -0,0 +1,60 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       amd64 binary encoding/emission
+ */
+#ifndef FIRM_BE_AMD64_AMD64_ENCODE_H
+#define FIRM_BE_AMD64_AMD64_ENCODE_H
+
+#include <stdint.h>
+#include "be_types.h"
+#include "firm_types.h"
+#include "jit.h"
+
+enum {
+	AMD64_RELOCATION_ABS64 = 128, /**< 64bit absolute address */
+	AMD64_RELOCATION_JMP8,        /**< jmp with 8bit displacement */
+	AMD64_RELOCATION_JMP32,       /**< jmp with 32bit displacement */
+	/** jcc with 8bit displacement, condition code in the lower 4 bits */
+	AMD64_RELOCATION_JCC8  = 0xE0,
+	/** jcc with 32bit displacement, condition code in the lower 4 bits */
+	AMD64_RELOCATION_JCC32 = 0xF0,
+};
+
+ir_jit_function_t *amd64_emit_jit(ir_jit_segment_t *segment, ir_graph *irg);
+
+void amd64_emit_jit_function(char *buffer, ir_jit_function_t *function);
+
+/** ELF relocations of the code produced by amd64_emit_jit(). */
+extern be_elf_target_t const amd64_elf_target;
+
+void amd64_enc_simple(uint8_t opcode);
+
+void amd64_enc_binop(ir_node const *node, uint8_t code);
+
+void amd64_enc_shiftop(ir_node const *node, uint8_t ext);
+
+void amd64_enc_unop(ir_node const *node, uint8_t ext);
+
+void amd64_enc_0f_unop_reg(ir_node const *node, uint8_t code);
+
+void amd64_enc_xmm_binop(ir_node const *node, uint8_t prefix, uint8_t code);
+
+void amd64_enc_xmm_scalar_binop(ir_node const *node, uint8_t code);
+
+void amd64_enc_xmm_packed_binop(ir_node const *node, uint8_t code);
+
+void amd64_enc_xmm_element_binop(ir_node const *node, uint8_t code,
+                                 uint8_t code_64);
+
+void amd64_enc_fsimple(uint8_t opcode);
+
+void amd64_enc_fbinop(ir_node const *node, uint8_t op);
+
+void amd64_enc_fop_reg(ir_node const *node, uint8_t op0, uint8_t op1);
+
+#endif
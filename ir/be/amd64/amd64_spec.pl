@@ -9,22 +9,22 @@ $mode_x87   = "x86_mode_E";
 	gp => {
 		mode => $mode_gp,
 		registers => [
-			{ name => "rax", dwarf =>  0 },
-			{ name => "rcx", dwarf =>  2 },
-			{ name => "rdx", dwarf =>  1 },
-			{ name => "rsi", dwarf =>  4 },
-			{ name => "rdi", dwarf =>  5 },
-			{ name => "rbx", dwarf =>  3 },
-			{ name => "rbp", dwarf =>  6 },
-			{ name => "rsp", dwarf =>  7 },
-			{ name => "r8",  dwarf =>  8 },
-			{ name => "r9",  dwarf =>  9 },
-			{ name => "r10", dwarf => 10 },
-			{ name => "r11", dwarf => 11 },
-			{ name => "r12", dwarf => 12 },
-			{ name => "r13", dwarf => 13 },
-			{ name => "r14", dwarf => 14 },
-			{ name => "r15", dwarf => 15 },
+			{ name => "rax", encoding =>  0, dwarf =>  0 },
+			{ name => "rcx", encoding =>  1, dwarf =>  2 },
+			{ name => "rdx", encoding =>  2, dwarf =>  1 },
+			{ name => "rsi", encoding =>  6, dwarf =>  4 },
+			{ name => "rdi", encoding =>  7, dwarf =>  5 },
+			{ name => "rbx", encoding =>  3, dwarf =>  3 },
+			{ name => "rbp", encoding =>  5, dwarf =>  6 },
+			{ name => "rsp", encoding =>  4, dwarf =>  7 },
+			{ name => "r8",  encoding =>  8, dwarf =>  8 },
+			{ name => "r9",  encoding =>  9, dwarf =>  9 },
+			{ name => "r10", encoding => 10, dwarf => 10 },
+			{ name => "r11", encoding => 11, dwarf => 11 },
+			{ name => "r12", encoding => 12, dwarf => 12 },
+			{ name => "r13", encoding => 13, dwarf => 13 },
+			{ name => "r14", encoding => 14, dwarf => 14 },
+			{ name => "r15", encoding => 15, dwarf => 15 },
 		]
 	},
 	flags => {
@@ -358,16 +358,24 @@ leave => {
 	fixed     => "amd64_op_mode_t op_mode = AMD64_OP_NONE;\n"
 	            ."x86_insn_size_t size    = X86_SIZE_64;\n",
 	emit      => "leave",
+	encode    => "amd64_enc_simple(0xC9)",
 },
 
-add => { template => $binop_commutative },
+add => {
+	template => $binop_commutative,
+	encode   => "amd64_enc_binop(node, 0)",
+},
 
-and => { template => $binop_commutative },
+and => {
+	template => $binop_commutative,
+	encode   => "amd64_enc_binop(node, 4)",
+},
 
 cltd => {
 	template => $sextop,
 	fixed    => "amd64_op_mode_t op_mode = AMD64_OP_NONE;\n"
 	           ."x86_insn_size_t size    = X86_SIZE_32;\n",
+	encode   => "amd64_enc_simple(0x99)",
 },
 
 cqto => {
@@ -376,39 +384,74 @@ cqto => {
 	           ."x86_insn_size_t size    = X86_SIZE_64;\n",
 },
 
-div => { template => $divop },
+div => {
+	template => $divop,
+	encode   => "amd64_enc_unop(node, 6)",
+},
 
-idiv => { template => $divop },
+idiv => {
+	template => $divop,
+	encode   => "amd64_enc_unop(node, 7)",
+},
 
 imul => { template => $binop_commutative },
 
 imul_1op => {
 	template => $mulop,
 	name     => "imul",
+	encode   => "amd64_enc_unop(node, 5)",
 },
 
-mul => { template => $mulop },
+mul => {
+	template => $mulop,
+	encode   => "amd64_enc_unop(node, 4)",
+},
 
-or => { template => $binop_commutative },
+or => {
+	template => $binop_commutative,
+	encode   => "amd64_enc_binop(node, 1)",
+},
 
-shl => { template => $shiftop },
+shl => {
+	template => $shiftop,
+	encode   => "amd64_enc_shiftop(node, 4)",
+},
 
-shr => { template => $shiftop },
+shr => {
+	template => $shiftop,
+	encode   => "amd64_enc_shiftop(node, 5)",
+},
 
-sar => { template => $shiftop },
+sar => {
+	template => $shiftop,
+	encode   => "amd64_enc_shiftop(node, 7)",
+},
 
 sub => {
 	template  => $binop,
 	irn_flags => [ "modify_flags", "rematerializable" ],
+	encode    => "amd64_enc_binop(node, 5)",
 },
 
-sbb => { template => $binop },
+sbb => {
+	template => $binop,
+	encode   => "amd64_enc_binop(node, 3)",
+},
 
-neg => { template => $unop },
+neg => {
+	template => $unop,
+	encode   => "amd64_enc_unop(node, 3)",
+},
 
-not => { template => $unop },
+not => {
+	template => $unop,
+	encode   => "amd64_enc_unop(node, 2)",
+},
 
-xor => { template => $binop_commutative },
+xor => {
+	template => $binop_commutative,
+	encode   => "amd64_enc_binop(node, 6)",
+},
 
 xor_0 => {
 	op_flags  => [ "constlike" ],
@@ -469,7 +512,10 @@ jmp => {
 	            ."x86_insn_size_t size    = X86_SIZE_64;\n",
 },
 
-cmp => { template => $cmpop },
+cmp => {
+	template => $cmpop,
+	encode   => "amd64_enc_binop(node, 7)",
+},
 
 test => { template => $cmpop },
 
@@ -560,19 +606,30 @@ ret => {
 	fixed    => "amd64_op_mode_t op_mode = AMD64_OP_NONE;\n"
 	           ."x86_insn_size_t size    = X86_SIZE_64;\n",
 	emit     => "ret",
+	encode   => "amd64_enc_simple(0xC3)",
 },
 
-bsf => { template => $unop_out },
+bsf => {
+	template => $unop_out,
+	encode   => "amd64_enc_0f_unop_reg(node, 0xBC)",
+},
 
-bsr => { template => $unop_out },
+bsr => {
+	template => $unop_out,
+	encode   => "amd64_enc_0f_unop_reg(node, 0xBD)",
+},
 
 # SSE
 
-adds => { template => $binopx_commutative },
+adds => {
+	template => $binopx_commutative,
+	encode   => "amd64_enc_xmm_scalar_binop(node, 0x58)",
+},
 
 divs => {
 	template => $binopx,
 	emit     => "divs%MX %AM",
+	encode   => "amd64_enc_xmm_scalar_binop(node, 0x5E)",
 },
 
 movs_xmm => {
@@ -581,7 +638,10 @@ movs_xmm => {
 	emit     => "movs%MX %AM, %D0",
 },
 
-muls => { template => $binopx_commutative },
+muls => {
+	template => $binopx_commutative,
+	encode   => "amd64_enc_xmm_scalar_binop(node, 0x59)",
+},
 
 movs_store_xmm => {
 	op_flags  => [ "uses_memory" ],
@@ -597,6 +657,7 @@ movs_store_xmm => {
 subs => {
 	template => $binopx,
 	emit     => "subs%MX %AM",
+	encode   => "amd64_enc_xmm_scalar_binop(node, 0x5C)",
 },
 
 ucomis => {
@@ -608,6 +669,7 @@ ucomis => {
 	attr_type => "amd64_binop_addr_attr_t",
 	attr      => "const amd64_binop_addr_attr_t *attr_init",
 	emit      => "ucomis%MX %AM",
+	encode    => "amd64_enc_xmm_packed_binop(node, 0x2E)",
 },
 
 xorp_0 => {
@@ -620,7 +682,10 @@ xorp_0 => {
 	emit      => "xorp%MX %^D0, %^D0",
 },
 
-xorp => { template => $binopx_commutative },
+xorp => {
+	template => $binopx_commutative,
+	encode   => "amd64_enc_xmm_packed_binop(node, 0x57)",
+},
 
 movd_xmm_gp => {
 	state     => "exc_pinned",
@@ -654,6 +719,81 @@ pxor_0 => {
 	emit      => "pxor %^D0, %^D0",
 },
 
+# Packed SSE operations. The size is the size of a single vector element.
+
+addp => {
+	template => $binopx_commutative,
+	encode   => "amd64_enc_xmm_packed_binop(node, 0x58)",
+},
+
+subp => {
+	template => $binopx,
+	emit     => "subp%MX %AM",
+	encode   => "amd64_enc_xmm_packed_binop(node, 0x5C)",
+},
+
+mulp => {
+	template => $binopx_commutative,
+	encode   => "amd64_enc_xmm_packed_binop(node, 0x59)",
+},
+
+divp => {
+	template => $binopx,
+	emit     => "divp%MX %AM",
+	encode   => "amd64_enc_xmm_packed_binop(node, 0x5E)",
+},
+
+padd => {
+	template => $binopx_commutative,
+	emit     => "padd%MP %AM",
+	encode   => "amd64_enc_xmm_element_binop(node, 0xFC, 0xD4)",
+},
+
+psub => {
+	template => $binopx,
+	emit     => "psub%MP %AM",
+	encode   => "amd64_enc_xmm_element_binop(node, 0xF8, 0xFB)",
+},
+
+pmullw => {
+	template => $binopx_commutative,
+	emit     => "pmullw %AM",
+	encode   => "amd64_enc_xmm_binop(node, 0x66, 0xD5)",
+},
+
+pand => {
+	template => $binopx_commutative,
+	emit     => "pand %AM",
+	encode   => "amd64_enc_xmm_binop(node, 0x66, 0xDB)",
+},
+
+por => {
+	template => $binopx_commutative,
+	emit     => "por %AM",
+	encode   => "amd64_enc_xmm_binop(node, 0x66, 0xEB)",
+},
+
+pxor => {
+	template => $binopx_commutative,
+	emit     => "pxor %AM",
+	encode   => "amd64_enc_xmm_binop(node, 0x66, 0xEF)",
+},
+
+punpcklbw => {
+	template => $binopx,
+	encode   => "amd64_enc_xmm_binop(node, 0x66, 0x60)",
+},
+
+punpcklwd => {
+	template => $binopx,
+	encode   => "amd64_enc_xmm_binop(node, 0x66, 0x61)",
+},
+
+punpcklqdq => {
+	template => $binopx,
+	encode   => "amd64_enc_xmm_binop(node, 0x66, 0x6C)",
+},
+
 # Conversion operations
 
 cvtss2sd => { template => $cvtop2x },
@@ -742,15 +882,30 @@ l_haddpd => {
 	mode      => $mode_xmm,
 },
 
-punpckldq => { template => $binopx },
+punpckldq => {
+	template => $binopx,
+	encode   => "amd64_enc_xmm_binop(node, 0x66, 0x62)",
+},
 
-subpd => { template => $binopx },
+subpd => {
+	template => $binopx,
+	encode   => "amd64_enc_xmm_binop(node, 0x66, 0x5C)",
+},
 
-haddpd => { template => $binopx },
+haddpd => {
+	template => $binopx,
+	encode   => "amd64_enc_xmm_binop(node, 0x66, 0x7C)",
+},
 
-fldz => { template => $x87const },
+fldz => {
+	template => $x87const,
+	encode   => "amd64_enc_fsimple(0xEE)",
+},
 
-fld1 => { template => $x87const },
+fld1 => {
+	template => $x87const,
+	encode   => "amd64_enc_fsimple(0xE8)",
+},
 
 fld => {
 	irn_flags => [ "rematerializable" ],
@@ -794,24 +949,31 @@ fstp => {
 fadd => {
 	template => $x87binop,
 	emit     => "fadd%FP %AF",
+	encode   => "amd64_enc_fbinop(node, 0)",
 },
 
 fdiv => {
 	template => $x87binop,
 	emit     => "fdiv%FR%FP %AF",
+	encode   => "amd64_enc_fbinop(node, 6)",
 },
 
 fmul => {
 	template => $x87binop,
 	emit     => "fmul%FP %AF",
+	encode   => "amd64_enc_fbinop(node, 1)",
 },
 
 fsub => {
 	template => $x87binop,
 	emit     => "fsub%FR%FP %AF",
+	encode   => "amd64_enc_fbinop(node, 4)",
 },
 
-fchs => { template => $x87unop },
+fchs => {
+	template => $x87unop,
+	encode   => "amd64_enc_fsimple(0xE0)",
+},
 
 fucomi => {
 	irn_flags => [ "rematerializable" ],
@@ -832,6 +994,7 @@ fdup => {
 	attr        => "const arch_register_t *reg",
 	init        => "attr->x87.reg = reg;",
 	emit        => "fld %F0",
+	encode      => "amd64_enc_fop_reg(node, 0xD9, 0xC0)",
 },
 
 fxch => {
@@ -842,6 +1005,7 @@ fxch => {
 	attr        => "const arch_register_t *reg",
 	init        => "attr->x87.reg = reg;",
 	emit        => "fxch %F0",
+	encode      => "amd64_enc_fop_reg(node, 0xD9, 0xC8)",
 },
 
 fpop => {
@@ -852,6 +1016,7 @@ fpop => {
 	attr        => "const arch_register_t *reg",
 	init        => "attr->x87.reg = reg;",
 	emit        => "fstp %F0",
+	encode      => "amd64_enc_fop_reg(node, 0xDD, 0xD8)",
 },
 
 );
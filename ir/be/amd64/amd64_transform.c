@@ -37,8 +37,8 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
-static x86_cconv_t    *current_cconv = NULL;
-static be_stack_env_t  stack_env;
+static THREAD_LOCAL x86_cconv_t    *current_cconv = NULL;
+static THREAD_LOCAL be_stack_env_t  stack_env;
 
 #define GP &amd64_reg_classes[CLASS_amd64_gp]
 const x86_asm_constraint_list_t amd64_asm_constraints = {
@@ -297,25 +297,29 @@ static ir_node *get_frame_base(ir_graph *irg)
 	}
 }
 
+/** Guards the constant entities, which are shared by the functions. */
+static ir_mutex_t constants_mutex = IR_MUTEX_INITIALIZER;
+
 ir_entity *create_float_const_entity(ir_tarval *const tv)
 {
 	/* TODO: share code with ia32 backend */
+	ir_mutex_lock(&constants_mutex);
 	ir_entity *entity = pmap_get(ir_entity, amd64_constants, tv);
-	if (entity != NULL)
-		return entity;
-
-	ir_mode *mode = get_tarval_mode(tv);
-	ir_type *type = get_type_for_mode(mode);
-	ir_type *glob = get_glob_type();
+	if (entity == NULL) {
+		ir_mode *mode = get_tarval_mode(tv);
+		ir_type *type = get_type_for_mode(mode);
+		ir_type *glob = get_glob_type();
 
-	entity = new_global_entity(glob, id_unique("C"), type,
-	                           ir_visibility_private,
-	                           IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
+		entity = new_global_entity(glob, be_get_tarval_ident("C", tv), type,
+		                           ir_visibility_private,
+		                           IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
 
-	ir_initializer_t *initializer = create_initializer_tarval(tv);
-	set_entity_initializer(entity, initializer);
+		ir_initializer_t *initializer = create_initializer_tarval(tv);
+		set_entity_initializer(entity, initializer);
 
-	pmap_insert(amd64_constants, tv, entity);
+		pmap_insert(amd64_constants, tv, entity);
+	}
+	ir_mutex_unlock(&constants_mutex);
 	return entity;
 }
 
@@ -555,7 +559,7 @@ static bool match_immediate_32(x86_imm32_t *const imm, ir_node const *const op,
 	return true;
 }
 
-static ir_heights_t *heights;
+static THREAD_LOCAL ir_heights_t *heights;
 
 static bool input_depends_on_load(ir_node *load, ir_node *input)
 {
@@ -894,6 +898,58 @@ static ir_node *gen_binop_xmm(ir_node *node, ir_node *op0, ir_node *op1,
 	return be_new_Proj(new_node, pn_amd64_subs_res);
 }
 
+/**
+ * Creates a packed SSE operation on already transformed operands. Packed
+ * operations require aligned memory operands, so no address mode is used.
+ */
+static ir_node *new_vector_binop(dbg_info *const dbgi, ir_node *const block,
+                                 ir_node *const op0, ir_node *const op1,
+                                 construct_binop_func const make_node,
+                                 x86_insn_size_t const size)
+{
+	amd64_binop_addr_attr_t attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.base.base.op_mode    = AMD64_OP_REG_REG;
+	attr.base.base.size       = size;
+	attr.base.addr.base_input = 0;
+	attr.base.addr.variant    = X86_ADDR_REG;
+	attr.u.reg_input          = 1;
+
+	ir_node *const in[]     = { op0, op1 };
+	ir_node *const new_node = make_node(dbgi, block, ARRAY_SIZE(in), in,
+	                                    amd64_xmm_xmm_reqs, &attr);
+	/* see create_sse_div() */
+	bool const commutative = arch_get_irn_flags(new_node)
+	                       & amd64_arch_irn_flag_commutative_binop;
+	arch_set_irn_register_req_out(new_node, 0, commutative
+		? &amd64_requirement_xmm_same_0
+		: &amd64_requirement_xmm_same_0_not_1);
+	return new_node;
+}
+
+/** Transforms an operation on vectors, the size is the element size. */
+static ir_node *gen_binop_vector(ir_node *const node, ir_node *const op0,
+                                 ir_node *const op1,
+                                 construct_binop_func const make_node)
+{
+	dbg_info *const dbgi      = get_irn_dbg_info(node);
+	ir_node  *const new_block = be_transform_nodes_block(node);
+	ir_node  *const new_op0   = be_transform_node(op0);
+	ir_node  *const new_op1   = be_transform_node(op1);
+	ir_mode  *const mode      = get_irn_mode(op0);
+	x86_insn_size_t const size
+		= x86_size_from_mode(get_vector_element_mode(mode));
+	ir_node  *const new_node  = new_vector_binop(dbgi, new_block, new_op0,
+	                                             new_op1, make_node, size);
+	/* all packed operations have the same outputs */
+	return be_new_Proj(new_node, pn_amd64_addp_res);
+}
+
+static bool is_float_vector(ir_mode *const mode)
+{
+	return mode_is_float(get_vector_element_mode(mode));
+}
+
 typedef ir_node *(*construct_x87_binop_func)(
 		dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1);
 
@@ -992,7 +1048,10 @@ static ir_node *gen_Add(ir_node *const node)
 	ir_mode *const mode  = get_irn_mode(node);
 	ir_node *const block = get_nodes_block(node);
 
-	if (mode_is_float(mode)) {
+	if (mode_is_vector(mode)) {
+		return gen_binop_vector(node, op1, op2, is_float_vector(mode)
+		                        ? new_bd_amd64_addp : new_bd_amd64_padd);
+	} else if (mode_is_float(mode)) {
 		if (mode == x86_mode_E)
 			return gen_binop_x87(node, op1, op2, new_bd_amd64_fadd);
 		return gen_binop_am(node, op1, op2, new_bd_amd64_adds,
@@ -1032,7 +1091,10 @@ static ir_node *gen_Sub(ir_node *const node)
 	ir_node *const op2  = get_Sub_right(node);
 	ir_mode *const mode = get_irn_mode(node);
 
-	if (mode_is_float(mode)) {
+	if (mode_is_vector(mode)) {
+		return gen_binop_vector(node, op1, op2, is_float_vector(mode)
+		                        ? new_bd_amd64_subp : new_bd_amd64_psub);
+	} else if (mode_is_float(mode)) {
 		if (mode == x86_mode_E)
 			return gen_binop_x87(node, op1, op2, new_bd_amd64_fsub);
 		return gen_binop_am(node, op1, op2, new_bd_amd64_subs,
@@ -1055,6 +1117,8 @@ static ir_node *gen_And(ir_node *const node)
 {
 	ir_node *const op1 = get_And_left(node);
 	ir_node *const op2 = get_And_right(node);
+	if (mode_is_vector(get_irn_mode(node)))
+		return gen_binop_vector(node, op1, op2, new_bd_amd64_pand);
 
 	/* Is it a zero extension? */
 	if (is_Const(op2)) {
@@ -1085,6 +1149,8 @@ static ir_node *gen_Eor(ir_node *const node)
 {
 	ir_node *const op1 = get_Eor_left(node);
 	ir_node *const op2 = get_Eor_right(node);
+	if (mode_is_vector(get_irn_mode(node)))
+		return gen_binop_vector(node, op1, op2, new_bd_amd64_pxor);
 	return gen_binop_am(node, op1, op2, new_bd_amd64_xor, pn_amd64_xor_res,
 	                    match_immediate | match_am | match_mode_neutral
 	                    | match_commutative);
@@ -1094,6 +1160,8 @@ static ir_node *gen_Or(ir_node *const node)
 {
 	ir_node *const op1 = get_Or_left(node);
 	ir_node *const op2 = get_Or_right(node);
+	if (mode_is_vector(get_irn_mode(node)))
+		return gen_binop_vector(node, op1, op2, new_bd_amd64_por);
 	return gen_binop_am(node, op1, op2, new_bd_amd64_or, pn_amd64_or_res,
 	                    match_immediate | match_am | match_mode_neutral
 	                    | match_commutative);
@@ -1105,7 +1173,10 @@ static ir_node *gen_Mul(ir_node *const node)
 	ir_node *const op2  = get_Mul_right(node);
 	ir_mode *const mode = get_irn_mode(node);
 
-	if (get_mode_size_bits(mode) < 16) {
+	if (mode_is_vector(mode)) {
+		return gen_binop_vector(node, op1, op2, is_float_vector(mode)
+		                        ? new_bd_amd64_mulp : new_bd_amd64_pmullw);
+	} else if (get_mode_size_bits(mode) < 16) {
 		/* imulb only supports rax - reg form */
 		ir_node *new_node
 			= gen_binop_rax(node, op1, op2, new_bd_amd64_imul_1op,
@@ -1250,7 +1321,16 @@ static ir_node *gen_Div(ir_node *const node)
 	ir_node *const op2  = get_Div_right(node);
 	ir_node *const mem  = get_Div_mem(node);
 
-	if (mode_is_float(mode)) {
+	if (mode_is_vector(mode)) {
+		dbg_info *const dbgi      = get_irn_dbg_info(node);
+		ir_node  *const new_block = be_transform_nodes_block(node);
+		ir_node  *const new_op1   = be_transform_node(op1);
+		ir_node  *const new_op2   = be_transform_node(op2);
+		x86_insn_size_t const size
+			= x86_size_from_mode(get_vector_element_mode(mode));
+		return new_vector_binop(dbgi, new_block, new_op1, new_op2,
+		                        new_bd_amd64_divp, size);
+	} else if (mode_is_float(mode)) {
 		if (mode == x86_mode_E)
 			return gen_binop_x87(node, op1, op2, new_bd_amd64_fdiv);
 		return create_sse_div(node, mode, op1, op2);
@@ -1277,7 +1357,7 @@ static ir_node *gen_Proj_Div(ir_node *const node)
 			panic("amd64 exception NIY");
 		}
 		panic("invalid Div Proj");
-	} else if (is_amd64_divs(new_pred)) {
+	} else if (is_amd64_divs(new_pred) || is_amd64_divp(new_pred)) {
 		switch (pn) {
 		case pn_Div_M:
 			/* float divs don't trap, skip memory */
@@ -1561,8 +1641,8 @@ static ir_node *gen_Switch(ir_node *const node)
 
 	ir_type   *const utype = get_unknown_type();
 	ir_entity *const entity
-		= new_global_entity(irp->dummy_owner, id_unique("TBL"), utype,
-		                    ir_visibility_private,
+		= new_global_entity(irp->dummy_owner, be_new_irg_ident(irg, "TBL"),
+		                    utype, ir_visibility_private,
 		                    IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
 
 	arch_register_req_t const **in_reqs;
@@ -1747,7 +1827,10 @@ static ir_node *make_store_for_mode(ir_mode *const mode, dbg_info *const dbgi, i
 {
 	construct_binop_func               cons;
 	arch_register_req_t const **const *reqs;
-	if (!mode_is_float(mode)) {
+	if (mode_is_vector(mode)) {
+		cons = &new_bd_amd64_movdqu_store;
+		reqs = xmm_am_reqs;
+	} else if (!mode_is_float(mode)) {
 		cons = &new_bd_amd64_mov_store;
 		reqs = gp_am_reqs;
 	} else if (mode == x86_mode_E) {
@@ -2151,6 +2234,8 @@ static ir_node *gen_Phi(ir_node *const node)
 		req = mode == x86_mode_E
 		    ? &amd64_class_reg_req_x87
 		    : &amd64_class_reg_req_xmm;
+	} else if (mode_is_vector(mode)) {
+		req = &amd64_class_reg_req_xmm;
 	} else {
 		req = arch_memory_req;
 	}
@@ -2669,7 +2754,7 @@ ir_node *amd64_new_spill(ir_node *const value, ir_node *const after)
 	return store;
 }
 
-static ir_node *create_sse_spill(dbg_info *const dbgi, ir_node *const block,
+static ir_node *create_movdqu(dbg_info *const dbgi, ir_node *const block,
                                  int const arity, ir_node *const *const in,
                                  arch_register_req_t const **const in_reqs,
                                  x86_insn_size_t const size, amd64_op_mode_t const op_mode,
@@ -2707,7 +2792,7 @@ ir_node *amd64_new_reload(ir_node *value, ir_node *spill, ir_node *before)
 		pn_res = pn_amd64_fld_res;
 	} else {
 		size   = X86_SIZE_128;
-		cons   = &create_sse_spill;
+		cons   = &create_movdqu;
 		pn_res = pn_amd64_movdqu_res;
 	}
 	ir_node *const load = cons(NULL, block, ARRAY_SIZE(in), in, reg_mem_reqs,
@@ -2742,6 +2827,7 @@ static ir_node *gen_Load(ir_node *const node)
 	assert((size_t)arity <= ARRAY_SIZE(in));
 
 	create_mov_func   const cons      =
+		mode_is_vector(mode)                                  ? &create_movdqu         :
 		mode_is_float(mode)                                   ?
 			(mode == x86_mode_E ? new_bd_amd64_fld : &new_bd_amd64_movs_xmm) :
 		get_mode_size_bits(mode) < 64 && mode_is_signed(mode) ? &new_bd_amd64_movs     :
@@ -2757,7 +2843,7 @@ static ir_node *gen_Unknown(ir_node *const node)
 {
 	ir_node *const block = be_transform_nodes_block(node);
 	ir_mode *const mode  = get_irn_mode(node);
-	if (mode_is_float(mode)) {
+	if (mode_is_float(mode) || mode_is_vector(mode)) {
 		return be_new_Unknown(block, &amd64_class_reg_req_xmm);
 	} else if (be_mode_needs_gp_reg(mode)) {
 		return be_new_Unknown(block, &amd64_class_reg_req_gp);
@@ -2814,6 +2900,13 @@ static ir_node *gen_Proj_Load(ir_node *const node)
 			return be_new_Proj(new_load, pn_amd64_fld_M);
 		}
 		break;
+	case iro_amd64_movdqu:
+		if (pn == pn_Load_res) {
+			return be_new_Proj(new_load, pn_amd64_movdqu_res);
+		} else if (pn == pn_Load_M) {
+			return be_new_Proj(new_load, pn_amd64_movdqu_M);
+		}
+		break;
 	case iro_amd64_add:
 	case iro_amd64_and:
 	case iro_amd64_cmp:
@@ -3212,6 +3305,68 @@ static ir_node *gen_Bitcast(ir_node *const node)
 	}
 }
 
+/**
+ * Moves each element into the lowest part of an xmm register and interleaves
+ * the registers pairwise with ever larger parts until one register remains.
+ */
+static ir_node *gen_Pack(ir_node *const node)
+{
+	dbg_info *const dbgi         = get_irn_dbg_info(node);
+	ir_node  *const block        = be_transform_nodes_block(node);
+	ir_mode  *const element_mode = get_vector_element_mode(get_irn_mode(node));
+	int       const n_elems      = get_Pack_n_elems(node);
+	ir_node **const vals         = ALLOCAN(ir_node*, n_elems);
+	for (int i = 0; i < n_elems; ++i) {
+		ir_node *const new_elem = be_transform_node(get_Pack_elem(node, i));
+		if (mode_is_float(element_mode)) {
+			vals[i] = new_elem;
+		} else {
+			x86_addr_t const addr = {
+				.base_input = 0,
+				.variant    = X86_ADDR_REG,
+			};
+			x86_insn_size_t const size
+				= get_size_32_64_from_mode(element_mode);
+			vals[i] = new_bd_amd64_movd_gp_xmm(dbgi, block, new_elem, size,
+			                                   AMD64_OP_REG, addr);
+		}
+	}
+
+	x86_insn_size_t size = x86_size_from_mode(element_mode);
+	for (int n = n_elems; n > 1; n /= 2) {
+		construct_binop_func cons;
+		x86_insn_size_t      next_size;
+		switch (size) {
+		case X86_SIZE_8:
+			cons      = new_bd_amd64_punpcklbw;
+			next_size = X86_SIZE_16;
+			break;
+		case X86_SIZE_16:
+			cons      = new_bd_amd64_punpcklwd;
+			next_size = X86_SIZE_32;
+			break;
+		case X86_SIZE_32:
+			cons      = new_bd_amd64_punpckldq;
+			next_size = X86_SIZE_64;
+			break;
+		case X86_SIZE_64:
+			cons      = new_bd_amd64_punpcklqdq;
+			next_size = X86_SIZE_128;
+			break;
+		default:
+			panic("cannot pack elements of %+F", element_mode);
+		}
+		for (int i = 0; i < n / 2; ++i) {
+			ir_node *const unpack = new_vector_binop(dbgi, block, vals[2 * i],
+			                                         vals[2 * i + 1], cons,
+			                                         size);
+			vals[i] = be_new_Proj(unpack, pn_amd64_punpckldq_res);
+		}
+		size = next_size;
+	}
+	return vals[0];
+}
+
 static ir_node *gen_amd64_l_punpckldq(ir_node *const node)
 {
 	ir_node *const op0 = get_irn_n(node, n_amd64_l_punpckldq_arg0);
@@ -3263,6 +3418,7 @@ static void amd64_register_transformers(void)
 	be_set_transform_function(op_Mulh,              gen_Mulh);
 	be_set_transform_function(op_Not,               gen_Not);
 	be_set_transform_function(op_Or,                gen_Or);
+	be_set_transform_function(op_Pack,              gen_Pack);
 	be_set_transform_function(op_Phi,               gen_Phi);
 	be_set_transform_function(op_Return,            gen_Return);
 	be_set_transform_function(op_Shl,               gen_Shl);
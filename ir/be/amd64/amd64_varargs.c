@@ -37,16 +37,16 @@ static struct va_list_members {
 	ir_entity *stack_args_ptr;
 } va_list_members;
 
-static size_t            n_gp_params;
-static size_t            n_xmm_params;
+static THREAD_LOCAL size_t            n_gp_params;
+static THREAD_LOCAL size_t            n_xmm_params;
 /* The register save area, and the slots for GP and XMM registers
  * inside of it. */
-static ir_entity        *reg_save_area;
-static ir_entity       **gp_save_slots;
-static ir_entity       **xmm_save_slots;
+static THREAD_LOCAL ir_entity        *reg_save_area;
+static THREAD_LOCAL ir_entity       **gp_save_slots;
+static THREAD_LOCAL ir_entity       **xmm_save_slots;
 /* Parameter entity pointing to the first variadic parameter on the
  * stack. */
-static ir_entity        *stack_args_param;
+static THREAD_LOCAL ir_entity        *stack_args_param;
 
 static const size_t n_gp_args  =  6;
 static const size_t n_xmm_args =  8;
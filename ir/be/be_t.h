@@ -16,6 +16,7 @@
 
 #include "be.h"
 #include "be_types.h"
+#include "compiler.h"
 #include "firm_types.h"
 #include "pmap.h"
 #include "timing.h"
@@ -37,10 +38,14 @@ struct be_options_t {
 	bool timing;               /**< time the backend phases */
 	bool opt_profile_generate; /**< instrument code for profiling */
 	bool opt_profile_use;      /**< use existing profile data */
+	bool opt_profile_edges;    /**< profile edges instead of blocks */
+	bool opt_profile_values;   /**< profile switch selectors and call targets */
 	bool omit_fp;              /**< try to omit the frame pointer */
 	bool do_verify;            /**< backend verify option */
 	char ilp_solver[128];      /**< the ilp solver name */
 	bool verbose_asm;          /**< dump verbose assembler */
+	bool compact_graphs;       /**< compact graphs before code generation */
+	int  threads;              /**< number of threads generating code */
 };
 extern be_options_t be_options;
 
@@ -103,12 +108,19 @@ typedef enum {
 } be_timer_id_t;
 ENUM_COUNTABLE(be_timer_id_t)
 extern ir_timer_t *be_timers[T_LAST+1];
+/** Node memory allocated by this thread while a timer was the innermost
+ * running one. */
+extern THREAD_LOCAL size_t be_timer_memory[T_LAST+1];
+
+void be_timer_memory_push(be_timer_id_t id);
+void be_timer_memory_pop(be_timer_id_t id);
 
 static inline void be_timer_push(be_timer_id_t id)
 {
 	assert(id <= T_LAST);
 	if (!be_timing)
 		return;
+	be_timer_memory_push(id);
 	ir_timer_push(be_timers[id]);
 }
 
@@ -118,6 +130,7 @@ static inline void be_timer_pop(be_timer_id_t id)
 	if (!be_timing)
 		return;
 	ir_timer_pop(be_timers[id]);
+	be_timer_memory_pop(id);
 }
 
 /**
@@ -149,6 +162,16 @@ bool be_step_first(ir_graph *irg);
 void be_step_regalloc(ir_graph *irg, const regalloc_if_t *regif);
 void be_step_schedule(ir_graph *irg);
 void be_step_last(ir_graph *irg);
+
+/** Generates the code of a graph, from be_step_first() to be_step_last(). */
+typedef void be_compile_func(ir_graph *irg, void *data);
+
+/**
+ * Calls @p compile for all graphs of the program. With the threads option
+ * several graphs are compiled concurrently, their texts still appear in the
+ * order chosen by be_begin().
+ */
+void be_compile_graphs(be_compile_func *compile, void *data);
 /** @} */
 
 #endif
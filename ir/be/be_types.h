@@ -62,6 +62,7 @@ typedef struct be_options_t    be_options_t;
 typedef struct regalloc_if_t   regalloc_if_t;
 
 typedef struct be_register_name_t be_register_name_t;
+typedef struct be_elf_target_t    be_elf_target_t;
 
 /** Additional register pressure applied to before (positive value) or after
  * (negative value) a instruction. */
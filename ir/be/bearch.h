@@ -295,6 +295,12 @@ struct arch_isa_if_t {
 
 	void (*emit_function)(char *buffer, ir_jit_function_t *function);
 
+	/**
+	 * Description of the ELF relocations of the code produced by
+	 * jit_compile(). Necessary for writing object files, may be NULL.
+	 */
+	be_elf_target_t const *elf_target;
+
 	/**
 	 * lowers current program for target. See the documentation for
 	 * be_lower_for_target() for details.
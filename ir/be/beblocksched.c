@@ -18,6 +18,16 @@
  * to change as many edges to fallthroughs as possible, this is done by setting
  * a next and prev pointers on blocks. The greedy algorithm sorts the edges by
  * execution frequencies and tries to transform them to fallthroughs in this order
+ *
+ * The default ExtTSP algorithm (see Newell and Pupyrev: "Improved Basic Block
+ * Reordering") additionally rewards short forward and backward jumps. It starts
+ * with a chain per block and repeatedly merges the two chains, whose merge
+ * increases the ExtTSP score the most. Merges may split one of the chains once
+ * to put the other one in between.
+ *
+ * Blocks, which were never executed in a profiled run of their function, are
+ * placed at the end of the schedule. The emitter may move them into a separate
+ * section.
  */
 #include "beblocksched.h"
 
@@ -25,18 +35,47 @@
 #include "beirg.h"
 #include "bemodule.h"
 #include "besched.h"
+#include "bitset.h"
 #include "debug.h"
 #include "execfreq.h"
 #include "iredges_t.h"
 #include "irgmod.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "irprofile.h"
+#include "irtools.h"
+#include "lc_opts.h"
+#include "lc_opts_enum.h"
 #include "pdeq.h"
 #include "util.h"
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
-static bool blocks_removed;
+typedef enum blocksched_algo_t {
+	BLOCKSCHED_GREEDY,
+	BLOCKSCHED_EXTTSP,
+} blocksched_algo_t;
+
+static int  algo       = BLOCKSCHED_EXTTSP;
+static bool split_cold = true;
+
+static const lc_opt_enum_int_items_t algo_items[] = {
+	{ "greedy", BLOCKSCHED_GREEDY },
+	{ "exttsp", BLOCKSCHED_EXTTSP },
+	{ NULL,     0                 }
+};
+
+static lc_opt_enum_int_var_t algo_var = {
+	&algo, algo_items
+};
+
+static const lc_opt_table_entry_t blocksched_options[] = {
+	LC_OPT_ENT_ENUM_INT("algo",      "block scheduling algorithm",                        &algo_var),
+	LC_OPT_ENT_BOOL    ("splitcold", "move blocks never executed in the profile to the end", &split_cold),
+	LC_OPT_LAST
+};
+
+static THREAD_LOCAL bool blocks_removed;
 
 /**
  * Post-block-walker: Find blocks containing only one jump and
@@ -137,6 +176,87 @@ static void remove_empty_blocks(ir_graph *irg)
 		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
 }
 
+/**
+ * Returns the block, which @p block implicitly falls through into, or NULL.
+ */
+static ir_node *get_forced_pred(ir_node const *const block)
+{
+	if (get_Block_n_cfgpreds(block) != 1)
+		return NULL;
+	ir_node *const pred = get_Block_cfgpred(block, 0);
+	return is_x_regular_Proj(pred) ? get_nodes_block(pred) : NULL;
+}
+
+/** the blocks of the current graph, which belong to the cold end */
+static THREAD_LOCAL bitset_t *cold_blocks;
+
+static void collect_block(ir_node *const block, void *const data)
+{
+	ir_node ***const blocks = (ir_node***)data;
+	ARR_APP1(ir_node*, *blocks, block);
+}
+
+/**
+ * Check whether the cold end of the block schedule gets @p block from its
+ * predecessors: A block, which its predecessor falls through into, stays
+ * with it. Blocks without profile data, like the ones created by lowering
+ * after profiling, are cold, if only cold blocks lead to them.
+ */
+static bool inherits_coldness(ir_node const *const block)
+{
+	if (get_Block_n_cfgpreds(block) == 0)
+		return false;
+	if (get_forced_pred(block) != NULL)
+		return true;
+	return !ir_profile_is_block_cold(block)
+	    && ir_profile_get_block_execcount(block) == 0;
+}
+
+static void compute_cold_blocks(ir_graph *const irg)
+{
+	cold_blocks = bitset_malloc(get_irg_last_idx(irg));
+	if (!split_cold || !ir_profile_has_data())
+		return;
+
+	ir_node **blocks = NEW_ARR_F(ir_node*, 0);
+	irg_block_walk_graph(irg, NULL, collect_block, &blocks);
+
+	/* assume the inheriting blocks to be cold, until a hot predecessor turns
+	 * up, so that loops of them can be cold */
+	for (size_t i = 0, n = ARR_LEN(blocks); i < n; ++i) {
+		ir_node *const block = blocks[i];
+		if (inherits_coldness(block) || ir_profile_is_block_cold(block))
+			bitset_set(cold_blocks, get_irn_idx(block));
+	}
+	for (bool changed = true; changed;) {
+		changed = false;
+		/* reverse postorder */
+		for (size_t i = ARR_LEN(blocks); i-- > 0;) {
+			ir_node *const block = blocks[i];
+			unsigned const idx   = get_irn_idx(block);
+			if (!bitset_is_set(cold_blocks, idx) || !inherits_coldness(block))
+				continue;
+			for (int p = 0, n = get_Block_n_cfgpreds(block); p < n; ++p) {
+				ir_node *const pred = get_Block_cfgpred_block(block, p);
+				if (!bitset_is_set(cold_blocks, get_irn_idx(pred))) {
+					bitset_clear(cold_blocks, idx);
+					changed = true;
+					break;
+				}
+			}
+		}
+	}
+	DEL_ARR_F(blocks);
+}
+
+/**
+ * Check whether @p block belongs to the cold end of the block schedule.
+ */
+static bool is_cold_block(ir_node const *const block)
+{
+	return bitset_is_set(cold_blocks, get_irn_idx(block));
+}
+
 typedef struct blocksched_entry_t blocksched_entry_t;
 struct blocksched_entry_t {
 	ir_node            *block;
@@ -221,7 +341,10 @@ static void collect_egde_frequency(ir_node *block, void *data)
 		edge.block = block;
 		for (int i = 0; i < arity; ++i) {
 			ir_node *const pred_block = get_Block_cfgpred_block(block, i);
-			double   const execfreq   = get_block_execfreq(pred_block);
+			double         execfreq;
+			/* prefer the exact frequency from an edge profile */
+			if (!ir_profile_get_edge_execfreq(block, i, &execfreq))
+				execfreq = get_block_execfreq(pred_block);
 
 			edge.pos              = i;
 			edge.execfreq         = execfreq;
@@ -532,7 +655,30 @@ static ir_node **create_blocksched_array(blocksched_env_t *const env)
 	return block_list;
 }
 
-ir_node **be_create_block_schedule(ir_graph *irg)
+/**
+ * Moves the cold blocks to the end of the block schedule, keeping the order of
+ * the hot and of the cold blocks.
+ * @return the number of hot blocks
+ */
+static unsigned partition_cold_blocks(ir_node **const block_list)
+{
+	ir_node       **cold  = NEW_ARR_F(ir_node*, 0);
+	unsigned        n_hot = 0;
+	for (size_t i = 0, n = ARR_LEN(block_list); i < n; ++i) {
+		ir_node *const block = block_list[i];
+		if (is_cold_block(block))
+			ARR_APP1(ir_node*, cold, block);
+		else
+			block_list[n_hot++] = block;
+	}
+	for (size_t i = 0, n = ARR_LEN(cold); i < n; ++i)
+		block_list[n_hot + i] = cold[i];
+	DEL_ARR_F(cold);
+	return n_hot;
+}
+
+static ir_node **create_greedy_schedule(ir_graph *const irg,
+                                        unsigned *const n_hot)
 {
 	blocksched_env_t env = {
 		.irg        = irg,
@@ -557,11 +703,571 @@ ir_node **be_create_block_schedule(ir_graph *irg)
 	DEL_ARR_F(env.edges);
 	obstack_free(&env.obst, NULL);
 
+	*n_hot = partition_cold_blocks(block_list);
+	return block_list;
+}
+
+/* ExtTSP parameters from the paper */
+#define TSP_FORWARD_WEIGHT    0.1
+#define TSP_BACKWARD_WEIGHT   0.1
+#define TSP_FORWARD_DISTANCE  1024
+#define TSP_BACKWARD_DISTANCE 640
+/** Do not try to split chains with more blocks */
+#define TSP_SPLIT_THRESHOLD   128
+/** Estimated number of bytes per instruction */
+#define TSP_INSN_SIZE         4
+#define TSP_MIN_GAIN          1e-8
+
+typedef struct tsp_chain_t tsp_chain_t;
+typedef struct tsp_edge_t  tsp_edge_t;
+
+typedef struct tsp_block_t tsp_block_t;
+struct tsp_block_t {
+	ir_node     *block;
+	tsp_chain_t *chain;
+	tsp_block_t *forced_succ; /**< block, which must follow this one */
+	unsigned     size;        /**< estimated code size in bytes */
+	unsigned     address;     /**< address in the layout being evaluated */
+	double       freq;
+};
+
+typedef struct tsp_jump_t {
+	tsp_block_t *src;
+	tsp_block_t *dst;
+	double       freq;
+} tsp_jump_t;
+
+struct tsp_chain_t {
+	tsp_block_t **blocks; /**< the blocks in layout order, NULL if merged */
+	tsp_jump_t  **jumps;  /**< jumps between blocks of this chain */
+	tsp_edge_t  **edges;  /**< edges to other chains */
+	unsigned      id;
+	unsigned      size;
+	double        freq;   /**< sum of the block frequencies */
+	double        score;  /**< ExtTSP score of the jumps of this chain */
+	bool          cold;
+};
+
+typedef enum merge_kind_t {
+	MERGE_X_Y,
+	MERGE_X1_Y_X2,
+	MERGE_Y_X2_X1,
+	MERGE_X2_X1_Y,
+} merge_kind_t;
+
+typedef struct tsp_merge_t {
+	double       gain;
+	merge_kind_t kind;
+	size_t       split; /**< number of blocks in X1 */
+} tsp_merge_t;
+
+/** All jumps between two chains. */
+struct tsp_edge_t {
+	tsp_chain_t *chains[2];
+	tsp_jump_t **jumps;
+	/** best merge with chains[i] as X, valid if cached[i] is set */
+	tsp_merge_t  merge[2];
+	bool         cached[2];
+};
+
+typedef struct tsp_env_t {
+	struct obstack  obst;
+	tsp_block_t   **blocks;
+	tsp_chain_t   **chains;
+	tsp_chain_t    *entry;
+} tsp_env_t;
+
+typedef struct tsp_range_t {
+	tsp_block_t *const *begin;
+	tsp_block_t *const *end;
+} tsp_range_t;
+
+static double get_jump_score(tsp_jump_t const *const jump)
+{
+	unsigned const src_end = jump->src->address + jump->src->size;
+	unsigned const dst     = jump->dst->address;
+	if (dst == src_end)
+		return jump->freq;
+	if (dst > src_end) {
+		unsigned const distance = dst - src_end;
+		if (distance <= TSP_FORWARD_DISTANCE)
+			return TSP_FORWARD_WEIGHT * jump->freq
+			     * (1.0 - (double)distance / TSP_FORWARD_DISTANCE);
+	} else {
+		unsigned const distance = src_end - dst;
+		if (distance <= TSP_BACKWARD_DISTANCE)
+			return TSP_BACKWARD_WEIGHT * jump->freq
+			     * (1.0 - (double)distance / TSP_BACKWARD_DISTANCE);
+	}
+	return 0.0;
+}
+
+static double get_jumps_score(tsp_jump_t *const *const jumps)
+{
+	double score = 0.0;
+	for (size_t i = 0, n = ARR_LEN(jumps); i < n; ++i)
+		score += get_jump_score(jumps[i]);
+	return score;
+}
+
+/**
+ * Splits the blocks of @p x and @p y into the ranges, which form the order
+ * of the merged chain.
+ */
+static void get_merge_ranges(tsp_chain_t const *const x,
+                             tsp_chain_t const *const y,
+                             merge_kind_t const kind, size_t const split,
+                             tsp_range_t ranges[3])
+{
+	tsp_block_t *const *const xb = x->blocks;
+	tsp_block_t *const *const yb = y->blocks;
+	tsp_range_t const x1 = { xb,         xb + split          };
+	tsp_range_t const x2 = { xb + split, xb + ARR_LEN(xb)    };
+	tsp_range_t const yr = { yb,         yb + ARR_LEN(yb)    };
+	switch (kind) {
+	case MERGE_X_Y:     ranges[0] = x1; ranges[1] = x2; ranges[2] = yr; return;
+	case MERGE_X1_Y_X2: ranges[0] = x1; ranges[1] = yr; ranges[2] = x2; return;
+	case MERGE_Y_X2_X1: ranges[0] = yr; ranges[1] = x2; ranges[2] = x1; return;
+	case MERGE_X2_X1_Y: ranges[0] = x2; ranges[1] = x1; ranges[2] = yr; return;
+	}
+	panic("invalid merge kind");
+}
+
+static void assign_addresses(tsp_range_t const *const ranges, size_t const n)
+{
+	unsigned address = 0;
+	for (size_t i = 0; i < n; ++i) {
+		for (tsp_block_t *const *b = ranges[i].begin; b != ranges[i].end; ++b) {
+			(*b)->address = address;
+			address      += (*b)->size;
+		}
+	}
+}
+
+static double get_merge_gain(tsp_edge_t const *const edge,
+                             tsp_chain_t const *const x,
+                             tsp_chain_t const *const y,
+                             merge_kind_t const kind, size_t const split)
+{
+	tsp_range_t ranges[3];
+	get_merge_ranges(x, y, kind, split, ranges);
+	assign_addresses(ranges, ARRAY_SIZE(ranges));
+
+	/* the jumps inside of y keep their distances and so does x, unless it is
+	 * split */
+	double gain = get_jumps_score(edge->jumps);
+	if (kind != MERGE_X_Y)
+		gain += get_jumps_score(x->jumps) - x->score;
+	return gain;
+}
+
+static void try_merge(tsp_merge_t *const best, tsp_edge_t const *const edge,
+                      tsp_chain_t const *const x, tsp_chain_t const *const y,
+                      merge_kind_t const kind, size_t const split)
+{
+	double const gain = get_merge_gain(edge, x, y, kind, split);
+	if (gain > best->gain) {
+		best->gain  = gain;
+		best->kind  = kind;
+		best->split = split;
+	}
+}
+
+/**
+ * Finds the best way to merge the chain @p y into @p x.
+ */
+static tsp_merge_t find_best_merge(tsp_env_t const *const env,
+                                   tsp_edge_t const *const edge,
+                                   tsp_chain_t const *const x,
+                                   tsp_chain_t const *const y)
+{
+	tsp_merge_t best = { .gain = -1.0, .kind = MERGE_X_Y, .split = 0 };
+	/* the entry block stays first */
+	if (y == env->entry)
+		return best;
+
+	try_merge(&best, edge, x, y, MERGE_X_Y, 0);
+
+	size_t const n = ARR_LEN(x->blocks);
+	if (n > TSP_SPLIT_THRESHOLD)
+		return best;
+	for (size_t split = 1; split < n; ++split) {
+		/* do not separate blocks from their forced successors */
+		if (x->blocks[split - 1]->forced_succ == x->blocks[split])
+			continue;
+		try_merge(&best, edge, x, y, MERGE_X1_Y_X2, split);
+		if (x == env->entry)
+			continue;
+		try_merge(&best, edge, x, y, MERGE_Y_X2_X1, split);
+		try_merge(&best, edge, x, y, MERGE_X2_X1_Y, split);
+	}
+	return best;
+}
+
+static tsp_chain_t *new_chain(tsp_env_t *const env, tsp_block_t *const block)
+{
+	tsp_chain_t *const chain = OALLOCZ(&env->obst, tsp_chain_t);
+	chain->blocks = NEW_ARR_F(tsp_block_t*, 0);
+	chain->jumps  = NEW_ARR_F(tsp_jump_t*, 0);
+	chain->edges  = NEW_ARR_F(tsp_edge_t*, 0);
+	chain->id     = ARR_LEN(env->chains);
+	chain->cold   = true;
+	for (tsp_block_t *b = block; b != NULL; b = b->forced_succ) {
+		ARR_APP1(tsp_block_t*, chain->blocks, b);
+		b->chain     = chain;
+		chain->size += b->size;
+		chain->freq += b->freq;
+		chain->cold &= is_cold_block(b->block);
+	}
+	ARR_APP1(tsp_chain_t*, env->chains, chain);
+	return chain;
+}
+
+static tsp_edge_t *find_edge(tsp_chain_t const *const a,
+                             tsp_chain_t const *const b)
+{
+	for (size_t i = 0, n = ARR_LEN(a->edges); i < n; ++i) {
+		tsp_edge_t *const edge = a->edges[i];
+		if (edge->chains[0] == b || edge->chains[1] == b)
+			return edge;
+	}
+	return NULL;
+}
+
+static void remove_edge(tsp_chain_t *const chain, tsp_edge_t const *const edge)
+{
+	tsp_edge_t **const edges = chain->edges;
+	size_t       const n     = ARR_LEN(edges);
+	for (size_t i = 0; i < n; ++i) {
+		if (edges[i] == edge) {
+			edges[i] = edges[n - 1];
+			ARR_SHRINKLEN(chain->edges, n - 1);
+			return;
+		}
+	}
+	panic("edge not found");
+}
+
+static void add_jump(tsp_env_t *const env, tsp_jump_t *const jump)
+{
+	tsp_chain_t *const a = jump->src->chain;
+	tsp_chain_t *const b = jump->dst->chain;
+	if (a == b) {
+		ARR_APP1(tsp_jump_t*, a->jumps, jump);
+		return;
+	}
+
+	tsp_edge_t *edge = find_edge(a, b);
+	if (edge == NULL) {
+		edge = OALLOCZ(&env->obst, tsp_edge_t);
+		edge->chains[0] = a;
+		edge->chains[1] = b;
+		edge->jumps     = NEW_ARR_F(tsp_jump_t*, 0);
+		ARR_APP1(tsp_edge_t*, a->edges, edge);
+		ARR_APP1(tsp_edge_t*, b->edges, edge);
+	}
+	ARR_APP1(tsp_jump_t*, edge->jumps, jump);
+}
+
+static void update_chain_score(tsp_chain_t *const chain)
+{
+	tsp_range_t const range = {
+		chain->blocks, chain->blocks + ARR_LEN(chain->blocks)
+	};
+	assign_addresses(&range, 1);
+	chain->score = get_jumps_score(chain->jumps);
+}
+
+static void collect_tsp_block(ir_node *const block, void *const data)
+{
+	tsp_env_t *const env = (tsp_env_t*)data;
+	if (block == get_irg_end_block(get_irn_irg(block)))
+		return;
+
+	unsigned n_insns = 0;
+	sched_foreach(block, node) {
+		++n_insns;
+	}
+
+	tsp_block_t *const tsp_block = OALLOCZ(&env->obst, tsp_block_t);
+	tsp_block->block = block;
+	tsp_block->size  = MAX(n_insns * TSP_INSN_SIZE, 1);
+	tsp_block->freq  = get_block_execfreq(block);
+	set_irn_link(block, tsp_block);
+	ARR_APP1(tsp_block_t*, env->blocks, tsp_block);
+}
+
+static unsigned get_n_block_succs(ir_node const *const block)
+{
+	unsigned n = 0;
+	foreach_block_succ(block, edge) {
+		++n;
+	}
+	return n;
+}
+
+/**
+ * Returns the execution frequency of the control flow edge into @p block at
+ * cfgpred @p pos.
+ */
+static double get_jump_freq(ir_node const *const block, int const pos)
+{
+	double freq;
+	if (ir_profile_get_edge_execfreq(block, pos, &freq))
+		return freq;
+
+	ir_node *const pred_block = get_Block_cfgpred_block(block, pos);
+	double   const block_freq = get_block_execfreq(block);
+	double   const pred_freq  = get_block_execfreq(pred_block);
+	if (get_Block_n_cfgpreds(block) == 1)
+		return block_freq;
+	if (get_n_block_succs(pred_block) == 1)
+		return pred_freq;
+	return MIN(block_freq, pred_freq);
+}
+
+static void create_tsp_chains(tsp_env_t *const env, ir_graph *const irg)
+{
+	tsp_block_t **const blocks = env->blocks;
+	for (size_t i = 0, n = ARR_LEN(blocks); i < n; ++i) {
+		ir_node *const forced_pred = get_forced_pred(blocks[i]->block);
+		if (forced_pred == NULL)
+			continue;
+		tsp_block_t *const pred = (tsp_block_t*)get_irn_link(forced_pred);
+		pred->forced_succ = blocks[i];
+	}
+
+	/* blocks with a forced predecessor are added with it */
+	for (size_t i = 0, n = ARR_LEN(blocks); i < n; ++i) {
+		if (get_forced_pred(blocks[i]->block) == NULL)
+			(void)new_chain(env, blocks[i]);
+	}
+	ir_node *const start_block = get_irg_start_block(irg);
+	env->entry = ((tsp_block_t*)get_irn_link(start_block))->chain;
+
+	for (size_t i = 0, n = ARR_LEN(blocks); i < n; ++i) {
+		tsp_block_t *const dst   = blocks[i];
+		ir_node     *const block = dst->block;
+		for (int p = 0, arity = get_Block_n_cfgpreds(block); p < arity; ++p) {
+			if (is_Bad(get_Block_cfgpred(block, p)))
+				continue;
+			ir_node *const pred_block = get_Block_cfgpred_block(block, p);
+			if (pred_block == block)
+				continue;
+			tsp_jump_t *const jump = OALLOC(&env->obst, tsp_jump_t);
+			jump->src  = (tsp_block_t*)get_irn_link(pred_block);
+			jump->dst  = dst;
+			jump->freq = get_jump_freq(block, p);
+			add_jump(env, jump);
+		}
+	}
+
+	for (size_t i = 0, n = ARR_LEN(env->chains); i < n; ++i)
+		update_chain_score(env->chains[i]);
+}
+
+/**
+ * Merges @p y into @p x in the order described by @p merge.
+ */
+static void merge_chains(tsp_chain_t *const x, tsp_chain_t *const y,
+                         tsp_edge_t *const edge, tsp_merge_t const *const merge)
+{
+	DB((dbg, LEVEL_2, "merge chain %u into %u (kind %d, split %zu, gain %.3g)\n",
+	    y->id, x->id, (int)merge->kind, merge->split, merge->gain));
+
+	tsp_range_t ranges[3];
+	get_merge_ranges(x, y, merge->kind, merge->split, ranges);
+	tsp_block_t **blocks = NEW_ARR_F(tsp_block_t*, 0);
+	for (size_t i = 0; i < ARRAY_SIZE(ranges); ++i) {
+		for (tsp_block_t *const *b = ranges[i].begin; b != ranges[i].end; ++b) {
+			(*b)->chain = x;
+			ARR_APP1(tsp_block_t*, blocks, *b);
+		}
+	}
+	DEL_ARR_F(x->blocks);
+	DEL_ARR_F(y->blocks);
+	x->blocks = blocks;
+	y->blocks = NULL;
+	x->size  += y->size;
+	x->freq  += y->freq;
+
+	for (size_t i = 0, n = ARR_LEN(y->jumps); i < n; ++i)
+		ARR_APP1(tsp_jump_t*, x->jumps, y->jumps[i]);
+	for (size_t i = 0, n = ARR_LEN(edge->jumps); i < n; ++i)
+		ARR_APP1(tsp_jump_t*, x->jumps, edge->jumps[i]);
+	DEL_ARR_F(y->jumps);
+	DEL_ARR_F(edge->jumps);
+	update_chain_score(x);
+
+	remove_edge(x, edge);
+	remove_edge(y, edge);
+
+	/* redirect the edges of y to x */
+	for (size_t i = 0, n = ARR_LEN(y->edges); i < n; ++i) {
+		tsp_edge_t  *const y_edge = y->edges[i];
+		unsigned     const idx    = y_edge->chains[0] == y ? 0 : 1;
+		tsp_chain_t *const other  = y_edge->chains[1 - idx];
+		tsp_edge_t  *const x_edge = find_edge(x, other);
+		if (x_edge == NULL) {
+			y_edge->chains[idx] = x;
+			ARR_APP1(tsp_edge_t*, x->edges, y_edge);
+			continue;
+		}
+		for (size_t j = 0, m = ARR_LEN(y_edge->jumps); j < m; ++j)
+			ARR_APP1(tsp_jump_t*, x_edge->jumps, y_edge->jumps[j]);
+		DEL_ARR_F(y_edge->jumps);
+		remove_edge(other, y_edge);
+	}
+	DEL_ARR_F(y->edges);
+	y->edges = NULL;
+
+	/* all merges involving x have to be reevaluated */
+	for (size_t i = 0, n = ARR_LEN(x->edges); i < n; ++i) {
+		x->edges[i]->cached[0] = false;
+		x->edges[i]->cached[1] = false;
+	}
+}
+
+static void merge_tsp_chains(tsp_env_t *const env)
+{
+	for (;;) {
+		tsp_edge_t  *best_edge = NULL;
+		tsp_chain_t *best_x    = NULL;
+		tsp_merge_t  best      = { .gain = TSP_MIN_GAIN };
+		for (size_t c = 0, n_chains = ARR_LEN(env->chains); c < n_chains; ++c) {
+			tsp_chain_t *const chain = env->chains[c];
+			if (chain->blocks == NULL)
+				continue;
+			for (size_t i = 0, n = ARR_LEN(chain->edges); i < n; ++i) {
+				tsp_edge_t *const edge = chain->edges[i];
+				/* visit each edge once */
+				if (edge->chains[0] != chain)
+					continue;
+				/* keep hot and cold blocks apart */
+				if (edge->chains[0]->cold != edge->chains[1]->cold)
+					continue;
+				for (unsigned idx = 0; idx < 2; ++idx) {
+					tsp_chain_t *const x = edge->chains[idx];
+					tsp_chain_t *const y = edge->chains[1 - idx];
+					if (!edge->cached[idx]) {
+						edge->merge[idx]  = find_best_merge(env, edge, x, y);
+						edge->cached[idx] = true;
+					}
+					if (edge->merge[idx].gain > best.gain) {
+						best      = edge->merge[idx];
+						best_edge = edge;
+						best_x    = x;
+					}
+				}
+			}
+		}
+		if (best_edge == NULL)
+			break;
+
+		unsigned     const idx = best_edge->chains[0] == best_x ? 0 : 1;
+		tsp_chain_t *const y   = best_edge->chains[1 - idx];
+		merge_chains(best_x, y, best_edge, &best);
+	}
+}
+
+static int cmp_tsp_chains(void const *const a, void const *const b)
+{
+	tsp_chain_t const *const c0 = *(tsp_chain_t const *const*)a;
+	tsp_chain_t const *const c1 = *(tsp_chain_t const *const*)b;
+	if (c0->cold != c1->cold)
+		return c0->cold ? 1 : -1;
+	/* place chains with denser execution first */
+	double const density0 = c0->freq / c0->size;
+	double const density1 = c1->freq / c1->size;
+	if (density0 != density1)
+		return density0 < density1 ? 1 : -1;
+	return c0->id < c1->id ? -1 : c0->id > c1->id ? 1 : 0;
+}
+
+static ir_node **create_exttsp_schedule(ir_graph *const irg,
+                                        unsigned *const n_hot)
+{
+	remove_empty_blocks(irg);
+
+	tsp_env_t env = {
+		.blocks = NEW_ARR_F(tsp_block_t*, 0),
+		.chains = NEW_ARR_F(tsp_chain_t*, 0),
+	};
+	obstack_init(&env.obst);
+
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
+	irg_block_walk_graph(irg, collect_tsp_block, NULL, &env);
+	create_tsp_chains(&env, irg);
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+
+	merge_tsp_chains(&env);
+
+	tsp_chain_t **chains = NEW_ARR_F(tsp_chain_t*, 0);
+	for (size_t i = 0, n = ARR_LEN(env.chains); i < n; ++i) {
+		tsp_chain_t *const chain = env.chains[i];
+		if (chain->blocks != NULL && chain != env.entry)
+			ARR_APP1(tsp_chain_t*, chains, chain);
+	}
+	QSORT_ARR(chains, cmp_tsp_chains);
+
+	struct obstack *const obst       = be_get_be_obst(irg);
+	size_t          const n_blocks   = ARR_LEN(env.blocks);
+	ir_node       **const block_list = NEW_ARR_D(ir_node*, obst, n_blocks);
+	size_t                pos        = 0;
+	*n_hot = 0;
+	DB((dbg, LEVEL_1, "Blockschedule:\n"));
+	for (size_t i = 0, n = ARR_LEN(chains); i <= n; ++i) {
+		tsp_chain_t *const chain = i == 0 ? env.entry : chains[i - 1];
+		for (size_t b = 0, n_chain = ARR_LEN(chain->blocks); b < n_chain; ++b) {
+			ir_node *const block = chain->blocks[b]->block;
+			DB((dbg, LEVEL_1, "\t%+F%s\n", block, chain->cold ? " (cold)" : ""));
+			block_list[pos++] = block;
+		}
+		if (!chain->cold)
+			*n_hot = pos;
+	}
+	assert(pos == n_blocks);
+
+	for (size_t i = 0, n = ARR_LEN(env.chains); i < n; ++i) {
+		tsp_chain_t *const chain = env.chains[i];
+		if (chain->blocks == NULL)
+			continue;
+		DEL_ARR_F(chain->blocks);
+		DEL_ARR_F(chain->jumps);
+		for (size_t e = 0, n_edges = ARR_LEN(chain->edges); e < n_edges; ++e) {
+			tsp_edge_t *const edge = chain->edges[e];
+			if (edge->chains[0] == chain)
+				DEL_ARR_F(edge->jumps);
+		}
+		DEL_ARR_F(chain->edges);
+	}
+	DEL_ARR_F(chains);
+	DEL_ARR_F(env.chains);
+	DEL_ARR_F(env.blocks);
+	obstack_free(&env.obst, NULL);
+
+	return block_list;
+}
+
+ir_node **be_create_block_schedule(ir_graph *irg)
+{
+	compute_cold_blocks(irg);
+	unsigned        n_hot;
+	ir_node **const block_list = algo == BLOCKSCHED_GREEDY
+		? create_greedy_schedule(irg, &n_hot)
+		: create_exttsp_schedule(irg, &n_hot);
+	be_birg_from_irg(irg)->n_hot_blocks = n_hot;
+	free(cold_blocks);
+	cold_blocks = NULL;
 	return block_list;
 }
 
 BE_REGISTER_MODULE_CONSTRUCTOR(be_init_blocksched)
 void be_init_blocksched(void)
 {
+	lc_opt_entry_t *be_grp    = lc_opt_get_grp(firm_opt_get_root(), "be");
+	lc_opt_entry_t *sched_grp = lc_opt_get_grp(be_grp, "blocksched");
+	lc_opt_add_table(sched_grp, blocksched_options);
+
 	FIRM_DBG_REGISTER(dbg, "firm.be.blocksched");
 }
@@ -51,7 +51,7 @@ typedef struct pair_entry {
 	bool          is_def;
 } pair_entry_t;
 
-static unsigned n_regs;
+static THREAD_LOCAL unsigned n_regs;
 
 static int compare_entries(const void *a, const void *b)
 {
@@ -147,7 +147,7 @@ void check_for_memory_operands(ir_graph *irg, const regalloc_if_t *regif)
 	irg_walk_graph(irg, NULL, memory_operand_walker, (void*)regif);
 }
 
-static be_node_stats_t last_node_stats;
+static THREAD_LOCAL be_node_stats_t last_node_stats;
 
 /**
  * Perform things which need to be done per register class before spilling.
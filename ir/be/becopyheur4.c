@@ -56,7 +56,7 @@ static firm_dbg_module_t *dbg = NULL;
 typedef float real_t;
 #define REAL(C)   (C ## f)
 
-static unsigned last_chunk_id;
+static THREAD_LOCAL unsigned last_chunk_id;
 static int      recolor_limit     = 7;
 static double   dislike_influence = REAL(0.1);
 
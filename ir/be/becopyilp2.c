@@ -552,8 +552,6 @@ static int co_solve_ilp2(copy_opt_t *const co)
 	ASSERT_OU_AVAIL(co); //See build_clique_st
 	ASSERT_GS_AVAIL(co);
 
-	FIRM_DBG_REGISTER(dbg, "firm.be.coilp2");
-
 	local_env_t my;
 	my.first_x_var = -1;
 	my.last_x_var  = -1;
@@ -573,4 +571,5 @@ void be_init_copyilp2(void)
 	};
 
 	be_register_copyopt("ilp", &copyheur);
+	FIRM_DBG_REGISTER(dbg, "firm.be.coilp2");
 }
@@ -152,6 +152,7 @@ void be_init_copyopt(void)
 	lc_opt_add_table(co_grp, options);
 	be_add_module_list_opt(co_grp, "algo", "select copy optimization algo",
 	                       &copyopts, (void**) &selected_copyopt);
+	FIRM_DBG_REGISTER(dbg, "ir.be.copyopt");
 }
 
 static int void_algo(copy_opt_t *co)
@@ -172,8 +173,6 @@ void be_init_copynone(void)
 
 static copy_opt_t *new_copy_opt(be_chordal_env_t *chordal_env, cost_fct_t get_costs)
 {
-	FIRM_DBG_REGISTER(dbg, "ir.be.copyopt");
-
 	copy_opt_t *const co = XMALLOCZ(copy_opt_t);
 	co->cenv      = chordal_env;
 	co->irg       = chordal_env->irg;
@@ -228,9 +227,9 @@ static int co_get_costs_loop_depth(const ir_node *root, int pos)
 	return cost+1;
 }
 
-static ir_execfreq_int_factors factors;
+static THREAD_LOCAL ir_execfreq_int_factors factors;
 /* Remember the graph that we computed the factors for. */
-static ir_graph               *irg_for_factors;
+static THREAD_LOCAL ir_graph               *irg_for_factors;
 
 /**
  * Computes the costs of a copy according to execution frequency
@@ -303,6 +303,11 @@ static void emit_pubnames(void)
 	emit_label("pubnames_end");
 }
 
+bool be_dwarf_enabled(void)
+{
+	return debug_level >= LEVEL_BASIC;
+}
+
 void be_dwarf_location(dbg_info *dbgi)
 {
 	if (debug_level < LEVEL_LOCATIONS)
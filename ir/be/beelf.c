@@ -0,0 +1,1011 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Writer for ELF relocatable object files.
+ *
+ * Functions are taken from the jit, so the code is produced by the binary
+ * emitters of the backend and no assembler is needed.  Relocations against
+ * entities are kept symbolic and turned into ELF relocations.  Data is
+ * written from the initializers of the global entities, following the rules
+ * of the GNU assembler emitter for sections and symbol attributes.
+ */
+#include "beelf.h"
+
+#include "array.h"
+#include "begnuas.h"
+#include "bitfiddle.h"
+#include "entity_t.h"
+#include "irnode_t.h"
+#include "irprog_t.h"
+#include "panic.h"
+#include "pmap.h"
+#include "target_t.h"
+#include "tv.h"
+#include "util.h"
+#include "xmalloc.h"
+#include <string.h>
+
+enum {
+	ELFCLASS32    = 1,
+	ELFCLASS64    = 2,
+	ELFDATA2LSB   = 1,
+	EV_CURRENT    = 1,
+	ET_REL        = 1,
+
+	SHT_NULL      = 0,
+	SHT_PROGBITS  = 1,
+	SHT_SYMTAB    = 2,
+	SHT_STRTAB    = 3,
+	SHT_RELA      = 4,
+	SHT_NOBITS    = 8,
+	SHT_REL       = 9,
+
+	SHF_WRITE     = 0x1,
+	SHF_ALLOC     = 0x2,
+	SHF_EXECINSTR = 0x4,
+	SHF_INFO_LINK = 0x40,
+	SHF_TLS       = 0x400,
+
+	STB_LOCAL     = 0,
+	STB_GLOBAL    = 1,
+	STB_WEAK      = 2,
+
+	STT_NOTYPE    = 0,
+	STT_OBJECT    = 1,
+	STT_FUNC      = 2,
+	STT_SECTION   = 3,
+	STT_FILE      = 4,
+	STT_TLS       = 6,
+
+	STV_DEFAULT   = 0,
+	STV_HIDDEN    = 2,
+	STV_PROTECTED = 3,
+
+	SHN_UNDEF     = 0,
+	SHN_ABS       = 0xFFF1,
+	SHN_COMMON    = 0xFFF2,
+};
+
+/** Alignment of functions in the text section. */
+#define FUNCTION_P2ALIGN 4
+
+typedef enum elf_section_id_t {
+	ELF_TEXT,
+	ELF_DATA,
+	ELF_RODATA,
+	ELF_DATA_REL_RO,
+	ELF_DATA_REL_RO_LOCAL,
+	ELF_BSS,
+	ELF_TDATA,
+	ELF_TBSS,
+	ELF_CTORS,
+	ELF_DTORS,
+	ELF_JCR,
+	ELF_N_SECTIONS,
+	ELF_COMMON = ELF_N_SECTIONS, /**< pseudo section of common symbols */
+} elf_section_id_t;
+
+typedef struct elf_section_info_t {
+	char const *name;
+	uint32_t    type;
+	uint32_t    flags;
+} elf_section_info_t;
+
+static elf_section_info_t const section_infos[] = {
+	[ELF_TEXT]              = { ".text",              SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR },
+	[ELF_DATA]              = { ".data",              SHT_PROGBITS, SHF_ALLOC | SHF_WRITE },
+	[ELF_RODATA]            = { ".rodata",            SHT_PROGBITS, SHF_ALLOC },
+	[ELF_DATA_REL_RO]       = { ".data.rel.ro",       SHT_PROGBITS, SHF_ALLOC | SHF_WRITE },
+	[ELF_DATA_REL_RO_LOCAL] = { ".data.rel.ro.local", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE },
+	[ELF_BSS]               = { ".bss",               SHT_NOBITS,   SHF_ALLOC | SHF_WRITE },
+	[ELF_TDATA]             = { ".tdata",             SHT_PROGBITS, SHF_ALLOC | SHF_WRITE | SHF_TLS },
+	[ELF_TBSS]              = { ".tbss",              SHT_NOBITS,   SHF_ALLOC | SHF_WRITE | SHF_TLS },
+	[ELF_CTORS]             = { ".ctors",             SHT_PROGBITS, SHF_ALLOC | SHF_WRITE },
+	[ELF_DTORS]             = { ".dtors",             SHT_PROGBITS, SHF_ALLOC | SHF_WRITE },
+	[ELF_JCR]               = { ".jcr",               SHT_PROGBITS, SHF_ALLOC | SHF_WRITE },
+};
+
+typedef struct elf_relocation_t {
+	uint64_t         offset;  /**< position in the section */
+	uint32_t         type;    /**< ELF relocation type */
+	unsigned         size;    /**< size of the relocated field */
+	ir_entity const *entity;  /**< destination, NULL for a section */
+	elf_section_id_t section; /**< destination section if entity is NULL */
+	int64_t          addend;
+} elf_relocation_t;
+
+typedef struct elf_section_t {
+	char             *data;        /**< contents, NULL for nobits sections */
+	uint64_t          size;
+	unsigned          alignment;
+	elf_relocation_t *relocations;
+	unsigned          index;       /**< section header index, 0 if omitted */
+	unsigned          rel_index;   /**< index of the relocation section */
+	unsigned          symbol;      /**< index of the section symbol */
+	uint64_t          file_offset;
+	uint64_t          rel_file_offset;
+} elf_section_t;
+
+/** Where an entity ended up. */
+typedef struct elf_location_t {
+	elf_section_id_t section; /**< ELF_COMMON for common symbols */
+	uint64_t         offset;  /**< the alignment for common symbols */
+	uint64_t         size;
+	unsigned         symbol;  /**< symbol index, 0 if none assigned yet */
+} elf_location_t;
+
+typedef struct elf_symbol_t {
+	uint32_t name;
+	uint8_t  info;
+	uint8_t  other;
+	uint16_t shndx;
+	uint64_t value;
+	uint64_t size;
+} elf_symbol_t;
+
+static be_elf_target_t const *target;
+static elf_section_t          sections[ELF_N_SECTIONS];
+static pmap                  *locations;
+static ir_entity const      **symbol_entities; /**< named entities in order */
+static ir_entity const      **aliases;
+static elf_symbol_t          *symbols;
+static char                  *strtab;
+static char                  *shstrtab;
+
+static unsigned add_string(char **const table, char const *const string)
+{
+	size_t const pos = ARR_LEN(*table);
+	size_t const len = strlen(string) + 1;
+	ARR_RESIZE(char, *table, pos + len);
+	memcpy(*table + pos, string, len);
+	return pos;
+}
+
+static elf_location_t *new_location(ir_entity const *const entity,
+                                    elf_section_id_t const section,
+                                    uint64_t const offset, uint64_t const size)
+{
+	elf_location_t *const location = XMALLOCZ(elf_location_t);
+	location->section = section;
+	location->offset  = offset;
+	location->size    = size;
+	pmap_insert(locations, entity, location);
+	if (get_entity_visibility(entity) != ir_visibility_private)
+		ARR_APP1(ir_entity const*, symbol_entities, entity);
+	return location;
+}
+
+/** Reserve @p size bytes with @p alignment at the end of a section. */
+static uint64_t reserve(elf_section_id_t const id, uint64_t const size,
+                        unsigned const alignment)
+{
+	elf_section_t *const section = &sections[id];
+	uint64_t       const offset  = round_up2(section->size, alignment);
+	if (section->data != NULL) {
+		size_t const old_len = ARR_LEN(section->data);
+		ARR_RESIZE(char, section->data, offset + size);
+		memset(section->data + old_len, 0, offset + size - old_len);
+	}
+	section->size      = offset + size;
+	section->alignment = MAX(section->alignment, alignment);
+	return offset;
+}
+
+static void add_relocation(elf_section_id_t const id, uint64_t const offset,
+                           uint32_t const type, unsigned const size,
+                           ir_entity const *const entity,
+                           elf_section_id_t const dest, int64_t const addend)
+{
+	elf_relocation_t const relocation = {
+		.offset  = offset,
+		.type    = type,
+		.size    = size,
+		.entity  = entity,
+		.section = dest,
+		.addend  = addend,
+	};
+	ARR_APP1(elf_relocation_t, sections[id].relocations, relocation);
+}
+
+void be_elf_begin(be_elf_target_t const *const elf_target)
+{
+	if (ir_target_big_endian())
+		panic("ELF writer only supports little endian targets");
+
+	target = elf_target;
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t *const section = &sections[i];
+		memset(section, 0, sizeof(*section));
+		section->alignment   = 1;
+		section->relocations = NEW_ARR_F(elf_relocation_t, 0);
+		if (section_infos[i].type != SHT_NOBITS)
+			section->data = NEW_ARR_F(char, 0);
+	}
+	locations       = pmap_create();
+	symbol_entities = NEW_ARR_F(ir_entity const*, 0);
+	aliases         = NEW_ARR_F(ir_entity const*, 0);
+	symbols         = NEW_ARR_F(elf_symbol_t, 0);
+	strtab          = NEW_ARR_F(char, 0);
+	shstrtab        = NEW_ARR_F(char, 0);
+}
+
+/** Position of the text of the function currently being written. */
+static char *text_begin;
+
+static unsigned elf_relocation_callback(char *const buffer,
+                                        uint8_t const be_kind,
+                                        ir_entity *const entity,
+                                        int32_t const offset)
+{
+	unsigned       size;
+	uint32_t const type = target->get_relocation(be_kind, entity, &size);
+	if (type == 0) {
+		if (entity != NULL)
+			panic("no ELF relocation for relocation kind %u of %+F",
+			      (unsigned)be_kind, entity);
+		return target->emit->relocation(buffer, be_kind, NULL, offset);
+	}
+
+	uint64_t const pos = buffer - text_begin;
+	if (entity != NULL) {
+		add_relocation(ELF_TEXT, pos, type, size, entity, ELF_TEXT, offset);
+	} else {
+		/* offset is relative to the relocation for code fragments */
+		add_relocation(ELF_TEXT, pos, type, size, NULL, ELF_TEXT,
+		               (int64_t)pos + offset);
+	}
+	memset(buffer, 0, size);
+	return size;
+}
+
+void be_elf_add_function(ir_entity const *const entity,
+                         ir_jit_function_t *const function)
+{
+	elf_section_t *const text   = &sections[ELF_TEXT];
+	uint64_t       const start  = text->size;
+	unsigned       const size   = be_get_function_size(function);
+	uint64_t       const offset = reserve(ELF_TEXT, size, 1U << FUNCTION_P2ALIGN);
+	if (offset > start)
+		target->emit->nops(text->data + start, offset - start);
+
+	be_jit_emit_interface_t const interface = {
+		.nops       = target->emit->nops,
+		.relocation = elf_relocation_callback,
+	};
+	text_begin = text->data;
+	be_jit_emit_memory(text->data + offset, function, &interface);
+
+	new_location(entity, ELF_TEXT, offset, size);
+}
+
+static elf_section_id_t get_data_section(ir_entity const *const entity,
+                                         bool const zero_initializer)
+{
+	be_gas_section_t const section = be_gas_get_section(entity);
+	if (section & GAS_SECTION_FLAG_TLS)
+		return zero_initializer ? ELF_TBSS : ELF_TDATA;
+	switch (section & GAS_SECTION_TYPE_MASK) {
+	case GAS_SECTION_DATA:         return ELF_DATA;
+	case GAS_SECTION_RODATA:       return ELF_RODATA;
+	case GAS_SECTION_REL_RO:       return ELF_DATA_REL_RO;
+	case GAS_SECTION_REL_RO_LOCAL: return ELF_DATA_REL_RO_LOCAL;
+	case GAS_SECTION_BSS:          return ELF_BSS;
+	case GAS_SECTION_CONSTRUCTORS: return ELF_CTORS;
+	case GAS_SECTION_DESTRUCTORS:  return ELF_DTORS;
+	case GAS_SECTION_JCR:          return ELF_JCR;
+	default:
+		panic("unsupported section for %+F", entity);
+	}
+}
+
+static void write_bytes(elf_section_id_t const id, uint64_t const offset,
+                        uint64_t const value, unsigned const size)
+{
+	char *const dest = sections[id].data + offset;
+	for (unsigned i = 0; i < size; ++i) {
+		dest[i] = (char)(value >> (i * 8));
+	}
+}
+
+static void write_tarval(elf_section_id_t const id, uint64_t const offset,
+                         ir_tarval *const tv)
+{
+	char    *const dest = sections[id].data + offset;
+	unsigned const size = get_mode_size_bytes(get_tarval_mode(tv));
+	for (unsigned i = 0; i < size; ++i) {
+		dest[i] = get_tarval_sub_bits(tv, i);
+	}
+}
+
+/**
+ * Evaluate an address expression of an initializer. Returns the entity whose
+ * address is part of the value, the rest of the value is stored in @p value.
+ */
+static ir_entity const *eval_expression(ir_node const *const node,
+                                        int64_t *const value)
+{
+	switch (get_irn_opcode(node)) {
+	case iro_Conv:
+		return eval_expression(get_Conv_op(node), value);
+	case iro_Const:
+		*value = get_tarval_long(get_Const_tarval(node));
+		return NULL;
+	case iro_Address: {
+		ir_entity const *const entity = get_Address_entity(node);
+		if (get_entity_kind(entity) == IR_ENTITY_LABEL)
+			panic("label %+F in initializer not supported", entity);
+		*value = 0;
+		return entity;
+	}
+	case iro_Offset:
+		*value = get_entity_offset(get_Offset_entity(node));
+		return NULL;
+	case iro_Align:
+		*value = get_type_alignment(get_Align_type(node));
+		return NULL;
+	case iro_Size:
+		*value = get_type_size(get_Size_type(node));
+		return NULL;
+	case iro_Unknown:
+		*value = 0;
+		return NULL;
+	case iro_Add:
+	case iro_Sub:
+	case iro_Mul: {
+		int64_t                l;
+		int64_t                r;
+		ir_entity const *const left  = eval_expression(get_binop_left(node), &l);
+		ir_entity const *const right = eval_expression(get_binop_right(node), &r);
+		if (is_Add(node)) {
+			if (left != NULL && right != NULL)
+				break;
+			*value = l + r;
+			return left != NULL ? left : right;
+		} else if (is_Sub(node)) {
+			if (right != NULL)
+				break;
+			*value = l - r;
+			return left;
+		} else {
+			if (left != NULL || right != NULL)
+				break;
+			*value = l * r;
+			return NULL;
+		}
+	}
+	default:
+		break;
+	}
+	panic("unsupported IR-node %+F in initializer", node);
+}
+
+static void write_node(elf_section_id_t const id, uint64_t const offset,
+                       ir_node const *const node, ir_type *const type)
+{
+	if (is_Const(node)) {
+		write_tarval(id, offset, get_Const_tarval(node));
+		return;
+	}
+
+	int64_t                value;
+	ir_entity const *const entity = eval_expression(node, &value);
+	unsigned         const size   = get_type_size(type);
+	if (entity == NULL) {
+		write_bytes(id, offset, value, size);
+		return;
+	}
+
+	uint32_t type_num;
+	switch (size) {
+	case 4: type_num = target->abs32_relocation; break;
+	case 8: type_num = target->abs64_relocation; break;
+	default:
+		panic("unsupported size %u of address in initializer", size);
+	}
+	if (type_num == 0)
+		panic("unsupported size %u of address in initializer", size);
+	add_relocation(id, offset, type_num, size, entity, ELF_N_SECTIONS, value);
+}
+
+static void write_bitfield(elf_section_id_t const id, uint64_t const offset,
+                           unsigned const offset_bits,
+                           unsigned const bitfield_size,
+                           ir_initializer_t const *const initializer)
+{
+	ir_tarval *tv;
+	switch (get_initializer_kind(initializer)) {
+	case IR_INITIALIZER_NULL:
+		return;
+	case IR_INITIALIZER_TARVAL:
+		tv = get_initializer_tarval_value(initializer);
+		break;
+	case IR_INITIALIZER_CONST: {
+		ir_node *const node = get_initializer_const_value(initializer);
+		if (!is_Const(node))
+			panic("bitfield initializer not a Const node");
+		tv = get_Const_tarval(node);
+		break;
+	}
+	default:
+		panic("bitfield initializer is compound");
+	}
+
+	char *const dest = sections[id].data + offset;
+	for (unsigned bit = 0; bit < bitfield_size; ++bit) {
+		if (!(get_tarval_sub_bits(tv, bit / 8) & (1U << (bit % 8))))
+			continue;
+		unsigned const dest_bit = offset_bits + bit;
+		dest[dest_bit / 8] |= 1U << (dest_bit % 8);
+	}
+}
+
+static void write_initializer(elf_section_id_t const id, uint64_t const offset,
+                              ir_initializer_t const *const initializer,
+                              ir_type *const type)
+{
+	switch (get_initializer_kind(initializer)) {
+	case IR_INITIALIZER_NULL:
+		return;
+	case IR_INITIALIZER_TARVAL:
+		write_tarval(id, offset, get_initializer_tarval_value(initializer));
+		return;
+	case IR_INITIALIZER_CONST:
+		write_node(id, offset, get_initializer_const_value(initializer), type);
+		return;
+	case IR_INITIALIZER_COMPOUND:
+		if (is_Array_type(type)) {
+			ir_type *const element_type = get_array_element_type(type);
+			uint64_t const skip         = round_up2(get_type_size(element_type),
+			                                        get_type_alignment(element_type));
+			for (size_t i = 0, n = get_initializer_compound_n_entries(initializer);
+			     i < n; ++i) {
+				ir_initializer_t const *const sub
+					= get_initializer_compound_value(initializer, i);
+				write_initializer(id, offset + i * skip, sub, element_type);
+			}
+		} else {
+			assert(is_compound_type(type));
+			for (size_t i = 0, n = get_compound_n_members(type); i < n; ++i) {
+				ir_entity *const member = get_compound_member(type, i);
+				uint64_t   const member_offset
+					= offset + get_entity_offset(member);
+				assert(i < get_initializer_compound_n_entries(initializer));
+				ir_initializer_t const *const sub
+					= get_initializer_compound_value(initializer, i);
+
+				unsigned const bitfield_size = get_entity_bitfield_size(member);
+				if (bitfield_size > 0) {
+					write_bitfield(id, member_offset,
+					               get_entity_bitfield_offset(member),
+					               bitfield_size, sub);
+					continue;
+				}
+				write_initializer(id, member_offset, sub,
+				                  get_entity_type(member));
+			}
+		}
+		return;
+	}
+	panic("invalid ir_initializer kind found");
+}
+
+static void add_global(ir_entity const *const entity)
+{
+	ir_entity_kind const kind = get_entity_kind(entity);
+	/* functions were added by be_elf_add_function() */
+	if (kind == IR_ENTITY_LABEL || kind == IR_ENTITY_METHOD)
+		return;
+	if (kind == IR_ENTITY_ALIAS) {
+		ARR_APP1(ir_entity const*, aliases, entity);
+		return;
+	}
+
+	ir_linkage    const linkage          = get_entity_linkage(entity);
+	bool          const zero_initializer = be_gas_entity_is_zero_initialized(entity);
+	be_gas_section_t const gas_section   = be_gas_get_section(entity);
+	unsigned            alignment        = be_gas_get_entity_alignment(entity);
+	unsigned long       size             = be_gas_get_entity_size(entity);
+	if (!is_po2_or_zero(alignment))
+		panic("alignment not a power of 2");
+	if (alignment == 0)
+		alignment = 1;
+	if (size == 0)
+		size = 1;
+
+	if (linkage & IR_LINKAGE_MERGE && !(gas_section & GAS_SECTION_FLAG_TLS)) {
+		ir_visibility const visibility = get_entity_visibility(entity);
+		if (visibility != ir_visibility_local
+		 && visibility != ir_visibility_private) {
+			new_location(entity, ELF_COMMON, alignment, size);
+			return;
+		}
+	}
+
+	if (!entity_has_definition(entity))
+		return;
+
+	elf_section_id_t const id     = get_data_section(entity, zero_initializer);
+	uint64_t         const offset = reserve(id, size, alignment);
+	if (!zero_initializer) {
+		if (sections[id].data == NULL)
+			panic("initialized entity %+F in nobits section", entity);
+		write_initializer(id, offset, get_entity_initializer(entity),
+		                  get_entity_type(entity));
+	}
+	new_location(entity, id, offset, get_type_size(get_entity_type(entity)));
+}
+
+static void add_globals(ir_type *const type)
+{
+	for (size_t i = 0, n = get_compound_n_members(type); i < n; ++i) {
+		ir_entity *const entity = get_compound_member(type, i);
+		if (!(get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN))
+			add_global(entity);
+	}
+}
+
+static void add_aliases(void)
+{
+	for (size_t i = 0, n = ARR_LEN(aliases); i < n; ++i) {
+		ir_entity const *const entity  = aliases[i];
+		ir_entity const *const aliased = get_entity_alias(entity);
+		elf_location_t  const *const location
+			= pmap_get(elf_location_t, locations, aliased);
+		if (location == NULL || location->section == ELF_COMMON)
+			panic("alias %+F of undefined entity %+F", entity, aliased);
+		new_location(entity, location->section, location->offset,
+		             location->size);
+	}
+}
+
+/** Assign section header indices and section symbols. */
+static unsigned number_sections(void)
+{
+	unsigned n = 1;
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t *const section = &sections[i];
+		if (i != ELF_TEXT && section->size == 0)
+			continue;
+		section->index = n++;
+	}
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t *const section = &sections[i];
+		if (section->index != 0 && ARR_LEN(section->relocations) > 0)
+			section->rel_index = n++;
+	}
+	return n;
+}
+
+static unsigned add_symbol(uint32_t const name, uint8_t const bind,
+                           uint8_t const type, uint8_t const other,
+                           uint16_t const shndx, uint64_t const value,
+                           uint64_t const size)
+{
+	elf_symbol_t const symbol = {
+		.name  = name,
+		.info  = (bind << 4) | type,
+		.other = other,
+		.shndx = shndx,
+		.value = value,
+		.size  = size,
+	};
+	unsigned const index = ARR_LEN(symbols);
+	ARR_APP1(elf_symbol_t, symbols, symbol);
+	return index;
+}
+
+static bool is_local_symbol(ir_entity const *const entity)
+{
+	ir_visibility const visibility = get_entity_visibility(entity);
+	return visibility == ir_visibility_local
+	    || visibility == ir_visibility_private;
+}
+
+static void add_entity_symbol(ir_entity const *const entity,
+                              elf_location_t *const location)
+{
+	uint8_t bind = STB_GLOBAL;
+	ir_linkage const linkage = get_entity_linkage(entity);
+	if (is_local_symbol(entity)) {
+		bind = STB_LOCAL;
+	} else if (linkage & IR_LINKAGE_WEAK) {
+		bind = STB_WEAK;
+	} else if (location != NULL && location->section != ELF_COMMON
+	        && (linkage & IR_LINKAGE_MERGE)
+	        && (linkage & IR_LINKAGE_GARBAGE_COLLECT)) {
+		/* no comdat groups, a weak symbol gives the same semantics */
+		bind = STB_WEAK;
+	}
+
+	uint8_t other = STV_DEFAULT;
+	switch (get_entity_visibility(entity)) {
+	case ir_visibility_external_private:   other = STV_HIDDEN;    break;
+	case ir_visibility_external_protected: other = STV_PROTECTED; break;
+	default:                                                      break;
+	}
+
+	ir_entity const *const aliased = is_alias_entity(entity)
+		? get_entity_alias(entity) : entity;
+	uint32_t const name = add_string(&strtab, get_entity_ld_name(entity));
+	uint8_t  type;
+	uint16_t shndx;
+	uint64_t value;
+	uint64_t size;
+	if (location == NULL) {
+		type  = STT_NOTYPE;
+		shndx = SHN_UNDEF;
+		value = 0;
+		size  = 0;
+	} else if (location->section == ELF_COMMON) {
+		type  = STT_OBJECT;
+		shndx = SHN_COMMON;
+		value = location->offset;
+		size  = location->size;
+	} else {
+		elf_section_id_t const id = location->section;
+		type  = is_method_entity(aliased)                  ? STT_FUNC :
+		        section_infos[id].flags & SHF_TLS          ? STT_TLS  :
+		        /* data */                                   STT_OBJECT;
+		shndx = sections[id].index;
+		value = location->offset;
+		size  = location->size;
+	}
+	unsigned const index
+		= add_symbol(name, bind, type, other, shndx, value, size);
+	if (location != NULL)
+		location->symbol = index;
+}
+
+/**
+ * Create the symbol table. Returns the index of the first global symbol.
+ */
+static unsigned create_symbols(char const *const cup_name)
+{
+	add_string(&strtab, "");
+	add_symbol(0, STB_LOCAL, STT_NOTYPE, STV_DEFAULT, SHN_UNDEF, 0, 0);
+	add_symbol(add_string(&strtab, cup_name), STB_LOCAL, STT_FILE, STV_DEFAULT,
+	           SHN_ABS, 0, 0);
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t *const section = &sections[i];
+		if (section->index == 0)
+			continue;
+		section->symbol = add_symbol(0, STB_LOCAL, STT_SECTION, STV_DEFAULT,
+		                             section->index, 0, 0);
+	}
+
+	for (size_t i = 0, n = ARR_LEN(symbol_entities); i < n; ++i) {
+		ir_entity const *const entity = symbol_entities[i];
+		if (is_local_symbol(entity))
+			add_entity_symbol(entity, pmap_get(elf_location_t, locations, entity));
+	}
+	unsigned const first_global = ARR_LEN(symbols);
+	for (size_t i = 0, n = ARR_LEN(symbol_entities); i < n; ++i) {
+		ir_entity const *const entity = symbol_entities[i];
+		if (!is_local_symbol(entity))
+			add_entity_symbol(entity, pmap_get(elf_location_t, locations, entity));
+	}
+
+	/* undefined entities referenced by relocations */
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_relocation_t const *const relocations = sections[i].relocations;
+		for (size_t r = 0, n = ARR_LEN(relocations); r < n; ++r) {
+			ir_entity const *const entity = relocations[r].entity;
+			if (entity == NULL || pmap_contains(locations, entity))
+				continue;
+			if (is_local_symbol(entity))
+				panic("reference to undefined local entity %+F", entity);
+			elf_location_t *const location = XMALLOCZ(elf_location_t);
+			pmap_insert(locations, entity, location);
+			add_entity_symbol(entity, NULL);
+			location->symbol = ARR_LEN(symbols) - 1;
+		}
+	}
+	return first_global;
+}
+
+/** Determine symbol and addend of a relocation. */
+static unsigned resolve_relocation(elf_relocation_t const *const relocation,
+                                   int64_t *const addend)
+{
+	*addend = relocation->addend;
+	ir_entity const *const entity = relocation->entity;
+	if (entity == NULL)
+		return sections[relocation->section].symbol;
+
+	elf_location_t const *const location
+		= pmap_get(elf_location_t, locations, entity);
+	if (location->symbol != 0)
+		return location->symbol;
+	/* private entities have no symbol */
+	*addend += location->offset;
+	return sections[location->section].symbol;
+}
+
+static struct obstack out;
+
+static void out8(uint8_t const value)
+{
+	obstack_1grow(&out, value);
+}
+
+static void out16(uint16_t const value)
+{
+	out8(value);
+	out8(value >> 8);
+}
+
+static void out32(uint32_t const value)
+{
+	out16(value);
+	out16(value >> 16);
+}
+
+static void out64(uint64_t const value)
+{
+	out32(value);
+	out32(value >> 32);
+}
+
+/** Output an address or offset, which has the size of the ELF class. */
+static void out_addr(uint64_t const value)
+{
+	if (target->elf64) {
+		out64(value);
+	} else {
+		out32(value);
+	}
+}
+
+static void out_pad(uint64_t const offset)
+{
+	while (obstack_object_size(&out) < offset)
+		out8(0);
+}
+
+static void out_section_header(uint32_t const name, uint32_t const type,
+                               uint64_t const flags, uint64_t const offset,
+                               uint64_t const size, uint32_t const link,
+                               uint32_t const info, uint64_t const alignment,
+                               uint64_t const entsize)
+{
+	out32(name);
+	out32(type);
+	out_addr(flags);
+	out_addr(0);
+	out_addr(offset);
+	out_addr(size);
+	out32(link);
+	out32(info);
+	out_addr(alignment);
+	out_addr(entsize);
+}
+
+static void out_symbol(elf_symbol_t const *const symbol)
+{
+	if (target->elf64) {
+		out32(symbol->name);
+		out8(symbol->info);
+		out8(symbol->other);
+		out16(symbol->shndx);
+		out64(symbol->value);
+		out64(symbol->size);
+	} else {
+		out32(symbol->name);
+		out32(symbol->value);
+		out32(symbol->size);
+		out8(symbol->info);
+		out8(symbol->other);
+		out16(symbol->shndx);
+	}
+}
+
+static void out_relocations(elf_section_id_t const id)
+{
+	elf_section_t    const *const section     = &sections[id];
+	elf_relocation_t const *const relocations = section->relocations;
+	for (size_t i = 0, n = ARR_LEN(relocations); i < n; ++i) {
+		elf_relocation_t const *const relocation = &relocations[i];
+		int64_t        addend;
+		unsigned const symbol = resolve_relocation(relocation, &addend);
+		out_addr(relocation->offset);
+		if (target->elf64) {
+			out64((uint64_t)symbol << 32 | relocation->type);
+		} else {
+			out32(symbol << 8 | (relocation->type & 0xFF));
+		}
+		if (target->rela)
+			out_addr(addend);
+	}
+}
+
+/** REL relocations take the addend from the relocated field. */
+static void apply_rel_addends(void)
+{
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_relocation_t const *const relocations = sections[i].relocations;
+		for (size_t r = 0, n = ARR_LEN(relocations); r < n; ++r) {
+			elf_relocation_t const *const relocation = &relocations[r];
+			int64_t addend;
+			resolve_relocation(relocation, &addend);
+			write_bytes(i, relocation->offset, addend, relocation->size);
+		}
+	}
+}
+
+static void free_state(void)
+{
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t *const section = &sections[i];
+		if (section->data != NULL)
+			DEL_ARR_F(section->data);
+		DEL_ARR_F(section->relocations);
+	}
+	foreach_pmap(locations, entry) {
+		free(entry->value);
+	}
+	pmap_destroy(locations);
+	DEL_ARR_F(symbol_entities);
+	DEL_ARR_F(aliases);
+	DEL_ARR_F(symbols);
+	DEL_ARR_F(strtab);
+	DEL_ARR_F(shstrtab);
+}
+
+void be_elf_finish(FILE *const output, char const *const cup_name)
+{
+	add_globals(get_glob_type());
+	add_globals(get_tls_type());
+	add_globals(get_segment_type(IR_SEGMENT_CONSTRUCTORS));
+	add_globals(get_segment_type(IR_SEGMENT_DESTRUCTORS));
+	add_globals(get_segment_type(IR_SEGMENT_JCR));
+	add_aliases();
+
+	unsigned const n_data_sections = number_sections();
+	unsigned const symtab_index    = n_data_sections;
+	unsigned const strtab_index    = symtab_index + 1;
+	unsigned const shstrtab_index  = strtab_index + 1;
+	unsigned const note_index      = shstrtab_index + 1;
+	unsigned const n_sections      = note_index + 1;
+	unsigned const first_global    = create_symbols(cup_name);
+	if (!target->rela)
+		apply_rel_addends();
+
+	/* section names */
+	add_string(&shstrtab, "");
+	uint32_t names[ELF_N_SECTIONS];
+	uint32_t rel_names[ELF_N_SECTIONS];
+	char const *const rel_prefix = target->rela ? ".rela" : ".rel";
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t const *const section = &sections[i];
+		if (section->index == 0)
+			continue;
+		names[i] = add_string(&shstrtab, section_infos[i].name);
+		if (section->rel_index != 0) {
+			char buf[64];
+			snprintf(buf, sizeof(buf), "%s%s", rel_prefix,
+			         section_infos[i].name);
+			rel_names[i] = add_string(&shstrtab, buf);
+		}
+	}
+	uint32_t const symtab_name   = add_string(&shstrtab, ".symtab");
+	uint32_t const strtab_name   = add_string(&shstrtab, ".strtab");
+	uint32_t const shstrtab_name = add_string(&shstrtab, ".shstrtab");
+	uint32_t const note_name     = add_string(&shstrtab, ".note.GNU-stack");
+
+	/* layout */
+	unsigned const ehsize     = target->elf64 ? 64 : 52;
+	unsigned const shentsize  = target->elf64 ? 64 : 40;
+	unsigned const symentsize = target->elf64 ? 24 : 16;
+	unsigned const relentsize = (target->elf64 ? 8 : 4) * (target->rela ? 3 : 2);
+	unsigned const word_align = target->elf64 ? 8 : 4;
+	uint64_t       offset     = ehsize;
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t *const section = &sections[i];
+		if (section->index == 0)
+			continue;
+		offset               = round_up2(offset, section->alignment);
+		section->file_offset = offset;
+		if (section->data != NULL)
+			offset += section->size;
+	}
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t *const section = &sections[i];
+		if (section->rel_index == 0)
+			continue;
+		offset                   = round_up2(offset, word_align);
+		section->rel_file_offset = offset;
+		offset += ARR_LEN(section->relocations) * relentsize;
+	}
+	uint64_t const symtab_offset   = round_up2(offset, word_align);
+	uint64_t const symtab_size     = ARR_LEN(symbols) * symentsize;
+	uint64_t const strtab_offset   = symtab_offset + symtab_size;
+	uint64_t const shstrtab_offset = strtab_offset + ARR_LEN(strtab);
+	uint64_t const shoff
+		= round_up2(shstrtab_offset + ARR_LEN(shstrtab), word_align);
+
+	obstack_init(&out);
+
+	/* ELF header */
+	out8(0x7F); out8('E'); out8('L'); out8('F');
+	out8(target->elf64 ? ELFCLASS64 : ELFCLASS32);
+	out8(ELFDATA2LSB);
+	out8(EV_CURRENT);
+	out_pad(16);
+	out16(ET_REL);
+	out16(target->machine);
+	out32(EV_CURRENT);
+	out_addr(0); /* entry */
+	out_addr(0); /* program headers */
+	out_addr(shoff);
+	out32(0);    /* flags */
+	out16(ehsize);
+	out16(0);    /* program header entry size */
+	out16(0);    /* number of program headers */
+	out16(shentsize);
+	out16(n_sections);
+	out16(shstrtab_index);
+
+	/* contents */
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t const *const section = &sections[i];
+		if (section->index == 0 || section->data == NULL)
+			continue;
+		out_pad(section->file_offset);
+		obstack_grow(&out, section->data, section->size);
+	}
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t const *const section = &sections[i];
+		if (section->rel_index == 0)
+			continue;
+		out_pad(section->rel_file_offset);
+		out_relocations(i);
+	}
+	out_pad(symtab_offset);
+	for (size_t i = 0, n = ARR_LEN(symbols); i < n; ++i) {
+		out_symbol(&symbols[i]);
+	}
+	obstack_grow(&out, strtab, ARR_LEN(strtab));
+	obstack_grow(&out, shstrtab, ARR_LEN(shstrtab));
+
+	/* section headers */
+	out_pad(shoff);
+	out_section_header(0, SHT_NULL, 0, 0, 0, 0, 0, 0, 0);
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t const *const section = &sections[i];
+		if (section->index == 0)
+			continue;
+		elf_section_info_t const *const info = &section_infos[i];
+		out_section_header(names[i], info->type, info->flags,
+		                   section->file_offset, section->size, 0, 0,
+		                   section->alignment, 0);
+	}
+	for (size_t i = 0; i < ELF_N_SECTIONS; ++i) {
+		elf_section_t const *const section = &sections[i];
+		if (section->rel_index == 0)
+			continue;
+		out_section_header(rel_names[i], target->rela ? SHT_RELA : SHT_REL,
+		                   SHF_INFO_LINK, section->rel_file_offset,
+		                   ARR_LEN(section->relocations) * relentsize,
+		                   symtab_index, section->index, word_align,
+		                   relentsize);
+	}
+	out_section_header(symtab_name, SHT_SYMTAB, 0, symtab_offset, symtab_size,
+	                   strtab_index, first_global, word_align, symentsize);
+	out_section_header(strtab_name, SHT_STRTAB, 0, strtab_offset,
+	                   ARR_LEN(strtab), 0, 0, 1, 0);
+	out_section_header(shstrtab_name, SHT_STRTAB, 0, shstrtab_offset,
+	                   ARR_LEN(shstrtab), 0, 0, 1, 0);
+	out_section_header(note_name, SHT_PROGBITS, 0, shoff, 0, 0, 0, 1, 0);
+
+	size_t const size = obstack_object_size(&out);
+	char  *const file = (char*)obstack_finish(&out);
+	if (fwrite(file, 1, size, output) != size)
+		panic("could not write object file");
+	obstack_free(&out, NULL);
+
+	free_state();
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Writer for ELF relocatable object files.
+ */
+#ifndef FIRM_BE_BEELF_H
+#define FIRM_BE_BEELF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "be_types.h"
+#include "bejit.h"
+#include "firm_types.h"
+
+/**
+ * Returns the ELF relocation type for a relocation of kind @p be_kind against
+ * @p entity (NULL for relocations against code of the same function) and
+ * stores the size of the relocated field in @p size. Returns 0 if the
+ * relocation is position independent and is resolved by the relocation
+ * function of the jit emitter.
+ */
+typedef uint32_t (*get_elf_relocation_func)(uint8_t be_kind,
+                                            ir_entity const *entity,
+                                            unsigned *size);
+
+/** Description of the ELF flavour of a target. */
+struct be_elf_target_t {
+	uint16_t machine; /**< e_machine of the object file */
+	bool     elf64;   /**< ELFCLASS64 instead of ELFCLASS32 */
+	bool     rela;    /**< relocations carry the addend (RELA instead of REL) */
+	/** Nops and position independent relocations in code. */
+	be_jit_emit_interface_t const *emit;
+	get_elf_relocation_func        get_relocation;
+	uint32_t abs32_relocation; /**< relocation for 32bit data addresses */
+	uint32_t abs64_relocation; /**< relocation for 64bit data addresses */
+};
+
+/**
+ * Start a new object file for @p target.
+ */
+void be_elf_begin(be_elf_target_t const *target);
+
+/**
+ * Add the code of @p entity to the object file. @p function must have been
+ * compiled into a segment created by be_new_relocatable_jit_segment().
+ */
+void be_elf_add_function(ir_entity const *entity, ir_jit_function_t *function);
+
+/**
+ * Add all global variables of the program and write the object file to
+ * @p output.
+ */
+void be_elf_finish(FILE *output, char const *cup_name);
+
+#endif
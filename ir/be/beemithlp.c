@@ -15,6 +15,7 @@
 #include "bedwarf.h"
 #include "beemitter.h"
 #include "begnuas.h"
+#include "beirg.h"
 #include "benode.h"
 #include "dbginfo.h"
 #include "debug.h"
@@ -82,6 +83,18 @@ void be_emit_init_cf_links(ir_node **const block_schedule)
 	}
 }
 
+size_t be_emit_init_cold_part(ir_graph *const irg,
+                              ir_node **const block_schedule)
+{
+	size_t const n_blocks = ARR_LEN(block_schedule);
+	size_t const n_hot    = be_birg_from_irg(irg)->n_hot_blocks;
+	if (n_hot >= n_blocks || !be_gas_can_split_function(get_irg_entity(irg)))
+		return n_blocks;
+
+	set_irn_link(block_schedule[n_hot], NULL);
+	return n_hot;
+}
+
 be_cond_branch_projs_t be_get_cond_branch_projs(ir_node const *const node)
 {
 	be_cond_branch_projs_t projs = { NULL, NULL };
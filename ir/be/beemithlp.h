@@ -51,6 +51,14 @@ void be_emit_node(ir_node const *node);
  */
 void be_emit_init_cf_links(ir_node **block_schedule);
 
+/**
+ * Returns the position of the first block in @p block_schedule, which is
+ * emitted into the cold part of the function, or the number of blocks if the
+ * function is not split. Nothing falls through into the cold part.
+ * Requires a prior call to be_emit_init_cf_links().
+ */
+size_t be_emit_init_cold_part(ir_graph *irg, ir_node **block_schedule);
+
 /**
  * Returns the target block for a control flow node.
  * Requires a prior call to be_emit_init_cf_links().
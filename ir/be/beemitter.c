@@ -11,23 +11,133 @@
  */
 #include "beemitter.h"
 
+#include "array.h"
 #include "irprintf.h"
+#include "irthread.h"
 #include "panic.h"
+#include "xmalloc.h"
+#include <stdbool.h>
 
-static FILE    *emit_file;
-struct obstack  emit_obst;
+/** Text of a function, waiting for its predecessors to be written. */
+typedef struct emit_chunk_t {
+	char   *text;
+	size_t  len;
+	bool    finished;
+} emit_chunk_t;
+
+static FILE                          *emit_file;
+THREAD_LOCAL struct obstack           emit_obst;
+static THREAD_LOCAL struct obstack    chunk_obst;
+static THREAD_LOCAL bool              chunk_obst_initialized;
+static THREAD_LOCAL bool              in_chunk;
+static THREAD_LOCAL unsigned          current_chunk;
+/* chunks and next_chunk are shared by all threads */
+static ir_mutex_t                     chunk_mutex = IR_MUTEX_INITIALIZER;
+static emit_chunk_t                  *chunks;
+static size_t                         next_chunk;
 
 void be_emit_init(FILE *file)
 {
-	emit_file = file;
-	obstack_init(&emit_obst);
+	emit_file  = file;
+	chunks     = NEW_ARR_F(emit_chunk_t, 0);
+	next_chunk = 0;
+	be_emit_init_thread();
 }
 
 void be_emit_exit(void)
 {
+	assert(next_chunk == ARR_LEN(chunks) && "function text not written");
+	DEL_ARR_F(chunks);
+	chunks = NULL;
+	be_emit_exit_thread();
+}
+
+void be_emit_init_thread(void)
+{
+	obstack_init(&emit_obst);
+}
+
+void be_emit_exit_thread(void)
+{
+	assert(!in_chunk);
+	if (chunk_obst_initialized) {
+		obstack_free(&chunk_obst, NULL);
+		chunk_obst_initialized = false;
+	}
 	obstack_free(&emit_obst, NULL);
 }
 
+unsigned be_emit_reserve_chunk(void)
+{
+	emit_chunk_t const chunk = { .text = NULL, .len = 0, .finished = false };
+	ir_mutex_lock(&chunk_mutex);
+	ARR_APP1(emit_chunk_t, chunks, chunk);
+	unsigned const slot = ARR_LEN(chunks) - 1;
+	ir_mutex_unlock(&chunk_mutex);
+	return slot;
+}
+
+void be_emit_begin_chunk(unsigned const slot)
+{
+	assert(!in_chunk);
+	ir_mutex_lock(&chunk_mutex);
+	assert(slot < ARR_LEN(chunks) && !chunks[slot].finished);
+	ir_mutex_unlock(&chunk_mutex);
+	if (!chunk_obst_initialized) {
+		obstack_init(&chunk_obst);
+		chunk_obst_initialized = true;
+	}
+	in_chunk      = true;
+	current_chunk = slot;
+}
+
+/**
+ * Write out all finished chunks whose predecessors have been written.
+ * The caller holds chunk_mutex.
+ */
+static void write_finished_chunks(void)
+{
+	for (size_t const n = ARR_LEN(chunks); next_chunk < n; ++next_chunk) {
+		emit_chunk_t *const chunk = &chunks[next_chunk];
+		if (!chunk->finished)
+			break;
+		fwrite(chunk->text, 1, chunk->len, emit_file);
+		free(chunk->text);
+		chunk->text = NULL;
+	}
+}
+
+void be_emit_finish_chunk(void)
+{
+	assert(in_chunk);
+	assert(obstack_object_size(&emit_obst) == 0 && "unfinished line");
+	in_chunk = false;
+
+	size_t const len  = obstack_object_size(&chunk_obst);
+	char  *const text = (char*)obstack_finish(&chunk_obst);
+	ir_mutex_lock(&chunk_mutex);
+	emit_chunk_t *const chunk = &chunks[current_chunk];
+	if (current_chunk == next_chunk) {
+		/* Common case: Write directly without copying the text. */
+		fwrite(text, 1, len, emit_file);
+		++next_chunk;
+		write_finished_chunks();
+	} else {
+		chunk->text = XMALLOCN(char, len);
+		chunk->len  = len;
+		memcpy(chunk->text, text, len);
+	}
+	chunk->finished = true;
+	ir_mutex_unlock(&chunk_mutex);
+	obstack_free(&chunk_obst, text);
+}
+
+unsigned be_emit_current_chunk(void)
+{
+	assert(in_chunk);
+	return current_chunk;
+}
+
 void be_emit_irvprintf(const char *fmt, va_list args)
 {
 	ir_obst_vprintf(&emit_obst, fmt, args);
@@ -45,6 +155,10 @@ void be_emit_write_line(void)
 {
 	size_t const len  = obstack_object_size(&emit_obst);
 	char  *const line = (char*)obstack_finish(&emit_obst);
-	fwrite(line, 1, len, emit_file);
+	if (in_chunk) {
+		obstack_grow(&chunk_obst, line, len);
+	} else {
+		fwrite(line, 1, len, emit_file);
+	}
 	obstack_free(&emit_obst, line);
 }
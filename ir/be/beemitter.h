@@ -16,10 +16,11 @@
 #define FIRM_BE_BEEMITTER_H
 
 #include <stdio.h>
+#include "compiler.h"
 #include "obst.h"
 
 /* don't use the following vars directly, they're only here for the inlines */
-extern struct obstack  emit_obst;
+extern THREAD_LOCAL struct obstack emit_obst;
 
 /**
  * Emit a character to the (assembler) output.
@@ -71,6 +72,16 @@ void be_emit_init(FILE *F);
  */
 void be_emit_exit(void);
 
+/**
+ * Prepares a worker thread to emit function texts into slots.
+ */
+void be_emit_init_thread(void);
+
+/**
+ * Frees the line buffers of a worker thread.
+ */
+void be_emit_exit_thread(void);
+
 /**
  * Emit the output of an ir_printf.
  *
@@ -90,6 +101,31 @@ void be_emit_irvprintf(const char *fmt, va_list args);
  */
 void be_emit_write_line(void);
 
+/**
+ * Reserve a slot for the text of a function in the output. Slots are written
+ * to the output file in the order they were reserved, regardless of the order
+ * in which their text is finished.
+ *
+ * @return  the number of the reserved slot
+ */
+unsigned be_emit_reserve_chunk(void);
+
+/**
+ * Collect all lines written by the current thread in the slot @p slot until
+ * be_emit_finish_chunk() is called.
+ */
+void be_emit_begin_chunk(unsigned slot);
+
+/**
+ * Finish the slot started with be_emit_begin_chunk(). Its text is written to
+ * the output file as soon as all slots reserved before it are finished.
+ * Threads may finish their slots concurrently.
+ */
+void be_emit_finish_chunk(void);
+
+/** Returns the slot the current thread is collecting lines for. */
+unsigned be_emit_current_chunk(void);
+
 /** Return column in current line. Counting starts at 0. */
 static inline size_t be_emit_get_column(void)
 {
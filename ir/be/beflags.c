@@ -36,12 +36,12 @@
 #include "irtools.h"
 #include <stdbool.h>
 
-static arch_register_req_t const *flags_req;
-static arch_register_t     const *flags_reg;
-static func_rematerialize         remat;
-static check_modifies_flags       check_modify;
-static try_replace_flags          try_replace;
-static bool                       changed;
+static THREAD_LOCAL arch_register_req_t const *flags_req;
+static THREAD_LOCAL arch_register_t     const *flags_reg;
+static THREAD_LOCAL func_rematerialize         remat;
+static THREAD_LOCAL check_modifies_flags       check_modify;
+static THREAD_LOCAL try_replace_flags          try_replace;
+static THREAD_LOCAL bool                       changed;
 
 static ir_node *default_remat(ir_node *node, ir_node *after)
 {
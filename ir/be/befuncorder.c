@@ -0,0 +1,353 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Order of the functions in the output.
+ *
+ * Functions are clustered with the C3 heuristic (see Ottoni and Maher:
+ * "Optimizing Function Placement for Large-Scale Data-Center Applications"),
+ * a variant of the Pettis-Hansen algorithm: Starting with a cluster per
+ * function, the functions are visited in order of decreasing heat and the
+ * cluster of each function is appended to the cluster of its most frequent
+ * caller. The clusters are emitted in order of decreasing density.
+ *
+ * The call frequencies come from the execution frequencies of the blocks
+ * containing the calls, scaled by the profiled entry counts of the callers, and
+ * from the profiled targets of indirect calls.
+ */
+#include "befuncorder.h"
+
+#include "bediagnostic.h"
+#include "bemodule.h"
+#include "cgana.h"
+#include "debug.h"
+#include "execfreq.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+#include "irprofile.h"
+#include "irtools.h"
+#include "lc_opts.h"
+#include "lc_opts_enum.h"
+#include "obst.h"
+#include "pmap.h"
+#include "util.h"
+#include <stdio.h>
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
+
+/** Estimated code size of a node in bytes */
+#define NODE_SIZE         4
+/** Clusters do not grow beyond this estimated size in bytes */
+#define MAX_CLUSTER_SIZE  (1U << 20)
+/** A cluster is not appended to a cluster, which is that much less dense */
+#define MAX_DENSITY_RATIO 8.0
+
+typedef enum funcorder_mode_t {
+	FUNCORDER_NONE,
+	FUNCORDER_PROFILE,
+	FUNCORDER_ALWAYS,
+} funcorder_mode_t;
+
+static int  mode = FUNCORDER_PROFILE;
+static char order_file[1024];
+
+static const lc_opt_enum_int_items_t mode_items[] = {
+	{ "none",    FUNCORDER_NONE    },
+	{ "profile", FUNCORDER_PROFILE },
+	{ "always",  FUNCORDER_ALWAYS  },
+	{ NULL,      0                 }
+};
+
+static lc_opt_enum_int_var_t mode_var = {
+	&mode, mode_items
+};
+
+static const lc_opt_table_entry_t funcorder_options[] = {
+	LC_OPT_ENT_ENUM_INT("mode", "reorder functions never, with a profile or always", &mode_var),
+	LC_OPT_ENT_STR     ("file", "write the function order to a symbol ordering file", &order_file),
+	LC_OPT_LAST
+};
+
+typedef struct cluster_t cluster_t;
+
+typedef struct func_t func_t;
+struct func_t {
+	ir_graph  *irg;
+	cluster_t *cluster;
+	func_t    *best_caller; /**< the caller with the most frequent calls */
+	double     best_freq;   /**< frequency of the calls from best_caller */
+	double     entry;       /**< number of invocations */
+	double     heat;        /**< estimated execution time */
+	unsigned   size;        /**< estimated code size in bytes */
+	unsigned   index;       /**< position in the original order */
+};
+
+struct cluster_t {
+	func_t   **funcs; /**< flexible array, NULL if merged */
+	double     heat;
+	unsigned   size;
+	unsigned   id;
+};
+
+typedef struct call_t {
+	func_t *caller;
+	func_t *callee;
+	double  freq;
+} call_t;
+
+typedef struct funcorder_env_t {
+	struct obstack  obst;
+	pmap           *entity_funcs; /**< maps entities to their func_t */
+	func_t        **funcs;        /**< flexible array */
+	call_t         *calls;        /**< flexible array */
+	func_t         *func;         /**< the function being analysed */
+} funcorder_env_t;
+
+static void add_call(funcorder_env_t *const env, ir_entity *const entity,
+                     double const freq)
+{
+	func_t *const callee = pmap_get(func_t, env->entity_funcs, entity);
+	if (callee == NULL || callee == env->func || freq <= 0.0)
+		return;
+	call_t const call = { .caller = env->func, .callee = callee, .freq = freq };
+	ARR_APP1(call_t, env->calls, call);
+}
+
+static void analyse_node(ir_node *const node, void *const data)
+{
+	funcorder_env_t *const env = (funcorder_env_t*)data;
+	if (is_Block(node))
+		return;
+
+	func_t *const func = env->func;
+	double  const freq = get_block_execfreq(get_nodes_block(node)) * func->entry;
+	func->heat += freq;
+	func->size += NODE_SIZE;
+	if (!is_Call(node))
+		return;
+
+	ir_entity *const callee = get_Call_callee(node);
+	if (callee != NULL) {
+		add_call(env, callee, freq);
+	} else if (cg_call_has_callees(node)) {
+		size_t const n_callees = cg_get_call_n_callees(node);
+		for (size_t i = 0; i < n_callees; ++i)
+			add_call(env, cg_get_call_callee(node, i), freq / n_callees);
+	} else {
+		ir_profile_value_t values[IR_PROFILE_N_VALUES];
+		for (unsigned i = 0, n = ir_profile_get_values(node, values); i < n; ++i) {
+			if (values[i].callee != NULL)
+				add_call(env, values[i].callee, values[i].count);
+		}
+	}
+}
+
+static int cmp_calls(void const *const a, void const *const b)
+{
+	call_t const *const c0 = (call_t const*)a;
+	call_t const *const c1 = (call_t const*)b;
+	if (c0->callee != c1->callee)
+		return QSORT_CMP(c0->callee->index, c1->callee->index);
+	return QSORT_CMP(c0->caller->index, c1->caller->index);
+}
+
+/**
+ * Determines the most frequent caller of each function.
+ */
+static void find_best_callers(call_t *const calls)
+{
+	QSORT_ARR(calls, cmp_calls);
+	for (size_t i = 0, n = ARR_LEN(calls); i < n;) {
+		func_t *const caller = calls[i].caller;
+		func_t *const callee = calls[i].callee;
+		double        freq   = 0.0;
+		for (; i < n && calls[i].caller == caller && calls[i].callee == callee; ++i)
+			freq += calls[i].freq;
+		if (freq > callee->best_freq) {
+			callee->best_caller = caller;
+			callee->best_freq   = freq;
+		}
+	}
+}
+
+static double get_density(cluster_t const *const cluster)
+{
+	return cluster->heat / cluster->size;
+}
+
+static int cmp_funcs_heat(void const *const a, void const *const b)
+{
+	func_t const *const f0 = *(func_t const *const*)a;
+	func_t const *const f1 = *(func_t const *const*)b;
+	if (f0->heat != f1->heat)
+		return f0->heat < f1->heat ? 1 : -1;
+	return QSORT_CMP(f0->index, f1->index);
+}
+
+static int cmp_clusters(void const *const a, void const *const b)
+{
+	cluster_t const *const c0 = *(cluster_t const *const*)a;
+	cluster_t const *const c1 = *(cluster_t const *const*)b;
+	double const d0 = get_density(c0);
+	double const d1 = get_density(c1);
+	if (d0 != d1)
+		return d0 < d1 ? 1 : -1;
+	return QSORT_CMP(c0->id, c1->id);
+}
+
+static void merge_clusters(cluster_t *const into, cluster_t *const from)
+{
+	for (size_t i = 0, n = ARR_LEN(from->funcs); i < n; ++i) {
+		func_t *const func = from->funcs[i];
+		func->cluster = into;
+		ARR_APP1(func_t*, into->funcs, func);
+	}
+	into->heat += from->heat;
+	into->size += from->size;
+	DEL_ARR_F(from->funcs);
+	from->funcs = NULL;
+}
+
+static cluster_t **create_clusters(funcorder_env_t *const env)
+{
+	cluster_t **clusters = NEW_ARR_F(cluster_t*, 0);
+	for (size_t i = 0, n = ARR_LEN(env->funcs); i < n; ++i) {
+		func_t    *const func    = env->funcs[i];
+		cluster_t *const cluster = OALLOC(&env->obst, cluster_t);
+		cluster->funcs = NEW_ARR_F(func_t*, 1);
+		cluster->funcs[0] = func;
+		cluster->heat     = func->heat;
+		cluster->size     = func->size;
+		cluster->id       = i;
+		func->cluster     = cluster;
+		ARR_APP1(cluster_t*, clusters, cluster);
+	}
+
+	func_t **const hot = DUP_ARR_F(func_t*, env->funcs);
+	QSORT_ARR(hot, cmp_funcs_heat);
+	for (size_t i = 0, n = ARR_LEN(hot); i < n; ++i) {
+		func_t *const func   = hot[i];
+		func_t *const caller = func->best_caller;
+		if (func->heat <= 0.0 || caller == NULL)
+			continue;
+
+		cluster_t *const cluster        = func->cluster;
+		cluster_t *const caller_cluster = caller->cluster;
+		if (cluster == caller_cluster)
+			continue;
+		if (cluster->size + caller_cluster->size > MAX_CLUSTER_SIZE)
+			continue;
+		if (get_density(caller_cluster) * MAX_DENSITY_RATIO < get_density(cluster))
+			continue;
+
+		DB((dbg, LEVEL_2, "append cluster of %+F to cluster of %+F\n",
+		    func->irg, caller->irg));
+		merge_clusters(caller_cluster, cluster);
+	}
+	DEL_ARR_F(hot);
+	return clusters;
+}
+
+static void write_order_file(ir_graph *const *const graphs,
+                             ir_graph *const *const stubs)
+{
+	FILE *const out = fopen(order_file, "w");
+	if (out == NULL) {
+		be_warningf(NULL, "could not open symbol ordering file '%s'", order_file);
+		return;
+	}
+	for (size_t i = 0, n = ARR_LEN(graphs); i < n; ++i)
+		fprintf(out, "%s\n", get_entity_ld_name(get_irg_entity(graphs[i])));
+	/* the stub graphs are emitted behind the others in program order */
+	for (size_t i = 0, n = ARR_LEN(stubs); i < n; ++i)
+		fprintf(out, "%s\n", get_entity_ld_name(get_irg_entity(stubs[i])));
+	fclose(out);
+}
+
+static void order_functions(ir_graph **const graphs)
+{
+	funcorder_env_t env = {
+		.entity_funcs = pmap_create(),
+		.funcs        = NEW_ARR_F(func_t*, 0),
+		.calls        = NEW_ARR_F(call_t, 0),
+	};
+	obstack_init(&env.obst);
+
+	bool has_profile = false;
+	bool const profile_loaded = ir_profile_has_data();
+	for (size_t i = 0, n = ARR_LEN(graphs); i < n; ++i) {
+		ir_graph *const irg   = graphs[i];
+		func_t   *const func  = OALLOCZ(&env.obst, func_t);
+		func->irg   = irg;
+		func->index = i;
+		if (profile_loaded) {
+			ir_node *const start = get_irg_start_block(irg);
+			func->entry = ir_profile_get_block_execcount(start);
+			has_profile |= func->entry > 0.0;
+		}
+		pmap_insert(env.entity_funcs, get_irg_entity(irg), func);
+		ARR_APP1(func_t*, env.funcs, func);
+	}
+
+	if (has_profile || mode == FUNCORDER_ALWAYS) {
+		for (size_t i = 0, n = ARR_LEN(env.funcs); i < n; ++i) {
+			func_t *const func = env.funcs[i];
+			/* without a profile every function counts the same */
+			if (!has_profile)
+				func->entry = 1.0;
+			env.func = func;
+			irg_walk_graph(func->irg, analyse_node, NULL, &env);
+			func->size = MAX(func->size, 1);
+		}
+		find_best_callers(env.calls);
+
+		cluster_t **const clusters = create_clusters(&env);
+		size_t            n_live   = 0;
+		for (size_t i = 0, n = ARR_LEN(clusters); i < n; ++i) {
+			if (clusters[i]->funcs != NULL)
+				clusters[n_live++] = clusters[i];
+		}
+		ARR_SHRINKLEN(clusters, n_live);
+		QSORT_ARR(clusters, cmp_clusters);
+
+		size_t pos = 0;
+		for (size_t i = 0; i < n_live; ++i) {
+			cluster_t *const cluster = clusters[i];
+			for (size_t f = 0, n = ARR_LEN(cluster->funcs); f < n; ++f) {
+				func_t *const func = cluster->funcs[f];
+				DB((dbg, LEVEL_1, "%+F (heat %.3g, size %u)\n", func->irg,
+				    func->heat, func->size));
+				graphs[pos++] = func->irg;
+			}
+			DEL_ARR_F(cluster->funcs);
+		}
+		assert(pos == ARR_LEN(graphs));
+		DEL_ARR_F(clusters);
+	}
+
+	DEL_ARR_F(env.calls);
+	DEL_ARR_F(env.funcs);
+	pmap_destroy(env.entity_funcs);
+	obstack_free(&env.obst, NULL);
+}
+
+void be_order_functions(ir_graph **const graphs, ir_graph *const *const stubs)
+{
+	if (mode != FUNCORDER_NONE)
+		order_functions(graphs);
+	if (order_file[0] != '\0')
+		write_order_file(graphs, stubs);
+}
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_funcorder)
+void be_init_funcorder(void)
+{
+	lc_opt_entry_t *be_grp        = lc_opt_get_grp(firm_opt_get_root(), "be");
+	lc_opt_entry_t *funcorder_grp = lc_opt_get_grp(be_grp, "funcorder");
+	lc_opt_add_table(funcorder_grp, funcorder_options);
+
+	FIRM_DBG_REGISTER(dbg, "firm.be.funcorder");
+}
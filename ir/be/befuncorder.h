@@ -0,0 +1,23 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Order of the functions in the output.
+ */
+#ifndef FIRM_BE_BEFUNCORDER_H
+#define FIRM_BE_BEFUNCORDER_H
+
+#include "firm_types.h"
+
+/**
+ * Sorts the flexible array @p graphs, so that hot callers and their callees
+ * are placed next to each other, and writes the order to the symbol ordering
+ * file if one was requested. The stub graphs in the flexible array @p stubs
+ * are not read, they follow the others in program order.
+ */
+void be_order_functions(ir_graph **graphs, ir_graph *const *stubs);
+
+#endif
@@ -35,9 +35,16 @@ elf_variant_t          be_gas_elf_variant   = ELF_VARIANT_NORMAL;
 bool                   be_gas_emit_types    = true;
 char                   be_gas_elf_type_char = '@';
 
-static be_gas_section_t current_section = (be_gas_section_t) -1;
-static pmap            *block_numbers;
-static unsigned         next_block_nr;
+/* Functions are emitted by several threads, each one keeps the state of the
+ * text it is writing. */
+static THREAD_LOCAL be_gas_section_t current_section = (be_gas_section_t) -1;
+static THREAD_LOCAL pmap            *block_numbers;
+/** block labels are numbered per function and qualified by its text slot,
+ * so they do not depend on the order in which the functions are emitted */
+static THREAD_LOCAL unsigned         function_nr;
+static THREAD_LOCAL unsigned         next_block_nr;
+/** the function, whose cold part is being emitted */
+static THREAD_LOCAL ir_entity const *cold_part_entity;
 
 static bool is_macho(void)
 {
@@ -137,6 +144,7 @@ static const elf_sectioninfo_t elf_sectioninfos[] = {
 	[GAS_SECTION_DEBUG_LINE]     = { "debug_line",        "progbits", ""   },
 	[GAS_SECTION_DEBUG_PUBNAMES] = { "debug_pubnames",    "progbits", ""   },
 	[GAS_SECTION_DEBUG_FRAME]    = { "debug_frame",       "progbits", ""   },
+	[GAS_SECTION_TEXT_UNLIKELY]  = { "text.unlikely",     "progbits", "ax" },
 };
 
 static void emit_section_sparc(be_gas_section_t section,
@@ -379,7 +387,7 @@ static bool entity_is_string_const(const ir_entity *ent, bool only_suffix_null)
 	return initializer_is_string_const(init, only_suffix_null);
 }
 
-static bool entity_is_zero_initialized(ir_entity const *entity)
+bool be_gas_entity_is_zero_initialized(ir_entity const *entity)
 {
 	if (is_alias_entity(entity))
 		return false;
@@ -475,7 +483,7 @@ static be_gas_section_t determine_basic_section(const ir_entity *entity)
 			return GAS_SECTION_RODATA;
 		}
 	}
-	if (entity_is_zero_initialized(entity))
+	if (be_gas_entity_is_zero_initialized(entity))
 		return GAS_SECTION_BSS;
 
 	return GAS_SECTION_DATA;
@@ -516,6 +524,11 @@ static be_gas_section_t determine_section(be_main_env_t const *const main_env, i
 	panic("couldn't determine section for %+F", entity);
 }
 
+be_gas_section_t be_gas_get_section(ir_entity const *const entity)
+{
+	return determine_section(NULL, entity);
+}
+
 static void emit_symbol_directive(const char *directive,
                                   const ir_entity *entity)
 {
@@ -597,6 +610,17 @@ void be_gas_emit_function_prolog(const ir_entity *entity, unsigned po2alignment,
 {
 	be_dwarf_function_before(entity, parameter_infos);
 
+	/* blocks are only named inside their function and the data emitted
+	 * behind it, the graph of the previous function may be freed already */
+	if (block_numbers != NULL)
+		pmap_destroy(block_numbers);
+	block_numbers = pmap_create();
+	function_nr   = be_emit_current_chunk();
+	next_block_nr = 0;
+
+	/* function texts may be reordered in the output, so the section of the
+	 * text preceding this one is not known */
+	current_section = (be_gas_section_t)-1;
 	be_gas_section_t const section = determine_section(NULL, entity);
 	emit_section(section, entity);
 
@@ -644,17 +668,61 @@ void be_gas_emit_function_prolog(const ir_entity *entity, unsigned po2alignment,
 	be_dwarf_function_begin();
 }
 
+static void emit_function_name(ir_entity const *const entity, bool const cold)
+{
+	be_gas_emit_entity(entity);
+	if (cold)
+		be_emit_cstring(".cold");
+}
+
+static void emit_function_size(ir_entity const *const entity, bool const cold)
+{
+	be_emit_cstring("\t.size\t");
+	emit_function_name(entity, cold);
+	be_emit_cstring(", .-");
+	emit_function_name(entity, cold);
+	be_emit_char('\n');
+	be_emit_write_line();
+}
+
+bool be_gas_can_split_function(ir_entity const *const entity)
+{
+	/* the call frame information of a function cannot span several
+	 * sections */
+	return ir_platform.object_format == OBJECT_FORMAT_ELF
+	    && be_gas_elf_variant == ELF_VARIANT_NORMAL
+	    && determine_section(NULL, entity) == GAS_SECTION_TEXT
+	    && !be_dwarf_enabled();
+}
+
+void be_gas_begin_cold_part(ir_entity const *const entity)
+{
+	assert(be_gas_can_split_function(entity));
+	assert(cold_part_entity == NULL);
+	cold_part_entity = entity;
+
+	emit_function_size(entity, false);
+	emit_section(GAS_SECTION_TEXT_UNLIKELY, entity);
+	be_emit_cstring("\t.type\t");
+	emit_function_name(entity, true);
+	be_emit_irprintf(", %cfunction\n", be_gas_elf_type_char);
+	be_emit_write_line();
+	emit_function_name(entity, true);
+	be_emit_cstring(":\n");
+	be_emit_write_line();
+}
+
 void be_gas_emit_function_epilog(ir_entity const *const entity)
 {
 	be_dwarf_function_end();
 
-	if (ir_platform.object_format == OBJECT_FORMAT_ELF) {
-		be_emit_cstring("\t.size\t");
-		be_gas_emit_entity(entity);
-		be_emit_cstring(", .-");
-		be_gas_emit_entity(entity);
-		be_emit_char('\n');
-		be_emit_write_line();
+	if (cold_part_entity == entity) {
+		emit_function_size(entity, true);
+		/* trailing data like exception tables belongs to the function */
+		emit_section(determine_section(NULL, entity), entity);
+		cold_part_entity = NULL;
+	} else if (ir_platform.object_format == OBJECT_FORMAT_ELF) {
+		emit_function_size(entity, false);
 	}
 
 	if (be_options.verbose_asm) {
@@ -667,8 +735,8 @@ void be_gas_emit_function_epilog(ir_entity const *const entity)
 	be_emit_char('\n');
 	be_emit_write_line();
 
-	next_block_nr += 199;
-	next_block_nr -= next_block_nr % 100;
+	/* neither is the section of the text following this one */
+	current_section = (be_gas_section_t)-1;
 }
 
 /**
@@ -898,7 +966,7 @@ static size_t get_initializer_size(const ir_initializer_t *initializer,
 	panic("found invalid initializer");
 }
 
-static unsigned long compute_entity_size(ir_entity const *const entity)
+unsigned long be_gas_get_entity_size(ir_entity const *const entity)
 {
 	ir_type *const type = get_entity_type(entity);
 	unsigned long  size = get_type_size(type);
@@ -1190,7 +1258,7 @@ static void emit_align(unsigned p2alignment)
 	be_emit_write_line();
 }
 
-static unsigned get_effective_entity_alignment(const ir_entity *entity)
+unsigned be_gas_get_entity_alignment(const ir_entity *entity)
 {
 	unsigned alignment = get_entity_alignment(entity);
 	if (alignment == 0) {
@@ -1203,7 +1271,7 @@ static unsigned get_effective_entity_alignment(const ir_entity *entity)
 static void emit_common(const ir_entity *entity, unsigned long size,
                         bool is_local)
 {
-	unsigned const alignment = get_effective_entity_alignment(entity);
+	unsigned const alignment = be_gas_get_entity_alignment(entity);
 
 	switch (ir_platform.object_format) {
 	case OBJECT_FORMAT_MACH_O:
@@ -1238,7 +1306,7 @@ static void emit_zerofill(const ir_entity *entity, const char *section_segment,
 	be_emit_string(section_segment);
 	be_emit_char(',');
 	be_gas_emit_entity(entity);
-	unsigned const alignment = get_effective_entity_alignment(entity);
+	unsigned const alignment = be_gas_get_entity_alignment(entity);
 	be_emit_irprintf(",%lu,%u\n", size, log2_floor(alignment));
 	be_emit_write_line();
 }
@@ -1326,7 +1394,8 @@ void be_gas_emit_block_name(const ir_node *block)
 		} else {
 			nr = PTR_TO_INT(nr_val) - 1;
 		}
-		be_emit_irprintf("%s%d", be_gas_get_private_prefix(), nr);
+		be_emit_irprintf("%s%u_%d", be_gas_get_private_prefix(),
+		                 function_nr, nr);
 	}
 }
 
@@ -1418,8 +1487,8 @@ static void emit_global(be_main_env_t const *const main_env,
 
 	ir_visibility const visibility       = get_entity_visibility(entity);
 	ir_linkage    const linkage          = get_entity_linkage(entity);
-	bool          const zero_initializer = entity_is_zero_initialized(entity);
-	unsigned long       size             = compute_entity_size(entity);
+	bool          const zero_initializer = be_gas_entity_is_zero_initialized(entity);
+	unsigned long       size             = be_gas_get_entity_size(entity);
 
 	/* We need to output at least 1 byte, otherwise macho will merge
 	 * the label with the next thing */
@@ -1475,7 +1544,7 @@ static void emit_global(be_main_env_t const *const main_env,
 	}
 
 	/* alignment */
-	unsigned alignment = get_effective_entity_alignment(entity);
+	unsigned alignment = be_gas_get_entity_alignment(entity);
 	if (!is_po2_or_zero(alignment))
 		panic("alignment not a power of 2");
 	if (alignment > 1)
@@ -1544,7 +1613,7 @@ static void emit_global_decls(be_main_env_t const *const main_env)
 	}
 }
 
-void be_emit_jump_table(ir_node const *const node, be_switch_attr_t const *const swtch, ir_mode *const entry_mode, emit_target_func const emit_target)
+ir_node const **be_get_jump_table_targets(ir_node const *const node, be_switch_attr_t const *const swtch, unsigned long *const length_out)
 {
 	/* go over all proj's and collect their jump targets */
 	unsigned        n_outs  = arch_get_irn_n_outs(node);
@@ -1604,6 +1673,21 @@ void be_emit_jump_table(ir_node const *const node, be_switch_attr_t const *const
 		}
 	}
 
+	for (unsigned long i = 0; i < length; ++i) {
+		if (labels[i] == NULL)
+			labels[i] = targets[0];
+	}
+
+	free(targets);
+	*length_out = length;
+	return labels;
+}
+
+void be_emit_jump_table(ir_node const *const node, be_switch_attr_t const *const swtch, ir_mode *const entry_mode, emit_target_func const emit_target)
+{
+	unsigned long         length;
+	ir_node const **const labels = be_get_jump_table_targets(node, swtch, &length);
+
 	/* emit table */
 	unsigned         const pointer_size = get_mode_size_bytes(entry_mode);
 	ir_entity const *const entity       = swtch->table_entity;
@@ -1616,20 +1700,18 @@ void be_emit_jump_table(ir_node const *const node, be_switch_attr_t const *const
 	}
 
 	for (unsigned long i = 0; i < length; ++i) {
-		ir_node const *target = labels[i];
-		if (target == NULL)
-			target = targets[0];
 		emit_size_type(pointer_size);
-		emit_target(entity, target);
+		emit_target(entity, labels[i]);
 		be_emit_char('\n');
 		be_emit_write_line();
 	}
 
-	if (entity && !is_macho())
-		be_gas_emit_switch_section(GAS_SECTION_TEXT);
+	if (entity && !is_macho()) {
+		be_gas_emit_switch_section(cold_part_entity != NULL
+			? GAS_SECTION_TEXT_UNLIKELY : GAS_SECTION_TEXT);
+	}
 
 	free(labels);
-	free(targets);
 }
 
 static void emit_global_asms(void)
@@ -1657,22 +1739,29 @@ void be_gas_begin_compilation_unit(const be_main_env_t *env)
 	be_dwarf_open();
 	be_dwarf_unit_begin(env->cup_name);
 
-	block_numbers = pmap_create();
-	next_block_nr = 0;
-
 	emit_global_asms();
 }
 
 void be_gas_end_compilation_unit(const be_main_env_t *env)
 {
+	/* the function texts end in an unknown section */
+	current_section = (be_gas_section_t)-1;
 	emit_global_decls(env);
 
-	pmap_destroy(block_numbers);
+	be_gas_exit_thread();
 
 	be_dwarf_unit_end();
 	be_dwarf_close();
 }
 
+void be_gas_exit_thread(void)
+{
+	if (block_numbers != NULL) {
+		pmap_destroy(block_numbers);
+		block_numbers = NULL;
+	}
+}
+
 void be_emit_finish_line_gas(const ir_node *node)
 {
 	if (node && be_options.verbose_asm) {
@@ -35,6 +35,7 @@ typedef enum {
 	GAS_SECTION_DEBUG_LINE,      /**< dwarf debug line */
 	GAS_SECTION_DEBUG_PUBNAMES,  /**< dwarf pub names */
 	GAS_SECTION_DEBUG_FRAME,     /**< dwarf callframe infos */
+	GAS_SECTION_TEXT_UNLIKELY,   /**< rarely executed program code */
 	GAS_SECTION_TYPE_MASK    = 0xFF,
 
 	GAS_SECTION_FLAG_TLS     = 1 << 8,  /**< thread local flag */
@@ -72,8 +73,42 @@ void be_gas_emit_function_prolog(const ir_entity *entity,
 
 void be_gas_emit_function_epilog(const ir_entity *entity);
 
+/**
+ * Check whether the code of the function @p entity may be split into a part in
+ * its own section and a cold part in a section for rarely executed code.
+ */
+bool be_gas_can_split_function(const ir_entity *entity);
+
+/**
+ * Continue the code of the function @p entity in the section for rarely
+ * executed code.
+ */
+void be_gas_begin_cold_part(const ir_entity *entity);
+
 char const *be_gas_get_private_prefix(void);
 
+/**
+ * Returns the section @p entity is placed in.
+ */
+be_gas_section_t be_gas_get_section(ir_entity const *entity);
+
+/**
+ * Returns the size of @p entity, including the initialized part of a
+ * trailing flexible array.
+ */
+unsigned long be_gas_get_entity_size(ir_entity const *entity);
+
+/**
+ * Returns the alignment of @p entity, which is the alignment of its type if
+ * none was set explicitly.
+ */
+unsigned be_gas_get_entity_alignment(ir_entity const *entity);
+
+/**
+ * Returns true if @p entity has an initializer consisting of zeros only.
+ */
+bool be_gas_entity_is_zero_initialized(ir_entity const *entity);
+
 /**
  * emit ld_ident of an entity and performs additional mangling if necessary.
  * (mangling is necessary for ir_visibility_private for example).
@@ -117,6 +152,12 @@ void be_gas_begin_compilation_unit(const be_main_env_t *env);
  */
 void be_gas_end_compilation_unit(const be_main_env_t *env);
 
+/**
+ * Frees the function text state of a thread, which emitted functions for
+ * be_compile_graphs().
+ */
+void be_gas_exit_thread(void);
+
 /**
  * Return the label prefix for labeled instructions.
  */
@@ -124,6 +165,13 @@ const char *be_gas_insn_label_prefix(void);
 
 typedef void (*emit_target_func)(ir_entity const *table, ir_node const *proj_x);
 
+/**
+ * Compute the entries of the jump table for switch operation @p node.
+ * Returns a freshly allocated array of @p *length control flow Projs, entries
+ * not covered by the table point to the default Proj.
+ */
+ir_node const **be_get_jump_table_targets(ir_node const *node, be_switch_attr_t const *swtch, unsigned long *length);
+
 /**
  * Emits a jump table for switch operations
  */
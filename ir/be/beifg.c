@@ -11,6 +11,7 @@
  */
 #include "beifg.h"
 
+#include "array.h"
 #include "bechordal_t.h"
 #include "beirg.h"
 #include "belive.h"
@@ -18,17 +19,63 @@
 #include "bitset.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "irtools.h"
 #include "lc_opts.h"
 #include "lc_opts_enum.h"
 #include "timing.h"
+#include "util.h"
 #include "xmalloc.h"
+#include <limits.h>
 #include <stdlib.h>
+#include <string.h>
+
+typedef enum ifg_flavor_t {
+	IFG_FLAVOR_STD,    /**< compute neighbours on demand */
+	IFG_FLAVOR_MATRIX, /**< materialize as bit matrix */
+	IFG_FLAVOR_CSR,    /**< materialize as adjacency arrays */
+	IFG_FLAVOR_AUTO,   /**< bit matrix for small, arrays for large graphs */
+} ifg_flavor_t;
+
+/** Graphs with up to this many nodes use the bit matrix in auto mode. */
+#define IFG_MATRIX_MAX_NODES 1024
+
+static int ifg_flavor = IFG_FLAVOR_AUTO;
+
+static const lc_opt_enum_int_items_t ifg_flavor_items[] = {
+	{ "std",    IFG_FLAVOR_STD    },
+	{ "matrix", IFG_FLAVOR_MATRIX },
+	{ "csr",    IFG_FLAVOR_CSR    },
+	{ "auto",   IFG_FLAVOR_AUTO   },
+	{ NULL,     0                 }
+};
+
+static lc_opt_enum_int_var_t ifg_flavor_var = {
+	&ifg_flavor, ifg_flavor_items
+};
+
+static const lc_opt_table_entry_t be_ifg_options[] = {
+	LC_OPT_ENT_ENUM_INT("ifg", "interference graph flavour", &ifg_flavor_var),
+	LC_OPT_LAST
+};
 
 void be_ifg_free(be_ifg_t *self)
 {
+	obstack_free(&self->obst, NULL);
 	free(self);
 }
 
+/**
+ * Returns the dense index of @p irn in the materialized graph or UINT_MAX if
+ * the node is not part of it.
+ */
+static unsigned get_dense_index(const be_ifg_t *ifg, const ir_node *irn)
+{
+	if (ifg->node_index == NULL)
+		return UINT_MAX;
+	unsigned const idx = get_irn_idx(irn);
+	return idx < ifg->n_idx ? ifg->node_index[idx] : UINT_MAX;
+}
+
 static void nodes_walker(ir_node *bl, void *data)
 {
 	nodes_iter_t     *it   = (nodes_iter_t*)data;
@@ -98,9 +145,11 @@ static void find_neighbour_walker(ir_node *block, void *data)
 
 static void find_neighbours(const be_ifg_t *ifg, neighbours_iter_t *it, const ir_node *irn)
 {
-	it->env         = ifg->env;
-	it->irn         = irn;
-	it->valid       = 1;
+	it->env          = ifg->env;
+	it->ifg          = ifg;
+	it->irn          = irn;
+	it->valid        = 1;
+	it->materialized = false;
 	ir_nodeset_init(&it->neighbours);
 
 	dom_tree_walk(get_nodes_block(irn), find_neighbour_walker, NULL, it);
@@ -108,16 +157,67 @@ static void find_neighbours(const be_ifg_t *ifg, neighbours_iter_t *it, const ir
 	ir_nodeset_iterator_init(&it->iter, &it->neighbours);
 }
 
+/**
+ * Sets up @p it to iterate the row of @p irn in the materialized graph.
+ * Returns false if @p irn is not part of the materialized graph.
+ */
+static bool begin_materialized(const be_ifg_t *ifg, neighbours_iter_t *it,
+                               const ir_node *irn)
+{
+	unsigned const i = get_dense_index(ifg, irn);
+	if (i == UINT_MAX)
+		return false;
+
+	it->env          = ifg->env;
+	it->ifg          = ifg;
+	it->irn          = irn;
+	it->valid        = 1;
+	it->materialized = true;
+	if (ifg->matrix != NULL) {
+		it->base = (size_t)i * ifg->n_nodes;
+		it->pos  = it->base;
+		it->end  = it->base + ifg->n_nodes;
+	} else {
+		it->base = 0;
+		it->pos  = ifg->offsets[i];
+		it->end  = ifg->offsets[i + 1];
+	}
+	return true;
+}
+
 static inline void neighbours_break(neighbours_iter_t *it, int force)
 {
 	(void) force;
 	assert(it->valid == 1);
-	ir_nodeset_destroy(&it->neighbours);
+	if (!it->materialized)
+		ir_nodeset_destroy(&it->neighbours);
 	it->valid = 0;
 }
 
+static ir_node *get_next_materialized(neighbours_iter_t *it)
+{
+	be_ifg_t const *const ifg = it->ifg;
+	if (ifg->matrix != NULL) {
+		size_t const next = it->pos < it->end
+			? bitset_next_set(ifg->matrix, it->pos) : (size_t)-1;
+		if (next == (size_t)-1 || next >= it->end) {
+			it->pos = it->end;
+			return NULL;
+		}
+		it->pos = next + 1;
+		return ifg->nodes[next - it->base];
+	}
+
+	if (it->pos >= it->end)
+		return NULL;
+	return ifg->nodes[ifg->adj[it->pos++]];
+}
+
 static ir_node *get_next_neighbour(neighbours_iter_t *it)
 {
+	if (it->materialized)
+		return get_next_materialized(it);
+
 	ir_node *res = ir_nodeset_iterator_next(&it->iter);
 
 	if (res == NULL) {
@@ -129,7 +229,8 @@ static ir_node *get_next_neighbour(neighbours_iter_t *it)
 ir_node *be_ifg_neighbours_begin(const be_ifg_t *ifg, neighbours_iter_t *iter,
                                  const ir_node *irn)
 {
-	find_neighbours(ifg, iter, irn);
+	if (!begin_materialized(ifg, iter, irn))
+		find_neighbours(ifg, iter, irn);
 	return get_next_neighbour(iter);
 }
 
@@ -244,16 +345,186 @@ int be_ifg_degree(const be_ifg_t *ifg, const ir_node *irn)
 {
 	neighbours_iter_t it;
 	int degree;
+	if (begin_materialized(ifg, &it, irn)) {
+		if (ifg->matrix == NULL)
+			return (int)(it.end - it.pos);
+		degree = 0;
+		while (get_next_materialized(&it) != NULL)
+			++degree;
+		return degree;
+	}
 	find_neighbours(ifg, &it, irn);
 	degree = ir_nodeset_size(&it.neighbours);
 	neighbours_break(&it, 1);
 	return degree;
 }
 
+typedef struct build_env_t {
+	be_ifg_t *ifg;
+	unsigned *living;     /**< Dense indices of the living nodes. */
+	unsigned *living_pos; /**< Position of a dense index in living. */
+	unsigned  n_living;
+	unsigned *edges;      /**< Flexible array of edge end pairs (CSR only). */
+} build_env_t;
+
+static void number_nodes_walker(ir_node *block, void *data)
+{
+	be_ifg_t         *ifg  = (be_ifg_t*)data;
+	struct list_head *head = get_block_border_head(ifg->env, block);
+
+	foreach_border_head(head, b) {
+		if (!b->is_def)
+			continue;
+		unsigned const idx = get_irn_idx(b->irn);
+		assert(idx < ifg->n_idx);
+		if (ifg->node_index[idx] != UINT_MAX)
+			continue;
+		ifg->node_index[idx] = ifg->n_nodes++;
+		obstack_ptr_grow(&ifg->obst, b->irn);
+	}
+}
+
+static void add_edge(build_env_t *env, unsigned a, unsigned b)
+{
+	be_ifg_t *const ifg = env->ifg;
+	if (ifg->matrix != NULL) {
+		bitset_set(ifg->matrix, (size_t)a * ifg->n_nodes + b);
+		bitset_set(ifg->matrix, (size_t)b * ifg->n_nodes + a);
+	} else {
+		ARR_APP1(unsigned, env->edges, a);
+		ARR_APP1(unsigned, env->edges, b);
+	}
+}
+
+/**
+ * Sweeps the border list of a block: Every node starting to live interferes
+ * with all nodes living at that point.
+ */
+static void build_walker(ir_node *block, void *data)
+{
+	build_env_t      *env  = (build_env_t*)data;
+	be_ifg_t         *ifg  = env->ifg;
+	struct list_head *head = get_block_border_head(ifg->env, block);
+
+	foreach_border_head(head, b) {
+		unsigned const i = get_dense_index(ifg, b->irn);
+		if (b->is_def) {
+			for (unsigned l = 0; l < env->n_living; ++l)
+				add_edge(env, env->living[l], i);
+			env->living_pos[i]          = env->n_living;
+			env->living[env->n_living++] = i;
+		} else {
+			/* remove by moving the last living node into the gap */
+			unsigned const pos  = env->living_pos[i];
+			unsigned const last = env->living[--env->n_living];
+			env->living[pos]      = last;
+			env->living_pos[last] = pos;
+		}
+	}
+
+	/* Nodes without a use stay alive until the end of their block. */
+	env->n_living = 0;
+}
+
+/**
+ * Builds the adjacency arrays from the collected edges. A pair of nodes
+ * living in several blocks at the same time produces an edge per block, so
+ * duplicates are removed.
+ */
+static void build_adjacency_arrays(build_env_t *env)
+{
+	be_ifg_t       *const ifg     = env->ifg;
+	unsigned const        n_nodes = ifg->n_nodes;
+	size_t const          n_ends  = ARR_LEN(env->edges);
+
+	unsigned *const offsets = OALLOCNZ(&ifg->obst, unsigned, n_nodes + 1);
+	for (size_t e = 0; e < n_ends; ++e)
+		++offsets[env->edges[e] + 1];
+	for (unsigned i = 0; i < n_nodes; ++i)
+		offsets[i + 1] += offsets[i];
+
+	unsigned *const adj  = XMALLOCN(unsigned, n_ends);
+	unsigned *const fill = XMALLOCN(unsigned, n_nodes);
+	memcpy(fill, offsets, n_nodes * sizeof(*fill));
+	for (size_t e = 0; e < n_ends; e += 2) {
+		unsigned const a = env->edges[e];
+		unsigned const b = env->edges[e + 1];
+		adj[fill[a]++] = b;
+		adj[fill[b]++] = a;
+	}
+
+	/* Compact the rows, fill[] now remembers the last row a node was seen. */
+	memset(fill, 0xFF, n_nodes * sizeof(*fill));
+	unsigned n_adj = 0;
+	for (unsigned i = 0; i < n_nodes; ++i) {
+		unsigned const start = offsets[i];
+		unsigned const end   = offsets[i + 1];
+		offsets[i] = n_adj;
+		for (unsigned p = start; p < end; ++p) {
+			unsigned const other = adj[p];
+			if (fill[other] == i)
+				continue;
+			fill[other]  = i;
+			adj[n_adj++] = other;
+		}
+	}
+	offsets[n_nodes] = n_adj;
+
+	ifg->offsets = offsets;
+	ifg->adj     = OALLOCN(&ifg->obst, unsigned, n_adj);
+	MEMCPY(ifg->adj, adj, n_adj);
+	free(fill);
+	free(adj);
+}
+
+/**
+ * Materializes the interference graph in one sweep over the border lists.
+ */
+static void materialize_ifg(be_ifg_t *ifg)
+{
+	ir_graph *const irg = ifg->env->irg;
+
+	ifg->n_idx      = get_irg_last_idx(irg);
+	ifg->node_index = OALLOCN(&ifg->obst, unsigned, ifg->n_idx);
+	memset(ifg->node_index, 0xFF, ifg->n_idx * sizeof(*ifg->node_index));
+	irg_block_walk_graph(irg, number_nodes_walker, NULL, ifg);
+	ifg->nodes = (ir_node**)obstack_finish(&ifg->obst);
+
+	unsigned const n_nodes    = ifg->n_nodes;
+	bool     const use_matrix = ifg_flavor == IFG_FLAVOR_MATRIX
+		|| (ifg_flavor == IFG_FLAVOR_AUTO && n_nodes <= IFG_MATRIX_MAX_NODES);
+
+	build_env_t env;
+	env.ifg        = ifg;
+	env.living     = XMALLOCN(unsigned, n_nodes);
+	env.living_pos = XMALLOCN(unsigned, n_nodes);
+	env.n_living   = 0;
+	env.edges      = NULL;
+	if (use_matrix) {
+		ifg->matrix = bitset_obstack_alloc(&ifg->obst,
+		                                   (size_t)n_nodes * n_nodes);
+	} else {
+		env.edges = NEW_ARR_F(unsigned, 0);
+	}
+
+	irg_block_walk_graph(irg, build_walker, NULL, &env);
+
+	if (!use_matrix) {
+		build_adjacency_arrays(&env);
+		DEL_ARR_F(env.edges);
+	}
+	free(env.living_pos);
+	free(env.living);
+}
+
 be_ifg_t *be_create_ifg(const be_chordal_env_t *env)
 {
-	be_ifg_t *ifg = XMALLOC(be_ifg_t);
+	be_ifg_t *ifg = XMALLOCZ(be_ifg_t);
 	ifg->env = env;
+	obstack_init(&ifg->obst);
+
+	if (ifg_flavor != IFG_FLAVOR_STD)
+		materialize_ifg(ifg);
 
 	return ifg;
 }
@@ -307,3 +578,13 @@ void be_ifg_stat(ir_graph *irg, be_ifg_t *ifg, be_ifg_stat_t *stat)
 	stat->n_edges = n_edges / 2;
 	stat->n_comps = n_comps;
 }
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_ifg)
+void be_init_ifg(void)
+{
+	lc_opt_entry_t *be_grp      = lc_opt_get_grp(firm_opt_get_root(), "be");
+	lc_opt_entry_t *ra_grp      = lc_opt_get_grp(be_grp, "ra");
+	lc_opt_entry_t *chordal_grp = lc_opt_get_grp(ra_grp, "chordal");
+
+	lc_opt_add_table(chordal_grp, be_ifg_options);
+}
@@ -14,12 +14,30 @@
 
 #include "be_types.h"
 #include "bechordal.h"
+#include "bitset.h"
 #include "irnodeset.h"
 #include "obstack.h"
 #include "pset.h"
 
+/**
+ * The interference graph of a register class.
+ *
+ * If the graph is materialized, every node defined in the border lists gets a
+ * dense index and its neighbours are stored either in a bit matrix (small
+ * graphs) or in compressed sparse rows (large graphs). Otherwise the
+ * neighbours are recomputed from the border lists for every query.
+ */
 struct be_ifg_t {
 	const be_chordal_env_t *env;
+	struct obstack          obst;       /**< Holds the materialized graph. */
+	unsigned                n_nodes;    /**< Number of materialized nodes. */
+	unsigned                n_idx;      /**< Size of the index map. */
+	unsigned               *node_index; /**< Node index to dense index, NULL
+	                                         if the graph is not materialized. */
+	ir_node               **nodes;      /**< Dense index to node. */
+	bitset_t               *matrix;     /**< Adjacency bit matrix or NULL. */
+	unsigned               *offsets;    /**< Row starts of the adjacency arrays. */
+	unsigned               *adj;        /**< Dense indices of the neighbours. */
 };
 
 typedef struct nodes_iter_t {
@@ -32,10 +50,15 @@ typedef struct nodes_iter_t {
 
 typedef struct neighbours_iter_t {
 	const be_chordal_env_t *env;
+	const be_ifg_t       *ifg;
 	const ir_node        *irn;
 	int                   valid;
+	bool                  materialized; /**< Iterate the materialized graph. */
 	ir_nodeset_t          neighbours;
 	ir_nodeset_iterator_t iter;
+	size_t                pos;          /**< Next position in the row. */
+	size_t                end;          /**< End of the row. */
+	size_t                base;         /**< Start of the row in the matrix. */
 } neighbours_iter_t;
 
 typedef struct cliques_iter_t {
@@ -43,8 +43,8 @@ void be_info_new_node(ir_graph *irg, ir_node *node)
 	struct obstack *obst = be_get_be_obst(irg);
 	backend_info_t *info = OALLOCZ(obst, backend_info_t);
 
-	assert(node->backend_info == NULL);
-	node->backend_info = info;
+	assert(node->cold->backend_info == NULL);
+	node->cold->backend_info = info;
 
 	/*
 	 * Set backend info for some middleend nodes which still appear in
@@ -80,12 +80,15 @@ void be_info_new_node(ir_graph *irg, ir_node *node)
 static void new_phi_copy_attr(ir_graph *irg, const ir_node *old_node,
                               ir_node *new_node)
 {
-	backend_info_t *old_info = be_get_info(old_node);
-	backend_info_t *new_info = be_get_info(new_node);
-
-	new_info->in_reqs = old_info->in_reqs;
-	size_t const n_outs = arch_get_irn_n_outs(old_node);
-	MEMCPY(new_info->out_infos, old_info->out_infos, n_outs);
+	/* graphs compacted before the backend takes over have no backend info */
+	if (irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_BACKEND)) {
+		backend_info_t *old_info = be_get_info(old_node);
+		backend_info_t *new_info = be_get_info(new_node);
+
+		new_info->in_reqs = old_info->in_reqs;
+		size_t const n_outs = arch_get_irn_n_outs(old_node);
+		MEMCPY(new_info->out_infos, old_info->out_infos, n_outs);
+	}
 
 	old_phi_copy_attr(irg, old_node, new_node);
 }
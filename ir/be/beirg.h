@@ -54,7 +54,20 @@ typedef struct be_irg_t {
 	struct obstack    obst;
 	/** Architecture specific per-graph data */
 	void             *isa_link;
+	/** Slot of the function's text in the assembler output */
+	unsigned          emit_chunk;
+	bool              has_emit_chunk;
+	/** Number of identifiers created by be_new_irg_ident() */
+	unsigned          n_idents;
+	/** Number of blocks at the start of the block schedule, which are not
+	 * moved into the cold part of the function */
+	unsigned          n_hot_blocks;
 	bool              has_returns_twice_call;
+	/** The graph was read from a file for code generation only and is
+	 * turned back into a stub after its code is emitted. */
+	bool              release_after_emit;
+	/** CSE setting restored by be_step_last() */
+	int               cse_setting;
 } be_irg_t;
 
 static inline be_irg_t *be_birg_from_irg(const ir_graph *irg)
@@ -9,6 +9,9 @@
  * @author      Matthias Braun
  * @date        12.03.2007
  */
+/* for MAP_ANONYMOUS with -std=c99 */
+#define _DEFAULT_SOURCE
+
 #include "bejit.h"
 
 #include "array.h"
@@ -19,9 +22,17 @@
 #include "entity_t.h"
 #include "obst.h"
 #include "panic.h"
+#include "xmalloc.h"
 #include <assert.h>
 #include <limits.h>
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
 typedef enum reloc_dest_kind_t {
 	RELOC_DEST_CODE_FRAGMENT,
 	RELOC_DEST_ENTITY,
@@ -36,21 +47,35 @@ typedef struct relocation_t {
 		uint16_t   fragment_num;
 		ir_entity *entity;
 	} dest;
+	uint8_t                   len;       /**< emitted size */
+	uint8_t                   long_len;  /**< size reserved in the code */
+	uint8_t                   long_kind; /**< be_kind of the long form */
 } relocation_t;
 
 typedef struct fragment_info_t {
 	unsigned     address;  /**< Address from begin of code segment */
 	unsigned     len;      /**< size of the fragments data */
+	unsigned     size;     /**< size after relaxing jumps */
 	uint8_t      p2align;  /**< power 2 of two we should align */
 	uint8_t      max_skip; /**< Maximum number of bytes to skip for alignment */
 	uint16_t     n_relocations;
 	relocation_t relocations[];
 } fragment_info_t;
 
+/** Executable memory allocated by be_jit_load_function(). */
+typedef struct jit_memory_t jit_memory_t;
+struct jit_memory_t {
+	jit_memory_t *next;
+	void         *address;
+	size_t        size;
+};
+
 struct ir_jit_segment_t {
 	struct obstack code_obst;
 	struct obstack fragment_info_obst;
 	struct obstack fragment_info_arr_obst;
+	jit_memory_t  *memory;
+	bool           relocatable;
 };
 
 struct ir_jit_function_t {
@@ -60,9 +85,10 @@ struct ir_jit_function_t {
 	fragment_info_t **fragment_infos;
 };
 
-struct obstack        *code_obst;
-static struct obstack *fragment_info_obst;
-static struct obstack *fragment_info_arr_obst;
+THREAD_LOCAL struct obstack        *code_obst;
+static THREAD_LOCAL struct obstack *fragment_info_obst;
+static THREAD_LOCAL struct obstack *fragment_info_arr_obst;
+static THREAD_LOCAL bool            relocatable;
 
 ir_jit_segment_t *be_new_jit_segment(void)
 {
@@ -73,8 +99,35 @@ ir_jit_segment_t *be_new_jit_segment(void)
 	return segment;
 }
 
+ir_jit_segment_t *be_new_relocatable_jit_segment(void)
+{
+	ir_jit_segment_t *const segment = be_new_jit_segment();
+	segment->relocatable = true;
+	return segment;
+}
+
+bool be_jit_is_relocatable(void)
+{
+	return relocatable;
+}
+
+static void free_code_memory(void *const address, size_t const size)
+{
+#ifdef _WIN32
+	(void)size;
+	VirtualFree(address, 0, MEM_RELEASE);
+#else
+	munmap(address, size);
+#endif
+}
+
 void be_destroy_jit_segment(ir_jit_segment_t *segment)
 {
+	for (jit_memory_t *memory = segment->memory, *next; memory; memory = next) {
+		next = memory->next;
+		free_code_memory(memory->address, memory->size);
+		free(memory);
+	}
 	obstack_free(&segment->code_obst, NULL);
 	obstack_free(&segment->fragment_info_obst, NULL);
 	obstack_free(&segment->fragment_info_arr_obst, NULL);
@@ -101,38 +154,75 @@ void be_jit_begin_function(ir_jit_segment_t *const segment)
 	code_obst              = &segment->code_obst;
 	fragment_info_obst     = &segment->fragment_info_obst;
 	fragment_info_arr_obst = &segment->fragment_info_arr_obst;
+	relocatable            = segment->relocatable;
 }
 
-static void layout_fragments(ir_jit_function_t *const function,
-                             unsigned const code_size)
+static void layout_fragments(ir_jit_function_t *const function)
 {
 	unsigned          const n_fragments    = function->n_fragments;
 	fragment_info_t **const fragment_infos = function->fragment_infos;
 
-	unsigned address      = 0;
-#ifndef NDEBUG
-	unsigned orig_address = 0;
-#endif
+	unsigned address = 0;
 	for (unsigned i = 0; i < n_fragments; ++i) {
 		fragment_info_t *const fragment = fragment_infos[i];
-		assert(fragment->address == ~0u);
-		assert(fragment->len != ~0u);
 
 		unsigned const align   = 1 << fragment->p2align;
 		unsigned const aligned = round_up2(address, align);
 		if (aligned - address <= fragment->max_skip)
 			address = aligned;
 
-		fragment->address = address;
+		unsigned size = fragment->len;
+		for (unsigned r = 0, n = fragment->n_relocations; r < n; ++r) {
+			relocation_t const *const relocation = &fragment->relocations[r];
+			size -= relocation->long_len - relocation->len;
+		}
 
-		address      += fragment->len;
-#ifndef NDEBUG
-		orig_address += fragment->len;
-#endif
+		fragment->address = address;
+		fragment->size    = size;
+		address          += size;
 	}
 	function->size = address;
-	assert(code_size == orig_address);
-	(void)code_size;
+}
+
+static int32_t resolve_relocation_code(ir_jit_function_t const *const function,
+                                       relocation_t const *const relocation,
+                                       unsigned const relocation_address)
+{
+	unsigned const fragment_num = relocation->dest.fragment_num;
+	assert(fragment_num < function->n_fragments);
+	fragment_info_t const *const fragment
+		= function->fragment_infos[fragment_num];
+	unsigned const dest_address = fragment->address + relocation->dest_offset;
+	return (int32_t)dest_address - relocation_address;
+}
+
+/**
+ * Switch jumps whose short form does not reach the destination to their
+ * long form. Returns true if anything changed.
+ */
+static bool relax_jumps(ir_jit_function_t *const function)
+{
+	bool changed = false;
+	for (unsigned i = 0, n = function->n_fragments; i < n; ++i) {
+		fragment_info_t *const fragment = function->fragment_infos[i];
+		unsigned               shrink   = 0;
+		for (unsigned r = 0; r < fragment->n_relocations; ++r) {
+			relocation_t *const relocation = &fragment->relocations[r];
+			unsigned      const address
+				= fragment->address + relocation->offset - shrink;
+			if (relocation->len < relocation->long_len) {
+				int32_t const dest = resolve_relocation_code(function,
+					relocation, address + relocation->len);
+				if (dest < INT8_MIN || dest > INT8_MAX) {
+					relocation->len     = relocation->long_len;
+					relocation->be_kind = relocation->long_kind;
+					changed             = true;
+				}
+			}
+			shrink += relocation->long_len - relocation->len;
+		}
+	}
+	return changed;
 }
 
 ir_jit_function_t *be_jit_finish_function(void)
@@ -144,14 +234,26 @@ ir_jit_function_t *be_jit_finish_function(void)
 	assert(size % sizeof(fragment_info_t*) == 0);
 	fragment_info_t **const fragment_infos = obstack_finish(obst);
 
+#ifndef NDEBUG
 	unsigned const code_size = obstack_object_size(code_obst);
+	unsigned       orig_size = 0;
+	for (unsigned i = 0; i < n_fragments; ++i) {
+		assert(fragment_infos[i]->address == ~0u);
+		assert(fragment_infos[i]->len != ~0u);
+		orig_size += fragment_infos[i]->len;
+	}
+	assert(code_size == orig_size);
+#endif
 
 	ir_jit_function_t *const res = OALLOCZ(obst, ir_jit_function_t);
 	res->n_fragments    = n_fragments;
 	res->fragment_infos = fragment_infos;
 	res->code           = obstack_finish(code_obst);
 
-	layout_fragments(res, code_size);
+	/* Jumps only ever grow, so this terminates. */
+	do {
+		layout_fragments(res);
+	} while (relax_jumps(res));
 
 #ifndef NDEBUG
 	code_obst              = NULL;
@@ -167,6 +269,60 @@ unsigned be_get_function_size(ir_jit_function_t const *const function)
 	return function->size;
 }
 
+/** Allocate writable memory, which is later made executable. */
+static void *allocate_code_memory(size_t const size)
+{
+#ifdef _WIN32
+	return VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+	void *address = MAP_FAILED;
+#ifdef MAP_32BIT
+	/* Prefer the low 2GB, so absolute 32bit references to the code (like
+	 * non-PIC jump tables) can be resolved. */
+	address = mmap(NULL, size, PROT_READ | PROT_WRITE,
+	               MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+#endif
+	if (address == MAP_FAILED)
+		address = mmap(NULL, size, PROT_READ | PROT_WRITE,
+		               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	return address != MAP_FAILED ? address : NULL;
+#endif
+}
+
+static bool make_code_executable(void *const address, size_t const size)
+{
+#ifdef _WIN32
+	DWORD old_protect;
+	if (!VirtualProtect(address, size, PAGE_EXECUTE_READ, &old_protect))
+		return false;
+	return FlushInstructionCache(GetCurrentProcess(), address, size);
+#else
+	return mprotect(address, size, PROT_READ | PROT_EXEC) == 0;
+#endif
+}
+
+void *be_jit_load_function(ir_jit_segment_t *const segment,
+                           ir_jit_function_t *const function)
+{
+	size_t const size = function->size > 0 ? function->size : 1;
+	char  *const code = (char*)allocate_code_memory(size);
+	if (code == NULL)
+		return NULL;
+
+	be_emit_function(code, function);
+	if (!make_code_executable(code, size)) {
+		free_code_memory(code, size);
+		return NULL;
+	}
+
+	jit_memory_t *const memory = XMALLOC(jit_memory_t);
+	memory->next    = segment->memory;
+	memory->address = code;
+	memory->size    = size;
+	segment->memory = memory;
+	return code;
+}
+
 unsigned be_begin_fragment(uint8_t const p2align, uint8_t const max_skip)
 {
 	assert(obstack_object_size(fragment_info_obst) == 0);
@@ -210,12 +366,32 @@ static void be_emit_relocation(unsigned const len, relocation_t *const relocatio
 	unsigned         const now      = obstack_object_size(code_obst);
 	relocation->offset = now - begin;
 
+	relocation->long_len = len;
+	if (relocation->len == 0)
+		relocation->len = len;
+
 	assert(obstack_object_size(fragment_info_obst) >= sizeof(fragment_info_t));
 	obstack_grow(fragment_info_obst, relocation, sizeof(*relocation));
 
 	obstack_blank(code_obst, len);
 }
 
+void be_emit_reloc_jump(uint8_t const short_kind, unsigned const short_len,
+                        uint8_t const long_kind, unsigned const long_len,
+                        unsigned const fragment_num)
+{
+	assert(short_len < long_len);
+	relocation_t relocation = {
+		.be_kind           = short_kind,
+		.dest_kind         = RELOC_DEST_CODE_FRAGMENT,
+		.dest.fragment_num = fragment_num,
+		/* start optimistically with the short form, see relax_jumps() */
+		.len               = short_len,
+		.long_kind         = long_kind,
+	};
+	be_emit_relocation(long_len, &relocation);
+}
+
 void be_emit_reloc_fragment(unsigned const len, uint8_t const be_kind,
                             unsigned const fragment_num, int32_t const offset)
 {
@@ -240,18 +416,6 @@ void be_emit_reloc_entity(unsigned const len, uint8_t be_kind,
 	be_emit_relocation(len, &relocation);
 }
 
-static int32_t resolve_relocation_code(ir_jit_function_t const *const function,
-                                       relocation_t const *const relocation,
-                                       unsigned const relocation_address)
-{
-	unsigned const fragment_num = relocation->dest.fragment_num;
-	assert(fragment_num < function->n_fragments);
-	fragment_info_t const *const fragment
-		= function->fragment_infos[fragment_num];
-	unsigned const dest_address = fragment->address + relocation->dest_offset;
-	return (int32_t)dest_address - relocation_address;
-}
-
 static unsigned emit_relocation(ir_jit_function_t const *const function,
                                 relocation_t const *const relocation,
                                 unsigned const relocation_address,
@@ -287,14 +451,18 @@ static void emit_fragment_as_asm(ir_jit_function_t const *const function,
 {
 	unsigned        const fragment_address = fragment->address;
 	char     const *      b                = fragment_code;
+	unsigned              shrink           = 0;
 	for (unsigned r = 0, n = fragment->n_relocations; r < n; ++r) {
 		relocation_t const *const relocation = &fragment->relocations[r];
 		unsigned            const offset     = relocation->offset;
 		emit_bytes_as_asm(b, fragment_code + offset);
-		unsigned const reloc_address = fragment_address + offset;
+		unsigned const reloc_address = fragment_address + offset - shrink;
 		unsigned const reloc_size
 			= emit_relocation(function, relocation, reloc_address, NULL, emit);
-		b = fragment_code + relocation->offset + reloc_size;
+		assert(reloc_size == relocation->len);
+		(void)reloc_size;
+		b       = fragment_code + offset + relocation->long_len;
+		shrink += relocation->long_len - relocation->len;
 	}
 	char const *const end = fragment_code + fragment->len;
 	emit_bytes_as_asm(b, end);
@@ -317,7 +485,7 @@ void be_jit_emit_as_asm(ir_jit_function_t *const function,
 		emit_fragment_as_asm(function, fragment, code + orig_address, emit);
 
 		orig_address += fragment->len;
-		last_address = address + fragment->len;
+		last_address = address + fragment->size;
 	}
 }
 
@@ -338,12 +506,13 @@ static void emit_fragment(ir_jit_function_t const *const function,
 		memcpy(d, b, len);
 		d += len;
 		b += len;
-		unsigned const reloc_address = fragment_address + offset;
+		unsigned const reloc_address = fragment_address + (d - buffer);
 		unsigned const reloc_size
 			= emit_relocation(function, relocation, reloc_address, d, emit);
+		assert(reloc_size == relocation->len);
 		d += reloc_size;
-		b += reloc_size;
-		last_offset = offset + reloc_size;
+		b += relocation->long_len;
+		last_offset = offset + relocation->long_len;
 	}
 	char const *const end = fragment_code + fragment->len;
 	assert(b <= end);
@@ -360,7 +529,7 @@ void be_jit_emit_memory(char *const buffer, ir_jit_function_t *const function,
 	for (size_t i = 0, n = function->n_fragments; i < n; ++i) {
 		fragment_info_t const *const fragment  = function->fragment_infos[i];
 		unsigned               const address   = fragment->address;
-		unsigned               const nop_bytes = last_address - address;
+		unsigned               const nop_bytes = address - last_address;
 		assert(address >= last_address);
 		if (nop_bytes > 0)
 			emitter->nops(buffer + last_address, nop_bytes);
@@ -369,6 +538,6 @@ void be_jit_emit_memory(char *const buffer, ir_jit_function_t *const function,
 		              emitter->relocation);
 
 		orig_address += fragment->len;
-		last_address = address + fragment->len;
+		last_address = address + fragment->size;
 	}
 }
@@ -12,8 +12,10 @@
 #ifndef FIRM_BE_BEEMITTER_BINARY_H
 #define FIRM_BE_BEEMITTER_BINARY_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "compiler.h"
 #include "firm_types.h"
 #include "jit.h"
 #include "obst.h"
@@ -35,13 +37,25 @@ void be_jit_emit_memory(char *buffer, ir_jit_function_t *function,
 
 void be_jit_emit_as_asm(ir_jit_function_t *function, emit_relocation_func emit);
 
+/**
+ * Create a segment for functions which are written to an object file instead
+ * of being loaded: relocations against entities stay symbolic.
+ */
+ir_jit_segment_t *be_new_relocatable_jit_segment(void);
+
+/**
+ * Returns true if the function currently being emitted belongs to a
+ * relocatable segment, see be_new_relocatable_jit_segment().
+ */
+bool be_jit_is_relocatable(void);
+
 void be_jit_begin_function(ir_jit_segment_t *segment);
 ir_jit_function_t *be_jit_finish_function(void);
 
 unsigned be_begin_fragment(uint8_t p2align, uint8_t max_skip);
 void be_finish_fragment(void);
 
-extern struct obstack *code_obst;
+extern THREAD_LOCAL struct obstack *code_obst;
 
 /** Append a byte to the current fragment */
 static inline void be_emit8(uint8_t const byte)
@@ -67,4 +81,14 @@ void be_emit_reloc_fragment(unsigned len, uint8_t be_kind,
 void be_emit_reloc_entity(unsigned len, uint8_t be_kind, ir_entity *entity,
                           int32_t offset);
 
+/**
+ * Append a jump to fragment @p fragment_num that covers the whole
+ * instruction. The short form (@p short_len bytes of kind @p short_kind) is
+ * used if the destination is reachable with an 8bit displacement relative to
+ * the end of the short form, otherwise the long form is used.
+ */
+void be_emit_reloc_jump(uint8_t short_kind, unsigned short_len,
+                        uint8_t long_kind, unsigned long_len,
+                        unsigned fragment_num);
+
 #endif
@@ -34,12 +34,12 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
-static ir_node     *current_block;
-static unsigned    *available;
-static ir_node     *ready_cfop;
+static THREAD_LOCAL ir_node     *current_block;
+static THREAD_LOCAL unsigned    *available;
+static THREAD_LOCAL ir_node     *ready_cfop;
 /** Set of ready nodes (nodes where all dependencies are already fulfilled).
  * Does not contain cfops. */
-static ir_nodeset_t ready_set;
+static THREAD_LOCAL ir_nodeset_t ready_set;
 
 /**
  * Returns non-zero if the node is already available
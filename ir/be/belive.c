@@ -16,8 +16,11 @@
 #include "iredges_t.h"
 #include "irgwalk.h"
 #include "irprintf.h"
+#include "irtools.h"
 #include "irdump_t.h"
 #include "irnodeset.h"
+#include "lc_opts.h"
+#include "raw_bitset.h"
 
 #include "statev_t.h"
 #include "be_t.h"
@@ -25,10 +28,36 @@
 #include "besched.h"
 #include "bemodule.h"
 #include "beirg.h"
+#include "target_t.h"
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
 #define LV_STD_SIZE             63
+#define NO_NUMBER               ((unsigned)-1)
+
+static bool use_bitsets = true;
+
+static const lc_opt_table_entry_t options[] = {
+	LC_OPT_ENT_BOOL("bitsets", "keep dense liveness bitsets per register class", &use_bitsets),
+	LC_OPT_LAST
+};
+
+/** Dense liveness of the values of one register class. */
+typedef struct lv_class_sets_t {
+	bool      valid;
+	unsigned  n_values;
+	unsigned  n_words;  /**< size of a block's bitset in words */
+	ir_node **values;   /**< values by value number, flexible array */
+	unsigned *live_in;  /**< live-in bitsets, n_words per block */
+	unsigned *live_end; /**< live-end bitsets, n_words per block */
+} lv_class_sets_t;
+
+struct be_lv_dense_t {
+	unsigned        n_nodes;
+	unsigned       *numbers;   /**< block or value number by node index */
+	unsigned        n_blocks;
+	lv_class_sets_t classes[];
+};
 
 static unsigned _be_liveness_bsearch(be_lv_info_t const *const arr, ir_node const *const node)
 {
@@ -159,7 +188,7 @@ static void lv_remove_irn_walker(ir_node *const bl, void *const data)
 	DBG((dbg, LEVEL_3, "\tdeleting %+F from %+F at pos %d\n", irn, bl, pos));
 }
 
-static struct {
+static THREAD_LOCAL struct {
 	be_lv_t *lv;         /**< The liveness object. */
 	ir_node *def;        /**< The node (value). */
 	ir_node *def_block;  /**< The block of def. */
@@ -258,6 +287,261 @@ static void collect_liveness_nodes(ir_node *irn, void *data)
 		nodes[get_irn_idx(irn)] = irn;
 }
 
+/**
+ * Returns the register class of value @p irn if it is one of the classes
+ * bitsets are kept for, NULL otherwise.
+ */
+static arch_register_class_t const *get_dense_class(ir_node const *irn)
+{
+	if (get_irn_mode(irn) == mode_T)
+		return NULL;
+	unsigned pos = 0;
+	if (is_Proj(irn)) {
+		pos = get_Proj_num(irn);
+		irn = get_Proj_pred(irn);
+	}
+	backend_info_t const *const info = be_get_info(irn);
+	if (info == NULL || info->out_infos == NULL
+	 || pos >= ARR_LEN(info->out_infos))
+		return NULL;
+
+	arch_register_req_t   const *const req = info->out_infos[pos].req;
+	arch_register_class_t const *const cls = req != NULL ? req->cls : NULL;
+	if (cls == NULL || req->ignore
+	 || cls->index >= ir_target.isa->n_register_classes
+	 || &ir_target.isa->register_classes[cls->index] != cls)
+		return NULL;
+	return cls;
+}
+
+static unsigned dense_number(be_lv_dense_t const *const dense,
+                             ir_node const *const node)
+{
+	unsigned const idx = get_irn_idx(node);
+	return idx < dense->n_nodes ? dense->numbers[idx] : NO_NUMBER;
+}
+
+/**
+ * Returns the class sets containing @p value and its value number, NULL if
+ * there are no valid bitsets for it.
+ */
+static lv_class_sets_t *dense_get_class(be_lv_t const *const lv,
+                                        ir_node const *const value,
+                                        unsigned *const nr)
+{
+	be_lv_dense_t *const dense = lv->dense;
+	if (dense == NULL)
+		return NULL;
+	arch_register_class_t const *const cls = get_dense_class(value);
+	if (cls == NULL)
+		return NULL;
+	lv_class_sets_t *const sets = &dense->classes[cls->index];
+	unsigned         const v    = dense_number(dense, value);
+	if (!sets->valid || v >= sets->n_values || sets->values[v] != value)
+		return NULL;
+	*nr = v;
+	return sets;
+}
+
+/**
+ * Like be_is_live_end() but answered from the bitsets if possible.
+ */
+static bool lv_live_end(be_lv_t const *const lv, ir_node const *const block,
+                        ir_node const *const value)
+{
+	unsigned               v;
+	lv_class_sets_t const *sets = dense_get_class(lv, value, &v);
+	if (sets != NULL) {
+		unsigned const b = dense_number(lv->dense, block);
+		if (b < lv->dense->n_blocks)
+			return rbitset_is_set(&sets->live_end[b * sets->n_words], v);
+	}
+	return be_is_live_end(lv, block, value);
+}
+
+/**
+ * The bitsets of the class of @p irn become stale when its liveness changes.
+ */
+static void dense_invalidate_node(be_lv_t *const lv, ir_node const *const irn)
+{
+	if (lv->dense == NULL)
+		return;
+	arch_register_class_t const *const cls = get_dense_class(irn);
+	if (cls != NULL)
+		lv->dense->classes[cls->index].valid = false;
+}
+
+static void dense_free(be_lv_t *const lv)
+{
+	be_lv_dense_t *const dense = lv->dense;
+	if (dense == NULL)
+		return;
+	for (unsigned c = 0, n = ir_target.isa->n_register_classes; c < n; ++c) {
+		lv_class_sets_t *const sets = &dense->classes[c];
+		if (sets->values != NULL)
+			DEL_ARR_F(sets->values);
+		free(sets->live_in);
+		free(sets->live_end);
+	}
+	free(dense->numbers);
+	free(dense);
+	lv->dense = NULL;
+}
+
+/**
+ * Solve the liveness of one register class. Every value gets set in the
+ * def bitset of its block, in the gen bitset of blocks using it and in the
+ * phi_use bitset of Phi predecessor blocks. Then
+ *   end(B) = phi_use(B) | U in(S) for all successors S
+ *   in(B)  = gen(B) | (end(B) & ~def(B))
+ * is solved with a worklist that starts in reverse walk order, so most
+ * successors are handled before their predecessors.
+ */
+static void dense_compute_class(be_lv_dense_t *const dense,
+                                lv_class_sets_t *const sets,
+                                ir_node **const blocks)
+{
+	unsigned const n_blocks = dense->n_blocks;
+	unsigned const n_words  = BITSET_SIZE_ELEMS(sets->n_values);
+	size_t   const size     = (size_t)n_blocks * n_words;
+	unsigned      *gen      = XMALLOCNZ(unsigned, size);
+	unsigned      *def      = XMALLOCNZ(unsigned, size);
+	unsigned      *in       = XMALLOCNZ(unsigned, size);
+	unsigned      *end      = XMALLOCNZ(unsigned, size);
+	sets->n_words = n_words;
+
+	for (unsigned v = 0; v < sets->n_values; ++v) {
+		ir_node *const value     = sets->values[v];
+		ir_node *const def_block = get_nodes_block(value);
+		unsigned const d         = dense_number(dense, def_block);
+		if (d >= n_blocks)
+			continue;
+		rbitset_set(&def[d * n_words], v);
+
+		foreach_out_edge(value, edge) {
+			ir_node *const use = get_edge_src_irn(edge);
+			if (!is_liveness_node(use))
+				continue;
+			ir_node *const use_block = get_nodes_block(use);
+			if (is_Phi(use)) {
+				ir_node *const pred_block
+					= get_Block_cfgpred_block(use_block, get_edge_src_pos(edge));
+				unsigned const p = dense_number(dense, pred_block);
+				if (p < n_blocks)
+					rbitset_set(&end[p * n_words], v);
+			} else if (use_block != def_block) {
+				unsigned const u = dense_number(dense, use_block);
+				if (u < n_blocks)
+					rbitset_set(&gen[u * n_words], v);
+			}
+		}
+	}
+
+	unsigned *const queue    = XMALLOCN(unsigned, n_blocks);
+	unsigned *const in_queue = rbitset_malloc(n_blocks);
+	unsigned        head     = 0;
+	unsigned        n_queued = 0;
+	for (unsigned b = n_blocks; b-- > 0; ) {
+		unsigned *const bin  = &in[b * n_words];
+		unsigned *const bend = &end[b * n_words];
+		unsigned *const bgen = &gen[b * n_words];
+		unsigned *const bdef = &def[b * n_words];
+		for (unsigned w = 0; w < n_words; ++w)
+			bin[w] = bgen[w] | (bend[w] & ~bdef[w]);
+		queue[n_queued++] = b;
+		rbitset_set(in_queue, b);
+	}
+
+	while (n_queued > 0) {
+		unsigned const b = queue[head];
+		head = head + 1 == n_blocks ? 0 : head + 1;
+		--n_queued;
+		rbitset_clear(in_queue, b);
+
+		unsigned const *const bin   = &in[b * n_words];
+		ir_node        *const block = blocks[b];
+		for (int i = get_Block_n_cfgpreds(block); i-- > 0; ) {
+			ir_node *const pred_block = get_Block_cfgpred_block(block, i);
+			unsigned const p          = dense_number(dense, pred_block);
+			if (p >= n_blocks)
+				continue;
+			unsigned *const pin  = &in[p * n_words];
+			unsigned *const pend = &end[p * n_words];
+			unsigned *const pdef = &def[p * n_words];
+			bool            changed = false;
+			for (unsigned w = 0; w < n_words; ++w) {
+				unsigned const new_end = pend[w] | bin[w];
+				unsigned const new_in  = pin[w] | (new_end & ~pdef[w]);
+				changed |= new_in != pin[w];
+				pend[w] = new_end;
+				pin[w]  = new_in;
+			}
+			if (changed && !rbitset_is_set(in_queue, p)) {
+				unsigned const tail = (head + n_queued) % n_blocks;
+				queue[tail] = p;
+				++n_queued;
+				rbitset_set(in_queue, p);
+			}
+		}
+	}
+
+	free(in_queue);
+	free(queue);
+	free(def);
+	free(gen);
+	sets->live_in  = in;
+	sets->live_end = end;
+	sets->valid    = true;
+}
+
+static void collect_block(ir_node *block, void *data)
+{
+	ir_node ***blocks = (ir_node***)data;
+	ARR_APP1(ir_node*, *blocks, block);
+}
+
+static void collect_dense_value(ir_node *irn, void *data)
+{
+	be_lv_dense_t *const dense = (be_lv_dense_t*)data;
+	if (!is_liveness_node(irn))
+		return;
+	arch_register_class_t const *const cls = get_dense_class(irn);
+	if (cls == NULL)
+		return;
+	lv_class_sets_t *const sets = &dense->classes[cls->index];
+	if (sets->values == NULL)
+		sets->values = NEW_ARR_F(ir_node*, 0);
+	dense->numbers[get_irn_idx(irn)] = ARR_LEN(sets->values);
+	ARR_APP1(ir_node*, sets->values, irn);
+}
+
+static void dense_compute(be_lv_t *const lv)
+{
+	ir_graph *const irg       = lv->irg;
+	unsigned  const n_classes = ir_target.isa->n_register_classes;
+	be_lv_dense_t *const dense     = XMALLOCFZ(be_lv_dense_t, classes, n_classes);
+	dense->n_nodes = get_irg_last_idx(irg);
+	dense->numbers = XMALLOCN(unsigned, dense->n_nodes);
+	memset(dense->numbers, 0xFF, dense->n_nodes * sizeof(*dense->numbers));
+
+	ir_node **blocks = NEW_ARR_F(ir_node*, 0);
+	irg_block_walk_graph(irg, collect_block, NULL, &blocks);
+	dense->n_blocks = ARR_LEN(blocks);
+	for (unsigned b = 0; b < dense->n_blocks; ++b)
+		dense->numbers[get_irn_idx(blocks[b])] = b;
+
+	irg_walk_graph(irg, NULL, collect_dense_value, dense);
+	for (unsigned c = 0; c < n_classes; ++c) {
+		lv_class_sets_t *const sets = &dense->classes[c];
+		if (sets->values == NULL)
+			continue;
+		sets->n_values = ARR_LEN(sets->values);
+		dense_compute_class(dense, sets, blocks);
+	}
+	DEL_ARR_F(blocks);
+	lv->dense = dense;
+}
+
 void be_liveness_compute_sets(be_lv_t *lv)
 {
 	if (lv->sets_valid)
@@ -285,6 +569,9 @@ void be_liveness_compute_sets(be_lv_t *lv)
 
 	DEL_ARR_F(nodes);
 	lv->sets_valid = true;
+
+	if (use_bitsets)
+		dense_compute(lv);
 	be_timer_pop(T_LIVE);
 }
 
@@ -302,6 +589,7 @@ void be_liveness_invalidate_sets(be_lv_t *lv)
 	obstack_free(&lv->obst, NULL);
 	ir_nodehashmap_destroy(&lv->map);
 	lv->sets_valid = false;
+	dense_free(lv);
 }
 
 void be_liveness_invalidate_chk(be_lv_t *lv)
@@ -335,6 +623,7 @@ void be_liveness_remove(be_lv_t *lv, const ir_node *irn)
 	/* Removes a single irn from the liveness information.
 	 * Since an irn can only be live at blocks dominated by the block of its
 	 * definition, we only have to process that dominance subtree. */
+	dense_invalidate_node(lv, irn);
 	lv_remove_walker_t w = { lv, irn };
 	dom_tree_walk(get_nodes_block(irn), lv_remove_irn_walker, NULL, &w);
 }
@@ -344,6 +633,7 @@ void be_liveness_introduce(be_lv_t *lv, ir_node *irn)
 	assert(lv->sets_valid);
 	/* Don't compute liveness information for non-data nodes. */
 	if (is_liveness_node(irn)) {
+		dense_invalidate_node(lv, irn);
 		re.lv = lv;
 		liveness_for_node(irn);
 	}
@@ -375,6 +665,21 @@ void be_liveness_end_of_block(const be_lv_t *lv,
                               const arch_register_class_t *cls,
                               const ir_node *block, ir_nodeset_t *live)
 {
+	be_lv_dense_t const *const dense = lv->dense;
+	if (dense != NULL && dense->classes[cls->index].valid) {
+		lv_class_sets_t const *const sets = &dense->classes[cls->index];
+		unsigned               const b    = dense_number(dense, block);
+		if (b < dense->n_blocks) {
+			unsigned const *const bend = &sets->live_end[b * sets->n_words];
+			for (size_t v = rbitset_next_max(bend, 0, sets->n_values, true);
+			     v != (size_t)-1;
+			     v = rbitset_next_max(bend, v + 1, sets->n_values, true)) {
+				ir_nodeset_insert(live, sets->values[v]);
+			}
+			return;
+		}
+	}
+
 	be_lv_foreach_cls(lv, block, be_lv_state_end, cls, node) {
 		ir_nodeset_insert(live, node);
 	}
@@ -406,7 +711,7 @@ static bool value_live_after(const ir_node *const value,
 	const ir_node  *const bb  = get_nodes_block(after);
 	const ir_graph *const irg = get_irn_irg(after);
 	const be_lv_t  *const lv  = be_get_irg_liveness(irg);
-	if (be_is_live_end(lv, bb, value))
+	if (lv_live_end(lv, bb, value))
 		return true;
 
 	/* Look at all usages of value.
@@ -565,5 +870,8 @@ BE_REGISTER_MODULE_CONSTRUCTOR(be_init_live)
 void be_init_live(void)
 {
 	(void)be_live_chk_compare;
+	lc_opt_entry_t *be_grp = lc_opt_get_grp(firm_opt_get_root(), "be");
+	lc_opt_entry_t *lv_grp = lc_opt_get_grp(be_grp, "liveness");
+	lc_opt_add_table(lv_grp, options);
 	FIRM_DBG_REGISTER(dbg, "firm.be.liveness");
 }
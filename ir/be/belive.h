@@ -129,12 +129,15 @@ void be_liveness_nodes_live_before(be_lv_t const *lv,
                                    arch_register_class_t const *cls,
                                    ir_node const *pos, ir_nodeset_t *live);
 
+typedef struct be_lv_dense_t be_lv_dense_t;
+
 struct be_lv_t {
 	ir_nodehashmap_t map;
 	struct obstack   obst;
 	bool             sets_valid;
 	ir_graph        *irg;
 	lv_chk_t        *lvc;
+	be_lv_dense_t   *dense; /**< per register class bitsets, may be NULL */
 };
 
 typedef struct be_lv_info_node_t be_lv_info_node_t;
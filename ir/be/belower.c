@@ -17,6 +17,7 @@
 #include "bearch.h"
 #include "beirg.h"
 #include "belive.h"
+#include "bemodule.h"
 #include "benode.h"
 #include "besched.h"
 #include "bessaconstr.h"
@@ -502,9 +503,6 @@ static void lower_nodes_after_ra_walker(ir_node *irn, void *walk_env)
 
 void lower_nodes_after_ra(ir_graph *irg, bool use_copies)
 {
-	FIRM_DBG_REGISTER(dbg, "firm.be.lower");
-	FIRM_DBG_REGISTER(dbg_permmove, "firm.be.lower.permmove");
-
 	/* we will need interference */
 	be_assure_live_chk(irg);
 
@@ -526,3 +524,10 @@ void lower_nodes_after_ra(ir_graph *irg, bool use_copies)
 		be_invalidate_live_sets(irg);
 	}
 }
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_lower)
+void be_init_lower(void)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.be.lower");
+	FIRM_DBG_REGISTER(dbg_permmove, "firm.be.lower.permmove");
+}
@@ -12,11 +12,15 @@
 #include "be_t.h"
 #include "beasm.h"
 #include "bechordal_t.h"
+#include "bedwarf.h"
 #include "bediagnostic.h"
+#include "beelf.h"
 #include "beemitter.h"
+#include "befuncorder.h"
 #include "begnuas.h"
 #include "beifg.h"
 #include "beirg.h"
+#include "bejit.h"
 #include "belistsched.h"
 #include "belive.h"
 #include "belower.h"
@@ -36,20 +40,27 @@
 #include "irdom_t.h"
 #include "irdump.h"
 #include "iredges_t.h"
+#include "irgraph_t.h"
 #include "irgopt.h"
+#include "irhooks.h"
 #include "irloop_t.h"
+#include "irop_t.h"
 #include "iroptimize.h"
 #include "irprofile.h"
-#include "irprog.h"
+#include "irprog_t.h"
+#include "irthread.h"
 #include "irtools.h"
 #include "irverify.h"
 #include "lc_opts.h"
 #include "lc_opts_enum.h"
 #include "obst.h"
+#include "platform_t.h"
 #include "statev.h"
 #include "target_t.h"
+#include "type_t.h"
 #include "util.h"
 #include <stdio.h>
+#include <string.h>
 
 static struct obstack obst;
 static be_main_env_t  env;
@@ -60,10 +71,14 @@ be_options_t be_options = {
 	.timing               = false,
 	.opt_profile_generate = false,
 	.opt_profile_use      = false,
+	.opt_profile_edges    = false,
+	.opt_profile_values   = false,
 	.omit_fp              = false,
 	.do_verify            = true,
 	.ilp_solver           = "",
 	.verbose_asm          = true,
+	.compact_graphs       = false,
+	.threads              = 1,
 };
 
 /* possible dumping options */
@@ -90,7 +105,11 @@ static const lc_opt_table_entry_t be_main_options[] = {
 	LC_OPT_ENT_BOOL     ("time",       "get backend timing statistics",                       &be_options.timing),
 	LC_OPT_ENT_BOOL     ("profilegenerate", "instrument the code for execution count profiling", &be_options.opt_profile_generate),
 	LC_OPT_ENT_BOOL     ("profileuse",      "use existing profile data",                         &be_options.opt_profile_use),
+	LC_OPT_ENT_BOOL     ("profileedges",    "count control flow edges instead of blocks",        &be_options.opt_profile_edges),
+	LC_OPT_ENT_BOOL     ("profilevalues",   "profile switch selectors and indirect call targets", &be_options.opt_profile_values),
 	LC_OPT_ENT_BOOL     ("verboseasm", "enable verbose assembler output",                        &be_options.verbose_asm),
+	LC_OPT_ENT_BOOL     ("compact",    "compact the graphs before code generation",              &be_options.compact_graphs),
+	LC_OPT_ENT_INT      ("threads",    "number of threads generating code for amd64 and ia32",   &be_options.threads),
 
 	LC_OPT_ENT_STR("ilp.solver", "the ilp solver name", &be_options.ilp_solver),
 	LC_OPT_LAST
@@ -253,9 +272,6 @@ static ir_timer_t *bemain_timer;
  */
 static void initialize_birg(be_irg_t *birg, ir_graph *irg, be_main_env_t *env)
 {
-	/* don't duplicate locals in backend when dumping... */
-	ir_remove_dump_flags(ir_dump_flag_consts_local);
-
 	be_dump(DUMP_INITIAL, irg, "begin");
 
 	assure_irg_properties(irg,
@@ -264,6 +280,11 @@ static void initialize_birg(be_irg_t *birg, ir_graph *irg, be_main_env_t *env)
 		| IR_GRAPH_PROPERTY_NO_CRITICAL_EDGES
 		| IR_GRAPH_PROPERTY_MANY_RETURNS);
 
+	/* the middleend leaves dead nodes behind, the backend walks the graph
+	 * often enough to profit from dense nodes */
+	if (be_options.compact_graphs)
+		compact_graph(irg);
+
 	memset(birg, 0, sizeof(*birg));
 	birg->main_env = env;
 	obstack_init(&birg->obst);
@@ -281,6 +302,13 @@ static void initialize_birg(be_irg_t *birg, ir_graph *irg, be_main_env_t *env)
 	}
 }
 
+static void prepare_irg(ir_graph *irg)
+{
+	if (ir_target.isa->handle_intrinsics)
+		ir_target.isa->handle_intrinsics(irg);
+	be_dump(DUMP_INITIAL, irg, "prepared");
+}
+
 static ir_graph *be_prepare_profile(const char *const cup_name)
 {
 	obstack_printf(&obst, "%s.prof", cup_name);
@@ -293,20 +321,30 @@ static ir_graph *be_prepare_profile(const char *const cup_name)
 		if (!res) {
 			be_warningf(NULL, "could not read profile data '%s'", prof_filename);
 		} else {
+			/* the profile is freed in be_finish(), block scheduling looks
+			 * up edge frequencies */
 			ir_create_execfreqs_from_profile();
-			ir_profile_free();
 			have_profile = true;
 		}
 	}
 
 	ir_graph *prof_init_irg = NULL;
-	if (be_options.opt_profile_generate)
-		prof_init_irg = ir_profile_instrument(prof_filename);
+	if (be_options.opt_profile_generate) {
+		ir_profile_flags_t flags = ir_profile_blocks;
+		if (be_options.opt_profile_edges)
+			flags |= ir_profile_edges;
+		if (be_options.opt_profile_values)
+			flags |= ir_profile_values;
+		prof_init_irg = ir_profile_instrument(prof_filename, flags);
+	}
 
 	if (!have_profile) {
 		be_timer_push(T_EXECFREQ);
-		foreach_irp_irg(i, irg) {
-			ir_estimate_execfreq(irg);
+		for (size_t i = 0, n = get_irp_n_irgs(); i < n; ++i) {
+			/* stub graphs get their estimate in be_step_first() */
+			ir_graph *const irg = get_irp_irg_or_stub(i);
+			if (!irg->is_stub)
+				ir_estimate_execfreq(irg);
 		}
 		be_timer_pop(T_EXECFREQ);
 	}
@@ -340,7 +378,7 @@ void be_begin(FILE *file_handle, const char *cup_name)
 	be_timing = be_options.timing;
 
 	/* perform target lowering if it didn't happen yet */
-	if (get_irp_n_irgs() > 0 && !irg_is_constrained(get_irp_irg(0), IR_GRAPH_CONSTRAINT_TARGET_LOWERED))
+	if (get_irp_n_irgs() > 0 && !irg_is_constrained(get_irp_irg_or_stub(0), IR_GRAPH_CONSTRAINT_TARGET_LOWERED))
 		be_lower_for_target();
 
 	if (be_timing) {
@@ -352,6 +390,9 @@ void be_begin(FILE *file_handle, const char *cup_name)
 
 	be_emit_init(file_handle);
 
+	/* don't duplicate locals in backend when dumping... */
+	ir_remove_dump_flags(ir_dump_flag_consts_local);
+
 	memset(&env, 0, sizeof(env));
 	env.ent_trampoline_map   = pmap_create();
 	env.pic_trampolines_type = new_type_segment(NEW_IDENT("$PIC_TRAMPOLINE_TYPE"), tf_none);
@@ -361,26 +402,65 @@ void be_begin(FILE *file_handle, const char *cup_name)
 
 	be_info_init();
 
+	/* Profiling instruments or annotates the whole program, so the stub
+	 * graphs cannot wait for their turn. */
+	if (be_options.opt_profile_generate || be_options.opt_profile_use) {
+		for (size_t i = 0, n = get_irp_n_irgs(); i < n; ++i)
+			(void)get_irp_irg(i);
+	}
+
 	/* First: initialize all birgs */
 	size_t          num_birgs = 0;
 	/* we might need 1 birg more for instrumentation constructor */
 	be_irg_t *const birgs     = OALLOCN(&obst, be_irg_t, get_irp_n_irgs()+1);
-	foreach_irp_irg(i, irg) {
+	ir_graph      **graphs    = NEW_ARR_F(ir_graph*, 0);
+	ir_graph      **stubs     = NEW_ARR_F(ir_graph*, 0);
+	for (size_t i = 0, n = get_irp_n_irgs(); i < n; ++i) {
+		ir_graph *const irg = get_irp_irg_or_stub(i);
+		if (irg->is_stub) {
+			/* Stub graphs are read when their turn comes and given back
+			 * once their code is emitted, be_step_first() prepares them. */
+			be_irg_t *const birg = &birgs[num_birgs++];
+			memset(birg, 0, sizeof(*birg));
+			birg->release_after_emit = true;
+			irg->be_data = birg;
+			if (!(get_entity_linkage(get_irg_entity(irg)) & IR_LINKAGE_NO_CODEGEN))
+				ARR_APP1(ir_graph*, stubs, irg);
+			continue;
+		}
 		ir_entity *entity = get_irg_entity(irg);
 		if (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN)
 			continue;
 		initialize_birg(&birgs[num_birgs++], irg, &env);
-		if (ir_target.isa->handle_intrinsics)
-			ir_target.isa->handle_intrinsics(irg);
-		be_dump(DUMP_INITIAL, irg, "prepared");
+		ARR_APP1(ir_graph*, graphs, irg);
+		prepare_irg(irg);
 	}
 
 	/* Prepare basicblock profile generation/usage. Note: You should avoid
 	 * introducing new control flow after this point or you won't have profile
 	 * data for the new basic blocks. */
 	ir_graph *prof_init_irg = be_prepare_profile(cup_name);
-	if (prof_init_irg != NULL)
+	if (prof_init_irg != NULL) {
 		initialize_birg(&birgs[num_birgs++], prof_init_irg, &env);
+		ARR_APP1(ir_graph*, graphs, prof_init_irg);
+	}
+
+	/* Function texts appear in the output in the chosen order, no matter in
+	 * which order the graphs finish. Ordering needs the nodes, so the stub
+	 * graphs follow in program order. */
+	be_order_functions(graphs, stubs);
+	for (size_t i = 0, n = ARR_LEN(graphs); i < n; ++i) {
+		be_irg_t *const birg = be_birg_from_irg(graphs[i]);
+		birg->emit_chunk     = be_emit_reserve_chunk();
+		birg->has_emit_chunk = true;
+	}
+	for (size_t i = 0, n = ARR_LEN(stubs); i < n; ++i) {
+		be_irg_t *const birg = be_birg_from_irg(stubs[i]);
+		birg->emit_chunk     = be_emit_reserve_chunk();
+		birg->has_emit_chunk = true;
+	}
+	DEL_ARR_F(stubs);
+	DEL_ARR_F(graphs);
 
 	be_gas_begin_compilation_unit(&env);
 }
@@ -422,6 +502,37 @@ static const char *get_timer_name(be_timer_id_t id)
 	return "unknown";
 }
 ir_timer_t *be_timers[T_LAST+1];
+THREAD_LOCAL size_t be_timer_memory[T_LAST+1];
+
+/* Timers nest, only the innermost one runs and gets charged for the node
+ * memory allocated. Like the node memory counter this is kept per thread,
+ * so each thread charges the graph it compiles. */
+static THREAD_LOCAL be_timer_id_t memory_stack[T_LAST+1];
+static THREAD_LOCAL unsigned      memory_stack_top;
+static THREAD_LOCAL size_t        memory_mark;
+
+static void charge_node_memory(void)
+{
+	size_t const now = ir_get_node_memory_allocated();
+	if (memory_stack_top > 0)
+		be_timer_memory[memory_stack[memory_stack_top - 1]] += now - memory_mark;
+	memory_mark = now;
+}
+
+void be_timer_memory_push(be_timer_id_t id)
+{
+	charge_node_memory();
+	assert(memory_stack_top < ARRAY_SIZE(memory_stack));
+	memory_stack[memory_stack_top++] = id;
+}
+
+void be_timer_memory_pop(be_timer_id_t id)
+{
+	charge_node_memory();
+	assert(memory_stack_top > 0 && memory_stack[memory_stack_top - 1] == id);
+	(void)id;
+	--memory_stack_top;
+}
 
 static void dummy_after_transform(ir_graph *irg, const char *name)
 {
@@ -457,21 +568,51 @@ void be_lower_for_target(void)
 	}
 }
 
-static int cse_setting;
+/** Serializes reading stub graphs and turning them back into stubs, both
+ * change the graph list of the program. */
+static ir_mutex_t graphs_mutex = IR_MUTEX_INITIALIZER;
+
+static void release_birg_irg(ir_graph *const irg)
+{
+	ir_mutex_lock(&graphs_mutex);
+	release_irg(irg);
+	ir_mutex_unlock(&graphs_mutex);
+}
 
 bool be_step_first(ir_graph *irg)
 {
 	ir_entity *const entity = get_irg_entity(irg);
-	if (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN)
+	be_irg_t  *const birg   = be_birg_from_irg(irg);
+	if (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN) {
+		/* read from a stub only because the caller visits all graphs */
+		if (birg != NULL && birg->release_after_emit)
+			release_birg_irg(irg);
 		return false;
+	}
 
 	be_timer_push(T_OTHER);
 	if (stat_ev_enabled) {
 		stat_ev_ctx_push_fmt("bemain_irg", "%+F", irg);
 		stat_ev_ull("bemain_insns_start", be_count_insns(irg));
 		stat_ev_ull("bemain_blocks_start", be_count_blocks(irg));
+		stat_ev_ull("bemain_mem_start", get_irg_memory_used(irg));
+	}
+	if (birg->main_env == NULL) {
+		/* the graph was a stub in be_begin() */
+		be_irg_t const stub = *birg;
+		initialize_birg(birg, irg, &env);
+		birg->emit_chunk         = stub.emit_chunk;
+		birg->has_emit_chunk     = stub.has_emit_chunk;
+		birg->release_after_emit = true;
+		prepare_irg(irg);
+		be_timer_push(T_EXECFREQ);
+		ir_estimate_execfreq(irg);
+		be_timer_pop(T_EXECFREQ);
 	}
-	cse_setting = get_opt_cse();
+	birg->cse_setting = get_opt_cse();
+
+	if (birg->has_emit_chunk)
+		be_emit_begin_chunk(birg->emit_chunk);
 	return true;
 }
 
@@ -516,6 +657,7 @@ void be_step_last(ir_graph *irg)
 	if (stat_ev_enabled) {
 		stat_ev_ull("bemain_insns_finish", be_count_insns(irg));
 		stat_ev_ull("bemain_blocks_finish", be_count_blocks(irg));
+		stat_ev_ull("bemain_mem_finish", get_irg_memory_used(irg));
 	}
 
 	be_dump(DUMP_FINAL, irg, "final");
@@ -530,23 +672,152 @@ void be_step_last(ir_graph *irg)
 				snprintf(buf, sizeof(buf), "bemain_time_%s",
 				         get_timer_name(t));
 				stat_ev_dbl(buf, ir_timer_elapsed_usec(be_timers[t]));
+				snprintf(buf, sizeof(buf), "bemain_mem_%s", get_timer_name(t));
+				stat_ev_ull(buf, be_timer_memory[t]);
 			}
 		} else {
 			printf("==>> IRG %s <<==\n", get_entity_name(get_irg_entity(irg)));
 			for (be_timer_id_t t = T_FIRST; t < T_LAST+1; ++t) {
 				double val = ir_timer_elapsed_usec(be_timers[t]) / 1000.0;
-				printf("%-20s: %10.3f msec\n", get_timer_name(t), val);
+				printf("%-20s: %10.3f msec %10zu bytes\n", get_timer_name(t),
+				       val, be_timer_memory[t]);
 			}
 		}
 		for (be_timer_id_t t = T_FIRST; t < T_LAST+1; ++t) {
 			ir_timer_reset(be_timers[t]);
+			be_timer_memory[t] = 0;
 		}
 	}
 
+	be_irg_t *const birg        = be_birg_from_irg(irg);
+	bool      const release     = birg->release_after_emit;
+	int       const cse_setting = birg->cse_setting;
+	if (birg->has_emit_chunk)
+		be_emit_finish_chunk();
+
 	be_free_birg(irg);
 	stat_ev_ctx_pop("bemain_irg");
 
 	set_opt_cse(cse_setting);
+
+	if (release)
+		release_birg_irg(irg);
+}
+
+typedef struct compile_pool_t {
+	be_compile_func     *compile;
+	void                *data;
+	long                 next;      /**< position of the next graph */
+	long                 n_graphs;
+	optimization_state_t opt_state; /**< flags of the calling thread */
+} compile_pool_t;
+
+static void compile_graphs(compile_pool_t *const pool)
+{
+	for (;;) {
+		long const pos = ir_atomic_fetch_inc(&pool->next);
+		if (pos >= pool->n_graphs)
+			break;
+		ir_mutex_lock(&graphs_mutex);
+		ir_graph *const irg = get_irp_irg(pos);
+		ir_mutex_unlock(&graphs_mutex);
+		pool->compile(irg, pool->data);
+	}
+}
+
+static void *run_compile_worker(void *const data)
+{
+	compile_pool_t *const pool = (compile_pool_t*)data;
+	restore_optimization_state(&pool->opt_state);
+	be_emit_init_thread();
+	compile_graphs(pool);
+	be_gas_exit_thread();
+	be_emit_exit_thread();
+	ir_free_op_generics();
+	return NULL;
+}
+
+/**
+ * Timers, statistics, dumps and debug info collect their results in global
+ * state and hook callbacks are not expected to be thread-safe, so only
+ * plain code generation runs concurrently.
+ */
+static unsigned get_n_compile_threads(void)
+{
+	if (be_options.threads <= 1 || be_timing || stat_ev_enabled
+	    || be_options.dump_flags != 0 || be_dwarf_enabled())
+		return 1;
+	for (unsigned h = 0; h < hook_last; ++h) {
+		if (h != hook_node_info && hooks[h] != NULL)
+			return 1;
+	}
+	return be_options.threads;
+}
+
+static void compile_graphs_concurrently(compile_pool_t *const pool,
+                                        unsigned const n_threads)
+{
+	save_optimization_state(&pool->opt_state);
+	ir_thread_t *const threads = XMALLOCN(ir_thread_t, n_threads - 1);
+	ir_threads_running = true;
+	for (unsigned t = 0; t < n_threads - 1; ++t)
+		ir_thread_create(&threads[t], run_compile_worker, pool);
+	compile_graphs(pool);
+	for (unsigned t = 0; t < n_threads - 1; ++t)
+		ir_thread_join(threads[t]);
+	ir_threads_running = false;
+	free(threads);
+	/* graphs changed while the workers ran did not invalidate the usage
+	 * analysis of the global entities */
+	set_irp_globals_entity_usage_state(ir_entity_usage_not_computed);
+}
+
+static int cmp_entity_ld_name(void const *const a, void const *const b)
+{
+	ir_entity const *const ea = *(ir_entity const *const*)a;
+	ir_entity const *const eb = *(ir_entity const *const*)b;
+	return strcmp(get_entity_ld_name(ea), get_entity_ld_name(eb));
+}
+
+/**
+ * Sorts the members added to @p type after its first @p n_old members. The
+ * functions add constants and the like in the order they need them, which
+ * depends on the threads, and the global declarations are emitted in member
+ * order.
+ */
+static void sort_new_members(ir_type *const type, size_t const n_old)
+{
+	size_t const n = get_compound_n_members(type);
+	if (n > n_old) {
+		QSORT(&type->attr.compound.members[n_old], n - n_old,
+		      cmp_entity_ld_name);
+	}
+}
+
+void be_compile_graphs(be_compile_func *const compile, void *const data)
+{
+	compile_pool_t pool = {
+		.compile  = compile,
+		.data     = data,
+		.next     = 0,
+		.n_graphs = get_irp_n_irgs(),
+	};
+	ir_type *const owners[] = {
+		get_glob_type(), env.pic_trampolines_type, env.pic_symbols_type
+	};
+	size_t n_old_members[ARRAY_SIZE(owners)];
+	for (size_t i = 0; i < ARRAY_SIZE(owners); ++i)
+		n_old_members[i] = get_compound_n_members(owners[i]);
+
+	unsigned const n_threads = get_n_compile_threads();
+	if (n_threads <= 1 || pool.n_graphs <= 1) {
+		compile_graphs(&pool);
+	} else {
+		compile_graphs_concurrently(&pool, n_threads);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(owners); ++i)
+		sort_new_members(owners[i], n_old_members[i]);
 }
 
 void be_finish(void)
@@ -570,6 +841,7 @@ void be_finish(void)
 
 	be_emit_exit();
 	be_info_free();
+	ir_profile_free();
 
 	pmap_destroy(env.ent_trampoline_map);
 	pmap_destroy(env.ent_pic_symbol_map);
@@ -583,24 +855,53 @@ void be_main(FILE *file_handle, const char *cup_name)
 	ir_target.isa->generate_code(file_handle, cup_name);
 }
 
+int be_main_object(FILE *const output, const char *const cup_name)
+{
+	be_elf_target_t const *const elf_target = ir_target.isa->elf_target;
+	if (elf_target == NULL || ir_platform.object_format != OBJECT_FORMAT_ELF)
+		return 1;
+
+	/* perform target lowering if it didn't happen yet */
+	if (get_irp_n_irgs() > 0 && !irg_is_constrained(get_irp_irg_or_stub(0), IR_GRAPH_CONSTRAINT_TARGET_LOWERED))
+		be_lower_for_target();
+
+	be_elf_begin(elf_target);
+	ir_jit_segment_t *const segment = be_new_relocatable_jit_segment();
+	for (size_t i = 0, n = get_irp_n_irgs(); i < n; ++i) {
+		/* graphs without code are neither read nor analysed */
+		ir_entity *const entity = get_irg_entity(get_irp_irg_or_stub(i));
+		if (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN)
+			continue;
+		ir_graph *const irg = get_irp_irg(i);
+		ir_estimate_execfreq(irg);
+		ir_jit_function_t *const function = be_jit_compile(segment, irg);
+		if (function != NULL)
+			be_elf_add_function(get_irg_entity(irg), function);
+	}
+	be_elf_finish(output, cup_name);
+	be_destroy_jit_segment(segment);
+	return 0;
+}
+
 ir_jit_function_t *be_jit_compile(ir_jit_segment_t *const segment,
                                   ir_graph *const irg)
 {
 	if (ir_target.isa->jit_compile == NULL)
 		return NULL;
 
-	obstack_init(&obst);
-
 	ir_entity *entity = get_irg_entity(irg);
 	if (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN)
 		return NULL;
 	be_irg_t *const birg = OALLOCZ(&obst, be_irg_t);
 	initialize_birg(birg, irg, &env);
-	if (ir_target.isa->handle_intrinsics)
-		ir_target.isa->handle_intrinsics(irg);
-	be_dump(DUMP_INITIAL, irg, "prepared");
+	prepare_irg(irg);
 
-	return ir_target.isa->jit_compile(segment, irg);
+	ir_jit_function_t *const res = ir_target.isa->jit_compile(segment, irg);
+	/* be_step_last() frees the backend data, unless compiling failed */
+	if (irg->be_data == birg)
+		be_free_birg(irg);
+	obstack_free(&obst, birg);
+	return res;
 }
 
 void be_emit_function(char *const buffer, ir_jit_function_t *const function)
@@ -39,9 +39,12 @@ void be_init_copynone(void);
 void be_init_copyopt(void);
 void be_init_daemelspill(void);
 void be_init_dwarf(void);
+void be_init_funcorder(void);
+void be_init_ifg(void);
 void be_init_listsched(void);
 void be_init_live(void);
 void be_init_loopana(void);
+void be_init_lower(void);
 void be_init_pbqp(void);
 void be_init_pbqp_coloring(void);
 void be_init_peephole(void);
@@ -56,7 +59,9 @@ void be_init_spillbelady(void);
 void be_init_spilloptions(void);
 void be_init_spillslots(void);
 void be_init_ssaconstr(void);
+void be_init_ssadestr(void);
 void be_init_state(void);
+void be_init_uses(void);
 
 void be_quit_pbqp(void);
 
@@ -77,8 +82,10 @@ void be_init_modules(void)
 	be_init_chordal_common();
 	be_init_copyopt();
 	be_init_dwarf();
+	be_init_funcorder();
 	be_init_live();
 	be_init_loopana();
+	be_init_lower();
 	be_init_peephole();
 	be_init_ra();
 	be_init_sched();
@@ -86,7 +93,9 @@ void be_init_modules(void)
 	be_init_spilloptions();
 	be_init_spillslots();
 	be_init_ssaconstr();
+	be_init_ssadestr();
 	be_init_state();
+	be_init_uses();
 
 	/* in the following groups the first one is the default */
 	be_init_arch_ia32();
@@ -103,6 +112,7 @@ void be_init_modules(void)
 	be_init_sched_trivial();
 
 	be_init_chordal_main();
+	be_init_ifg();
 	be_init_pref_alloc();
 
 	be_init_chordal();
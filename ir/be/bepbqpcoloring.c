@@ -623,7 +623,7 @@ static void be_pbqp_coloring(be_chordal_env_t *env)
 	/* print out reverse perfect elimination order */
 #if PRINT_RPEO
 	deq_foreach_pointer(&pbqp_alloc_env.rpeo, pbqp_node_t, node) {
-		printf(" %d(%ld);", node->index, get_idx_irn(irg, node->index)->node_nr);
+		printf(" %d(%ld);", node->index, get_idx_irn(irg, node->index)->cold->node_nr);
 	}
 	printf("\n");
 #endif
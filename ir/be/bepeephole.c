@@ -27,9 +27,9 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
-static be_lv_t *lv;
-static ir_node *current_node;
-ir_node       **register_values;
+static THREAD_LOCAL be_lv_t *lv;
+static THREAD_LOCAL ir_node *current_node;
+THREAD_LOCAL ir_node **register_values;
 
 static void clear_reg_value(ir_node *node)
 {
@@ -193,7 +193,7 @@ static void process_block(ir_node *block, void *data)
 		set_uses(current_node);
 
 		ir_op            *op            = get_irn_op(current_node);
-		peephole_opt_func peephole_node = (peephole_opt_func)op->ops.generic;
+		peephole_opt_func peephole_node = (peephole_opt_func)get_op_generic(op)->generic;
 		if (peephole_node == NULL)
 			continue;
 
@@ -12,8 +12,9 @@
 #define BEPEEPHOLE_H
 
 #include "bearch.h"
+#include "compiler.h"
 
-extern ir_node **register_values;
+extern THREAD_LOCAL ir_node **register_values;
 
 static inline ir_node *be_peephole_get_value(unsigned register_idx)
 {
@@ -87,8 +88,8 @@ bool be_can_move_up(ir_heights_t *heights, const ir_node *node,
  */
 static inline void register_peephole_optimization(ir_op *const op, peephole_opt_func const func)
 {
-	assert(!op->ops.generic);
-	op->ops.generic = (op_func)func;
+	assert(!get_op_generic(op)->generic);
+	get_op_generic(op)->generic = (op_func)func;
 }
 
 /**
@@ -69,19 +69,19 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
-static struct obstack               obst;
-static ir_graph                    *irg;
-static const arch_register_class_t *cls;
-static be_lv_t                     *lv;
-static unsigned                     n_regs;
-static unsigned                    *normal_regs;
-static int                         *congruence_classes;
-static ir_node                    **block_order;
-static size_t                       n_block_order;
+static THREAD_LOCAL struct obstack               obst;
+static THREAD_LOCAL ir_graph                    *irg;
+static THREAD_LOCAL const arch_register_class_t *cls;
+static THREAD_LOCAL be_lv_t                     *lv;
+static THREAD_LOCAL unsigned                     n_regs;
+static THREAD_LOCAL unsigned                    *normal_regs;
+static THREAD_LOCAL int                         *congruence_classes;
+static THREAD_LOCAL ir_node                    **block_order;
+static THREAD_LOCAL size_t                       n_block_order;
 
 /** currently active assignments (while processing a basic block)
  * maps registers to values(their current copies) */
-static ir_node **assignments;
+static THREAD_LOCAL ir_node **assignments;
 
 /**
  * allocation information: last_uses, register preferences
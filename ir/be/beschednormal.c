@@ -24,8 +24,8 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
-static struct obstack obst;
-static ir_node       *curr_list;
+static THREAD_LOCAL struct obstack obst;
+static THREAD_LOCAL ir_node       *curr_list;
 
 typedef struct irn_cost_pair {
 	ir_node *irn;
@@ -60,21 +60,22 @@ typedef struct workset_t {
 	loc_t    vals[];  /**< array of the values/distances in this working set */
 } workset_t;
 
-static struct obstack               obst;
-static const arch_register_class_t *cls;
-static const be_lv_t               *lv;
-static be_loopana_t                *loop_ana;
-static unsigned                     n_regs;
-static workset_t                   *ws;     /**< the main workset used while
-	                                             processing a block. */
-static be_uses_t                   *uses;   /**< env for the next-use magic */
-static spill_env_t                 *senv;   /**< see bespill.h */
-static ir_node                    **blocklist;
-static workset_t                   *temp_workset;
+static THREAD_LOCAL struct obstack               obst;
+static THREAD_LOCAL const arch_register_class_t *cls;
+static THREAD_LOCAL const be_lv_t               *lv;
+static THREAD_LOCAL be_loopana_t                *loop_ana;
+static THREAD_LOCAL unsigned                     n_regs;
+static THREAD_LOCAL workset_t                   *ws;     /**< the main workset used while
+	                                                          processing a block. */
+static THREAD_LOCAL be_uses_t                   *uses;   /**< env for the next-use magic */
+static THREAD_LOCAL spill_env_t                 *senv;   /**< see bespill.h */
+static THREAD_LOCAL ir_node                    **blocklist;
+static THREAD_LOCAL workset_t                   *temp_workset;
 
 static bool                         move_spills      = true;
 static bool                         respectloopdepth = true;
 static bool                         improve_known_preds = true;
+static bool                         next_use_tables  = true;
 /* factor to weight the different costs of reloading/rematerializing a node
    (see bespill.h be_get_reload_costs_no_weight) */
 static int                          remat_bonus      = 10;
@@ -83,6 +84,7 @@ static const lc_opt_table_entry_t options[] = {
 	LC_OPT_ENT_BOOL   ("movespills", "try to move spills out of loops", &move_spills),
 	LC_OPT_ENT_BOOL   ("respectloopdepth", "outermost loop cutting", &respectloopdepth),
 	LC_OPT_ENT_BOOL   ("improveknownpreds", "known preds cutting", &improve_known_preds),
+	LC_OPT_ENT_BOOL   ("nextusetables", "precompute next-use distances", &next_use_tables),
 	LC_OPT_ENT_INT    ("rematbonus", "give bonus to rematerialisable nodes", &remat_bonus),
 	LC_OPT_LAST
 };
@@ -810,7 +812,8 @@ static void be_spill_belady(ir_graph *irg, const arch_register_class_t *rcls,
 	lv           = be_get_irg_liveness(irg);
 	n_regs       = be_get_n_allocatable_regs(irg, cls);
 	ws           = new_workset();
-	uses         = be_begin_uses(irg, lv);
+	uses         = next_use_tables ? be_begin_uses_cls(irg, lv, cls)
+	                               : be_begin_uses(irg, lv);
 	loop_ana     = be_new_loop_pressure(irg, cls);
 	senv         = be_new_spill_env(irg, regif);
 	blocklist    = be_get_cfgpostorder(irg);
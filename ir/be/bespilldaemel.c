@@ -37,11 +37,11 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
-static spill_env_t                 *spill_env;
-static unsigned                     n_regs;
-static const arch_register_class_t *cls;
-static const be_lv_t               *lv;
-static bitset_t                    *spilled_nodes;
+static THREAD_LOCAL spill_env_t                 *spill_env;
+static THREAD_LOCAL unsigned                     n_regs;
+static THREAD_LOCAL const arch_register_class_t *cls;
+static THREAD_LOCAL const be_lv_t               *lv;
+static THREAD_LOCAL bitset_t                    *spilled_nodes;
 
 typedef struct spill_candidate_t spill_candidate_t;
 struct spill_candidate_t {
@@ -686,10 +686,10 @@ static void be_new_Copy_for_input(ir_node *const val, ir_node *const before, int
 	set_irn_n(before, pos, copy);
 }
 
-static be_irg_t      *birg;
-static unsigned long  precol_copies;
-static unsigned long  multi_precol_copies;
-static unsigned long  constrained_livethrough_copies;
+static THREAD_LOCAL be_irg_t      *birg;
+static THREAD_LOCAL unsigned long  precol_copies;
+static THREAD_LOCAL unsigned long  multi_precol_copies;
+static THREAD_LOCAL unsigned long  constrained_livethrough_copies;
 
 static void prepare_constr_insn(ir_node *const node)
 {
@@ -1001,7 +1001,6 @@ static void add_missing_keep_walker(ir_node *node, void *data)
 
 void be_spill_prepare_for_constraints(ir_graph *irg)
 {
-	FIRM_DBG_REGISTER(dbg_constr, "firm.be.lower.constr");
 	be_timer_push(T_RA_CONSTR);
 
 	irg_walk_graph(irg, add_missing_keep_walker, NULL, NULL);
@@ -1072,4 +1071,5 @@ BE_REGISTER_MODULE_CONSTRUCTOR(be_init_spill)
 void be_init_spill(void)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.be.spill");
+	FIRM_DBG_REGISTER(dbg_constr, "firm.be.lower.constr");
 }
@@ -15,6 +15,7 @@
 #include "bearch.h"
 #include "beirg.h"
 #include "belive.h"
+#include "bemodule.h"
 #include "benode.h"
 #include "besched.h"
 #include "bespillutil.h"
@@ -225,8 +226,6 @@ static void insert_shuffle_code_walker(ir_node *block, void *data)
 
 void be_ssa_destruction(ir_graph *irg, const arch_register_class_t *cls)
 {
-	FIRM_DBG_REGISTER(dbg, "ir.be.ssadestr");
-
 	be_invalidate_live_sets(irg);
 	be_assure_live_chk(irg);
 
@@ -235,3 +234,9 @@ void be_ssa_destruction(ir_graph *irg, const arch_register_class_t *cls)
 	/* unfortunately updating doesn't work yet. */
 	be_invalidate_live_chk(irg);
 }
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_ssadestr)
+void be_init_ssadestr(void)
+{
+	FIRM_DBG_REGISTER(dbg, "ir.be.ssadestr");
+}
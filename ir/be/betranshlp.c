@@ -37,12 +37,13 @@
 #include "pdeq.h"
 #include "util.h"
 #include "vrp.h"
+#include <stdio.h>
 
 typedef struct be_transform_env_t {
 	deq_t worklist;  /**< worklist of nodes that still need to be transformed */
 } be_transform_env_t;
 
-static be_transform_env_t env;
+static THREAD_LOCAL be_transform_env_t env;
 
 #ifndef NDEBUG
 static void be_set_orig_node_rec(ir_node *const node, char const *const name)
@@ -114,13 +115,13 @@ ir_node *be_transform_phi(ir_node *node, const arch_register_req_t *req)
 void be_set_transform_function(ir_op *op, be_transform_func func)
 {
 	/* Shouldn't be assigned twice. */
-	assert(!op->ops.generic);
-	op->ops.generic = (op_func) func;
+	assert(!get_op_generic(op)->generic);
+	get_op_generic(op)->generic = (op_func) func;
 }
 
 void be_set_transform_proj_function(ir_op *op, be_transform_func func)
 {
-	op->ops.generic1 = (op_func) func;
+	get_op_generic(op)->generic1 = (op_func) func;
 }
 
 /**
@@ -129,7 +130,7 @@ void be_set_transform_proj_function(ir_op *op, be_transform_func func)
 static ir_node *transform_block(ir_node *node)
 {
 	ir_node *const block = exact_copy(node);
-	block->node_nr = node->node_nr;
+	block->cold->node_nr = node->cold->node_nr;
 
 	/* put the preds in the worklist */
 	be_enqueue_operands(node);
@@ -158,7 +159,7 @@ static ir_node *transform_proj(ir_node *node)
 	ir_node *pred    = get_Proj_pred(node);
 	ir_op   *pred_op = get_irn_op(pred);
 	be_transform_func *proj_transform
-		= (be_transform_func*)pred_op->ops.generic1;
+		= (be_transform_func*)get_op_generic(pred_op)->generic1;
 	/* we should have a Proj transformer registered */
 #ifdef DEBUG_libfirm
 	if (!proj_transform) {
@@ -186,7 +187,7 @@ ir_node *be_duplicate_node(ir_node *const node)
 	ir_node *const block    = be_transform_nodes_block(node);
 	ir_node *const new_node = new_similar_node(node, block, ins);
 
-	new_node->node_nr = node->node_nr;
+	new_node->cold->node_nr = node->cold->node_nr;
 	return new_node;
 }
 
@@ -210,7 +211,7 @@ ir_node *be_transform_node(ir_node *node)
 		mark_irn_visited(node);
 
 		ir_op             *const op        = get_irn_op(node);
-		be_transform_func *const transform = (be_transform_func*)op->ops.generic;
+		be_transform_func *const transform = (be_transform_func*)get_op_generic(op)->generic;
 #ifdef DEBUG_libfirm
 		if (!transform)
 			panic("no transformer for %+F", node);
@@ -348,9 +349,9 @@ void be_transform_graph(ir_graph *irg, arch_pretrans_nodes *func)
 bool be_upper_bits_clean(const ir_node *node, ir_mode *mode)
 {
 	ir_op *op = get_irn_op(node);
-	if (op->ops.generic2 == NULL)
+	if (get_op_generic(op)->generic2 == NULL)
 		return false;
-	upper_bits_clean_func func = (upper_bits_clean_func)op->ops.generic2;
+	upper_bits_clean_func func = (upper_bits_clean_func)get_op_generic(op)->generic2;
 	return func(node, mode);
 }
 
@@ -451,7 +452,7 @@ static bool proj_upper_bits_clean(const ir_node *node, ir_mode *mode)
 
 void be_set_upper_bits_clean_function(ir_op *op, upper_bits_clean_func func)
 {
-	op->ops.generic2 = (op_func)func;
+	get_op_generic(op)->generic2 = (op_func)func;
 }
 
 void be_start_transform_setup(void)
@@ -584,7 +585,7 @@ void be_map_exc_node_to_runtime_call(ir_node *node, ir_mode *res_mode,
 	turn_into_tuple(node, n_operands, tuple_in);
 }
 
-static ir_heights_t *heights;
+static THREAD_LOCAL ir_heights_t *heights;
 
 /**
  * Check if a node is somehow data dependent on another one.
@@ -952,3 +953,25 @@ unsigned be_get_out_for_reg(ir_node const *const node, arch_register_t const *co
 	}
 	panic("register requirement not found");
 }
+
+ident *be_new_irg_ident(ir_graph *const irg, char const *const tag)
+{
+	be_irg_t *const birg = be_birg_from_irg(irg);
+	if (birg == NULL || !birg->has_emit_chunk)
+		return id_unique(tag);
+	return new_id_fmt("%s.%u.%u", tag, birg->emit_chunk, birg->n_idents++);
+}
+
+ident *be_get_tarval_ident(char const *const tag, ir_tarval const *const tv)
+{
+	ir_mode *const mode    = get_tarval_mode(tv);
+	unsigned const n_bytes = (get_mode_size_bits(mode) + 7) / 8;
+	char           bits[2 * 16 + 1];
+	assert(n_bytes * 2 < sizeof(bits));
+	/* most significant byte first */
+	for (unsigned i = 0; i < n_bytes; ++i) {
+		snprintf(&bits[2 * i], 3, "%02x",
+		         get_tarval_sub_bits(tv, n_bytes - 1 - i));
+	}
+	return new_id_fmt("%s.%s.%s", tag, get_mode_name(mode), bits);
+}
@@ -199,4 +199,17 @@ static inline bool be_mode_needs_gp_reg(ir_mode *const mode)
  */
 unsigned be_get_out_for_reg(ir_node const *node, arch_register_t const *reg);
 
+/**
+ * Returns a new identifier for a private entity needed by the function of
+ * @p irg. Unlike id_unique() the identifier only depends on the slot of the
+ * function text, so it does not change when graphs are compiled concurrently.
+ */
+ident *be_new_irg_ident(ir_graph *irg, char const *tag);
+
+/**
+ * Returns the identifier of a constant entity holding @p tv, which is shared
+ * by all functions. It does not depend on the function needing it first.
+ */
+ident *be_get_tarval_ident(char const *tag, ir_tarval const *tv);
+
 #endif
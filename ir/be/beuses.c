@@ -11,8 +11,11 @@
  */
 #include "beuses.h"
 
+#include "array.h"
 #include "be_t.h"
+#include "bearch.h"
 #include "belive.h"
+#include "bemodule.h"
 #include "benode.h"
 #include "besched.h"
 #include "debug.h"
@@ -24,11 +27,14 @@
 #include "irnode_t.h"
 #include "obst.h"
 #include "pmap.h"
+#include "set.h"
 #include "util.h"
 #include <limits.h>
 #include <stdlib.h>
+#include <string.h>
 
 #define UNKNOWN_OUTERMOST_LOOP  ((unsigned)-1)
+#define NO_NUMBER               ((unsigned)-1)
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg;)
 
@@ -40,13 +46,72 @@ typedef struct be_use_t {
 	ir_visited_t   visited;
 } be_use_t;
 
+/** A use of a value in a block of the next-use table. */
+typedef struct table_use_t {
+	unsigned       block; /**< number of the block containing the use */
+	unsigned       value; /**< number of the used value */
+	unsigned       step;  /**< schedule step of the user */
+	const ir_node *node;  /**< the user */
+} table_use_t;
+
+/**
+ * Next-use information of a value that is used in a block or live at its
+ * end.
+ */
+typedef struct table_value_t {
+	unsigned       value;          /**< the value number */
+	unsigned       uses;           /**< index of the first use in the block */
+	unsigned       n_uses;         /**< number of uses in the block */
+	unsigned       cursor;         /**< use found by the previous query */
+	bool           phi_arg;        /**< value is a Phi argument at the end */
+	/** distance from the block end to the next use behind the block */
+	unsigned       time;
+	unsigned       outermost_loop; /**< outermost loop left on the way */
+	const ir_node *before;         /**< the next use behind the block */
+	unsigned       succs;          /**< index of the first successor entry */
+	unsigned       n_succs;        /**< number of successor entries */
+} table_value_t;
+
+/** A successor block the value is live-in at. */
+typedef struct table_succ_t {
+	unsigned block;   /**< number of the successor block */
+	unsigned slot;    /**< entry of the value in the successor */
+	unsigned penalty; /**< extra distance for leaving loops */
+} table_succ_t;
+
+/** Per-block part of the next-use table. */
+typedef struct table_block_t {
+	const ir_node *block;
+	unsigned       slots;      /**< index of the first value entry */
+	unsigned       n_slots;    /**< number of value entries */
+	unsigned       n_steps;    /**< number of schedule steps */
+	unsigned       loop_depth;
+	bool           invalid;    /**< schedule changed, query on demand */
+} table_block_t;
+
+/**
+ * Next-use distances of all values of a register class, precomputed for all
+ * blocks at once.
+ */
+typedef struct next_use_table_t {
+	unsigned      *numbers;  /**< block or value number by node index */
+	unsigned       n_nodes;  /**< size of numbers */
+	table_block_t *blocks;
+	table_value_t *slots;    /**< per block, sorted by value number */
+	table_use_t   *uses;     /**< sorted by block, value and step */
+	table_succ_t  *succs;
+	unsigned      *slot_of;  /**< entry by value number in the current block */
+	unsigned       current;  /**< block slot_of is filled for */
+} next_use_table_t;
+
 /**
  * The "uses" environment.
  */
 struct be_uses_t {
-	set           *uses; /**< cache: contains all computed uses so far. */
-	const be_lv_t *lv;   /**< the liveness for the graph. */
-	ir_visited_t   visited_counter; /**< current search counter. */
+	set              *uses; /**< cache: contains all computed uses so far. */
+	const be_lv_t    *lv;   /**< the liveness for the graph. */
+	ir_visited_t      visited_counter; /**< current search counter. */
+	next_use_table_t *table; /**< precomputed distances, may be NULL. */
 };
 
 /**
@@ -278,9 +343,99 @@ static be_next_use_t get_next_use(be_uses_t *const env, ir_node *const from,
 	return result;
 }
 
+static unsigned get_number(const next_use_table_t *table, const ir_node *node)
+{
+	unsigned const idx = get_irn_idx(node);
+	return idx < table->n_nodes ? table->numbers[idx] : NO_NUMBER;
+}
+
+/**
+ * Find the table entry of value @p value in block @p block_nr, NULL if the
+ * value is neither used in the block nor live at its end.
+ */
+static table_value_t *find_table_value(next_use_table_t *table,
+                                       unsigned block_nr, unsigned value)
+{
+	table_block_t const *const block = &table->blocks[block_nr];
+	if (table->current != block_nr) {
+		table->current = block_nr;
+		for (unsigned i = block->slots, e = i + block->n_slots; i < e; ++i)
+			table->slot_of[table->slots[i].value] = i;
+	}
+
+	unsigned const slot = table->slot_of[value];
+	if (slot < block->slots || slot >= block->slots + block->n_slots
+	 || table->slots[slot].value != value)
+		return NULL;
+	return &table->slots[slot];
+}
+
+/**
+ * Answer a next-use query from the precomputed table. Returns false if the
+ * table knows nothing about the block or value and the query has to be
+ * answered on demand.
+ */
+static bool get_next_use_table(be_uses_t *const env, ir_node *const from,
+                               const ir_node *def, bool skip_from_uses,
+                               be_next_use_t *const result)
+{
+	next_use_table_t *const table    = env->table;
+	ir_node          *const block    = get_nodes_block(from);
+	unsigned          const block_nr = get_number(table, block);
+	unsigned          const value    = get_number(table, def);
+	if (block_nr == NO_NUMBER || value == NO_NUMBER
+	 || table->blocks[block_nr].invalid)
+		return false;
+
+	table_block_t const *const tblock   = &table->blocks[block_nr];
+	table_value_t       *const tvalue   = find_table_value(table, block_nr, value);
+	unsigned             const timestep = get_step(from);
+	if (tvalue != NULL && tvalue->n_uses > 0) {
+		/* the spiller asks in schedule order, so continue at the use found
+		 * by the previous query */
+		table_use_t const *const uses     = &table->uses[tvalue->uses];
+		unsigned           const min_step = timestep + skip_from_uses;
+		unsigned                 i        = tvalue->cursor;
+		if (i > 0 && uses[i - 1].step >= min_step)
+			i = 0;
+		while (i < tvalue->n_uses && uses[i].step < min_step)
+			++i;
+		tvalue->cursor = i;
+		if (i < tvalue->n_uses) {
+			result->time           = uses[i].step - timestep;
+			result->outermost_loop = tblock->loop_depth;
+			result->before         = uses[i].node;
+			return true;
+		}
+	}
+
+	unsigned const step = tblock->n_steps - timestep;
+	bool     const phi_arg
+		= tvalue != NULL ? tvalue->phi_arg : be_is_phi_argument(block, def);
+	if (phi_arg) {
+		result->time           = step;
+		result->outermost_loop = tblock->loop_depth;
+		result->before         = block;
+	} else if (tvalue != NULL && !USES_IS_INFINITE(tvalue->time)) {
+		result->time           = tvalue->time + step;
+		result->outermost_loop = tvalue->outermost_loop;
+		result->before         = tvalue->before;
+	} else {
+		result->time           = USES_INFINITY + step;
+		result->outermost_loop = tblock->loop_depth;
+		result->before         = NULL;
+	}
+	return true;
+}
+
 be_next_use_t be_get_next_use(be_uses_t *env, ir_node *from,
                               const ir_node *def, bool skip_from_uses)
 {
+	be_next_use_t result;
+	if (env->table != NULL
+	 && get_next_use_table(env, from, def, skip_from_uses, &result))
+		return result;
+
 	++env->visited_counter;
 	return get_next_use(env, from, def, skip_from_uses);
 }
@@ -307,8 +462,6 @@ static void set_sched_step_walker(ir_node *block, void *data)
 
 be_uses_t *be_begin_uses(ir_graph *irg, const be_lv_t *lv)
 {
-	FIRM_DBG_REGISTER(dbg, "firm.be.uses");
-
 	assure_edges(irg);
 
 	/* precalculate sched steps */
@@ -321,8 +474,278 @@ be_uses_t *be_begin_uses(ir_graph *irg, const be_lv_t *lv)
 	return env;
 }
 
+
+static int cmp_table_use(const void *a, const void *b)
+{
+	table_use_t const *const p = (table_use_t const*)a;
+	table_use_t const *const q = (table_use_t const*)b;
+	if (p->block != q->block)
+		return QSORT_CMP(p->block, q->block);
+	if (p->value != q->value)
+		return QSORT_CMP(p->value, q->value);
+	return QSORT_CMP(p->step, q->step);
+}
+
+static int cmp_table_value(const void *a, const void *b)
+{
+	table_value_t const *const p = (table_value_t const*)a;
+	table_value_t const *const q = (table_value_t const*)b;
+	return QSORT_CMP(p->value, q->value);
+}
+
+static void collect_block(ir_node *block, void *data)
+{
+	ir_node ***blocks = (ir_node***)data;
+	ARR_APP1(ir_node*, *blocks, block);
+}
+
+/**
+ * Distance from the start of a block to the next use of the value of entry
+ * @p slot, the same as a query at the first node of the block.
+ */
+static be_next_use_t get_block_entry_use(next_use_table_t const *table,
+                                         table_block_t const *block,
+                                         table_value_t const *slot)
+{
+	be_next_use_t result;
+	if (slot->n_uses > 0) {
+		table_use_t const *const use = &table->uses[slot->uses];
+		result.time           = use->step;
+		result.outermost_loop = block->loop_depth;
+		result.before         = use->node;
+	} else if (slot->phi_arg) {
+		result.time           = block->n_steps;
+		result.outermost_loop = block->loop_depth;
+		result.before         = block->block;
+	} else if (!USES_IS_INFINITE(slot->time)) {
+		result.time           = slot->time + block->n_steps;
+		result.outermost_loop = slot->outermost_loop;
+		result.before         = slot->before;
+	} else {
+		result.time           = USES_INFINITY;
+		result.outermost_loop = block->loop_depth;
+		result.before         = NULL;
+	}
+	return result;
+}
+
+/**
+ * Compute the next-use distances at the end of all blocks. Distances only
+ * decrease, so sweeping over the blocks against the walk order until nothing
+ * changes reaches the fixpoint.
+ */
+static void solve_table(next_use_table_t *table, unsigned n_blocks)
+{
+	bool changed;
+	do {
+		changed = false;
+		for (unsigned b = n_blocks; b-- > 0; ) {
+			table_block_t const *const block = &table->blocks[b];
+			for (unsigned i = block->slots, e = i + block->n_slots; i < e; ++i) {
+				table_value_t *const slot           = &table->slots[i];
+				unsigned             next_use       = USES_INFINITY;
+				unsigned             outermost_loop = block->loop_depth;
+				const ir_node       *before         = NULL;
+				for (unsigned s = slot->succs, se = s + slot->n_succs; s < se; ++s) {
+					table_succ_t  const *const succ = &table->succs[s];
+					be_next_use_t const        use
+						= get_block_entry_use(table, &table->blocks[succ->block],
+						                      &table->slots[succ->slot]);
+					if (USES_IS_INFINITE(use.time))
+						continue;
+					unsigned const use_dist = use.time + succ->penalty;
+					if (use_dist < next_use) {
+						next_use       = use_dist;
+						outermost_loop = use.outermost_loop;
+						before         = use.before;
+					}
+				}
+				if (block->loop_depth < outermost_loop)
+					outermost_loop = block->loop_depth;
+
+				if (next_use != slot->time || outermost_loop != slot->outermost_loop
+				 || before != slot->before) {
+					slot->time           = next_use;
+					slot->outermost_loop = outermost_loop;
+					slot->before         = before;
+					changed              = true;
+				}
+			}
+		}
+	} while (changed);
+}
+
+static next_use_table_t *build_table(ir_graph *irg, const be_lv_t *lv,
+                                     const arch_register_class_t *cls)
+{
+	next_use_table_t *table = XMALLOCZ(next_use_table_t);
+	table->n_nodes = get_irg_last_idx(irg);
+	table->numbers = XMALLOCN(unsigned, table->n_nodes);
+	memset(table->numbers, 0xFF, table->n_nodes * sizeof(*table->numbers));
+
+	/* number blocks and the values of the register class */
+	ir_node **blocks = NEW_ARR_F(ir_node*, 0);
+	irg_block_walk_graph(irg, collect_block, NULL, &blocks);
+	unsigned const n_blocks = ARR_LEN(blocks);
+	table->blocks = XMALLOCNZ(table_block_t, n_blocks);
+	ir_node **values = NEW_ARR_F(ir_node*, 0);
+	for (unsigned b = 0; b < n_blocks; ++b) {
+		ir_node       *const block  = blocks[b];
+		table_block_t *const tblock = &table->blocks[b];
+		table->numbers[get_irn_idx(block)] = b;
+		tblock->block      = block;
+		tblock->loop_depth = get_loop_depth(get_irn_loop(block));
+		ir_node *const last = sched_last(block);
+		tblock->n_steps    = sched_is_end(last) ? 0 : get_step(last) + 1;
+		sched_foreach(block, node) {
+			be_foreach_value(node, value,
+				if (!arch_irn_consider_in_reg_alloc(cls, value))
+					continue;
+				table->numbers[get_irn_idx(value)] = ARR_LEN(values);
+				ARR_APP1(ir_node*, values, value);
+			);
+		}
+	}
+
+	/* collect the uses of all values, grouped by block */
+	unsigned const n_values = ARR_LEN(values);
+	table_use_t   *uses     = NEW_ARR_F(table_use_t, 0);
+	for (unsigned v = 0; v < n_values; ++v) {
+		foreach_out_edge(values[v], edge) {
+			ir_node *const user = get_edge_src_irn(edge);
+			if (is_Anchor(user) || is_Phi(user))
+				continue;
+			table_use_t const use = {
+				.block = get_number(table, get_nodes_block(user)),
+				.value = v,
+				.step  = get_step(user),
+				.node  = user,
+			};
+			ARR_APP1(table_use_t, uses, use);
+		}
+	}
+	QSORT_ARR(uses, cmp_table_use);
+	table->uses = uses;
+
+	/* an entry for each value used in a block or live at its end */
+	table_value_t *slots   = NEW_ARR_F(table_value_t, 0);
+	unsigned       n_uses  = ARR_LEN(uses);
+	unsigned       u       = 0;
+	for (unsigned b = 0; b < n_blocks; ++b) {
+		ir_node       *const block  = blocks[b];
+		table_block_t *const tblock = &table->blocks[b];
+		tblock->slots = ARR_LEN(slots);
+		while (u < n_uses && uses[u].block == b) {
+			table_value_t slot = {
+				.value = uses[u].value,
+				.uses  = u,
+			};
+			while (u < n_uses && uses[u].block == b
+			       && uses[u].value == slot.value) {
+				++slot.n_uses;
+				++u;
+			}
+			ARR_APP1(table_value_t, slots, slot);
+		}
+		unsigned const n_used = ARR_LEN(slots) - tblock->slots;
+		be_lv_foreach_cls(lv, block, be_lv_state_end, cls, node) {
+			unsigned const value = get_number(table, node);
+			if (value == NO_NUMBER)
+				continue;
+			table_value_t const key = { .value = value };
+			if (bsearch(&key, &slots[tblock->slots], n_used, sizeof(key),
+			            cmp_table_value) != NULL)
+				continue;
+			ARR_APP1(table_value_t, slots, key);
+		}
+		tblock->n_slots = ARR_LEN(slots) - tblock->slots;
+		QSORT(&slots[tblock->slots], tblock->n_slots, cmp_table_value);
+	}
+	table->slots = slots;
+
+	/* link the entries of values live-out to their successors */
+	table_succ_t *succs = NEW_ARR_F(table_succ_t, 0);
+	for (unsigned b = 0; b < n_blocks; ++b) {
+		ir_node             *const block  = blocks[b];
+		table_block_t const *const tblock = &table->blocks[b];
+		for (unsigned i = tblock->slots, e = i + tblock->n_slots; i < e; ++i) {
+			table_value_t *const slot = &slots[i];
+			ir_node       *const def  = values[slot->value];
+			slot->phi_arg        = be_is_phi_argument(block, def);
+			slot->time           = USES_INFINITY;
+			slot->outermost_loop = tblock->loop_depth;
+			slot->succs          = ARR_LEN(succs);
+			foreach_block_succ(block, edge) {
+				ir_node *const succ_block = get_edge_src_irn(edge);
+				if (!be_is_live_in(lv, succ_block, def))
+					continue;
+				unsigned             const s      = get_number(table, succ_block);
+				table_block_t const *const sblock = &table->blocks[s];
+				table_value_t const        key    = { .value = slot->value };
+				table_value_t const *const sslot  = (table_value_t const*)bsearch(
+					&key, &slots[sblock->slots], sblock->n_slots, sizeof(key),
+					cmp_table_value);
+				assert(sslot != NULL);
+				unsigned penalty = 0;
+				if (sblock->loop_depth < tblock->loop_depth)
+					penalty = (tblock->loop_depth - sblock->loop_depth) * 5000;
+				table_succ_t const succ = {
+					.block   = s,
+					.slot    = (unsigned)(sslot - slots),
+					.penalty = penalty,
+				};
+				ARR_APP1(table_succ_t, succs, succ);
+			}
+			slot->n_succs = ARR_LEN(succs) - slot->succs;
+		}
+	}
+	table->succs = succs;
+	DEL_ARR_F(values);
+	DEL_ARR_F(blocks);
+
+	solve_table(table, n_blocks);
+
+	table->slot_of = XMALLOCNZ(unsigned, n_values);
+	table->current = NO_NUMBER;
+	return table;
+}
+
+be_uses_t *be_begin_uses_cls(ir_graph *irg, const be_lv_t *lv,
+                             const arch_register_class_t *cls)
+{
+	be_uses_t *env = be_begin_uses(irg, lv);
+	env->table = build_table(irg, lv, cls);
+	return env;
+}
+
+void be_uses_invalidate_block(be_uses_t *env, ir_node *block)
+{
+	set_sched_step_walker(block, NULL);
+	if (env->table == NULL)
+		return;
+	unsigned const block_nr = get_number(env->table, block);
+	if (block_nr != NO_NUMBER)
+		env->table->blocks[block_nr].invalid = true;
+}
+
 void be_end_uses(be_uses_t *env)
 {
+	next_use_table_t *const table = env->table;
+	if (table != NULL) {
+		DEL_ARR_F(table->succs);
+		DEL_ARR_F(table->slots);
+		DEL_ARR_F(table->uses);
+		free(table->slot_of);
+		free(table->blocks);
+		free(table->numbers);
+		free(table);
+	}
 	del_set(env->uses);
 	free(env);
 }
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_uses)
+void be_init_uses(void)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.be.uses");
+}
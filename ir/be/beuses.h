@@ -52,6 +52,27 @@ be_next_use_t be_get_next_use(be_uses_t *uses, ir_node *from,
  */
 be_uses_t *be_begin_uses(ir_graph *irg, const be_lv_t *lv);
 
+/**
+ * Creates a new uses environment for a graph which precomputes the next-use
+ * distances of all values of a register class. Queries for these values are
+ * answered by table lookups instead of searching the successor blocks.
+ *
+ * @param irg  the graph
+ * @param lv   liveness information for the graph
+ * @param cls  the register class
+ */
+be_uses_t *be_begin_uses_cls(ir_graph *irg, const be_lv_t *lv,
+                             const arch_register_class_t *cls);
+
+/**
+ * Marks the schedule of a block as changed. The block is renumbered and
+ * queries in it are answered on demand from now on.
+ *
+ * @param uses   the environment
+ * @param block  the block whose schedule changed
+ */
+void be_uses_invalidate_block(be_uses_t *uses, ir_node *block);
+
 /**
  * Destroys the given uses environment.
  *
@@ -373,7 +373,8 @@ static void ia32_perform_memory_operand(ir_node *irn, unsigned int i)
 	kill_node(load);
 }
 
-static bool gprof;
+static bool       gprof;
+static ir_entity *mcount;
 
 static ir_node *ia32_turn_back_dest_am(ir_node *node)
 {
@@ -1116,25 +1117,30 @@ static void ia32_before_emit(ir_graph *irg)
 	be_remove_dead_nodes_from_schedule(irg);
 }
 
+/**
+ * Create mcount before the graphs are compiled, the graphs may be compiled
+ * concurrently.
+ */
+static void prepare_gprof(void)
+{
+	if (!gprof || mcount != NULL)
+		return;
+	/* Linux gprof implementation needs base pointer */
+	be_options.omit_fp = 0;
+
+	ir_type *tp = new_type_method(0, 0, false, cc_cdecl_set, mtp_no_property);
+	ident   *id = new_id_from_str("mcount");
+	mcount = new_global_entity(get_glob_type(), id, tp, ir_visibility_external,
+	                           IR_LINKAGE_DEFAULT);
+}
+
 /**
  * Prepare a graph and perform code selection.
  */
 static void ia32_select_instructions(ir_graph *irg)
 {
-	if (gprof) {
-		/* Linux gprof implementation needs base pointer */
-		be_options.omit_fp = 0;
-
-		static ir_entity *mcount = NULL;
-		if (mcount == NULL) {
-			ir_type *tp = new_type_method(0, 0, false, cc_cdecl_set, mtp_no_property);
-			ident   *id = new_id_from_str("mcount");
-			mcount = new_global_entity(get_glob_type(), id, tp,
-			                           ir_visibility_external,
-			                           IR_LINKAGE_DEFAULT);
-		}
+	if (gprof)
 		instrument_initcall(irg, mcount);
-	}
 	ia32_adjust_pic(irg);
 
 	be_timer_push(T_CODEGEN);
@@ -1367,6 +1373,11 @@ static void ia32_init(void)
 
 static void ia32_finish(void)
 {
+	if (ia32_tv_ent != NULL) {
+		pmap_destroy(ia32_tv_ent);
+		ia32_tv_ent = NULL;
+	}
+	mcount = NULL;
 	ia32_free_opcodes();
 	obstack_free(&opcodes_obst, NULL);
 }
@@ -1412,34 +1423,47 @@ static bool lower_for_emit(ir_graph *const irg, const unsigned *const sp_is_non_
 	return true;
 }
 
+static void ia32_compile_graph(ir_graph *const irg, void *const data)
+{
+	unsigned const *const sp_is_non_ssa = (unsigned const*)data;
+	if (!lower_for_emit(irg, sp_is_non_ssa))
+		return;
+
+	be_timer_push(T_EMIT);
+	ia32_emit_function(irg);
+	be_timer_pop(T_EMIT);
+
+	be_step_last(irg);
+}
+
 static void ia32_generate_code(FILE *output, const char *cup_name)
 {
 	ia32_tv_ent = pmap_create();
+	be_gas_elf_type_char = '@';
 
 	be_begin(output, cup_name);
+	prepare_gprof();
 	unsigned *const sp_is_non_ssa = rbitset_alloca(N_IA32_REGISTERS);
 	rbitset_set(sp_is_non_ssa, REG_ESP);
 
-	foreach_irp_irg(i, irg) {
-		if (!lower_for_emit(irg, sp_is_non_ssa))
-			continue;
-
-		be_timer_push(T_EMIT);
-		ia32_emit_function(irg);
-		be_timer_pop(T_EMIT);
-
-		be_step_last(irg);
-	}
+	be_compile_graphs(ia32_compile_graph, sp_is_non_ssa);
 
 	ia32_emit_thunks();
 
 	be_finish();
 	pmap_destroy(ia32_tv_ent);
+	ia32_tv_ent = NULL;
 }
 
 static ir_jit_function_t *ia32_jit_compile(ir_jit_segment_t *const segment,
                                            ir_graph *const irg)
 {
+	/* Constants are shared between all functions compiled until
+	 * ia32_finish(). */
+	if (ia32_tv_ent == NULL)
+		ia32_tv_ent = pmap_create();
+	prepare_gprof();
+
 	unsigned *const sp_is_non_ssa = rbitset_alloca(N_IA32_REGISTERS);
 	rbitset_set(sp_is_non_ssa, REG_ESP);
 
@@ -1669,6 +1693,7 @@ arch_isa_if_t const ia32_isa_if = {
 	.generate_code         = ia32_generate_code,
 	.jit_compile           = ia32_jit_compile,
 	.emit_function         = ia32_emit_jit_function,
+	.elf_target            = &ia32_elf_target,
 	.lower_for_target      = ia32_lower_for_target,
 	.additional_reg_names  = ia32_additional_reg_names,
 	.get_op_estimated_cost = ia32_get_op_estimated_cost,
@@ -48,6 +48,7 @@
 #include "ia32_new_nodes.h"
 #include "irgwalk.h"
 #include "irnodehashmap.h"
+#include "irthread.h"
 #include "irtools.h"
 #include "lc_opts.h"
 #include "lc_opts_enum.h"
@@ -57,15 +58,17 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
-static char       pic_base_label[128];
-static ir_label_t exc_label_id;
-static bool       mark_spill_reload;
+static THREAD_LOCAL char       pic_base_label[128];
+static THREAD_LOCAL ir_label_t exc_label_id;
+static bool                    mark_spill_reload;
 
-static bool       omit_fp;
-static int        frame_type_size;
-static int        callframe_offset;
-static ir_entity *thunks[N_ia32_gp_REGS];
-static ir_type   *thunk_type;
+static THREAD_LOCAL bool       omit_fp;
+static THREAD_LOCAL int        frame_type_size;
+static THREAD_LOCAL int        callframe_offset;
+/* the thunks are shared by all threads */
+static ir_mutex_t              thunks_mutex = IR_MUTEX_INITIALIZER;
+static ir_entity              *thunks[N_ia32_gp_REGS];
+static ir_type                *thunk_type;
 
 typedef enum get_ip_style_t {
 	IA32_GET_IP_POP,
@@ -74,16 +77,6 @@ typedef enum get_ip_style_t {
 
 static int get_ip_style = IA32_GET_IP_THUNK;
 
-/**
- * Add a number to a prefix. This number will not be used a second time.
- */
-static char *get_unique_label(char *buf, size_t buflen, const char *prefix)
-{
-	static unsigned long id = 0;
-	snprintf(buf, buflen, "%s%s%lu", be_gas_get_private_prefix(), prefix, ++id);
-	return buf;
-}
-
 static const char *get_register_name_8bit_low(const arch_register_t *reg)
 {
 	switch (reg->global_index) {
@@ -586,8 +579,9 @@ x86_condition_code_t ia32_determine_final_cc(ir_node const *const node,
  */
 static void ia32_emit_exc_label(const ir_node *node)
 {
-	be_emit_string(be_gas_insn_label_prefix());
-	be_emit_irprintf("%lu", get_ia32_exc_label_id(node));
+	/* the labels are numbered inside the function text */
+	be_emit_irprintf("%s%u_%lu", be_gas_insn_label_prefix(),
+	                 be_emit_current_chunk(), get_ia32_exc_label_id(node));
 }
 
 static void emit_jmp(ir_node const *const node, ir_node const *const target)
@@ -1073,6 +1067,7 @@ static void emit_ia32_GetEIP(const ir_node *node)
 
 	case IA32_GET_IP_THUNK: {
 		const arch_register_t *reg = arch_get_irn_register_out(node, 0);
+		ir_mutex_lock(&thunks_mutex);
 		ir_entity *thunk = thunks[reg->index];
 		if (thunk == NULL) {
 			ir_type    *const glob = get_glob_type();
@@ -1081,13 +1076,9 @@ static void emit_ia32_GetEIP(const ir_node *node)
 			ir_type    *const tp   = get_thunk_type();
 			thunk = new_global_entity(glob, id, tp, ir_visibility_external_private,
 			                          IR_LINKAGE_MERGE|IR_LINKAGE_GARBAGE_COLLECT);
-			/* Note that we do not create a proper method graph, but rather cheat
-			 * later and emit the instructions manually. This is just necessary so
-			 * firm knows we will actually output code for this entity. */
-			new_ir_graph(thunk, 0);
-
 			thunks[reg->index] = thunk;
 		}
+		ir_mutex_unlock(&thunks_mutex);
 
 		ia32_emitf(node, "call %E", thunk);
 		switch (ir_platform.pic_style) {
@@ -1162,7 +1153,7 @@ static void ia32_assign_exc_label(ir_node *node)
 	be_emit_char(':');
 	be_emit_pad_comment();
 	be_emit_cstring("/* exception to Block ");
-	be_emit_cfop_target(node);
+	be_gas_emit_block_name((ir_node const*)get_irn_link(node));
 	be_emit_cstring(" */\n");
 	be_emit_write_line();
 }
@@ -1332,8 +1323,10 @@ static void ia32_gen_labels(ir_node *block, void *data)
 	exc_entry **exc_list = (exc_entry**)data;
 	for (unsigned n = get_Block_n_cfgpreds(block); n-- > 0; ) {
 		ir_node *pred = get_Block_cfgpred(block, n);
+		if (!is_x_except_Proj(pred))
+			continue;
 
-		pred = skip_Proj(pred);
+		pred = get_Proj_pred(pred);
 		if (is_ia32_irn(pred) && get_ia32_exc_label(pred) && exc_list != NULL) {
 			exc_entry e;
 
@@ -1393,7 +1386,10 @@ static void emit_function_text(ir_graph *const irg, exc_entry **const exc_list)
 
 	be_emit_init_cf_links(blk_sched);
 
+	size_t const n_hot = be_emit_init_cold_part(irg, blk_sched);
 	for (size_t i = 0, n = ARR_LEN(blk_sched); i < n; ++i) {
+		if (i == n_hot)
+			be_gas_begin_cold_part(get_irg_entity(irg));
 		ir_node *const block = blk_sched[i];
 		ia32_gen_block(block);
 	}
@@ -1448,7 +1444,6 @@ static unsigned emit_jit_entity_relocation_asm(char *const buffer,
 void ia32_emit_function(ir_graph *const irg)
 {
 	exc_entry *exc_list = NEW_ARR_F(exc_entry, 0);
-	be_gas_elf_type_char = '@';
 
 	ir_entity *const entity = get_irg_entity(irg);
 	parameter_dbg_info_t *infos = construct_parameter_infos(irg);
@@ -1469,7 +1464,9 @@ void ia32_emit_function(ir_graph *const irg)
 		be_dwarf_callframe_spilloffset(&ia32_registers[REG_EBP], -8);
 	}
 
-	get_unique_label(pic_base_label, sizeof(pic_base_label), "PIC_BASE");
+	snprintf(pic_base_label, sizeof(pic_base_label), "%sPIC_BASE%u",
+	         be_gas_get_private_prefix(), be_emit_current_chunk());
+	exc_label_id = 0;
 	x86_pic_base_label = pic_base_label;
 
 	if (ia32_cg_config.emit_machcode) {
@@ -1492,9 +1489,11 @@ void ia32_emit_function(ir_graph *const irg)
 		be_emit_cstring("\t.long ");
 		ia32_emit_exc_label(exc_list[e].exc_instr);
 		be_emit_char('\n');
+		be_emit_write_line();
 		be_emit_cstring("\t.long ");
 		be_gas_emit_block_name(exc_list[e].block);
 		be_emit_char('\n');
+		be_emit_write_line();
 	}
 	DEL_ARR_F(exc_list);
 }
@@ -1507,11 +1506,20 @@ void ia32_emit_thunks(void)
 			continue;
 		const arch_register_t *reg = &ia32_reg_classes[CLASS_ia32_gp].regs[i];
 
+		/* Note that we do not create a proper method graph, but rather cheat
+		 * and emit the instructions manually. This is just necessary so firm
+		 * knows we will actually output code for this entity. The graph is
+		 * created here, as the graph list must not change while the functions
+		 * are compiled. */
+		new_ir_graph(entity, 0);
+
+		be_emit_begin_chunk(be_emit_reserve_chunk());
 		be_gas_emit_function_prolog(entity, ia32_cg_config.function_alignment,
 		                            NULL);
 		ia32_emitf(NULL, "movl (%%esp), %#R", reg);
 		ia32_emitf(NULL, "ret");
 		be_gas_emit_function_epilog(entity);
+		be_emit_finish_chunk();
 	}
 }
 
@@ -13,6 +13,7 @@
 #include "bearch.h"
 #include "beblocksched.h"
 #include "beemithlp.h"
+#include "beelf.h"
 #include "begnuas.h"
 #include "bejit.h"
 #include "besched.h"
@@ -24,10 +25,14 @@
 #include "ia32_emitter.h"
 #include "ia32_new_nodes.h"
 #include "irnodehashmap.h"
+#include "pmap.h"
 #include "x86_node.h"
 #include <stdint.h>
 
-static ir_nodehashmap_t block_fragmentnum;
+static THREAD_LOCAL ir_nodehashmap_t block_fragmentnum;
+/** Fragments of the jump tables, which are emitted behind the code. */
+static THREAD_LOCAL pmap            *table_fragmentnum;
+static THREAD_LOCAL ir_node const  **switch_nodes;
 
 /** Returns the encoding for a pnc field. */
 static unsigned char pnc2cc(x86_condition_code_t cc)
@@ -88,6 +93,16 @@ static void enc_relocation(x86_imm32_t const *const imm)
 		return;
 	}
 
+	if (table_fragmentnum != NULL) {
+		void *const num = pmap_get(void, table_fragmentnum, entity);
+		if (num != NULL) {
+			if (imm->kind != X86_IMM_ADDR)
+				panic("unsupported relocation kind %s for jump table %+F",
+				      x86_get_immediate_kind_str(imm->kind), entity);
+			be_emit_reloc_fragment(4, X86_IMM_ADDR, PTR_TO_INT(num), offset);
+			return;
+		}
+	}
 	be_emit_reloc_entity(4, imm->kind, entity, offset);
 }
 
@@ -266,6 +281,12 @@ static void enc_mov(arch_register_t const *const src, arch_register_t const *con
 	enc_modrr(src, dst);
 }
 
+static void enc_copyebpesp(ir_node const *const node)
+{
+	(void)node;
+	enc_mov(&ia32_registers[REG_EBP], &ia32_registers[REG_ESP]);
+}
+
 static void enc_xchg(arch_register_t const *const src, arch_register_t const *const dst)
 {
 	if (src->index == REG_GP_EAX) {
@@ -998,10 +1019,15 @@ static void enc_ia32_jcc(const ir_node *node)
 static void enc_switchjmp(const ir_node *node)
 {
 	be_emit8(0xFF); // jmp *tbl.label(,%in,4)
-	enc_mod_am(0x05, node);
-
-	ia32_switch_attr_t const *const attr = get_ia32_switch_attr_const(node);
-	be_emit_jump_table(node, &attr->swtch, mode_P, ia32_emit_jumptable_target);
+	enc_mod_am(4, node);
+
+	/* without machine code in the assembler output, the table is emitted
+	 * behind the code, see gen_jump_table() */
+	if (ia32_cg_config.emit_machcode) {
+		ia32_switch_attr_t const *const attr = get_ia32_switch_attr_const(node);
+		be_emit_jump_table(node, &attr->swtch, mode_P,
+		                   ia32_emit_jumptable_target);
+	}
 }
 
 static void enc_return(const ir_node *node)
@@ -1286,6 +1312,7 @@ static void ia32_register_binary_emitters(void)
 	be_set_emitter(op_ia32_Call,          enc_call);
 	be_set_emitter(op_ia32_Const,         enc_mov_const);
 	be_set_emitter(op_ia32_Conv_I2I,      enc_conv_i2i);
+	be_set_emitter(op_ia32_CopyEbpEsp,    enc_copyebpesp);
 	be_set_emitter(op_ia32_CopyB_i,       enc_copybi);
 	be_set_emitter(op_ia32_Dec,           enc_dec);
 	be_set_emitter(op_ia32_FldCW,         enc_fldcw);
@@ -1354,6 +1381,45 @@ static void gen_binary_block(ir_node *const block)
 	be_finish_fragment();
 }
 
+static void gen_jump_table(ir_node const *const node)
+{
+	ia32_switch_attr_t const *const attr = get_ia32_switch_attr_const(node);
+	unsigned long         length;
+	ir_node const **const targets
+		= be_get_jump_table_targets(node, &attr->swtch, &length);
+
+	be_begin_fragment(2, 3);
+	for (unsigned long i = 0; i < length; ++i) {
+		ir_node const *const block = be_emit_get_cfop_target(targets[i]);
+		unsigned       const num
+			= PTR_TO_INT(ir_nodehashmap_get(void, &block_fragmentnum, block));
+		be_emit_reloc_fragment(4, X86_IMM_ADDR, num, 0);
+	}
+	be_finish_fragment();
+
+	free(targets);
+}
+
+/**
+ * Assign fragment numbers behind the blocks to the jump tables, as the
+ * instructions referencing a table may come before the switch.
+ */
+static void assign_jump_table_fragments(ir_node **const blk_sched)
+{
+	size_t const n = ARR_LEN(blk_sched);
+	for (size_t i = 0; i < n; ++i) {
+		sched_foreach(blk_sched[i], node) {
+			if (!is_ia32_SwitchJmp(node))
+				continue;
+			ir_entity const *const table
+				= get_ia32_switch_attr_const(node)->swtch.table_entity;
+			unsigned const num = n + ARR_LEN(switch_nodes);
+			pmap_insert(table_fragmentnum, table, INT_TO_PTR(num));
+			ARR_APP1(ir_node const*, switch_nodes, node);
+		}
+	}
+}
+
 ir_jit_function_t *ia32_emit_jit(ir_jit_segment_t *const segment,
                                  ir_graph *const irg)
 {
@@ -1374,53 +1440,29 @@ ir_jit_function_t *ia32_emit_jit(ir_jit_segment_t *const segment,
 		ir_node *block = blk_sched[i];
 		assign_block_fragment_num(block, (unsigned)i);
 	}
+	if (!ia32_cg_config.emit_machcode) {
+		table_fragmentnum = pmap_create();
+		switch_nodes      = NEW_ARR_F(ir_node const*, 0);
+		assign_jump_table_fragments(blk_sched);
+	}
 	for (size_t i = 0; i < n; ++i) {
 		ir_node *block = blk_sched[i];
 		gen_binary_block(block);
 	}
+	if (table_fragmentnum != NULL) {
+		for (size_t i = 0, n_tables = ARR_LEN(switch_nodes); i < n_tables; ++i) {
+			gen_jump_table(switch_nodes[i]);
+		}
+		pmap_destroy(table_fragmentnum);
+		table_fragmentnum = NULL;
+		DEL_ARR_F(switch_nodes);
+	}
 	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
 	ir_nodehashmap_destroy(&block_fragmentnum);
 
 	return be_jit_finish_function();
 }
 
-static void enc_nop_callback(char *buffer, unsigned size)
-{
-	memset(buffer, 0, size);
-	while (size > 0) {
-		switch (size) {
-		case 1: buffer[0] = 0x90; return;
-		case 2:
-			buffer[0] = 0x66;
-			++buffer;
-			--size;
-			continue;
-		case 3:
-		sequence_0f1f:
-			buffer[0] = 0x0F;
-			buffer[1] = 0x1F;
-			return;
-		case 4: buffer[2] = 0x40; goto sequence_0f1f;
-		case 5: buffer[2] = 0x44; goto sequence_0f1f;
-		case 6:
-			buffer[0] = 0x66;
-			++buffer;
-			--size;
-			continue;
-		case 7: buffer[2] = 0x80; goto sequence_0f1f;
-		case 8: buffer[2] = 0x84; goto sequence_0f1f;
-		default:
-			buffer[0] = 0x66;
-			buffer[1] = 0x0F;
-			buffer[2] = 0x1F;
-			buffer[3] = 0x84;
-			buffer += 9;
-			size   -= 9;
-			continue;
-		}
-	}
-}
-
 static unsigned enc_relocation_callback(char *const buffer,
                                         uint8_t const be_kind,
                                         ir_entity *const entity,
@@ -1428,8 +1470,13 @@ static unsigned enc_relocation_callback(char *const buffer,
 {
 	uint32_t value;
 	if (entity == NULL) {
-		assert(be_kind == IA32_RELOCATION_RELJUMP);
-		value = (uint32_t)offset;
+		if (be_kind == IA32_RELOCATION_RELJUMP) {
+			value = (uint32_t)offset;
+		} else {
+			/* jump table entry or address of a jump table */
+			assert(be_kind == X86_IMM_ADDR);
+			value = (uint32_t)(uintptr_t)(buffer + offset);
+		}
 	} else {
 		intptr_t const entity_addr = (intptr_t)be_jit_get_entity_addr(entity);
 		if (entity_addr == (intptr_t)-1)
@@ -1446,11 +1493,45 @@ static unsigned enc_relocation_callback(char *const buffer,
 	return 4;
 }
 
+static const be_jit_emit_interface_t jit_emit_interface = {
+	.nops       = x86_enc_nops,
+	.relocation = enc_relocation_callback,
+};
+
 void ia32_emit_jit_function(char *buffer, ir_jit_function_t *const function)
 {
-	static const be_jit_emit_interface_t jit_emit_interface = {
-		.nops       = enc_nop_callback,
-		.relocation = enc_relocation_callback,
-	};
 	be_jit_emit_memory(buffer, function, &jit_emit_interface);
 }
+
+enum {
+	R_386_32   = 1,
+	R_386_PC32 = 2,
+};
+
+static uint32_t get_elf_relocation(uint8_t const be_kind,
+                                   ir_entity const *const entity,
+                                   unsigned *const size)
+{
+	*size = 4;
+	switch (be_kind) {
+	case IA32_RELOCATION_RELJUMP:
+		return 0;
+	case X86_IMM_ADDR:
+		return R_386_32;
+	case X86_IMM_PCREL:
+		assert(entity != NULL);
+		return R_386_PC32;
+	default:
+		panic("unsupported relocation kind %s for %+F",
+		      x86_get_immediate_kind_str(be_kind), entity);
+	}
+}
+
+be_elf_target_t const ia32_elf_target = {
+	.machine          = 3, /* EM_386 */
+	.elf64            = false,
+	.rela             = false,
+	.emit             = &jit_emit_interface,
+	.get_relocation   = get_elf_relocation,
+	.abs32_relocation = R_386_32,
+};
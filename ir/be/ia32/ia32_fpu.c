@@ -26,13 +26,16 @@
 #include "ia32_transform.h"
 #include "ircons.h"
 #include "irgwalk.h"
+#include "irthread.h"
 #include "tv.h"
 
+static ir_mutex_t fpcw_mutex    = IR_MUTEX_INITIALIZER;
 static ir_entity *fpcw_round    = NULL;
 static ir_entity *fpcw_truncate = NULL;
 
 static ir_entity *create_ent(ir_entity **const dst, int value, const char *name)
 {
+	ir_mutex_lock(&fpcw_mutex);
 	if (!*dst) {
 		ir_mode   *const mode = mode_Hu;
 		ir_type   *const type = get_type_for_mode(mode);
@@ -47,6 +50,7 @@ static ir_entity *create_ent(ir_entity **const dst, int value, const char *name)
 		set_entity_initializer(ent, init);
 		*dst = ent;
 	}
+	ir_mutex_unlock(&fpcw_mutex);
 	return *dst;
 }
 
@@ -19,6 +19,7 @@
 #include "ircons_t.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "irthread.h"
 #include "platform_t.h"
 #include "x86_node.h"
 
@@ -39,16 +40,21 @@ static ir_entity *create_trampoline(be_main_env_t *be, ir_entity *method)
 	return ent;
 }
 
+/** Guards the maps of trampolines and non-lazy pointers. */
+static ir_mutex_t pic_mutex = IR_MUTEX_INITIALIZER;
+
 /**
  * Returns the trampoline entity for the given method.
  */
 static ir_entity *get_trampoline(be_main_env_t *env, ir_entity *method)
 {
+	ir_mutex_lock(&pic_mutex);
 	ir_entity *result = pmap_get(ir_entity, env->ent_trampoline_map, method);
 	if (result == NULL) {
 		result = create_trampoline(env, method);
 		pmap_insert(env->ent_trampoline_map, method, result);
 	}
+	ir_mutex_unlock(&pic_mutex);
 
 	return result;
 }
@@ -70,11 +76,13 @@ static ir_entity *create_nonlazyptr(be_main_env_t *be, ir_entity *entity)
 
 static ir_entity *get_nonlazyptr(be_main_env_t *env, ir_entity *entity)
 {
+	ir_mutex_lock(&pic_mutex);
 	ir_entity *result = pmap_get(ir_entity, env->ent_pic_symbol_map, entity);
 	if (result == NULL) {
 		result = create_nonlazyptr(env, entity);
 		pmap_insert(env->ent_pic_symbol_map, entity, result);
 	}
+	ir_mutex_unlock(&pic_mutex);
 	return result;
 }
 
@@ -52,12 +52,12 @@
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg;)
 
-static x86_cconv_t          *current_cconv;
-static be_stack_env_t        stack_env;
-static ir_heights_t         *heights;
-static x86_immediate_kind_t  lconst_imm_kind;
-static x86_addr_variant_t    lconst_variant;
-static ir_node              *initial_va_list;
+static THREAD_LOCAL x86_cconv_t          *current_cconv;
+static THREAD_LOCAL be_stack_env_t        stack_env;
+static THREAD_LOCAL ir_heights_t         *heights;
+static THREAD_LOCAL x86_immediate_kind_t  lconst_imm_kind;
+static THREAD_LOCAL x86_addr_variant_t    lconst_variant;
+static THREAD_LOCAL ir_node              *initial_va_list;
 
 #define GP &ia32_reg_classes[CLASS_ia32_gp]
 #define FP &ia32_reg_classes[CLASS_ia32_fp]
@@ -137,8 +137,8 @@ static ir_node *create_immediate_or_transform(ir_node *node, char immediate_mode
 static ir_node *create_I2I_Conv(ir_mode *src_mode, dbg_info *dbgi, ir_node *block, ir_node *op);
 
 /* its enough to have those once */
-static ir_node *nomem;
-static ir_node *noreg_GP;
+static THREAD_LOCAL ir_node *nomem;
+static THREAD_LOCAL ir_node *noreg_GP;
 
 /** Return non-zero is a node represents the -1 constant. */
 static bool is_Const_Minus_1(ir_node *node)
@@ -257,6 +257,9 @@ static ir_node *try_create_Immediate(const ir_node *node, char const constraint)
 	return ia32_create_Immediate_full(irg, &immediate);
 }
 
+/** Guards the constant entities, which are shared by the functions. */
+static ir_mutex_t constants_mutex = IR_MUTEX_INITIALIZER;
+
 static ir_entity *create_float_const_entity(ir_tarval *tv, ident *name)
 {
 	ir_mode *mode = get_tarval_mode(tv);
@@ -275,10 +278,11 @@ static ir_entity *create_float_const_entity(ir_tarval *tv, ident *name)
 		}
 	}
 
+	ir_mutex_lock(&constants_mutex);
 	ir_entity *res = pmap_get(ir_entity, ia32_tv_ent, tv);
 	if (!res) {
 		if (!name)
-			name = id_unique("C");
+			name = be_get_tarval_ident("C", tv);
 
 		ir_type *const tp = get_type_for_mode(mode);
 		res = new_global_entity(get_glob_type(), name, tp,
@@ -290,6 +294,7 @@ static ir_entity *create_float_const_entity(ir_tarval *tv, ident *name)
 
 		pmap_insert(ia32_tv_ent, tv, res);
 	}
+	ir_mutex_unlock(&constants_mutex);
 	return res;
 }
 
@@ -456,9 +461,12 @@ static ir_type *ia32_create_float_array(ir_type *tp)
 		mode == ia32_mode_float32 ? &float_F :
 		mode == ia32_mode_float64 ? &float_D :
 		/*                       */ &float_E;
+	ir_mutex_lock(&constants_mutex);
 	if (!*arr)
 		*arr = new_type_array(tp, 2);
-	return *arr;
+	ir_type *const res = *arr;
+	ir_mutex_unlock(&constants_mutex);
+	return res;
 }
 
 /* Generates an entity for a known FP const (used for FP Neg + Abs) */
@@ -475,8 +483,10 @@ ir_entity *ia32_gen_fp_known_const(ia32_known_const_t const kct)
 		{ "C_dfp_abs",  "0x7FFFFFFFFFFFFFFF",  1 },
 		{ "C_ull_bias", "0x10000000000000000", 2 }
 	};
+	static ir_mutex_t cache_mutex = IR_MUTEX_INITIALIZER;
 	static ir_entity *ent_cache[ia32_known_const_max];
 
+	ir_mutex_lock(&cache_mutex);
 	ir_entity *ent = ent_cache[kct];
 
 	if (ent == NULL) {
@@ -511,8 +521,9 @@ ir_entity *ia32_gen_fp_known_const(ia32_known_const_t const kct)
 		/* cache the entry */
 		ent_cache[kct] = ent;
 	}
+	ir_mutex_unlock(&cache_mutex);
 
-	return ent_cache[kct];
+	return ent;
 }
 
 static ir_node *gen_Unknown(ir_node *node)
@@ -2785,13 +2796,13 @@ static ir_node *gen_Switch(ir_node *node)
 	if (get_mode_size_bits(sel_mode) < 32)
 		new_sel = transform_zext(sel);
 
+	ir_graph  *const irg   = get_irn_irg(node);
 	ir_type   *const utype = get_unknown_type();
 	ir_entity *const entity
-		= new_global_entity(irp->dummy_owner, id_unique("TBL"), utype,
-		                    ir_visibility_private,
+		= new_global_entity(irp->dummy_owner, be_new_irg_ident(irg, "TBL"),
+		                    utype, ir_visibility_private,
 		                    IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
 
-	ir_graph              *irg   = get_irn_irg(node);
 	const ir_switch_table *table = get_Switch_table(node);
 	table = ir_switch_table_duplicate(irg, table);
 
@@ -3165,8 +3176,9 @@ static ir_entity *ia32_create_const_array(ir_node *c0, ir_node *c1,
 	ir_type *tp = get_type_for_mode(mode);
 	tp = ia32_create_float_array(tp);
 
-	ir_entity *ent
-		= new_global_entity(get_glob_type(), id_unique("C"), tp,
+	ir_graph  *const irg = get_irn_irg(c0);
+	ir_entity *const ent
+		= new_global_entity(get_glob_type(), be_new_irg_ident(irg, "C"), tp,
 		                    ir_visibility_private,
 		                    IR_LINKAGE_CONSTANT | IR_LINKAGE_NO_IDENTITY);
 
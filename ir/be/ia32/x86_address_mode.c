@@ -25,7 +25,7 @@
 #include "irprintf.h"
 #include <inttypes.h>
 
-static bitset_t *non_address_mode_nodes;
+static THREAD_LOCAL bitset_t *non_address_mode_nodes;
 
 static bool tarval_possible(ir_tarval *tv)
 {
@@ -20,8 +20,9 @@
 #include "panic.h"
 #include "tv_t.h"
 #include <inttypes.h>
+#include <string.h>
 
-char const *x86_pic_base_label;
+THREAD_LOCAL char const *x86_pic_base_label;
 
 static bool check_immediate_constraint(long val, char immediate_constraint_type)
 {
@@ -162,3 +163,40 @@ void x86_emit_imm32(x86_imm32_t const *const imm)
 			be_emit_irprintf("%+"PRId32, offset);
 	}
 }
+
+void x86_enc_nops(char *buffer, unsigned size)
+{
+	memset(buffer, 0, size);
+	while (size > 0) {
+		switch (size) {
+		case 1: buffer[0] = 0x90; return;
+		case 2:
+			buffer[0] = 0x66;
+			++buffer;
+			--size;
+			continue;
+		case 3:
+		sequence_0f1f:
+			buffer[0] = 0x0F;
+			buffer[1] = 0x1F;
+			return;
+		case 4: buffer[2] = 0x40; goto sequence_0f1f;
+		case 5: buffer[2] = 0x44; goto sequence_0f1f;
+		case 6:
+			buffer[0] = 0x66;
+			++buffer;
+			--size;
+			continue;
+		case 7: buffer[2] = 0x80; goto sequence_0f1f;
+		case 8: buffer[2] = 0x84; goto sequence_0f1f;
+		default:
+			buffer[0] = 0x66;
+			buffer[1] = 0x0F;
+			buffer[2] = 0x1F;
+			buffer[3] = 0x84;
+			buffer += 9;
+			size   -= 9;
+			continue;
+		}
+	}
+}
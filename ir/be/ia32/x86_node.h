@@ -104,7 +104,7 @@ typedef struct x86_imm32_t {
 	ENUMBF(x86_immediate_kind_t) kind:8;
 } x86_imm32_t;
 
-extern char const *x86_pic_base_label;
+extern THREAD_LOCAL char const *x86_pic_base_label;
 
 static inline x86_condition_code_t x86_negate_condition_code(
 		x86_condition_code_t code)
@@ -154,6 +154,9 @@ void x86_emit_imm32(x86_imm32_t const *imm);
 void x86_emit_relocation_no_offset(x86_immediate_kind_t kind,
                                    ir_entity const *entity);
 
+/** Fill @p size bytes at @p buffer with (multi byte) nop instructions. */
+void x86_enc_nops(char *buffer, unsigned size);
+
 static inline bool x86_imm32_equal(x86_imm32_t const *const imm0,
 								   x86_imm32_t const *const imm1)
 {
@@ -43,7 +43,7 @@ ir_type *x86_type_E;
 
 #define N_X87_REGS  8
 
-static x87_simulator_config_t x87;
+static THREAD_LOCAL x87_simulator_config_t x87;
 
 static bool is_x87_req(arch_register_req_t const *const req)
 {
@@ -1488,8 +1488,8 @@ static void x87_simulate_block(x87_simulator *sim, ir_node *block)
 
 	sched_foreach_safe(block, n) {
 		const ir_op *op = get_irn_op(n);
-		if (op->ops.generic != NULL) {
-			sim_func func = (sim_func)op->ops.generic;
+		if (get_op_generic(op)->generic != NULL) {
+			sim_func func = (sim_func)get_op_generic(op)->generic;
 
 			/* simulate it */
 			func(state, n);
@@ -1527,8 +1527,8 @@ static void x87_simulate_block(x87_simulator *sim, ir_node *block)
 
 void x86_register_x87_sim(ir_op *op, sim_func func)
 {
-	assert(op->ops.generic == NULL);
-	op->ops.generic = (op_func)func;
+	assert(get_op_generic(op)->generic == NULL);
+	get_op_generic(op)->generic = (op_func)func;
 }
 
 void x86_prepare_x87_callbacks(void)
@@ -166,3 +166,9 @@ float_int_conversion_overflow_style_t ir_target_float_int_overflow_style(void)
 	assert(ir_target.isa_initialized);
 	return ir_target.float_int_overflow;
 }
+
+unsigned ir_target_vector_size(void)
+{
+	assert(ir_target.isa_initialized);
+	return ir_target.vector_size;
+}
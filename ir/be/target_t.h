@@ -16,11 +16,20 @@
 
 #define ir_target_big_endian()   ir_target_big_endian_()
 
+/**
+ * Returns whether the target can execute operation @p op on values of the
+ * vector mode @p mode.
+ */
+typedef bool (*vector_op_supported_func)(ir_op const *op, ir_mode const *mode);
+
 typedef struct target_info_t {
-	arch_isa_if_t   const *isa;
-	char const            *experimental;
-	arch_allow_ifconv_func allow_ifconv;
-	ir_mode               *mode_float_arithmetic;
+	arch_isa_if_t     const *isa;
+	char const              *experimental;
+	arch_allow_ifconv_func   allow_ifconv;
+	ir_mode                 *mode_float_arithmetic;
+	/** Size of the vector registers in bytes, 0 if there are none. */
+	unsigned                 vector_size;
+	vector_op_supported_func vector_op_supported;
 	bool isa_initialized          : 1;
 	bool fast_unaligned_memaccess : 1;
 	ENUMBF(float_int_conversion_overflow_style_t) float_int_overflow : 2;
@@ -18,11 +18,13 @@
 #include "debug.h"
 
 #include "hashptr.h"
+#include "irthread.h"
 #include "obst.h"
 #include "set.h"
 
 static struct obstack dbg_obst;
 static set *module_set;
+static ir_mutex_t module_mutex = IR_MUTEX_INITIALIZER;
 
 /**
  * A debug module.
@@ -61,10 +63,13 @@ firm_dbg_module_t *firm_dbg_register(const char *name)
   mod.name = name;
   mod.file = stderr;
 
+  ir_mutex_lock(&module_mutex);
   if (!module_set)
     firm_dbg_init();
 
-  return set_insert(firm_dbg_module_t, module_set, &mod, sizeof(mod), hash_str(name));
+  firm_dbg_module_t *res = set_insert(firm_dbg_module_t, module_set, &mod, sizeof(mod), hash_str(name));
+  ir_mutex_unlock(&module_mutex);
+  return res;
 }
 
 void firm_dbg_set_mask(firm_dbg_module_t *module, unsigned mask)
@@ -15,10 +15,12 @@
 #endif
 
 #include "be_t.h"
+#include "constbits.h"
 #include "debugger.h"
 #include "entity_t.h"
 #include "execfreq_t.h"
 #include "firm.h"
+#include "irargs_t.h"
 #include "ident_t.h"
 #include "ircons_t.h"
 #include "iredges_t.h"
@@ -57,6 +59,8 @@ void ir_init_library(void)
 	initialized = true;
 
 	firm_init_flags();
+	/* Create the printf environment before the backend threads share it. */
+	(void)firm_get_arg_env();
 	init_ident();
 	init_edges();
 	init_tarval_1();
@@ -74,6 +78,7 @@ void ir_init_library(void)
 	init_irprog_2();
 	firm_init_memory_disambiguator();
 	firm_init_loop_opt();
+	firm_init_constbits();
 
 	init_execfreq();
 	firm_be_init();
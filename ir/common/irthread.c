@@ -0,0 +1,62 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Threads and locks for processing graphs concurrently.
+ */
+#include "irthread.h"
+
+#include "panic.h"
+#include <sched.h>
+
+bool ir_threads_running;
+
+void ir_mutex_init(ir_mutex_t *mutex)
+{
+	pthread_mutex_init(mutex, NULL);
+}
+
+void ir_mutex_destroy(ir_mutex_t *mutex)
+{
+	pthread_mutex_destroy(mutex);
+}
+
+void ir_cond_init(ir_cond_t *cond)
+{
+	pthread_cond_init(cond, NULL);
+}
+
+void ir_cond_destroy(ir_cond_t *cond)
+{
+	pthread_cond_destroy(cond);
+}
+
+void ir_cond_wait(ir_cond_t *cond, ir_mutex_t *mutex)
+{
+	pthread_cond_wait(cond, mutex);
+}
+
+void ir_cond_broadcast(ir_cond_t *cond)
+{
+	pthread_cond_broadcast(cond);
+}
+
+void ir_thread_create(ir_thread_t *thread, void *(*func)(void *data),
+                      void *data)
+{
+	if (pthread_create(thread, NULL, func, data) != 0)
+		panic("could not create thread");
+}
+
+void ir_thread_join(ir_thread_t thread)
+{
+	pthread_join(thread, NULL);
+}
+
+void ir_thread_yield(void)
+{
+	sched_yield();
+}
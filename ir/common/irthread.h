@@ -0,0 +1,83 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Threads and locks for processing graphs concurrently.
+ */
+#ifndef FIRM_COMMON_IRTHREAD_H
+#define FIRM_COMMON_IRTHREAD_H
+
+#include <pthread.h>
+#include <stdbool.h>
+
+/**
+ * Set while worker threads are running. Tables shared by all graphs (tarvals,
+ * debug modules) are only locked then, so single-threaded users do not pay
+ * for the locks.
+ */
+extern bool ir_threads_running;
+
+typedef pthread_mutex_t ir_mutex_t;
+typedef pthread_cond_t  ir_cond_t;
+typedef pthread_t       ir_thread_t;
+
+#define IR_MUTEX_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+
+static inline void ir_mutex_lock(ir_mutex_t *mutex)
+{
+	if (ir_threads_running)
+		pthread_mutex_lock(mutex);
+}
+
+static inline void ir_mutex_unlock(ir_mutex_t *mutex)
+{
+	if (ir_threads_running)
+		pthread_mutex_unlock(mutex);
+}
+
+/** Reads @p *ptr, later reads see everything written before it was set. */
+#define ir_atomic_load(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+
+/** Sets @p *ptr, publishing everything written before. */
+#define ir_atomic_store(ptr, value) \
+	__atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+
+/**
+ * Sets @p *ptr to @p desired if it equals @p *expected. Otherwise stores the
+ * current value in @p *expected. Returns true on success.
+ */
+#define ir_atomic_cas(ptr, expected, desired) \
+	__atomic_compare_exchange_n((ptr), (expected), (desired), false, \
+	                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
+/** Increments @p counter atomically and returns its old value. */
+static inline long ir_atomic_fetch_inc(long *counter)
+{
+	return __atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+}
+
+void ir_mutex_init(ir_mutex_t *mutex);
+void ir_mutex_destroy(ir_mutex_t *mutex);
+
+void ir_cond_init(ir_cond_t *cond);
+void ir_cond_destroy(ir_cond_t *cond);
+void ir_cond_wait(ir_cond_t *cond, ir_mutex_t *mutex);
+void ir_cond_broadcast(ir_cond_t *cond);
+
+/**
+ * Starts a thread running @p func with @p data. Panics if the thread cannot
+ * be created.
+ */
+void ir_thread_create(ir_thread_t *thread, void *(*func)(void *data),
+                      void *data);
+
+/** Waits for a thread to finish. */
+void ir_thread_join(ir_thread_t thread);
+
+/** Lets other threads run before the calling one continues. */
+void ir_thread_yield(void);
+
+#endif
@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "compiler.h"
 #include "timing.h"
 #include "xmalloc.h"
 #include "panic.h"
@@ -54,8 +55,8 @@ struct ir_timer_t {
 	unsigned       running : 1; /**< set if this timer is running */
 };
 
-/** The top of the timer stack */
-static ir_timer_t *timer_stack;
+/** The top of the timer stack of the thread */
+static THREAD_LOCAL ir_timer_t *timer_stack;
 
 ir_timer_t *ir_timer_new(void)
 {
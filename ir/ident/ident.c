@@ -7,55 +7,257 @@
  * @file
  * @brief     Hash table to store names.
  * @author    Goetz Lindenmaier
+ *
+ * Names may be interned from several threads at once without locking. The
+ * table is split into shards by the high bits of the hash. Each shard is an
+ * open addressing table whose slots are claimed with compare-and-swap. A
+ * full table is frozen by marking its empty slots and copied into a table
+ * twice the size; threads running into a marked slot wait for the copy and
+ * retry there. The strings live in per-thread arenas and never move, so an
+ * ident stays a pointer to its string.
  */
 #include "ident_t.h"
 
+#include "compiler.h"
 #include "hashptr.h"
-#include "obst.h"
-#include "set.h"
+#include "irthread.h"
+#include "xmalloc.h"
+#include <assert.h>
+#include <limits.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
 
-static set *id_set;
+#define N_SHARD_BITS      6
+#define N_SHARDS          (1u << N_SHARD_BITS)
+#define INITIAL_SLOTS     64
+#define ARENA_CHUNK_SIZE  65536
 
-/** An obstack used for temporary space */
-static struct obstack id_obst;
+/** An interned string. The ident points to str. */
+typedef struct ident_entry_t {
+	unsigned hash;
+	size_t   len;
+	char     str[];
+} ident_entry_t;
+
+typedef struct ident_table_t ident_table_t;
+struct ident_table_t {
+	size_t          mask;      /**< number of slots - 1 */
+	long            n_entries;
+	ident_table_t  *next;      /**< set when the table gets copied */
+	ident_table_t  *prev;      /**< the table this one replaced */
+	ident_entry_t  *slots[];
+};
+
+/** Memory for entries, chunks of all threads are freed together. */
+typedef struct arena_chunk_t arena_chunk_t;
+struct arena_chunk_t {
+	arena_chunk_t *next;
+	size_t         padding;   /**< keeps data aligned for entries */
+	char           data[];
+};
+
+typedef struct ident_arena_t {
+	char     *next;
+	char     *end;
+	unsigned  generation;     /**< init_ident() round of the chunk */
+} ident_arena_t;
+
+static ident_table_t *shards[N_SHARDS];
+
+/** Marks the empty slots of a table being copied. */
+static ident_entry_t moved_marker;
+#define MOVED (&moved_marker)
+
+static arena_chunk_t *chunks;
+static unsigned       generation;
+
+static THREAD_LOCAL ident_arena_t arena;
+
+static ident_table_t *new_table(size_t n_slots)
+{
+	ident_table_t *table = (ident_table_t*)xmalloc(
+		sizeof(*table) + n_slots * sizeof(table->slots[0]));
+	table->mask      = n_slots - 1;
+	table->n_entries = 0;
+	table->next      = NULL;
+	table->prev      = NULL;
+	memset(table->slots, 0, n_slots * sizeof(table->slots[0]));
+	return table;
+}
 
 void init_ident(void)
 {
-	/* it's ok to use memcmp here, we check only strings */
-	id_set = new_set(memcmp, 128);
-	obstack_init(&id_obst);
+	++generation;
+	for (unsigned s = 0; s < N_SHARDS; ++s)
+		shards[s] = new_table(INITIAL_SLOTS);
 }
 
-ident *new_id_from_chars(const char *str, size_t len)
+static void push_chunk(arena_chunk_t *chunk)
 {
-	unsigned   hash   = hash_data((const unsigned char*)str, len);
-	set_entry *result = set_hinsert0(id_set, str, len, hash);
-	return (ident*)result->dptr;
+	arena_chunk_t *head = ir_atomic_load(&chunks);
+	do {
+		chunk->next = head;
+	} while (!ir_atomic_cas(&chunks, &head, chunk));
 }
 
-ident *new_id_from_str(const char *str)
+static size_t entry_size(size_t len)
 {
-	return new_id_from_chars(str, strlen(str));
+	size_t const align = sizeof(size_t);
+	size_t const size  = sizeof(ident_entry_t) + len + 1;
+	return (size + align - 1) & ~(align - 1);
 }
 
-static ident *new_ident_from_obst(struct obstack *const obst)
+static ident_entry_t *new_entry(char const *str, size_t len, unsigned hash)
 {
-	size_t const len    = obstack_object_size(obst);
-	char  *const string = (char*)obstack_finish(obst);
-	ident *const res    = new_id_from_chars(string, len);
-	obstack_free(obst, string);
-	return res;
+	size_t const size = entry_size(len);
+	char        *mem;
+	if (size > ARENA_CHUNK_SIZE / 4) {
+		/* do not waste the rest of the current chunk for long names */
+		arena_chunk_t *chunk = (arena_chunk_t*)xmalloc(sizeof(*chunk) + size);
+		push_chunk(chunk);
+		mem = chunk->data;
+	} else {
+		if (arena.generation != generation
+		    || (size_t)(arena.end - arena.next) < size) {
+			arena_chunk_t *chunk = (arena_chunk_t*)xmalloc(
+				sizeof(*chunk) + ARENA_CHUNK_SIZE);
+			push_chunk(chunk);
+			arena.next       = chunk->data;
+			arena.end        = chunk->data + ARENA_CHUNK_SIZE;
+			arena.generation = generation;
+		}
+		mem         = arena.next;
+		arena.next += size;
+	}
+
+	ident_entry_t *entry = (ident_entry_t*)mem;
+	entry->hash = hash;
+	entry->len  = len;
+	memcpy(entry->str, str, len);
+	entry->str[len] = '\0';
+	return entry;
+}
+
+/** Gives back an entry that lost the race against an equal one. */
+static void free_entry(ident_entry_t *entry)
+{
+	if ((char*)entry + entry_size(entry->len) == arena.next)
+		arena.next = (char*)entry;
+}
+
+static ident_table_t *wait_for_copy(unsigned shard, ident_table_t *table)
+{
+	ident_table_t *current;
+	while ((current = ir_atomic_load(&shards[shard])) == table)
+		ir_thread_yield();
+	return current;
+}
+
+/** Inserts an entry into a table not visible to other threads yet. */
+static void insert_copied(ident_table_t *table, ident_entry_t *entry)
+{
+	size_t i = entry->hash & table->mask;
+	for (size_t step = 1; table->slots[i] != NULL; ++step)
+		i = (i + step) & table->mask;
+	table->slots[i] = entry;
+	++table->n_entries;
+}
+
+/**
+ * Replaces a table by one twice the size. If another thread already copies
+ * the table, waits for it instead.
+ */
+static void grow_table(unsigned shard, ident_table_t *table)
+{
+	ident_table_t *next    = NULL;
+	ident_table_t *new_tab = new_table(2 * (table->mask + 1));
+	if (!ir_atomic_cas(&table->next, &next, new_tab)) {
+		free(new_tab);
+		wait_for_copy(shard, table);
+		return;
+	}
+
+	new_tab->prev = table;
+	for (size_t i = 0; i <= table->mask; ++i) {
+		ident_entry_t *entry = NULL;
+		if (!ir_atomic_cas(&table->slots[i], &entry, MOVED))
+			insert_copied(new_tab, entry);
+	}
+	ir_atomic_store(&shards[shard], new_tab);
+}
+
+static ident *intern_id(const char *str, size_t len)
+{
+	unsigned const hash  = hash_data((const unsigned char*)str, len);
+	unsigned const shard = hash >> (sizeof(hash) * CHAR_BIT - N_SHARD_BITS);
+	ident_entry_t *entry = NULL;
+	ident_table_t *table = ir_atomic_load(&shards[shard]);
+
+retry:;
+	size_t const mask = table->mask;
+	size_t       i    = hash & mask;
+	for (size_t step = 1;; i = (i + step++) & mask) {
+		if (step > mask + 1) {
+			/* the table filled up before it got copied */
+			grow_table(shard, table);
+			table = ir_atomic_load(&shards[shard]);
+			goto retry;
+		}
+
+		ident_entry_t *cur = ir_atomic_load(&table->slots[i]);
+		if (cur == NULL) {
+			if (entry == NULL)
+				entry = new_entry(str, len, hash);
+			if (ir_atomic_cas(&table->slots[i], &cur, entry)) {
+				long const n = ir_atomic_fetch_inc(&table->n_entries) + 1;
+				if ((size_t)n * 4 > (mask + 1) * 3)
+					grow_table(shard, table);
+				return entry->str;
+			}
+			/* another thread took the slot, cur is its entry now */
+		}
+		if (cur == MOVED) {
+			table = wait_for_copy(shard, table);
+			goto retry;
+		}
+		if (cur->hash == hash && cur->len == len
+		    && memcmp(cur->str, str, len) == 0) {
+			if (entry != NULL)
+				free_entry(entry);
+			return cur->str;
+		}
+	}
+}
+
+ident *new_id_from_chars(const char *str, size_t len)
+{
+	return intern_id(str, len);
+}
+
+ident *new_id_from_str(const char *str)
+{
+	return new_id_from_chars(str, strlen(str));
 }
 
 ident *new_id_fmt(char const *const fmt, ...)
 {
+	char    buf[128];
 	va_list ap;
 	va_start(ap, fmt);
-	obstack_vprintf(&id_obst, fmt, ap);
+	int const len = vsnprintf(buf, sizeof(buf), fmt, ap);
+	va_end(ap);
+	assert(len >= 0);
+	if ((size_t)len < sizeof(buf))
+		return intern_id(buf, len);
+
+	char *const str = XMALLOCN(char, len + 1);
+	va_start(ap, fmt);
+	vsnprintf(str, len + 1, fmt, ap);
 	va_end(ap);
-	return new_ident_from_obst(&id_obst);
+	ident *const res = intern_id(str, len);
+	free(str);
+	return res;
 }
 
 const char *(get_id_str)(ident *id)
@@ -65,13 +267,24 @@ const char *(get_id_str)(ident *id)
 
 void finish_ident(void)
 {
-	obstack_free(&id_obst, NULL);
-	del_set(id_set);
-	id_set = NULL;
+	for (unsigned s = 0; s < N_SHARDS; ++s) {
+		for (ident_table_t *table = shards[s], *prev; table != NULL;
+		     table = prev) {
+			prev = table->prev;
+			free(table);
+		}
+		shards[s] = NULL;
+	}
+	for (arena_chunk_t *chunk = chunks, *next; chunk != NULL; chunk = next) {
+		next = chunk->next;
+		free(chunk);
+	}
+	chunks = NULL;
 }
 
 ident *id_unique(const char *tag)
 {
-	static unsigned unique_id = 0;
-	return new_id_fmt("%s.%u", tag, unique_id++);
+	static long unique_id = 0;
+	long const nr = ir_atomic_fetch_inc(&unique_id);
+	return new_id_fmt("%s.%ld", tag, nr);
 }
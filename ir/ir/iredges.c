@@ -16,43 +16,20 @@
 
 #include "bitset.h"
 #include "debug.h"
-#include "hashptr.h"
 #include "irdump_t.h"
 #include "iredgekinds.h"
-#include "iredgeset.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
 #include "irnodemap.h"
 #include "iropt_t.h"
 #include "irprintf.h"
-#include "set.h"
-
-#define DO_REHASH
-#define SCALAR_RETURN
-#define HashSet                   ir_edgeset_t
-#define HashSetIterator           ir_edgeset_iterator_t
-#define ValueType                 ir_edge_t*
-#define NullValue                 NULL
-#define DeletedValue              ((ir_edge_t*)-1)
-#define Hash(this,key)            (hash_ptr(key->src) ^ (key->pos * 40013))
-#define KeysEqual(this,key1,key2) ((key1->src) == (key2->src) && (key1->pos == key2->pos))
-#define SetRangeEmpty(ptr,size)   memset(ptr, 0, (size) * sizeof((ptr)[0]))
-
-#define hashset_init            ir_edgeset_init
-void ir_edgeset_init_size(ir_edgeset_t *self, size_t size);
-#define hashset_init_size       ir_edgeset_init_size
-#define hashset_destroy         ir_edgeset_destroy
-#define hashset_insert          ir_edgeset_insert
-#define hashset_remove          ir_edgeset_remove
-ir_edge_t *ir_edgeset_find(const ir_edgeset_t *self, const ir_edge_t* key);
-#define hashset_find            ir_edgeset_find
-size_t ir_edgeset_size(const ir_edgeset_t *self);
-#define hashset_size            ir_edgeset_size
-#define hashset_iterator_init   ir_edgeset_iterator_init
-#define hashset_iterator_next   ir_edgeset_iterator_next
-#define hashset_remove_iterator ir_edgeset_remove_iterator
-
-#include "hashset.c.h"
+#include "util.h"
+#include <limits.h>
+
+/** Length of the first outs array of a node. */
+#define INITIAL_OUTS 4
+/** Marks an input without edge in the in_slots array. */
+#define NO_SLOT      UINT_MAX
 
 /**
  * A function that allows for setting an edge.
@@ -127,70 +104,87 @@ DEBUG_ONLY(static firm_dbg_module_t *dbg;)
  */
 static int edges_dbg = 0;
 
-/**
- * Returns an ID for the given edge.
- */
-static inline long edge_get_id(const ir_edge_t *e)
-{
-	return (long)e;
-}
-
 void edges_init_graph_kind(ir_graph *irg, ir_edge_kind_t kind)
 {
 	if (edges_activated_kind(irg, kind)) {
-		irg_edge_info_t *info   = get_irg_edge_info(irg, kind);
-		size_t           amount = get_irg_last_idx(irg) * 5 / 4;
+		irg_edge_info_t *info = get_irg_edge_info(irg, kind);
 
-		if (info->allocated) {
-			amount = ir_edgeset_size(&info->edges);
-			ir_edgeset_destroy(&info->edges);
+		if (info->allocated)
 			obstack_free(&info->edges_obst, NULL);
-		}
 		obstack_init(&info->edges_obst);
-		INIT_LIST_HEAD(&info->free_edges);
-		ir_edgeset_init_size(&info->edges, amount);
+		info->n_edges = 0;
+		/* the edge info of all nodes is outdated now */
+		++info->generation;
 		info->allocated = 1;
 	}
 }
 
 /**
- * Change the out count
- *
- * @param info  the edge info
- * @param ofs   amount to change the edge count
+ * Returns the edge info of a node. Info left over from an earlier
+ * activation of the edges is reset first.
  */
-static inline void edge_change_cnt(irn_edge_info_t *const info, int const ofs)
+static irn_edge_info_t *get_valid_info(ir_node *irn, ir_edge_kind_t kind,
+                                       irg_edge_info_t const *irg_info)
 {
-	assert((unsigned)info->out_count + ofs < 1U << 31);
-	info->out_count += ofs;
+	irn_edge_info_t *info = get_irn_edge_info(irn, kind);
+	if (info->generation != irg_info->generation)
+		*info = (irn_edge_info_t) { .generation = irg_info->generation };
+	return info;
 }
 
 /**
- * Verify the edge list of a node, i.e. ensure it's a loop:
- * head -> e_1 -> ... -> e_n -> head
+ * Returns the edge from input @p pos of @p src to @p tgt or NULL if there is
+ * none.
  */
-static inline void verify_list_head(ir_node *irn, ir_edge_kind_t kind)
-{
-	int                     num    = 0;
-	pset                   *lh_set = pset_new_ptr(16);
-	const struct list_head *head   = &get_irn_edge_info(irn, kind)->outs_head;
-	const struct list_head *pos;
-
-	list_for_each(pos, head) {
-		if (pset_find_ptr(lh_set, pos)) {
-			const ir_edge_t *edge = list_entry(pos, ir_edge_t, list);
-
-			ir_fprintf(stderr, "EDGE Verifier: edge list broken (self loop not to head) for %+F:\n", irn);
-			fprintf(stderr, "- at list entry %d\n", num);
-			if (edge->src)
-				ir_fprintf(stderr, "- edge(%ld) %+F(%d)\n", edge_get_id(edge), edge->src, edge->pos);
-			break;
+static ir_edge_t *find_edge(ir_node *src, int pos, ir_node *tgt,
+                            ir_edge_kind_t kind, irg_edge_info_t const *irg_info)
+{
+	irn_edge_info_t const *src_info = get_irn_edge_info(src, kind);
+	irn_edge_info_t const *tgt_info = get_irn_edge_info(tgt, kind);
+	if (src_info->generation != irg_info->generation
+	    || tgt_info->generation != irg_info->generation)
+		return NULL;
+
+	unsigned const slot = pos + 1;
+	if (slot >= src_info->n_in_slots)
+		return NULL;
+	unsigned const idx = src_info->in_slots[slot];
+	if (idx >= tgt_info->out_count)
+		return NULL;
+	ir_edge_t *edge = &tgt_info->outs[idx];
+	if (edge->src != src || edge->pos != pos)
+		return NULL;
+	return edge;
+}
+
+/**
+ * Verify the edge array of a node, i.e. ensure that each edge knows its
+ * index and is found from the input it belongs to.
+ */
+static bool verify_outs(ir_node *irn, ir_edge_kind_t kind)
+{
+	bool                   fine = true;
+	irn_edge_info_t const *info = get_irn_edge_info(irn, kind);
+	for (unsigned i = 0; i < info->out_count; ++i) {
+		ir_edge_t const       *edge     = &info->outs[i];
+		irn_edge_info_t const *src_info = get_irn_edge_info(edge->src, kind);
+		unsigned const         slot     = edge->pos + 1;
+		if (edge->idx != i || slot >= src_info->n_in_slots
+		    || src_info->in_slots[slot] != i) {
+			ir_fprintf(stderr, "EDGE Verifier: edge array broken for %+F:\n", irn);
+			ir_fprintf(stderr, "- edge %u %+F(%d)\n", i, edge->src, edge->pos);
+			fine = false;
 		}
-		num++;
-		pset_insert_ptr(lh_set, pos);
 	}
+	return fine;
+}
 
-	del_pset(lh_set);
+static void dump_outs(ir_node *irn, void *env)
+{
+	ir_edge_kind_t const kind = *(ir_edge_kind_t const*)env;
+	foreach_out_edge_kind(irn, e, kind) {
+		ir_printf("%+F %d\n", e->src, e->pos);
+	}
 }
 
 void edges_dump_kind(ir_graph *irg, ir_edge_kind_t kind)
@@ -198,13 +192,34 @@ void edges_dump_kind(ir_graph *irg, ir_edge_kind_t kind)
 	if (!edges_activated_kind(irg, kind))
 		return;
 
-	irg_edge_info_t       *info  = get_irg_edge_info(irg, kind);
-	ir_edgeset_t          *edges = &info->edges;
-	ir_edge_t             *e;
-	ir_edgeset_iterator_t  iter;
-	foreach_ir_edgeset(edges, e, iter) {
-		ir_printf("%+F %d\n", e->src, e->pos);
+	irg_walk_anchors(irg, dump_outs, NULL, &kind);
+}
+
+/**
+ * Appends the edge of input @p slot - 1 of the node with @p src_info to the
+ * outs of the node with @p tgt_info.
+ */
+static inline void append_edge(irn_edge_info_t *src_info, unsigned slot,
+                               irn_edge_info_t *tgt_info,
+                               irg_edge_info_t *info, ir_node *src)
+{
+	if (tgt_info->outs == NULL || tgt_info->out_count == tgt_info->outs_size) {
+		/* The old array is not freed, iterators may still look at it. */
+		unsigned size = tgt_info->outs == NULL ? tgt_info->outs_size
+		                                       : 2 * tgt_info->outs_size;
+		if (size < INITIAL_OUTS)
+			size = INITIAL_OUTS;
+		ir_edge_t *outs = OALLOCN(&info->edges_obst, ir_edge_t, size);
+		MEMCPY(outs, tgt_info->outs, tgt_info->out_count);
+		tgt_info->outs      = outs;
+		tgt_info->outs_size = size;
 	}
+
+	unsigned const idx = tgt_info->out_count++;
+	tgt_info->outs[idx] = (ir_edge_t) {
+		.src = src, .pos = (int)slot - 1, .idx = idx
+	};
+	src_info->in_slots[slot] = idx;
 }
 
 static void add_edge(ir_node *src, int pos, ir_node *tgt, ir_edge_kind_t kind,
@@ -213,34 +228,59 @@ static void add_edge(ir_node *src, int pos, ir_node *tgt, ir_edge_kind_t kind,
 	if (tgt == NULL)
 		return;
 	assert(edges_activated_kind(irg, kind));
-	irg_edge_info_t *info  = get_irg_edge_info(irg, kind);
-	ir_edgeset_t    *edges = &info->edges;
-
-	irn_edge_info_t  *tgt_info = get_irn_edge_info(tgt, kind);
-	struct list_head *head     = &tgt_info->outs_head;
-	assert(head->next && head->prev &&
-	       "target list head must have been initialized");
-
-	/* The old target was NULL, thus, the edge is newly created. */
-	ir_edge_t *edge;
-	if (list_empty(&info->free_edges)) {
-		edge = OALLOC(&info->edges_obst, ir_edge_t);
-	} else {
-		edge = list_entry(info->free_edges.next, ir_edge_t, list);
-		list_del(&edge->list);
+	irg_edge_info_t *info     = get_irg_edge_info(irg, kind);
+	irn_edge_info_t *tgt_info = get_valid_info(tgt, kind, info);
+	irn_edge_info_t *src_info = get_valid_info(src, kind, info);
+	assert(find_edge(src, pos, tgt, kind, info) == NULL);
+
+	unsigned const slot = pos + 1;
+	if (slot >= src_info->n_in_slots) {
+		unsigned n_slots = 2 * src_info->n_in_slots;
+		if (n_slots < (unsigned)get_irn_arity(src) + 1)
+			n_slots = get_irn_arity(src) + 1;
+		if (n_slots <= slot)
+			n_slots = slot + 1;
+		unsigned *in_slots = OALLOCN(&info->edges_obst, unsigned, n_slots);
+		MEMCPY(in_slots, src_info->in_slots, src_info->n_in_slots);
+		for (unsigned i = src_info->n_in_slots; i < n_slots; ++i)
+			in_slots[i] = NO_SLOT;
+		src_info->in_slots   = in_slots;
+		src_info->n_in_slots = n_slots;
 	}
 
-	edge->src     = src;
-	edge->pos     = pos;
-#ifdef DEBUG_libfirm
-	edge->present = false;
-#endif
+	append_edge(src_info, slot, tgt_info, info, src);
+	++info->n_edges;
+}
 
-	ir_edge_t *new_edge = ir_edgeset_insert(edges, edge);
-	assert(new_edge == edge);
+/**
+ * Takes an edge out of the out array of its target. The newest edge takes
+ * its place. The input slot of the edge is left to the caller.
+ */
+static inline void unlink_edge(ir_edge_t *edge, ir_node *tgt,
+                               ir_edge_kind_t kind)
+{
+	irn_edge_info_t *tgt_info = get_irn_edge_info(tgt, kind);
+	unsigned const   idx      = edge->idx;
+	unsigned const   last     = --tgt_info->out_count;
+	if (idx != last) {
+		ir_edge_t const *moved = &tgt_info->outs[last];
+		tgt_info->outs[idx] = (ir_edge_t) {
+			.src = moved->src, .pos = moved->pos, .idx = idx
+		};
+		get_irn_edge_info(moved->src, kind)->in_slots[moved->pos + 1] = idx;
+	}
+}
 
-	list_add(&new_edge->list, head);
-	edge_change_cnt(tgt_info, +1);
+/**
+ * Removes an edge from the out array of its target.
+ */
+static void remove_edge(ir_edge_t *edge, ir_node *tgt, ir_edge_kind_t kind,
+                        irg_edge_info_t *info)
+{
+	irn_edge_info_t *src_info = get_irn_edge_info(edge->src, kind);
+	src_info->in_slots[edge->pos + 1] = NO_SLOT;
+	unlink_edge(edge, tgt, kind);
+	--info->n_edges;
 }
 
 static void delete_edge(ir_node *src, int pos, ir_node *old_tgt,
@@ -250,28 +290,10 @@ static void delete_edge(ir_node *src, int pos, ir_node *old_tgt,
 		return;
 	assert(edges_activated_kind(irg, kind));
 
-	irg_edge_info_t *info  = get_irg_edge_info(irg, kind);
-	ir_edgeset_t    *edges = &info->edges;
-
-	/* Initialize the edge template to search in the set. */
-	ir_edge_t templ;
-	templ.src = src;
-	templ.pos = pos;
-
-	/* search the edge in the set. */
-	ir_edge_t *edge = ir_edgeset_find(edges, &templ);
-
-	/* mark the edge invalid if it was found */
-	if (edge == NULL)
-		return;
-
-	list_del(&edge->list);
-	ir_edgeset_remove(edges, edge);
-	list_add(&edge->list, &info->free_edges);
-	edge->pos = -2;
-	edge->src = NULL;
-	irn_edge_info_t *old_tgt_info = get_irn_edge_info(old_tgt, kind);
-	edge_change_cnt(old_tgt_info, -1);
+	irg_edge_info_t *info = get_irg_edge_info(irg, kind);
+	ir_edge_t       *edge = find_edge(src, pos, old_tgt, kind, info);
+	if (edge != NULL)
+		remove_edge(edge, old_tgt, kind, info);
 }
 
 static void edges_notify_edge_kind(ir_node *src, int pos, ir_node *tgt, ir_node *old_tgt, ir_edge_kind_t kind, ir_graph *irg)
@@ -289,38 +311,27 @@ static void edges_notify_edge_kind(ir_node *src, int pos, ir_node *tgt, ir_node
 	if (tgt == old_tgt)
 		return;
 
-	irg_edge_info_t *info  = get_irg_edge_info(irg, kind);
-	ir_edgeset_t    *edges = &info->edges;
-
-	/* The target is not NULL and the old target differs
-	 * from the new target, the edge shall be moved (if the
-	 * old target was != NULL) or added (if the old target was
-	 * NULL). */
-	irn_edge_info_t  *tgt_info = get_irn_edge_info(tgt, kind);
-	struct list_head *head     = &tgt_info->outs_head;
-	assert(head->next && head->prev &&
-	       "target list head must have been initialized");
-
-	/* Initialize the edge template to search in the set. */
-	ir_edge_t templ;
-	templ.src = src;
-	templ.pos = pos;
-
-	ir_edge_t *edge = ir_edgeset_find(edges, &templ);
+	/* The target is not NULL and the old target differs from the new target,
+	 * the edge shall be moved. */
+	irg_edge_info_t *info = get_irg_edge_info(irg, kind);
+	ir_edge_t       *edge = find_edge(src, pos, old_tgt, kind, info);
 	assert(edge && "edge to redirect not found!");
-
-	list_move(&edge->list, head);
-	irn_edge_info_t *old_tgt_info = get_irn_edge_info(old_tgt, kind);
-	edge_change_cnt(old_tgt_info, -1);
-	edge_change_cnt(tgt_info,     +1);
+	if (edge != NULL) {
+		/* The input slot exists already, so the edge is simply moved over
+		 * and the edge count stays the same. */
+		unlink_edge(edge, old_tgt, kind);
+		irn_edge_info_t *src_info = get_irn_edge_info(src, kind);
+		irn_edge_info_t *tgt_info = get_valid_info(tgt, kind, info);
+		append_edge(src_info, pos + 1, tgt_info, info, src);
+	} else {
+		add_edge(src, pos, tgt, kind, irg);
+	}
 
 #ifndef DEBUG_libfirm
-	/* verify list heads */
+	/* verify edge arrays */
 	if (edges_dbg) {
-		if (tgt)
-			verify_list_head(tgt, kind);
-		if (old_tgt)
-			verify_list_head(old_tgt, kind);
+		verify_outs(tgt, kind);
+		verify_outs(old_tgt, kind);
 	}
 #endif
 }
@@ -402,7 +413,8 @@ static void edges_node_revival_kind(ir_node *irn, ir_edge_kind_t kind)
 	if (!edges_activated_kind(irg, kind))
 		return;
 
-	irn_edge_info_t *info = get_irn_edge_info(irn, kind);
+	irn_edge_info_t *info
+		= get_valid_info(irn, kind, get_irg_edge_info(irg, kind));
 	if (info->edges_built)
 		return;
 
@@ -417,38 +429,53 @@ static void edges_node_revival_kind(ir_node *irn, ir_edge_kind_t kind)
 
 typedef struct build_walker {
 	ir_edge_kind_t kind;
-	bitset_t      *reachable;
+	ir_node      **nodes;  /**< The reachable nodes in walk order. */
 	bool           fine;
 } build_walker;
 
 /**
- * Post-Walker: notify all edges
+ * Post-Walker: count the edges of all targets and collect the nodes.
+ * Info of nodes without users is reset here, too, so they do not report
+ * edges of an earlier activation.
  */
-static void build_edges_walker(ir_node *irn, void *data)
+static void count_edges_walker(ir_node *irn, void *data)
 {
-	build_walker   *w    = (build_walker *)data;
-	ir_edge_kind_t  kind = w->kind;
-	ir_graph       *irg  = get_irn_irg(irn);
+	build_walker    *w    = (build_walker*)data;
+	ir_edge_kind_t   kind = w->kind;
+	irg_edge_info_t *info = get_irg_edge_info(get_irn_irg(irn), kind);
 
+	get_valid_info(irn, kind, info);
 	foreach_tgt(irn, i, n, kind) {
 		ir_node *pred = get_n(irn, i, kind);
-		add_edge(irn, i, pred, kind, irg);
+		if (pred != NULL)
+			++get_valid_info(pred, kind, info)->outs_size;
 	}
-	get_irn_edge_info(irn, kind)->edges_built = 1;
+	ARR_APP1(ir_node*, w->nodes, irn);
 }
 
 /**
- * Pre-Walker: initializes the list-heads and set the out-count
- * of all nodes to 0.
+ * Allocates the out arrays with the counted sizes and notifies all edges.
  */
-static void init_lh_walker(ir_node *irn, void *data)
+static void build_edges(ir_graph *irg, build_walker *w)
 {
-	build_walker   *w    = (build_walker*)data;
-	ir_edge_kind_t  kind = w->kind;
-	list_head      *head = &get_irn_edge_info(irn, kind)->outs_head;
-	INIT_LIST_HEAD(head);
-	get_irn_edge_info(irn, kind)->edges_built = 0;
-	get_irn_edge_info(irn, kind)->out_count   = 0;
+	ir_edge_kind_t   kind = w->kind;
+	irg_edge_info_t *info = get_irg_edge_info(irg, kind);
+
+	for (size_t i = 0, n = ARR_LEN(w->nodes); i < n; ++i) {
+		irn_edge_info_t *irn_info = get_irn_edge_info(w->nodes[i], kind);
+		if (irn_info->outs_size > 0) {
+			irn_info->outs = OALLOCN(&info->edges_obst, ir_edge_t,
+			                         irn_info->outs_size);
+		}
+	}
+	for (size_t i = 0, n = ARR_LEN(w->nodes); i < n; ++i) {
+		ir_node *irn = w->nodes[i];
+		foreach_tgt(irn, j, arity, kind) {
+			ir_node *pred = get_n(irn, j, kind);
+			add_edge(irn, j, pred, kind, irg);
+		}
+		get_irn_edge_info(irn, kind)->edges_built = 1;
+	}
 }
 
 void edges_activate_kind(ir_graph *irg, ir_edge_kind_t kind)
@@ -473,9 +500,12 @@ void edges_activate_kind(ir_graph *irg, ir_edge_kind_t kind)
 	 * - Manually iterate over the identities root set. This did not consume more memory
 	 *   but increase the computation time because the |identities| >= |V|
 	 *
-	 * Currently, we use the last option.
+	 * Currently, we use the first option: Each activation increments the
+	 * generation of the graph, and the edge info of a node from an older
+	 * generation is treated as empty. Revivaled nodes then build their
+	 * edges on demand.
 	 */
-	struct build_walker  w    = { .kind = kind };
+	struct build_walker  w    = { .kind = kind, .nodes = NEW_ARR_F(ir_node*, 0) };
 	irg_edge_info_t     *info = get_irg_edge_info(irg, kind);
 
 	assert(!info->activated);
@@ -483,12 +513,12 @@ void edges_activate_kind(ir_graph *irg, ir_edge_kind_t kind)
 	info->activated = 1;
 	edges_init_graph_kind(irg, kind);
 	if (kind == EDGE_KIND_BLOCK) {
-		visit_all_identities(irg, init_lh_walker, &w);
-		irg_block_walk_graph(irg, init_lh_walker, build_edges_walker, &w);
+		irg_block_walk_graph(irg, NULL, count_edges_walker, &w);
 	} else {
-		visit_all_identities(irg, init_lh_walker, &w);
-		irg_walk_anchors(irg, init_lh_walker, build_edges_walker, &w);
+		irg_walk_anchors(irg, NULL, count_edges_walker, &w);
 	}
+	build_edges(irg, &w);
+	DEL_ARR_F(w.nodes);
 }
 
 void edges_deactivate_kind(ir_graph *irg, ir_edge_kind_t kind)
@@ -498,7 +528,6 @@ void edges_deactivate_kind(ir_graph *irg, ir_edge_kind_t kind)
 	info->activated = 0;
 	if (info->allocated) {
 		obstack_free(&info->edges_obst, NULL);
-		ir_edgeset_destroy(&info->edges);
 		info->allocated = 0;
 	}
 	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
@@ -520,12 +549,14 @@ void edges_reroute_kind(ir_node *from, ir_node *to, ir_edge_kind_t kind)
 	set_edge_func_t *set_edge = edge_kind_info[kind].set_edge;
 
 	if (set_edge && edges_activated_kind(irg, kind)) {
-		struct list_head *head = &get_irn_edge_info(from, kind)->outs_head;
+		irn_edge_info_t *info
+			= get_valid_info(from, kind, get_irg_edge_info(irg, kind));
 
 		DBG((dbg, LEVEL_5, "reroute from %+F to %+F\n", from, to));
 
-		while (head != head->next) {
-			ir_edge_t *edge = list_entry(head->next, ir_edge_t, list);
+		/* taking the newest edge avoids moving the others */
+		while (info->out_count > 0) {
+			ir_edge_t const *edge = &info->outs[info->out_count - 1];
 			assert(edge->pos >= -1);
 			set_edge(edge->src, edge->pos, to);
 		}
@@ -549,21 +580,14 @@ void edges_reroute_except(ir_node *from, ir_node *to, ir_node *exception)
 
 static void verify_set_presence(ir_node *irn, void *data)
 {
-	build_walker *w     = (build_walker*)data;
-	ir_graph     *irg   = get_irn_irg(irn);
-	ir_edgeset_t *edges = &get_irg_edge_info(irg, w->kind)->edges;
+	build_walker    *w    = (build_walker*)data;
+	irg_edge_info_t *info = get_irg_edge_info(get_irn_irg(irn), w->kind);
 
 	foreach_tgt(irn, i, n, w->kind) {
-		ir_edge_t  templ = { .src = irn, .pos = i };
-		ir_edge_t *e     = ir_edgeset_find(edges, &templ);
-		ir_node   *dst   = get_n(irn, i, w->kind);
+		ir_node *dst = get_n(irn, i, w->kind);
 		if (dst == NULL)
 			continue;
-		if (e != NULL) {
-#ifdef DEBUG_libfirm
-			e->present = true;
-#endif
-		} else {
+		if (find_edge(irn, i, dst, w->kind, info) == NULL) {
 			w->fine = false;
 			ir_fprintf(stderr, "Edge Verifier: %+F,%d is missing\n",
 			           irn, i);
@@ -575,11 +599,12 @@ static void verify_list_presence(ir_node *irn, void *data)
 {
 	build_walker *w = (build_walker*)data;
 
-	bitset_set(w->reachable, get_irn_idx(irn));
-
-	/* check list heads */
-	verify_list_head(irn, w->kind);
+	/* check the edge array */
+	if (!verify_outs(irn, w->kind))
+		w->fine = false;
 
+	/* Each input has a single slot, so an edge not matching its input is
+	 * superfluous. */
 	foreach_out_edge_kind(irn, e, w->kind) {
 		if (w->kind == EDGE_KIND_NORMAL && get_irn_arity(e->src) <= e->pos) {
 			w->fine = false;
@@ -599,40 +624,14 @@ static void verify_list_presence(ir_node *irn, void *data)
 
 int edges_verify_kind(ir_graph *irg, ir_edge_kind_t kind)
 {
-	struct build_walker    w     = { .kind      = kind,
-	                                 .reachable = bitset_alloca(get_irg_last_idx(irg)),
-	                                 .fine      = true };
-
-#ifdef DEBUG_libfirm
-	ir_edgeset_t          *edges = &get_irg_edge_info(irg, kind)->edges;
-	ir_edge_t             *e;
-	ir_edgeset_iterator_t iter;
-	/* Clear the present bit in all edges available. */
-	foreach_ir_edgeset(edges, e, iter) {
-		e->present = false;
-	}
-#endif
+	struct build_walker w = { .kind = kind, .fine = true };
 
 	irg_walk_graph(irg, verify_set_presence, verify_list_presence, &w);
 
-#ifdef DEBUG_libfirm
-	/*
-	 * Dump all edges which are not invalid and not present.
-	 * These edges are superfluous and their presence in the
-	 * edge set is wrong.
-	 */
-	foreach_ir_edgeset(edges, e, iter) {
-		if (! e->present && bitset_is_set(w.reachable, get_irn_idx(e->src))) {
-			w.fine = false;
-			ir_fprintf(stderr, "Edge Verifier: edge(%ld) %+F,%d is superfluous\n", edge_get_id(e), e->src, e->pos);
-		}
-	}
-#endif
-
 	return w.fine;
 }
 
-static ir_nodemap usermap;
+static THREAD_LOCAL ir_nodemap usermap;
 
 /**
  * Initializes the user node map for each node.
@@ -674,12 +673,10 @@ static void verify_edge_counter(ir_node *irn, void *env)
 	bitset_t *bs       = ir_nodemap_get(bitset_t, &usermap, irn);
 	int       list_cnt = 0;
 	int       edge_cnt = get_irn_edge_info(irn, EDGE_KIND_NORMAL)->out_count;
-	const struct list_head *head
-		= &get_irn_edge_info(irn, EDGE_KIND_NORMAL)->outs_head;
 
-	/* We can iterate safely here, list heads have already been verified. */
-	const struct list_head *pos;
-	list_for_each(pos, head) {
+	/* We can iterate safely here, edge arrays have already been verified. */
+	foreach_out_edge(irn, edge) {
+		(void)edge;
 		++list_cnt;
 	}
 
@@ -766,6 +763,53 @@ void assure_edges_kind(ir_graph *irg, ir_edge_kind_t kind)
 		edges_activate_kind(irg, kind);
 }
 
+/**
+ * Copies the edge arrays of a graph to a new obstack, if outgrown arrays
+ * take most of the memory.
+ */
+static void edges_compact_kind(ir_graph *irg, ir_edge_kind_t kind)
+{
+	irg_edge_info_t *info = get_irg_edge_info(irg, kind);
+	if (!info->activated)
+		return;
+	size_t const live = info->n_edges * (sizeof(ir_edge_t) + sizeof(unsigned));
+	if ((size_t)obstack_memory_used(&info->edges_obst) <= 3 * live + 65536)
+		return;
+
+	struct obstack obst;
+	obstack_init(&obst);
+	for (unsigned i = 0, n = get_irg_last_idx(irg); i < n; ++i) {
+		ir_node *irn = get_idx_irn(irg, i);
+		if (irn == NULL)
+			continue;
+		irn_edge_info_t *irn_info = get_irn_edge_info(irn, kind);
+		if (irn_info->generation != info->generation)
+			continue;
+
+		ir_edge_t *outs = NULL;
+		if (irn_info->out_count > 0) {
+			outs = OALLOCN(&obst, ir_edge_t, irn_info->out_count);
+			MEMCPY(outs, irn_info->outs, irn_info->out_count);
+		}
+		irn_info->outs      = outs;
+		irn_info->outs_size = irn_info->out_count;
+
+		if (irn_info->n_in_slots > 0) {
+			unsigned *in_slots = OALLOCN(&obst, unsigned, irn_info->n_in_slots);
+			MEMCPY(in_slots, irn_info->in_slots, irn_info->n_in_slots);
+			irn_info->in_slots = in_slots;
+		}
+	}
+	obstack_free(&info->edges_obst, NULL);
+	info->edges_obst = obst;
+}
+
+void edges_compact(ir_graph *irg)
+{
+	edges_compact_kind(irg, EDGE_KIND_NORMAL);
+	edges_compact_kind(irg, EDGE_KIND_BLOCK);
+}
+
 void edges_node_deleted(ir_node *irn)
 {
 	edges_node_deleted_kind(irn, EDGE_KIND_NORMAL);
@@ -14,9 +14,6 @@
 
 #include <stdbool.h>
 
-#include "set.h"
-#include "list.h"
-
 #include "irnode_t.h"
 #include "irgraph_t.h"
 
@@ -33,15 +30,12 @@
 #define get_block_succ_next(irn, last)    get_irn_out_edge_next_(irn, last, EDGE_KIND_BLOCK)
 
 /**
- * An edge.
+ * An edge. It lives in the outs array of its target.
  */
 struct ir_edge_t {
-	ir_node *src;         /**< The source node of the edge. */
-	int      pos;         /**< The position of the edge at @p src. */
-#ifdef DEBUG_libfirm
-	bool     present : 1; /**< Used by the verifier. */
-#endif
-	struct list_head list;  /**< The list head to queue all out edges at a node. */
+	ir_node  *src;  /**< The source node of the edge. */
+	int       pos;  /**< The position of the edge at @p src. */
+	unsigned  idx;  /**< The index of the edge in the outs array. */
 };
 
 /** Accessor for private irn info. */
@@ -49,14 +43,14 @@ static inline irn_edge_info_t *get_irn_edge_info(ir_node *node,
                                                  ir_edge_kind_t kind)
 {
 	assert(edges_activated_kind(get_irn_irg(node), kind));
-	return &node->edge_info[kind];
+	return &node->cold->edge_info[kind];
 }
 
 static inline const irn_edge_info_t *get_irn_edge_info_const(
 		const ir_node *node, ir_edge_kind_t kind)
 {
 	assert(edges_activated_kind(get_irn_irg(node), kind));
-	return &node->edge_info[kind];
+	return &node->cold->edge_info[kind];
 }
 
 /** Accessor for private irg info. */
@@ -82,22 +76,30 @@ static inline const irg_edge_info_t *get_irg_edge_info_const(
  */
 static inline const ir_edge_t *get_irn_out_edge_first_kind_(const ir_node *irn, ir_edge_kind_t kind)
 {
-	struct list_head const *const head = &get_irn_edge_info_const(irn, kind)->outs_head;
-	return list_empty(head) ? NULL : list_entry(head->next, ir_edge_t, list);
+	irn_edge_info_t const *const info = get_irn_edge_info_const(irn, kind);
+	return info->out_count == 0 ? NULL : &info->outs[info->out_count - 1];
 }
 
 /**
  * Get the next edge in the out list of some node.
+ * The edges are visited from the newest to the oldest. Removing the current
+ * edge moves the newest edge into its place, which was visited already, and
+ * edges added meanwhile are not visited. Arrays replaced by larger ones stay
+ * readable until the edges get deactivated or compacted, so @p last stays
+ * valid.
  * @param irn The node.
  * @param last The last out edge you have seen.
  * @return The next out edge in @p irn 's out list after @p last.
  */
 static inline const ir_edge_t *get_irn_out_edge_next_(const ir_node *irn, const ir_edge_t *last, ir_edge_kind_t kind)
 {
-	struct list_head *next = last->list.next;
-	const struct list_head *head
-		= &get_irn_edge_info_const(irn, kind)->outs_head;
-	return next == head ? NULL : list_entry(next, ir_edge_t, list);
+	unsigned const idx = last->idx;
+	if (idx == 0)
+		return NULL;
+	irn_edge_info_t const *const info = get_irn_edge_info_const(irn, kind);
+	/* edges after the current one may have been removed meanwhile */
+	unsigned const next = idx <= info->out_count ? idx - 1 : info->out_count - 1;
+	return info->out_count == 0 ? NULL : &info->outs[next];
 }
 
 /**
@@ -133,6 +135,12 @@ static inline void edges_assure_kind_(ir_graph *irg, ir_edge_kind_t kind)
 
 void edges_init_graph_kind(ir_graph *irg, ir_edge_kind_t kind);
 
+/**
+ * Frees the memory of outgrown edge arrays, if they take most of the memory
+ * of the edges. Iterators over out edges must not be alive.
+ */
+void edges_compact(ir_graph *irg);
+
 void edges_node_deleted(ir_node *irn);
 
 /**
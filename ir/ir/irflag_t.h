@@ -11,6 +11,7 @@
 #ifndef FIRM_IR_IRFLAG_T_H
 #define FIRM_IR_IRFLAG_T_H
 
+#include "compiler.h"
 #include "irflag.h"
 
 #define get_opt_cse()                      get_opt_cse_()
@@ -29,7 +30,8 @@ typedef enum {
 #undef FLAG
 } libfirm_opts_t;
 
-extern optimization_state_t libFIRM_opt;
+/** The flags are per thread, passes toggle them while optimizing a graph. */
+extern THREAD_LOCAL optimization_state_t libFIRM_opt;
 
 /** initialises the flags */
 void firm_init_flags(void);
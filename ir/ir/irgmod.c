@@ -12,6 +12,7 @@
 
 #include "array.h"
 #include "ircons.h"
+#include "irdom.h"
 #include "iredges_t.h"
 #include "irflag_t.h"
 #include "irgraph_t.h"
@@ -270,6 +271,8 @@ void part_block(ir_node *node)
 	if (old_block == get_irg_start_block(irg))
 		update_startblock(old_block, new_block);
 
+	dom_insert_block(new_block, old_block);
+
 	set_optimize(rem_opt);
 }
 
@@ -25,6 +25,7 @@
 #include "iroptimize.h"
 #include "irouts.h"
 #include "irprog_t.h"
+#include "irthread.h"
 #include "irtools.h"
 #include "type_t.h"
 #include "util.h"
@@ -77,6 +78,8 @@ static void free_graph(ir_graph *irg)
 	for (ir_edge_kind_t i = EDGE_KIND_FIRST; i <= EDGE_KIND_LAST; ++i)
 		edges_deactivate_kind(irg, i);
 	DEL_ARR_F(irg->idx_irn_map);
+	if (irg->walk_stack != NULL)
+		DEL_ARR_F(irg->walk_stack);
 	free(irg);
 }
 
@@ -161,6 +164,42 @@ ir_graph *new_ir_graph(ir_entity *ent, int n_loc)
 	return res;
 }
 
+static ir_graph *alloc_stub(ir_entity *ent, ir_lazy_irg_t *lazy)
+{
+	ir_graph *const res = XMALLOCZ(ir_graph);
+	res->kind    = k_ir_graph;
+	res->ent     = ent;
+	res->lazy    = lazy;
+	res->is_stub = true;
+	set_entity_irg(ent, res);
+	++irp->n_stub_irgs;
+	return res;
+}
+
+ir_graph *new_ir_graph_stub(ir_entity *ent, ir_lazy_irg_t *lazy)
+{
+	ir_graph *const res = alloc_stub(ent, lazy);
+	add_irp_irg(res);
+	return res;
+}
+
+void release_irg(ir_graph *irg)
+{
+	assert(!irg->is_stub && irg->lazy != NULL);
+	ir_entity *const ent  = irg->ent;
+	ir_graph  *const stub = alloc_stub(ent, irg->lazy);
+	for (size_t i = 0, n = get_irp_n_irgs(); i < n; ++i) {
+		if (get_irp_irg_or_stub(i) == irg) {
+			set_irp_irg(i, stub);
+			break;
+		}
+	}
+	/* the stub owns the file section now */
+	irg->lazy = NULL;
+	free_ir_graph(irg);
+	set_entity_irg(ent, stub);
+}
+
 ir_graph *new_const_code_irg(void)
 {
 	ir_graph *const res = new_r_ir_graph(NULL, 0);
@@ -272,6 +311,14 @@ void free_ir_graph(ir_graph *irg)
 	assert(irg->kind == k_ir_graph);
 
 	remove_irp_irg(irg);
+	if (irg->lazy != NULL)
+		free_lazy_irg(irg->lazy);
+	if (irg->is_stub) {
+		--irp->n_stub_irgs;
+		set_entity_irg(irg->ent, NULL);
+		free(irg);
+		return;
+	}
 	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_NONE);
 
 	free_irg_outs(irg);
@@ -457,25 +504,31 @@ ir_visited_t (get_irg_visited)(const ir_graph *irg)
 /** maximum visited flag content of all ir_graph visited fields. */
 static ir_visited_t max_irg_visited = 0;
 
+/** Raises max_irg_visited to the visited counter of @p irg. Graphs may be
+ * walked by several threads at once. */
+static void update_max_irg_visited(ir_graph const *const irg)
+{
+	ir_visited_t max = ir_atomic_load(&max_irg_visited);
+	while (irg->visited > max
+	       && !ir_atomic_cas(&max_irg_visited, &max, irg->visited)) {
+	}
+}
+
 void set_irg_visited(ir_graph *irg, ir_visited_t visited)
 {
 	irg->visited = visited;
-	if (irg->visited > max_irg_visited) {
-		max_irg_visited = irg->visited;
-	}
+	update_max_irg_visited(irg);
 }
 
 void inc_irg_visited(ir_graph *irg)
 {
 	++irg->visited;
-	if (irg->visited > max_irg_visited) {
-		max_irg_visited = irg->visited;
-	}
+	update_max_irg_visited(irg);
 }
 
 ir_visited_t get_max_irg_visited(void)
 {
-	return max_irg_visited;
+	return ir_atomic_load(&max_irg_visited);
 }
 
 void set_max_irg_visited(int val)
@@ -544,6 +597,19 @@ unsigned get_irg_last_idx(const ir_graph *irg)
 	return irg->last_node_idx;
 }
 
+size_t get_irg_memory_used(ir_graph *irg)
+{
+	size_t used = obstack_memory_used(&irg->obst);
+	if (irg->out_obst_allocated)
+		used += obstack_memory_used(&irg->out_obst);
+	for (ir_edge_kind_t kind = EDGE_KIND_FIRST; kind <= EDGE_KIND_LAST; ++kind) {
+		irg_edge_info_t *const info = &irg->edge_info[kind];
+		if (info->allocated)
+			used += obstack_memory_used(&info->edges_obst);
+	}
+	return used;
+}
+
 void add_irg_constraints(ir_graph *irg, ir_graph_constraints_t constraints)
 {
 	irg->constraints |= constraints;
@@ -609,10 +675,14 @@ void confirm_irg_properties(ir_graph *irg, ir_graph_properties_t props)
 	clear_irg_properties(irg, ~props);
 	if (!(props & IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES))
 		edges_deactivate(irg);
+	else
+		edges_compact(irg);
 	if (!(props & IR_GRAPH_PROPERTY_CONSISTENT_OUTS)
 	    && (irg->properties & IR_GRAPH_PROPERTY_CONSISTENT_OUTS))
 	    free_irg_outs(irg);
-	if (!(props & IR_GRAPH_PROPERTY_CONSISTENT_ENTITY_USAGE))
+	/* the pass pipeline invalidates the global usage after its workers */
+	if (!(props & IR_GRAPH_PROPERTY_CONSISTENT_ENTITY_USAGE)
+	    && !ir_threads_running)
 		set_irp_globals_entity_usage_state(ir_entity_usage_not_computed);
 	if (!(props & IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE_FRONTIERS))
 		ir_free_dominance_frontiers(irg);
@@ -16,10 +16,10 @@
 #include "entity_t.h"
 #include "firm_types.h"
 #include "iredgekinds.h"
-#include "iredgeset.h"
 #include "irloop.h"
 #include "irnodemap.h"
 #include "irprog.h"
+#include "irvaluetable.h"
 #include "list.h"
 #include "obst.h"
 #include "pset.h"
@@ -73,9 +73,9 @@
  * Edge info to put into an irg.
  */
 typedef struct irg_edge_info_t {
-	ir_edgeset_t     edges;          /**< A set containing all edges of the current graph. */
-	struct list_head free_edges;     /**< list of all free edges. */
 	struct obstack   edges_obst;     /**< Obstack, where edges are allocated on. */
+	size_t           n_edges;        /**< Number of edges of the graph. */
+	unsigned         generation;     /**< Incremented on each activation. */
 	unsigned         allocated : 1;  /**< Set if edges are allocated on the obstack. */
 	unsigned         activated : 1;  /**< Set if edges are activated for the graph. */
 } irg_edge_info_t;
@@ -99,6 +99,17 @@ typedef struct ir_vrp_info {
 	struct obstack    obst;
 } ir_vrp_info;
 
+/**
+ * A node on the explicit stack of the graph walkers.
+ */
+typedef struct irg_walk_frame_t {
+	ir_node *node;
+	int      pos;  /**< Next predecessor to visit, see irgwalk.c. */
+} irg_walk_frame_t;
+
+/** A graph stored in a file, see irio.c. */
+typedef struct ir_lazy_irg_t ir_lazy_irg_t;
+
 /**
  * An ir_graph represents the code of a function as a graph of nodes.
  */
@@ -124,6 +135,8 @@ struct ir_graph {
 	ir_visited_t     block_visited; /**< Visited flag for block nodes. */
 	ir_visited_t     self_visited;  /**< Visited flag of the irg */
 	ir_node        **idx_irn_map;   /**< Map of node indexes to nodes. */
+	/** Reusable stack of the graph walkers (flexible array). */
+	irg_walk_frame_t *walk_stack;
 	size_t           index;         /**< a unique number for each graph */
 	/** A void* field to link any information to the graph. */
 	void            *link;
@@ -138,13 +151,16 @@ struct ir_graph {
 	ir_node *current_block;    /**< Block for new_*()ly created nodes. */
 
 	/** Hash table for global value numbering (CSE) */
-	pset               *value_table;
+	ir_valuetable_t    *value_table;
 	struct obstack      out_obst;    /**< Space for the Def-Use arrays. */
 	bool                out_obst_allocated;
 	ir_bitinfo          bitinfo;     /**< bit info */
 	ir_vrp_info         vrp;         /**< vrp info */
 	ir_loop            *loop;        /**< The outermost loop for this graph. */
 	ir_dom_front_info_t domfront;    /**< dominance frontier analysis data */
+	/** The dominator tree was changed by an incremental update since its
+	 * tree pre-order numbers were assigned. */
+	bool                dom_tree_changed;
 	irg_edges_info_t    edge_info;   /**< edge info for automatic outs */
 	ir_graph          **callers;     /**< Callgraph: list of callers. */
 	unsigned           *caller_isbe; /**< Callgraph: bitset if backedge info is
@@ -153,6 +169,10 @@ struct ir_graph {
 	unsigned           *callee_isbe; /**< Callgraph: bitset if backedge info is
 	                                      calculated. */
 	ir_loop            *l;           /**< For callgraph analysis. */
+	/** The file section the graph is read from, if it is imported lazily. */
+	ir_lazy_irg_t      *lazy;
+	/** The graph has no nodes yet and is read from lazy on first access. */
+	bool                is_stub;
 
 #ifdef DEBUG_libfirm
 	/** Unique graph number for each graph to make output readable. */
@@ -177,6 +197,24 @@ struct ir_graph {
  */
 void irg_set_nloc(ir_graph *res, int n_loc);
 
+/**
+ * Creates a stub graph for a method entity. The stub is placed in the
+ * graph list of the irp and set as the graph of the entity, and is replaced
+ * by the graph read from @p lazy when get_irp_irg() or get_entity_irg()
+ * return it the first time.
+ */
+ir_graph *new_ir_graph_stub(ir_entity *ent, ir_lazy_irg_t *lazy);
+
+/**
+ * Turns a graph read from a file back into a stub, freeing its nodes.
+ * Another access reads the graph again from the file, without the changes
+ * made to it since.
+ */
+void release_irg(ir_graph *irg);
+
+/** Frees the file section of a graph when the last graph using it is gone. */
+void free_lazy_irg(ir_lazy_irg_t *lazy);
+
 /**
  * Make a rudimentary ir graph for the constant code.
  * Must look like a correct irg, spare everything else.
@@ -468,7 +506,12 @@ static inline void irg_kill_node(ir_graph *irg, ir_node *n)
 	if (idx + 1 == irg->last_node_idx)
 		--irg->last_node_idx;
 	irg->idx_irn_map[idx] = NULL;
-	obstack_free(&irg->obst, n);
+	/* also free the in array if the node is stored behind it */
+	ir_node **const in = n->in;
+	if ((char*)&in[ARR_LEN(in)] == (char*)n)
+		obstack_free(&irg->obst, ARR_DESCR(in));
+	else
+		obstack_free(&irg->obst, n);
 }
 
 /**
@@ -26,50 +26,125 @@
 #include "pset_new.h"
 #include <stdlib.h>
 
+static irg_walk_mode_t walk_mode = irg_walk_mode_default;
+
+void set_irg_walk_mode(irg_walk_mode_t mode)
+{
+	walk_mode = mode;
+}
+
+irg_walk_mode_t get_irg_walk_mode(void)
+{
+	return walk_mode;
+}
+
+/* Values of irg_walk_frame_t.pos before the predecessors are counted down. */
+#define WALK_POS_BLOCK -2 /**< The block of the node is visited next. */
+#define WALK_POS_INS   -1 /**< The arity has not been read yet. */
+
 /**
- * specialized version of irg_walk_2, called if only pre callback exists
+ * Takes the walker stack of @p irg. A nested walk over the same graph does
+ * not find it and allocates its own.
  */
-static void irg_walk_2_pre(ir_node *node, irg_walk_func *pre, void *env)
+static irg_walk_frame_t *acquire_walk_stack(ir_graph *irg)
 {
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
+	irg_walk_frame_t *stack = irg->walk_stack;
+	if (stack == NULL)
+		return NEW_ARR_F(irg_walk_frame_t, 64);
+	irg->walk_stack = NULL;
+	return stack;
+}
 
-	pre(node, env);
+static void release_walk_stack(ir_graph *irg, irg_walk_frame_t *stack)
+{
+	if (irg->walk_stack == NULL)
+		irg->walk_stack = stack;
+	else
+		DEL_ARR_F(stack);
+}
 
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_2_pre(pred, pre, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_2_pre(pred, pre, env);
+static inline void prefetch_preds(ir_node const *node)
+{
+#ifdef __GNUC__
+	foreach_irn_in(node, i, pred) {
+		__builtin_prefetch(pred);
 	}
+#else
+	(void)node;
+#endif
 }
 
 /**
- * specialized version of irg_walk_2, called if only post callback exists
+ * Depth first walk with an explicit stack. Visits the nodes in the same
+ * order as a recursion that descends into the block first and then into the
+ * operands from last to first: The block and the operands are read only when
+ * the walk gets to them, so callbacks may still change them on the way.
  */
-static void irg_walk_2_post(ir_node *node, irg_walk_func *post, void *env)
+static inline void irg_walk_iterative(ir_node *node, irg_walk_func *pre,
+                                      irg_walk_func *post, void *env)
 {
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
+	ir_graph         *const irg      = get_irn_irg(node);
+	ir_visited_t      const visited  = irg->visited;
+	bool              const prefetch = walk_mode == irg_walk_mode_prefetch;
+	irg_walk_frame_t       *stack    = acquire_walk_stack(irg);
+	size_t                  n_frames = 0;
+
+	ir_node *next = node;
+	for (;;) {
+		if (next != NULL) {
+			set_irn_visited(next, visited);
+			if (pre != NULL)
+				pre(next, env);
+			if (prefetch)
+				prefetch_preds(next);
+
+			if (n_frames == ARR_LEN(stack))
+				ARR_RESIZE(irg_walk_frame_t, stack, 2 * n_frames);
+			irg_walk_frame_t *const frame = &stack[n_frames++];
+			frame->node = next;
+			frame->pos  = is_Block(next) ? WALK_POS_INS : WALK_POS_BLOCK;
+		}
 
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_2_post(pred, post, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_2_post(pred, post, env);
+		if (n_frames == 0)
+			break;
+
+		irg_walk_frame_t *const frame = &stack[n_frames - 1];
+		ir_node          *pred;
+		if (frame->pos == WALK_POS_BLOCK) {
+			frame->pos = WALK_POS_INS;
+			pred       = get_nodes_block(frame->node);
+		} else {
+			if (frame->pos == WALK_POS_INS)
+				frame->pos = get_irn_arity(frame->node);
+			if (frame->pos == 0) {
+				--n_frames;
+				if (post != NULL)
+					post(frame->node, env);
+				next = NULL;
+				continue;
+			}
+			pred = get_irn_n(frame->node, --frame->pos);
+		}
+		next = pred->visited < visited ? pred : NULL;
 	}
 
-	post(node, env);
+	release_walk_stack(irg, stack);
+}
+
+/**
+ * specialized version of irg_walk_2, called if only pre callback exists
+ */
+static void irg_walk_2_pre(ir_node *node, irg_walk_func *pre, void *env)
+{
+	irg_walk_iterative(node, pre, NULL, env);
+}
+
+/**
+ * specialized version of irg_walk_2, called if only post callback exists
+ */
+static void irg_walk_2_post(ir_node *node, irg_walk_func *post, void *env)
+{
+	irg_walk_iterative(node, NULL, post, env);
 }
 
 /**
@@ -78,24 +153,7 @@ static void irg_walk_2_post(ir_node *node, irg_walk_func *post, void *env)
 static void irg_walk_2_both(ir_node *node, irg_walk_func *pre,
                                 irg_walk_func *post, void *env)
 {
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
-
-	pre(node, env);
-
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_2_both(pred, pre, post, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_2_both(pred, pre, post, env);
-	}
-
-	post(node, env);
+	irg_walk_iterative(node, pre, post, env);
 }
 
 void irg_walk_2(ir_node *node, irg_walk_func *pre, irg_walk_func *post,
@@ -145,22 +203,7 @@ void all_irg_walk(irg_walk_func *pre, irg_walk_func *post, void *env)
 static void irg_walk_in_or_dep_2_pre(ir_node *node, irg_walk_func *pre,
                                      void *env)
 {
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
-
-	pre(node, env);
-
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_pre(pred, pre, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_pre(pred, pre, env);
-	}
+	irg_walk_iterative(node, pre, NULL, env);
 }
 
 /**
@@ -169,22 +212,7 @@ static void irg_walk_in_or_dep_2_pre(ir_node *node, irg_walk_func *pre,
 static void irg_walk_in_or_dep_2_post(ir_node *node, irg_walk_func *post,
                                       void *env)
 {
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
-
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_post(pred, post, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_post(pred, post, env);
-	}
-
-	post(node, env);
+	irg_walk_iterative(node, NULL, post, env);
 }
 
 /**
@@ -193,24 +221,7 @@ static void irg_walk_in_or_dep_2_post(ir_node *node, irg_walk_func *post,
 static void irg_walk_in_or_dep_2_both(ir_node *node, irg_walk_func *pre,
                                       irg_walk_func *post, void *env)
 {
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
-
-	pre(node, env);
-
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_both(pred, pre, post, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_both(pred, pre, post, env);
-	}
-
-	post(node, env);
+	irg_walk_iterative(node, pre, post, env);
 }
 
 /**
@@ -10,9 +10,12 @@
  */
 #include "irhooks.h"
 
+#include "irthread.h"
 #include <assert.h>
 
 hook_entry_t *hooks[hook_last];
+/** Analyses register node info hooks for graphs compiled concurrently. */
+static ir_mutex_t hooks_mutex = IR_MUTEX_INITIALIZER;
 
 void register_hook(hook_type_t hook, hook_entry_t *entry)
 {
@@ -20,15 +23,18 @@ void register_hook(hook_type_t hook, hook_entry_t *entry)
 	if (!entry->hook._hook_node_info)
 		return;
 
+	ir_mutex_lock(&hooks_mutex);
 	/* hook should not be registered yet */
 	assert(entry->next == NULL && hooks[hook] != entry);
 
 	entry->next = hooks[hook];
 	hooks[hook] = entry;
+	ir_mutex_unlock(&hooks_mutex);
 }
 
 void unregister_hook(hook_type_t hook, hook_entry_t *entry)
 {
+	ir_mutex_lock(&hooks_mutex);
 	for (hook_entry_t **p = &hooks[hook]; *p; p = &(*p)->next) {
 		if (*p == entry) {
 			*p          = entry->next;
@@ -36,4 +42,5 @@ void unregister_hook(hook_type_t hook, hook_entry_t *entry)
 			break;
 		}
 	}
+	ir_mutex_unlock(&hooks_mutex);
 }
@@ -23,13 +23,58 @@
 #include "pmap.h"
 #include "tv_t.h"
 #include "util.h"
+#include "xmalloc.h"
 #include <ctype.h>
+#include <limits.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #define SYMERROR ((unsigned) ~0)
 
+/**
+ * @name Binary format
+ * The binary format stores the same token sequence as the text format. Each
+ * token starts with a tag byte. Numbers are zigzag encoded varints, words
+ * and strings are varint indices into a string table. Scope and list
+ * brackets and line ends are single tag bytes; other whitespace is dropped.
+ *
+ * The file starts with a fixed size header of little endian 64 bit offsets
+ * and sizes of its regions: The prefix holds the modes and the type graph,
+ * then each graph is a section of its own, the suffix holds the constant
+ * code graph and program data. The string table follows, then an index
+ * with entity, offset, size and constraints of each graph section.
+ * @{
+ */
+#define BIN_INT          'i'
+#define BIN_WORD         'w'
+#define BIN_STRING       '"'
+#define BIN_NULL         'N'
+#define BIN_MAGIC        "FIRMIRB\2"
+#define BIN_MAGIC_SIZE   8
+#define BIN_HEADER_SIZE  (BIN_MAGIC_SIZE + BIN_N_FIELDS * 8)
+
+typedef enum bin_field_t {
+	BIN_PREFIX_OFFSET,
+	BIN_PREFIX_SIZE,
+	BIN_SUFFIX_OFFSET,
+	BIN_SUFFIX_SIZE,
+	BIN_STRINGS_OFFSET,
+	BIN_STRINGS_SIZE,
+	BIN_INDEX_OFFSET,
+	BIN_INDEX_SIZE,
+	BIN_N_FIELDS,
+} bin_field_t;
+/** @} */
+
 typedef enum typetag_t {
 	tt_align,
 	tt_builtin_kind,
@@ -68,6 +113,7 @@ typedef enum keyword_t {
 	kw_type,
 	kw_typegraph,
 	kw_unknown,
+	kw_vector_mode,
 } keyword_t;
 
 typedef struct symbol_t {
@@ -219,6 +265,7 @@ static void symtbl_init(void)
 	INSERTKEYWORD(type);
 	INSERTKEYWORD(typegraph);
 	INSERTKEYWORD(unknown);
+	INSERTKEYWORD(vector_mode);
 
 	INSERTENUM(tt_align, align_non_aligned);
 	INSERTENUM(tt_align, align_is_aligned);
@@ -318,28 +365,92 @@ static unsigned symbol(const char *str, typetag_t typetag)
 	return entry ? entry->code : SYMERROR;
 }
 
+static void write_varint(write_env_t *env, unsigned long value)
+{
+	while (value >= 0x80) {
+		putc((int)(value & 0x7F) | 0x80, env->file);
+		value >>= 7;
+	}
+	putc((int)value, env->file);
+}
+
+static void write_token_long(write_env_t *env, long value)
+{
+	/* zigzag encoding keeps small negative numbers short */
+	unsigned long const uvalue = (unsigned long)value;
+	putc(BIN_INT, env->file);
+	write_varint(env, value < 0 ? ~(uvalue << 1) : uvalue << 1);
+}
+
+/** Writes a string table reference. */
+static void write_token_string(write_env_t *env, int tag, const char *string)
+{
+	ident *const id  = new_id_from_str(string);
+	size_t       idx = PTR_TO_INT(pmap_get(void, env->strings, id));
+	if (idx == 0) {
+		ARR_APP1(ident*, env->string_list, id);
+		idx = ARR_LEN(env->string_list);
+		pmap_insert(env->strings, id, INT_TO_PTR(idx));
+	}
+	putc(tag, env->file);
+	write_varint(env, idx - 1);
+}
+
+/**
+ * Writes whitespace which only serves readability of the text format. Line
+ * ends are kept in the binary format to mark the end of records.
+ */
+static void write_layout(write_env_t *env, const char *text)
+{
+	if (!env->binary) {
+		fputs(text, env->file);
+	} else if (strchr(text, '\n') != NULL) {
+		putc('\n', env->file);
+	}
+}
+
 void write_long(write_env_t *env, long value)
 {
+	if (env->binary) {
+		write_token_long(env, value);
+		return;
+	}
 	fprintf(env->file, "%ld ", value);
 }
 
 void write_int(write_env_t *env, int value)
 {
+	if (env->binary) {
+		write_token_long(env, value);
+		return;
+	}
 	fprintf(env->file, "%d ", value);
 }
 
 void write_unsigned(write_env_t *env, unsigned value)
 {
+	if (env->binary) {
+		write_token_long(env, (long)value);
+		return;
+	}
 	fprintf(env->file, "%u ", value);
 }
 
 void write_size_t(write_env_t *env, size_t value)
 {
+	if (env->binary) {
+		write_token_long(env, (long)value);
+		return;
+	}
 	ir_fprintf(env->file, "%zu ", value);
 }
 
 void write_symbol(write_env_t *env, const char *symbol)
 {
+	if (env->binary) {
+		write_token_string(env, BIN_WORD, symbol);
+		return;
+	}
 	fputs(symbol, env->file);
 	fputc(' ', env->file);
 }
@@ -366,6 +477,10 @@ void write_type_ref(write_env_t *env, ir_type *type)
 
 void write_string(write_env_t *env, const char *string)
 {
+	if (env->binary) {
+		write_token_string(env, BIN_STRING, string);
+		return;
+	}
 	fputc('"', env->file);
 	for (const char *c = string; *c != '\0'; ++c) {
 		switch (*c) {
@@ -394,7 +509,10 @@ void write_ident(write_env_t *env, ident *id)
 void write_ident_null(write_env_t *env, ident *id)
 {
 	if (id == NULL) {
-		fputs("NULL ", env->file);
+		if (env->binary)
+			putc(BIN_NULL, env->file);
+		else
+			fputs("NULL ", env->file);
 	} else {
 		write_ident(env, id);
 	}
@@ -411,26 +529,22 @@ void write_tarval_ref(write_env_t *env, ir_tarval *tv)
 	write_mode_ref(env, mode);
 	char buf[128];
 	const char *ascii = ir_tarval_to_ascii(buf, sizeof(buf), tv);
-	fputs(ascii, env->file);
-	fputc(' ', env->file);
+	write_symbol(env, ascii);
 }
 
 void write_align(write_env_t *env, ir_align align)
 {
-	fputs(get_align_name(align), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_align_name(align));
 }
 
 void write_builtin_kind(write_env_t *env, ir_builtin_kind kind)
 {
-	fputs(get_builtin_kind_name(kind), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_builtin_kind_name(kind));
 }
 
 void write_cond_jmp_predicate(write_env_t *env, cond_jmp_predicate pred)
 {
-	fputs(get_cond_jmp_predicate_name(pred), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_cond_jmp_predicate_name(pred));
 }
 
 void write_relation(write_env_t *env, ir_relation relation)
@@ -450,22 +564,34 @@ void write_loop(write_env_t *env, bool loop)
 
 static void write_list_begin(write_env_t *env)
 {
-	fputs("[", env->file);
+	if (env->binary)
+		putc('[', env->file);
+	else
+		fputs("[", env->file);
 }
 
 static void write_list_end(write_env_t *env)
 {
-	fputs("] ", env->file);
+	if (env->binary)
+		putc(']', env->file);
+	else
+		fputs("] ", env->file);
 }
 
 static void write_scope_begin(write_env_t *env)
 {
-	fputs("{\n", env->file);
+	if (env->binary)
+		putc('{', env->file);
+	else
+		fputs("{\n", env->file);
 }
 
 static void write_scope_end(write_env_t *env)
 {
-	fputs("}\n\n", env->file);
+	if (env->binary)
+		putc('}', env->file);
+	else
+		fputs("}\n\n", env->file);
 }
 
 void write_node_ref(write_env_t *env, const ir_node *node)
@@ -476,11 +602,8 @@ void write_node_ref(write_env_t *env, const ir_node *node)
 void write_initializer(write_env_t *const env,
                        ir_initializer_t const *const ini)
 {
-	FILE *f = env->file;
 	ir_initializer_kind_t ini_kind = get_initializer_kind(ini);
-
-	fputs(get_initializer_kind_name(ini_kind), f);
-	fputc(' ', f);
+	write_symbol(env, get_initializer_kind_name(ini_kind));
 
 	switch (ini_kind) {
 	case IR_INITIALIZER_CONST:
@@ -507,37 +630,32 @@ void write_initializer(write_env_t *const env,
 
 void write_pin_state(write_env_t *env, op_pin_state state)
 {
-	fputs(get_op_pin_state_name(state), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_op_pin_state_name(state));
 }
 
 void write_volatility(write_env_t *env, ir_volatility vol)
 {
-	fputs(get_volatility_name(vol), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_volatility_name(vol));
 }
 
 static void write_type_state(write_env_t *env, ir_type_state state)
 {
-	fputs(get_type_state_name(state), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_type_state_name(state));
 }
 
 void write_visibility(write_env_t *env, ir_visibility visibility)
 {
-	fputs(get_visibility_name(visibility), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_visibility_name(visibility));
 }
 
 static void write_mode_arithmetic(write_env_t *env, ir_mode_arithmetic arithmetic)
 {
-	fputs(get_mode_arithmetic_name(arithmetic), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_mode_arithmetic_name(arithmetic));
 }
 
 static void write_type_common(write_env_t *env, ir_type *tp)
 {
-	fputc('\t', env->file);
+	write_layout(env, "\t");
 	write_symbol(env, "type");
 	write_long(env, get_type_nr(tp));
 	write_symbol(env, get_type_opcode_name(get_type_opcode(tp)));
@@ -552,7 +670,7 @@ static void write_type(write_env_t *env, ir_type *tp);
 static bool is_internal_mode(ir_mode *mode)
 {
 	return !mode_is_int(mode) && !mode_is_reference(mode)
-	    && !mode_is_float(mode);
+	    && !mode_is_float(mode) && !mode_is_vector(mode);
 }
 
 static bool is_default_mode(ir_mode *mode)
@@ -571,7 +689,7 @@ static void write_type_primitive(write_env_t *env, ir_type *tp)
 
 	write_type_common(env, tp);
 	write_mode_ref(env, mode);
-	fputc('\n', env->file);
+	write_layout(env, "\n");
 }
 
 static void write_type_compound(write_env_t *env, ir_type *tp)
@@ -585,7 +703,7 @@ static void write_type_compound(write_env_t *env, ir_type *tp)
 	}
 	write_type_common(env, tp);
 	write_ident_null(env, get_compound_ident(tp));
-	fputc('\n', env->file);
+	write_layout(env, "\n");
 
 	for (size_t i = 0, n = get_compound_n_members(tp); i < n; ++i) {
 		ir_entity *member = get_compound_member(tp, i);
@@ -601,7 +719,7 @@ static void write_type_array(write_env_t *env, ir_type *tp)
 	write_type_common(env, tp);
 	write_type_ref(env, element_type);
 	write_unsigned(env, get_array_size(tp));
-	fputc('\n', env->file);
+	write_layout(env, "\n");
 }
 
 static void write_type_method(write_env_t *env, ir_type *tp)
@@ -623,7 +741,7 @@ static void write_type_method(write_env_t *env, ir_type *tp)
 		write_type_ref(env, get_method_param_type(tp, i));
 	for (size_t i = 0; i < nresults; i++)
 		write_type_ref(env, get_method_res_type(tp, i));
-	fputc('\n', env->file);
+	write_layout(env, "\n");
 }
 
 static void write_type_pointer(write_env_t *env, ir_type *tp)
@@ -634,7 +752,7 @@ static void write_type_pointer(write_env_t *env, ir_type *tp)
 
 	write_type_common(env, tp);
 	write_type_ref(env, points_to);
-	fputc('\n', env->file);
+	write_layout(env, "\n");
 }
 
 static void write_type(write_env_t *env, ir_type *tp)
@@ -683,7 +801,7 @@ static void write_entity(write_env_t *env, ir_entity *ent)
 		write_entity(env, aliased);
 	}
 
-	fputc('\t', env->file);
+	write_layout(env, "\t");
 	switch ((ir_entity_kind)ent->kind) {
 	case IR_ENTITY_ALIAS:           write_symbol(env, "alias");           break;
 	case IR_ENTITY_NORMAL:          write_symbol(env, "entity");          break;
@@ -771,7 +889,7 @@ static void write_entity(write_env_t *env, ir_entity *ent)
 	}
 
 end_line:
-	fputc('\n', env->file);
+	write_layout(env, "\n");
 }
 
 void write_switch_table_ref(write_env_t *env, const ir_switch_table *table)
@@ -890,11 +1008,11 @@ static void write_node(const ir_node *node, write_env_t *env)
 	ir_op           *const op   = get_irn_op(node);
 	write_node_func *const func = get_generic_function_ptr(write_node_func, op);
 
-	fputc('\t', env->file);
+	write_layout(env, "\t");
 	if (func == NULL)
 		panic("no write_node_func for %+F", node);
 	func(env, node);
-	fputc('\n', env->file);
+	write_layout(env, "\n");
 }
 
 static void write_node_recursive(ir_node *node, write_env_t *env);
@@ -957,6 +1075,11 @@ static void write_mode(write_env_t *env, ir_mode *mode)
 		write_unsigned(env, get_mode_exponent_size(mode));
 		write_unsigned(env, get_mode_mantissa_size(mode));
 		write_unsigned(env, get_mode_float_int_overflow(mode));
+	} else if (mode_is_vector(mode)) {
+		write_symbol(env, "vector_mode");
+		write_string(env, get_mode_name(mode));
+		write_mode_ref(env, get_vector_element_mode(mode));
+		write_unsigned(env, get_vector_n_elements(mode));
 	} else {
 		panic("cannot write internal modes");
 	}
@@ -965,18 +1088,18 @@ static void write_mode(write_env_t *env, ir_mode *mode)
 static void write_modes(write_env_t *env)
 {
 	write_symbol(env, "modes");
-	fputs("{\n", env->file);
+	write_scope_begin(env);
 
 	for (size_t i = 0, n_modes = ir_get_n_modes(); i < n_modes; i++) {
 		ir_mode *mode = ir_get_mode(i);
 		if (is_internal_mode(mode))
 			continue;
-		fputc('\t', env->file);
+		write_layout(env, "\t");
 		write_mode(env, mode);
-		fputc('\n', env->file);
+		write_layout(env, "\n");
 	}
 
-	fputs("}\n\n", env->file);
+	write_scope_end(env);
 }
 
 static void write_program(write_env_t *env)
@@ -984,15 +1107,15 @@ static void write_program(write_env_t *env)
 	write_symbol(env, "program");
 	write_scope_begin(env);
 	if (irp_prog_name_is_set()) {
-		fputc('\t', env->file);
+		write_layout(env, "\t");
 		write_symbol(env, "name");
 		write_string(env, get_irp_name());
-		fputc('\n', env->file);
+		write_layout(env, "\n");
 	}
 
 	for (ir_segment_t s = IR_SEGMENT_FIRST; s <= IR_SEGMENT_LAST; ++s) {
 		ir_type *segment_type = get_segment_type(s);
-		fputc('\t', env->file);
+		write_layout(env, "\t");
 		write_symbol(env, "segment_type");
 		write_symbol(env, get_segment_name(s));
 		if (segment_type == NULL) {
@@ -1000,15 +1123,15 @@ static void write_program(write_env_t *env)
 		} else {
 			write_type_ref(env, segment_type);
 		}
-		fputc('\n', env->file);
+		write_layout(env, "\n");
 	}
 
 	for (size_t i = 0, n_asms = get_irp_n_asms(); i < n_asms; ++i) {
 		ident *asm_text = get_irp_asm(i);
-		fputc('\t', env->file);
+		write_layout(env, "\t");
 		write_symbol(env, "asm");
 		write_ident(env, asm_text);
-		fputc('\n', env->file);
+		write_layout(env, "\n");
 	}
 	write_scope_end(env);
 }
@@ -1072,6 +1195,15 @@ static void write_irg(write_env_t *env, ir_graph *irg)
 	write_scope_end(env);
 }
 
+static void write_constirg(write_env_t *env)
+{
+	write_symbol(env, "constirg");
+	write_node_ref(env, get_const_code_irg()->current_block);
+	write_scope_begin(env);
+	walk_const_code(NULL, write_node_cb, env);
+	write_scope_end(env);
+}
+
 /* Exports the whole irp to the given file in a textual form. */
 void ir_export_file(FILE *file)
 {
@@ -1092,22 +1224,131 @@ void ir_export_file(FILE *file)
 		write_irg(env, irg);
 	}
 
-	write_symbol(env, "constirg");
-	write_node_ref(env, get_const_code_irg()->current_block);
-	write_scope_begin(env);
-	walk_const_code(NULL, write_node_cb, env);
-	write_scope_end(env);
-
+	write_constirg(env);
 	write_program(env);
 
 	deq_free(&env->entity_queue);
 	deq_free(&env->write_queue);
 }
 
+typedef struct bin_section_t {
+	long     entity_nr;
+	uint64_t offset;
+	uint64_t size;
+	unsigned constraints;
+} bin_section_t;
+
+static void write_u64(FILE *file, uint64_t value)
+{
+	for (unsigned i = 0; i < 8; ++i)
+		putc((int)(value >> (i * 8)) & 0xFF, file);
+}
+
+static uint64_t get_offset(write_env_t *env)
+{
+	return (uint64_t)ftell(env->file);
+}
+
+static void export_binary(FILE *file)
+{
+	write_env_t my_env;
+	write_env_t *env = &my_env;
+
+	memset(env, 0, sizeof(*env));
+	env->file        = file;
+	env->binary      = true;
+	env->strings     = pmap_create();
+	env->string_list = NEW_ARR_F(ident*, 0);
+	deq_init(&env->write_queue);
+	deq_init(&env->entity_queue);
+
+	/* the header is written last, when all offsets are known */
+	uint64_t fields[BIN_N_FIELDS];
+	memset(fields, 0, sizeof(fields));
+	for (unsigned i = 0; i < BIN_HEADER_SIZE; ++i)
+		putc(0, file);
+
+	writers_init();
+	fields[BIN_PREFIX_OFFSET] = get_offset(env);
+	write_modes(env);
+	write_typegraph(env);
+	fields[BIN_PREFIX_SIZE] = get_offset(env) - fields[BIN_PREFIX_OFFSET];
+
+	bin_section_t *sections = NEW_ARR_F(bin_section_t, 0);
+	foreach_irp_irg(i, irg) {
+		bin_section_t section;
+		section.entity_nr   = get_entity_nr(get_irg_entity(irg));
+		section.offset      = get_offset(env);
+		write_irg(env, irg);
+		section.size        = get_offset(env) - section.offset;
+		section.constraints = irg->constraints;
+		ARR_APP1(bin_section_t, sections, section);
+	}
+
+	fields[BIN_SUFFIX_OFFSET] = get_offset(env);
+	write_constirg(env);
+	write_program(env);
+	fields[BIN_SUFFIX_SIZE] = get_offset(env) - fields[BIN_SUFFIX_OFFSET];
+
+	fields[BIN_STRINGS_OFFSET] = get_offset(env);
+	write_varint(env, ARR_LEN(env->string_list));
+	for (size_t i = 0, n = ARR_LEN(env->string_list); i < n; ++i) {
+		char const *const str = get_id_str(env->string_list[i]);
+		size_t      const len = strlen(str);
+		write_varint(env, len);
+		fwrite(str, 1, len, file);
+	}
+	fields[BIN_STRINGS_SIZE] = get_offset(env) - fields[BIN_STRINGS_OFFSET];
+
+	fields[BIN_INDEX_OFFSET] = get_offset(env);
+	write_varint(env, ARR_LEN(sections));
+	for (size_t i = 0, n = ARR_LEN(sections); i < n; ++i) {
+		write_varint(env, sections[i].entity_nr);
+		write_varint(env, sections[i].offset);
+		write_varint(env, sections[i].size);
+		write_varint(env, sections[i].constraints);
+	}
+	fields[BIN_INDEX_SIZE] = get_offset(env) - fields[BIN_INDEX_OFFSET];
+
+	fseek(file, 0, SEEK_SET);
+	fwrite(BIN_MAGIC, 1, BIN_MAGIC_SIZE, file);
+	for (unsigned i = 0; i < BIN_N_FIELDS; ++i)
+		write_u64(file, fields[i]);
+	fseek(file, 0, SEEK_END);
+
+	DEL_ARR_F(sections);
+	DEL_ARR_F(env->string_list);
+	pmap_destroy(env->strings);
+	deq_free(&env->entity_queue);
+	deq_free(&env->write_queue);
+}
+
+int ir_export_binary(const char *filename)
+{
+	FILE *file = fopen(filename, "wb");
+	if (file == NULL) {
+		perror(filename);
+		return 1;
+	}
+
+	export_binary(file);
+	int res = ferror(file);
+	fclose(file);
+	return res;
+}
+
 
 
 static void read_c(read_env_t *env)
 {
+	if (env->binary) {
+		int c = env->pos < env->end ? *env->pos++ : EOF;
+		env->c = c;
+		if (c == '\n')
+			env->line++;
+		return;
+	}
+
 	int c = fgetc(env->file);
 	env->c = c;
 	if (c == '\n')
@@ -1132,13 +1373,80 @@ static void skip_ws(read_env_t *env)
 	}
 }
 
+static unsigned long read_varint(read_env_t *env)
+{
+	unsigned long value = 0;
+	for (unsigned shift = 0; shift < sizeof(value) * CHAR_BIT; shift += 7) {
+		if (env->pos >= env->end)
+			break;
+		unsigned const byte = *env->pos++;
+		value |= (unsigned long)(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0)
+			return value;
+	}
+	parse_error(env, "Invalid number encoding\n");
+	exit(1);
+}
+
+/** Skips the data following the tag of a binary token. */
+static void skip_token_data(read_env_t *env)
+{
+	switch (env->c) {
+	case BIN_INT:
+	case BIN_WORD:
+	case BIN_STRING:
+		(void)read_varint(env);
+		return;
+	default:
+		return;
+	}
+}
+
 static void skip_to(read_env_t *env, char to_ch)
 {
 	while (env->c != to_ch && env->c != EOF) {
+		if (env->binary)
+			skip_token_data(env);
 		read_c(env);
 	}
 }
 
+static void expect_token(read_env_t *env, int tag)
+{
+	skip_ws(env);
+	if (env->c != tag) {
+		parse_error(env, "Unexpected token '%c', expected '%c'\n",
+		            env->c, tag);
+		exit(1);
+	}
+}
+
+static long read_token_long(read_env_t *env)
+{
+	expect_token(env, BIN_INT);
+	unsigned long const value = read_varint(env);
+	read_c(env);
+	return (long)(value & 1 ? ~(value >> 1) : value >> 1);
+}
+
+static ident *read_token_string(read_env_t *env, int tag)
+{
+	expect_token(env, tag);
+	unsigned long const idx = read_varint(env);
+	if (idx >= env->n_strings) {
+		parse_error(env, "Invalid string table index %lu\n", idx);
+		exit(1);
+	}
+	read_c(env);
+	return env->strings[idx];
+}
+
+static char *copy_string(read_env_t *env, ident *id)
+{
+	char const *const str = get_id_str(id);
+	return (char*)obstack_copy0(&env->obst, str, strlen(str));
+}
+
 static bool expect_char(read_env_t *env, char ch)
 {
 	skip_ws(env);
@@ -1153,9 +1461,19 @@ static bool expect_char(read_env_t *env, char ch)
 
 #define EXPECT(c) if (expect_char(env, (c))) {} else return
 
+static long read_long(read_env_t *env);
+
 static char *read_word(read_env_t *env)
 {
 	skip_ws(env);
+	if (env->binary) {
+		if (env->c == BIN_INT) {
+			char buf[32];
+			snprintf(buf, sizeof(buf), "%ld", read_long(env));
+			return (char*)obstack_copy0(&env->obst, buf, strlen(buf));
+		}
+		return copy_string(env, read_token_string(env, BIN_WORD));
+	}
 
 	assert(obstack_object_size(&env->obst) == 0);
 	while (true) {
@@ -1182,6 +1500,9 @@ endofword:
 
 static char *read_string(read_env_t *env)
 {
+	if (env->binary)
+		return copy_string(env, read_token_string(env, BIN_STRING));
+
 	skip_ws(env);
 	if (env->c != '"') {
 		parse_error(env, "Expected string, got '%c'\n", env->c);
@@ -1223,6 +1544,9 @@ static char *read_string(read_env_t *env)
 
 static ident *read_ident(read_env_t *env)
 {
+	if (env->binary)
+		return read_token_string(env, BIN_STRING);
+
 	char  *str = read_string(env);
 	ident *res = new_id_from_str(str);
 	obstack_free(&env->obst, str);
@@ -1231,6 +1555,9 @@ static ident *read_ident(read_env_t *env)
 
 static ident *read_symbol(read_env_t *env)
 {
+	if (env->binary)
+		return read_token_string(env, BIN_WORD);
+
 	char  *str = read_word(env);
 	ident *res = new_id_from_str(str);
 	obstack_free(&env->obst, str);
@@ -1243,7 +1570,13 @@ static ident *read_symbol(read_env_t *env)
 static char *read_string_null(read_env_t *env)
 {
 	skip_ws(env);
-	if (env->c == 'N') {
+	if (env->binary) {
+		if (env->c == BIN_NULL) {
+			read_c(env);
+			return NULL;
+		}
+		return read_string(env);
+	} else if (env->c == 'N') {
 		char *str = read_word(env);
 		if (streq(str, "NULL")) {
 			obstack_free(&env->obst, str);
@@ -1259,6 +1592,15 @@ static char *read_string_null(read_env_t *env)
 
 static ident *read_ident_null(read_env_t *env)
 {
+	if (env->binary) {
+		skip_ws(env);
+		if (env->c == BIN_NULL) {
+			read_c(env);
+			return NULL;
+		}
+		return read_token_string(env, BIN_STRING);
+	}
+
 	char *str = read_string_null(env);
 	if (str == NULL)
 		return NULL;
@@ -1270,6 +1612,9 @@ static ident *read_ident_null(read_env_t *env)
 
 static long read_long(read_env_t *env)
 {
+	if (env->binary)
+		return read_token_long(env);
+
 	skip_ws(env);
 	if (!isdigit(env->c) && env->c != '-') {
 		parse_error(env, "Expected number, got '%c'\n", env->c);
@@ -1318,7 +1663,7 @@ static void expect_list_begin(read_env_t *env)
 
 static bool list_has_next(read_env_t *env)
 {
-	if (feof(env->file)) {
+	if (env->binary ? env->c == EOF : feof(env->file)) {
 		parse_error(env, "Unexpected EOF while reading list");
 		exit(1);
 	}
@@ -1338,6 +1683,11 @@ static void *get_id(read_env_t *env, long id)
 
 	id_entry *entry = set_find(id_entry, env->idset, &key, sizeof(key),
 	                           (unsigned) id);
+	if (entry == NULL && env->image != NULL && env->image->idset != NULL) {
+		/* types and entities of a lazily read graph */
+		entry = set_find(id_entry, env->image->idset, &key, sizeof(key),
+		                 (unsigned) id);
+	}
 	return entry ? entry->elem : NULL;
 }
 
@@ -1376,6 +1726,12 @@ static ir_type *get_type(read_env_t *env, long typenr)
 
 ir_type *read_type_ref(read_env_t *env)
 {
+	if (env->binary) {
+		skip_ws(env);
+		if (env->c == BIN_INT)
+			return get_type(env, read_long(env));
+	}
+
 	char *str = read_word(env);
 	if (streq(str, "unknown")) {
 		obstack_free(&env->obst, str);
@@ -2193,6 +2549,13 @@ static void read_modes(read_env_t *env)
 			               overflow);
 			break;
 		}
+		case kw_vector_mode: {
+			const char *name         = read_string(env);
+			ir_mode    *element_mode = read_mode_ref(env);
+			unsigned    n_elements   = read_unsigned(env);
+			new_vector_mode(name, element_mode, n_elements);
+			break;
+		}
 
 		default:
 			skip_to(env, '\n');
@@ -2245,12 +2608,8 @@ int ir_import(const char *filename)
 	return res;
 }
 
-int ir_import_file(FILE *input, const char *inputname)
+static void begin_import(read_env_t *env, const char *inputname)
 {
-	read_env_t          myenv;
-	int                 oldoptimize = get_optimize();
-	read_env_t         *env         = &myenv;
-
 	readers_init();
 	symtbl_init();
 
@@ -2260,22 +2619,15 @@ int ir_import_file(FILE *input, const char *inputname)
 	env->idset      = new_set(id_cmp, 128);
 	env->fixedtypes = NEW_ARR_F(ir_type *, 0);
 	env->inputname  = inputname;
-	env->file       = input;
 	env->line       = 1;
 	env->delayed_initializers = NEW_ARR_F(delayed_initializer_t, 0);
 
-	/* read first character */
-	read_c(env);
-
-	/* if the first line starts with '#', it contains a comment. */
-	if (env->c == '#')
-		skip_to(env, '\n');
-
-	set_optimize(0);
-
 	n_initial_types = get_irp_n_types();
 	maybe_initial_type = true;
+}
 
+static void read_toplevel(read_env_t *env)
+{
 	while (true) {
 		keyword_t kw;
 
@@ -2315,7 +2667,10 @@ int ir_import_file(FILE *input, const char *inputname)
 		}
 		}
 	}
+}
 
+static int finish_import(read_env_t *env)
+{
 	for (size_t i = 0, n = ARR_LEN(env->fixedtypes); i < n; i++)
 		set_type_state(env->fixedtypes[i], layout_fixed);
 
@@ -2336,9 +2691,10 @@ int ir_import_file(FILE *input, const char *inputname)
 	DEL_ARR_F(env->delayed_initializers);
 	env->delayed_initializers = NULL;
 
-	del_set(env->idset);
-
-	set_optimize(oldoptimize);
+	if (env->image != NULL && env->image->idset == NULL)
+		env->image->idset = env->idset;
+	else
+		del_set(env->idset);
 
 	obstack_free(&env->preds_obst, NULL);
 	obstack_free(&env->obst, NULL);
@@ -2348,3 +2704,287 @@ int ir_import_file(FILE *input, const char *inputname)
 
 	return env->read_errors;
 }
+
+int ir_import_file(FILE *input, const char *inputname)
+{
+	read_env_t          myenv;
+	int                 oldoptimize = get_optimize();
+	read_env_t         *env         = &myenv;
+
+	begin_import(env, inputname);
+	env->file = input;
+
+	/* read first character */
+	read_c(env);
+
+	/* if the first line starts with '#', it contains a comment. */
+	if (env->c == '#')
+		skip_to(env, '\n');
+
+	set_optimize(0);
+	read_toplevel(env);
+	int const res = finish_import(env);
+	set_optimize(oldoptimize);
+	return res;
+}
+
+/** Maps a whole file into memory, returns NULL on failure. */
+static void *map_file(const char *filename, size_t *size)
+{
+#ifdef _WIN32
+	FILE *file = fopen(filename, "rb");
+	if (file == NULL)
+		return NULL;
+	fseek(file, 0, SEEK_END);
+	long const length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	char *data = length < 0 ? NULL : XMALLOCN(char, length + 1);
+	if (data != NULL && fread(data, 1, length, file) != (size_t)length) {
+		free(data);
+		data = NULL;
+	}
+	fclose(file);
+	*size = length;
+	return data;
+#else
+	int const fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+	struct stat st;
+	void *data = NULL;
+	if (fstat(fd, &st) == 0 && st.st_size > 0) {
+		data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED)
+			data = NULL;
+	}
+	close(fd);
+	*size = data != NULL ? (size_t)st.st_size : 0;
+	return data;
+#endif
+}
+
+static void unmap_file(void *data, size_t size)
+{
+#ifdef _WIN32
+	(void)size;
+	free(data);
+#else
+	munmap(data, size);
+#endif
+}
+
+/** Reads the region of a binary file at @p offset. */
+static void read_region(read_env_t *env, const unsigned char *data,
+                        uint64_t offset, uint64_t size)
+{
+	env->pos = data + offset;
+	env->end = env->pos + size;
+	read_c(env);
+}
+
+static uint64_t read_u64(const unsigned char *data)
+{
+	uint64_t value = 0;
+	for (unsigned i = 8; i-- > 0; )
+		value = value << 8 | data[i];
+	return value;
+}
+
+static void read_binary(read_env_t *env, const unsigned char *data,
+                        size_t size)
+{
+	if (size < BIN_HEADER_SIZE
+	    || memcmp(data, BIN_MAGIC, BIN_MAGIC_SIZE) != 0) {
+		parse_error(env, "not a binary firm file\n");
+		return;
+	}
+	uint64_t fields[BIN_N_FIELDS];
+	for (unsigned i = 0; i < BIN_N_FIELDS; ++i)
+		fields[i] = read_u64(data + BIN_MAGIC_SIZE + i * 8);
+	for (unsigned i = 0; i < BIN_N_FIELDS; i += 2) {
+		if (fields[i] > size || fields[i + 1] > size - fields[i]) {
+			parse_error(env, "truncated binary firm file\n");
+			return;
+		}
+	}
+
+	env->pos = data + fields[BIN_STRINGS_OFFSET];
+	env->end = env->pos + fields[BIN_STRINGS_SIZE];
+	env->n_strings = read_varint(env);
+	env->strings   = XMALLOCN(ident*, env->n_strings);
+	for (size_t i = 0; i < env->n_strings; ++i) {
+		size_t const len = read_varint(env);
+		if (len > (size_t)(env->end - env->pos)) {
+			parse_error(env, "truncated string table\n");
+			exit(1);
+		}
+		env->strings[i] = new_id_from_chars((const char*)env->pos, len);
+		env->pos += len;
+	}
+
+	read_region(env, data, fields[BIN_PREFIX_OFFSET], fields[BIN_PREFIX_SIZE]);
+	read_toplevel(env);
+
+	const unsigned char *index     = data + fields[BIN_INDEX_OFFSET];
+	const unsigned char *index_end = index + fields[BIN_INDEX_SIZE];
+	env->pos = index;
+	env->end = index_end;
+	size_t const n_sections = read_varint(env);
+	index = env->pos;
+	for (size_t i = 0; i < n_sections; ++i) {
+		env->pos = index;
+		env->end = index_end;
+		long     const entity = read_varint(env);
+		uint64_t const offset = read_varint(env);
+		uint64_t const length = read_varint(env);
+		ir_graph_constraints_t const constraints
+			= (ir_graph_constraints_t)read_varint(env);
+		index = env->pos;
+		if (offset > size || length > size - offset) {
+			parse_error(env, "invalid graph section\n");
+			break;
+		}
+		if (env->image != NULL) {
+			ir_lazy_irg_t *const lazy = XMALLOC(ir_lazy_irg_t);
+			lazy->image  = env->image;
+			lazy->offset = offset;
+			lazy->size   = length;
+			++env->image->n_refs;
+			ir_graph *const stub = new_ir_graph_stub(get_entity(env, entity), lazy);
+			add_irg_constraints(stub, constraints);
+		} else {
+			size_t const n_irgs = get_irp_n_irgs();
+			read_region(env, data, offset, length);
+			read_toplevel(env);
+			if (get_irp_n_irgs() > n_irgs)
+				add_irg_constraints(get_irp_irg_or_stub(n_irgs), constraints);
+		}
+	}
+
+	read_region(env, data, fields[BIN_SUFFIX_OFFSET], fields[BIN_SUFFIX_SIZE]);
+	read_toplevel(env);
+	if (env->image != NULL) {
+		env->image->strings   = env->strings;
+		env->image->n_strings = env->n_strings;
+	} else {
+		free(env->strings);
+	}
+}
+
+int ir_import_binary(const char *filename)
+{
+	size_t               size;
+	const unsigned char *data = (const unsigned char*)map_file(filename, &size);
+	if (data == NULL) {
+		perror(filename);
+		return 1;
+	}
+
+	read_env_t  myenv;
+	int         oldoptimize = get_optimize();
+	read_env_t *env         = &myenv;
+
+	begin_import(env, filename);
+	env->binary = true;
+	set_optimize(0);
+	read_binary(env, data, size);
+	int const res = finish_import(env);
+	set_optimize(oldoptimize);
+	unmap_file((void*)data, size);
+	return res;
+}
+
+static void free_image(ir_lazy_image_t *image)
+{
+	if (image->idset != NULL)
+		del_set(image->idset);
+	free(image->strings);
+	free(image->filename);
+	unmap_file((void*)image->data, image->size);
+	free(image);
+}
+
+void free_lazy_irg(ir_lazy_irg_t *lazy)
+{
+	ir_lazy_image_t *const image = lazy->image;
+	free(lazy);
+	if (--image->n_refs == 0)
+		free_image(image);
+}
+
+int ir_import_binary_lazy(const char *filename)
+{
+	size_t               size;
+	const unsigned char *data = (const unsigned char*)map_file(filename, &size);
+	if (data == NULL) {
+		perror(filename);
+		return 1;
+	}
+
+	ir_lazy_image_t *const image = XMALLOCZ(ir_lazy_image_t);
+	image->data     = data;
+	image->size     = size;
+	image->filename = xstrdup(filename);
+	/* the import holds a reference until it is done */
+	image->n_refs   = 1;
+
+	read_env_t  myenv;
+	int         oldoptimize = get_optimize();
+	read_env_t *env         = &myenv;
+
+	begin_import(env, filename);
+	env->binary = true;
+	env->image  = image;
+	set_optimize(0);
+	read_binary(env, data, size);
+	int const res = finish_import(env);
+	set_optimize(oldoptimize);
+	if (--image->n_refs == 0)
+		free_image(image);
+	return res;
+}
+
+ir_graph *materialize_irg(ir_graph *irg)
+{
+	if (!irg->is_stub)
+		return irg;
+
+	ir_lazy_irg_t   *const lazy  = irg->lazy;
+	ir_lazy_image_t *const image = lazy->image;
+	ir_graph        *const rem   = current_ir_graph;
+	int              const old   = get_optimize();
+
+	read_env_t  myenv;
+	read_env_t *env = &myenv;
+	begin_import(env, image->filename);
+	env->binary    = true;
+	env->image     = image;
+	env->strings   = image->strings;
+	env->n_strings = image->n_strings;
+	set_optimize(0);
+	read_region(env, image->data, lazy->offset, lazy->size);
+	read_toplevel(env);
+	size_t const n_irgs = get_irp_n_irgs();
+	if (finish_import(env) != 0
+	    || get_irp_irg_or_stub(n_irgs - 1)->ent != irg->ent)
+		panic("could not read graph of %+F from %s", irg->ent,
+		      image->filename);
+	set_optimize(old);
+	current_ir_graph = rem;
+
+	/* put the new graph in place of the stub */
+	ir_graph *const res = get_irp_irg_or_stub(n_irgs - 1);
+	for (size_t i = 0; i < n_irgs; ++i) {
+		if (get_irp_irg_or_stub(i) == irg) {
+			set_irp_irg(i, res);
+			break;
+		}
+	}
+	ARR_SHRINKLEN(irp->graphs, n_irgs - 1);
+	res->lazy    = lazy;
+	res->be_data = irg->be_data;
+	add_irg_constraints(res, irg->constraints);
+	--irp->n_stub_irgs;
+	free(irg);
+	return res;
+}
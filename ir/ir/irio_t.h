@@ -6,9 +6,11 @@
 #include "irnode_t.h"
 #include "obst.h"
 #include "pdeq.h"
+#include "pmap.h"
 #include "set.h"
 #include "type_t.h"
 #include "typerep.h"
+#include <stdint.h>
 #include <stdio.h>
 
 typedef struct delayed_initializer_t {
@@ -22,6 +24,24 @@ typedef struct delayed_pred_t {
 	long     preds[];
 } delayed_pred_t;
 
+/** A binary file with graphs that are read on demand. */
+typedef struct ir_lazy_image_t {
+	const unsigned char *data;      /**< the mapped file */
+	size_t               size;
+	char                *filename;
+	ident              **strings;   /**< string table of the file */
+	size_t               n_strings;
+	set                 *idset;     /**< file ids of types and entities */
+	size_t               n_refs;    /**< number of graphs still using it */
+} ir_lazy_image_t;
+
+/** The section of a graph in a binary file. */
+struct ir_lazy_irg_t {
+	ir_lazy_image_t *image;
+	uint64_t         offset;
+	uint64_t         size;
+};
+
 typedef struct read_env_t {
 	int            c;           /**< currently read char */
 	FILE          *file;
@@ -37,12 +57,22 @@ typedef struct read_env_t {
 	struct obstack preds_obst;
 	delayed_initializer_t *delayed_initializers;
 	const delayed_pred_t **delayed_preds;
+
+	bool                 binary;    /**< read the binary format */
+	const unsigned char *pos;       /**< next byte of binary input */
+	const unsigned char *end;       /**< end of the binary region */
+	ident              **strings;   /**< string table of binary input */
+	size_t               n_strings;
+	ir_lazy_image_t     *image;     /**< file of graphs read on demand */
 } read_env_t;
 
 typedef struct write_env_t {
-	FILE *file;
-	deq_t write_queue;
-	deq_t entity_queue;
+	FILE   *file;
+	deq_t   write_queue;
+	deq_t   entity_queue;
+	bool    binary;       /**< write the binary format */
+	pmap   *strings;      /**< string table index + 1 of idents */
+	ident **string_list;  /**< string table in binary format */
 } write_env_t;
 
 void write_align(write_env_t *env, ir_align align);
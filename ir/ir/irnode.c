@@ -11,6 +11,7 @@
 #include "irnode_t.h"
 
 #include "beinfo.h"
+#include "compiler.h"
 #include "ident.h"
 #include "irbackedge_t.h"
 #include "ircons.h"
@@ -33,6 +34,21 @@
    in the in array */
 #define END_KEEPALIVE_OFFSET  0
 
+/* Nodes with fixed arity are stored behind their in array. Building with
+ * INLINE_INS=0 gives the former layout with the in array behind the node
+ * for comparison. */
+#ifndef INLINE_INS
+#define INLINE_INS 1
+#endif
+
+/** Bytes the current thread allocated on graph obstacks for nodes. */
+static THREAD_LOCAL size_t node_memory_allocated;
+
+size_t ir_get_node_memory_allocated(void)
+{
+	return node_memory_allocated;
+}
+
 const char *get_relation_string(ir_relation relation)
 {
 	static char const *const relation_names[] = {
@@ -78,35 +94,58 @@ ir_node *new_ir_node(dbg_info *db, ir_graph *irg, ir_node *block, ir_op *op,
 {
 	assert(mode != NULL);
 
-	size_t   const node_size = offsetof(ir_node, attr) + op->attr_size;
-	ir_node *const res       = (ir_node*)OALLOCNZ(get_irg_obstack(irg), char, node_size);
+	/* the cold part follows the attributes */
+	size_t const attr_end  = offsetof(ir_node, attr) + op->attr_size;
+	size_t const cold_offs = (attr_end + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+	size_t const node_size = cold_offs + sizeof(ir_node_cold);
+
+	struct obstack *const obst  = get_irg_obstack(irg);
+	bool            const fixed = arity >= 0 && op->opar != oparity_dynamic;
+	ir_node              *res;
+	if (fixed && INLINE_INS) {
+		/* Place the node in the tail of its in array, so walkers find the
+		 * predecessors right in front of the node. */
+		size_t    const n_words = node_size / sizeof(ir_node*);
+		ir_node **const ins     = NEW_ARR_D(ir_node*, obst, arity + 1 + n_words);
+		ARR_SHRINKLEN(ins, arity + 1);
+		res = (ir_node*)&ins[arity + 1];
+		memset(res, 0, node_size);
+		res->in = ins;
+	} else {
+		res = (ir_node*)OALLOCNZ(obst, char, node_size);
+		if (fixed)
+			res->in = NEW_ARR_D(ir_node*, obst, arity + 1);
+	}
+	if (fixed)
+		node_memory_allocated += ARR_ELTS_OFFS + (arity + 1) * sizeof(ir_node*);
+	node_memory_allocated += node_size;
 
 	res->kind     = k_ir_node;
 	res->op       = op;
 	res->mode     = mode;
 	res->irg      = irg;
+	res->cold     = (ir_node_cold*)((char*)res + cold_offs);
 	res->node_idx = irg_register_node_idx(irg, res);
 
 	if (arity < 0) {
 		res->in = NEW_ARR_F(ir_node *, 1);  /* 1: space for block */
 	} else {
 		/* Nodes with dynamic arity must always have a flexible array. */
-		if (op->opar == oparity_dynamic)
+		if (!fixed)
 			res->in = NEW_ARR_F(ir_node *, (arity+1));
-		else
-			res->in = NEW_ARR_D(ir_node*, get_irg_obstack(irg), arity + 1);
 		MEMCPY(&res->in[1], in, arity);
 	}
 
 	res->in[0]   = block;
 	set_irn_dbg_info(res, db);
-	res->node_nr = get_irp_new_node_nr();
+	res->cold->node_nr = get_irp_new_node_nr();
 
 	for (ir_edge_kind_t i = EDGE_KIND_FIRST; i <= EDGE_KIND_LAST; ++i) {
-		INIT_LIST_HEAD(&res->edge_info[i].outs_head);
 		/* Edges will be built immediately. */
-		res->edge_info[i].edges_built = 1;
-		res->edge_info[i].out_count = 0;
+		res->cold->edge_info[i] = (irn_edge_info_t) {
+			.edges_built = 1,
+			.generation  = irg->edge_info[i].generation,
+		};
 	}
 
 	/* don't put this into the for loop, arity is -1 for some nodes! */
@@ -341,7 +380,7 @@ void set_irn_pinned(ir_node *node, int pinned)
 long get_irn_node_nr(const ir_node *node)
 {
 	assert(node->kind == k_ir_node);
-	return node->node_nr;
+	return node->cold->node_nr;
 }
 
 void *(get_irn_generic_attr)(ir_node *node)
@@ -263,12 +263,19 @@ typedef union ir_attr {
 } ir_attr;
 
 /**
- * Edge info to put into an irn.
+ * Edge info to put into an irn. The out edges of a node are kept in an
+ * array, and each input remembers where its edge sits in the array of its
+ * target, so edges are found and removed without searching.
  */
 typedef struct irn_edge_kind_info_t {
-	struct list_head outs_head;  /**< The list of all outs. */
-	unsigned edges_built : 1;    /**< Set edges where built for this node. */
-	unsigned out_count   : 31;   /**< Number of outs in the list. */
+	ir_edge_t *outs;             /**< The out edges, the newest last. */
+	unsigned   out_count;        /**< Number of out edges. */
+	unsigned   outs_size;        /**< Allocated length of outs. */
+	unsigned  *in_slots;         /**< Index of the edge of input i - 1 in the
+	                                  outs of its target. */
+	unsigned   n_in_slots  : 31; /**< Allocated length of in_slots. */
+	unsigned   edges_built : 1;  /**< Set edges where built for this node. */
+	unsigned   generation;       /**< Activation the arrays belong to. */
 } irn_edge_info_t;
 
 typedef irn_edge_info_t irn_edges_info_t[EDGE_KIND_LAST+1];
@@ -287,7 +294,26 @@ typedef struct ir_def_use_edges {
 } ir_def_use_edges;
 
 /**
- * Data of a function graph node.
+ * Rarely used data of a node. It is allocated behind the attributes, so it
+ * stays out of the cache lines touched by walkers and local optimizations.
+ */
+typedef struct ir_node_cold {
+	dbg_info        *dbi;      /**< Information for debug support. */
+	long             node_nr;  /**< Globally unique node number. */
+	union {
+		ir_def_use_edges *out;    /**< array of def-use edges. */
+		unsigned          n_outs; /**< number of def-use edges (temporarily used
+		                               during construction of data structure) */
+	} o;
+	ir_loop         *loop;         /**< Loop information. */
+	void            *backend_info;
+	irn_edges_info_t edge_info;    /**< Everlasting out edges. */
+} ir_node_cold;
+
+/**
+ * Data of a function graph node. The fields up to the attributes fit into
+ * one cache line. The in array of nodes with fixed arity directly precedes
+ * the node in memory.
  */
 struct ir_node {
 	firm_kind        kind;     /**< Distinguishes this node from others. */
@@ -300,17 +326,7 @@ struct ir_node {
 	void            *link;     /**< To attach additional information to the
 	                                node, e.g. used during optimization to link
 	                                to nodes that shall replace a node. */
-	dbg_info        *dbi;      /**< Information for debug support. */
-	long             node_nr;  /**< Globally unique node number. */
-
-	union {
-		ir_def_use_edges *out;    /**< array of def-use edges. */
-		unsigned          n_outs; /**< number of def-use edges (temporarily used
-		                               during construction of data structure) */
-	} o;
-	ir_loop         *loop;         /**< Loop information. */
-	void            *backend_info;
-	irn_edges_info_t edge_info;    /**< Everlasting out edges. */
+	ir_node_cold    *cold;     /**< The rarely used data of the node. */
 
 	/** Attributes of this node. Depends on opcode. Must be last field. */
 	ir_attr attr;
@@ -634,12 +650,12 @@ static inline const void *get_irn_generic_attr_const_(const ir_node *node)
 
 static inline dbg_info *get_irn_dbg_info_(const ir_node *n)
 {
-	return n->dbi;
+	return n->cold->dbi;
 }
 
 static inline void set_irn_dbg_info_(ir_node *n, dbg_info *db)
 {
-	n->dbi = db;
+	n->cold->dbi = db;
 }
 
 /**
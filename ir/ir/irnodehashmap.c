@@ -27,7 +27,7 @@ static ir_nodehashmap_entry_t null_nodehashmap_entry = { NULL, NULL };
 #define ConstKeyType              const ir_node*
 #define GetKey(value)             (value).node
 #define InitData(self,value,key)  (value).node = (key)
-#define Hash(self,key)            ((unsigned)((key)->node_nr))
+#define Hash(self,key)            ((unsigned)((key)->cold->node_nr))
 #define KeysEqual(self,key1,key2) (key1) == (key2)
 #define SetRangeEmpty(ptr,size)   memset(ptr, 0, (size) * sizeof((ptr)[0]))
 #define EntrySetEmpty(value)      (value).node = NULL
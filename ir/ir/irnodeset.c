@@ -22,7 +22,7 @@
 #define ValueType                 ir_node*
 #define NullValue                 NULL
 #define DeletedValue              ((ir_node*)-1)
-#define Hash(this,key)            ((unsigned)((key)->node_nr))
+#define Hash(this,key)            ((unsigned)((key)->cold->node_nr))
 #define KeysEqual(this,key1,key2) (key1) == (key2)
 #define SetRangeEmpty(ptr,size)   memset(ptr, 0, (size) * sizeof((ptr)[0]))
 
@@ -20,6 +20,7 @@
 #include "irverify_t.h"
 #include "panic.h"
 #include "reassoc_t.h"
+#include "util.h"
 #include "xmalloc.h"
 #include <string.h>
 
@@ -45,6 +46,18 @@ static int attrs_equal_true(const ir_node *a, const ir_node *b)
 	return true;
 }
 
+static int default_inputs_equal(const ir_node *a, const ir_node *b)
+{
+	int const arity = get_irn_arity(a);
+	if (arity != get_irn_arity(b))
+		return false;
+	for (int i = 0; i < arity; ++i) {
+		if (get_irn_n(a, i) != get_irn_n(b, i))
+			return false;
+	}
+	return true;
+}
+
 ir_op *new_ir_op(unsigned code, const char *name, op_pin_state p,
                  irop_flags flags, op_arity opar, int op_index,
                  size_t attr_size)
@@ -64,6 +77,7 @@ ir_op *new_ir_op(unsigned code, const char *name, op_pin_state p,
 	res->ops.hash            = default_hash_node;
 	res->ops.copy_attr       = default_copy_attr;
 	res->ops.attrs_equal     = attrs_equal_true;
+	res->ops.inputs_equal    = default_inputs_equal;
 	res->ops.get_type_attr   = default_get_type_attr;
 	res->ops.get_entity_attr = default_get_entity_attr;
 
@@ -98,16 +112,30 @@ ir_op *ir_get_opcode(unsigned code)
 	return opcodes[code];
 }
 
+THREAD_LOCAL ir_op_generic_t *ir_op_generics;
+THREAD_LOCAL unsigned         ir_n_op_generics;
+
+ir_op_generic_t *grow_op_generics(unsigned const code)
+{
+	unsigned const n = MAX(code + 1, ir_get_n_opcodes());
+	ir_op_generics = XREALLOC(ir_op_generics, ir_op_generic_t, n);
+	memset(&ir_op_generics[ir_n_op_generics], 0,
+	       (n - ir_n_op_generics) * sizeof(*ir_op_generics));
+	ir_n_op_generics = n;
+	return &ir_op_generics[code];
+}
+
+void ir_free_op_generics(void)
+{
+	free(ir_op_generics);
+	ir_op_generics   = NULL;
+	ir_n_op_generics = 0;
+}
+
 void ir_clear_opcodes_generic_func(void)
 {
-	for (size_t i = 0, n = ir_get_n_opcodes(); i < n; ++i) {
-		ir_op *op = ir_get_opcode(i);
-		if (op == NULL)
-			continue;
-		op->ops.generic  = (op_func)NULL;
-		op->ops.generic1 = (op_func)NULL;
-		op->ops.generic2 = (op_func)NULL;
-	}
+	if (ir_op_generics != NULL)
+		memset(ir_op_generics, 0, ir_n_op_generics * sizeof(*ir_op_generics));
 }
 
 void ir_op_set_memory_index(ir_op *op, int memory_index)
@@ -620,6 +648,7 @@ void firm_init_op(void)
 
 void firm_finish_op(void)
 {
+	ir_free_op_generics();
 	be_finish_op();
 	ir_finish_opcodes();
 	DEL_ARR_F(opcodes);
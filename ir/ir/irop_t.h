@@ -15,6 +15,8 @@
 
 #include <stdbool.h>
 
+#include "compiler.h"
+
 #include "tv.h"
 
 #define get_op_code(op)         get_op_code_(op)
@@ -27,6 +29,12 @@
 #define set_generic_function_ptr(op, func) set_generic_function_ptr_((op), (op_func)(func))
 #define get_generic_function_ptr(type, op) ((type*)get_generic_function_ptr_((op)))
 
+/**
+ * Compares the inputs (without the block) of two nodes with the same op.
+ * Returns non-zero if they are equal. Generated for ops with a fixed arity.
+ */
+typedef int (*node_inputs_equal_func)(const ir_node *a, const ir_node *b);
+
 /**
  * Operation specific callbacks.
  */
@@ -39,6 +47,8 @@ typedef struct {
 	transform_node_func   transform_node;       /**< Optimizes the node by transforming it. */
 	transform_node_func   transform_node_Proj;  /**< Optimizes the Proj node by transforming it. */
 	node_attrs_equal_func  attrs_equal;         /**< Compares two node attributes. */
+	node_inputs_equal_func inputs_equal;        /**< Compares the inputs of two nodes
+	                                                 with the same op. */
 	reassociate_func      reassociate;          /**< Reassociate a tree. */
 	copy_attr_func        copy_attr;            /**< Copy node attributes. */
 	get_type_attr_func    get_type_attr;        /**< Returns the type attribute of a node. */
@@ -46,11 +56,15 @@ typedef struct {
 	verify_node_func      verify_node;          /**< Verify the node. */
 	verify_proj_node_func verify_proj_node;     /**< Verify the Proj node. */
 	dump_node_func        dump_node;            /**< Dump a node. */
-	op_func               generic;              /**< A generic function pointer. */
-	op_func               generic1;             /**< A generic function pointer. */
-	op_func               generic2;             /**< A generic function pointer. */
 } ir_op_ops;
 
+/** Generic function pointers, which a pass sets up for its own use. */
+typedef struct ir_op_generic_t {
+	op_func generic;
+	op_func generic1;
+	op_func generic2;
+} ir_op_generic_t;
+
 /** The type of an ir_op. */
 struct ir_op {
 	unsigned     code;         /**< The unique opcode of the op. */
@@ -154,14 +168,33 @@ static inline op_pin_state get_op_pinned_(const ir_op *op)
 	return op->pin_state;
 }
 
+/* Each thread has its own generic function pointers, so passes using them can
+ * run on several graphs concurrently. */
+extern THREAD_LOCAL ir_op_generic_t *ir_op_generics;
+extern THREAD_LOCAL unsigned         ir_n_op_generics;
+
+ir_op_generic_t *grow_op_generics(unsigned code);
+
+/** Returns the generic function pointers of @p op for the calling thread. */
+static inline ir_op_generic_t *get_op_generic(ir_op const *const op)
+{
+	unsigned const code = op->code;
+	if (code < ir_n_op_generics)
+		return &ir_op_generics[code];
+	return grow_op_generics(code);
+}
+
+/** Frees the generic function pointers of the calling thread. */
+void ir_free_op_generics(void);
+
 static inline void set_generic_function_ptr_(ir_op *op, op_func func)
 {
-	op->ops.generic = func;
+	get_op_generic(op)->generic = func;
 }
 
 static inline op_func get_generic_function_ptr_(const ir_op *op)
 {
-	return op->ops.generic;
+	return get_op_generic(op)->generic;
 }
 
 static inline ir_op_ops const *get_op_ops(ir_op const *const op)
@@ -11,6 +11,7 @@
  */
 #include "irprofile.h"
 
+#include "array.h"
 #include "debug.h"
 #include "execfreq_t.h"
 #include "hashptr.h"
@@ -18,25 +19,35 @@
 #include "ircons_t.h"
 #include "irdump_t.h"
 #include "irgwalk.h"
+#include "irloop.h"
 #include "irnode_t.h"
+#include "irprintf.h"
 #include "irprog_t.h"
 #include "obst.h"
 #include "set.h"
 #include "typerep.h"
+#include "unionfind.h"
 #include "util.h"
 #include "xmalloc.h"
+#include <inttypes.h>
 
-/* Instrument blocks walker. */
-typedef struct block_id_walker_data_t {
-	unsigned int  id;       /**< current block id number */
-	ir_node      *counters; /**< the node representing the counter array */
-} block_id_walker_data_t;
+/*
+ * The profile file starts with "firmprof", which is written by libfirmprof,
+ * followed by the counter array as 32-bit little endian words. The array
+ * starts with a header of PROFILE_MAGIC, PROFILE_VERSION, the profiling flags
+ * and the number of functions. For every function in irp order follows a
+ * record of its CFG checksum, the number of counters and the number of value
+ * sites, then the counters and the value sites. The header words are
+ * initialized at compile time, so the runtime just writes the array.
+ */
+#define PROFILE_MAGIC        0x70727066u /* "fprp" */
+#define PROFILE_VERSION      2
+#define PROFILE_HEADER_WORDS 4
+#define RECORD_HEADER_WORDS  3
+/* A value site holds (low word, high word, count) for each value. */
+#define VALUE_SITE_WORDS     (3 * IR_PROFILE_N_VALUES)
 
-/* Associate counters with blocks. */
-typedef struct block_assoc_t {
-	unsigned int i;          /**< current block id number */
-	unsigned int *counters;  /**< block execution counts */
-} block_assoc_t;
+#define NO_COUNTER           (~0u)
 
 /* minimal execution frequency (an execfreq of 0 confuses algos) */
 #define MIN_EXECFREQ 0.00001
@@ -44,6 +55,9 @@ typedef struct block_assoc_t {
 /* keep the execcounts here because they are only read once per compiler run */
 static set *profile = NULL;
 
+/* value profiles of Switch nodes and indirect Calls */
+static set *value_profile = NULL;
+
 /* Hook for vcg output. */
 static hook_entry_t *hook;
 
@@ -57,9 +71,16 @@ DEBUG_ONLY(static firm_dbg_module_t *dbg;)
  */
 typedef struct execcount_t {
 	unsigned long block; /**< block id */
+	int           pos;   /**< cfgpred position of an edge, -1 for the block */
 	uint32_t      count; /**< execution count */
 } execcount_t;
 
+typedef struct value_profile_t {
+	long               node;     /**< Switch or Call id */
+	unsigned           n_values;
+	ir_profile_value_t values[IR_PROFILE_N_VALUES];
+} value_profile_t;
+
 /**
  * Compare two execcount_t entries.
  */
@@ -68,14 +89,57 @@ static int cmp_execcount(const void *a, const void *b, size_t size)
 	const execcount_t *ea = (const execcount_t*)a;
 	const execcount_t *eb = (const execcount_t*)b;
 	(void)size;
-	return ea->block != eb->block;
+	return ea->block != eb->block || ea->pos != eb->pos;
 }
 
-uint32_t ir_profile_get_block_execcount(const ir_node *block)
+static unsigned hash_execcount(const execcount_t *ec)
 {
-	execcount_t  const query = { .block = get_irn_node_nr(block), .count = 0 };
-	execcount_t *const ec    = set_find(execcount_t, profile, &query, sizeof(query), query.block);
+	return hash_combine(ec->block, ec->pos);
+}
 
+static int cmp_value_profile(const void *a, const void *b, size_t size)
+{
+	const value_profile_t *va = (const value_profile_t*)a;
+	const value_profile_t *vb = (const value_profile_t*)b;
+	(void)size;
+	return va->node != vb->node;
+}
+
+static unsigned hash_value_profile(const value_profile_t *vp)
+{
+	return (unsigned)vp->node;
+}
+
+static execcount_t *find_execcount(const ir_node *block, int pos)
+{
+	if (profile == NULL)
+		return NULL;
+	execcount_t const query = {
+		.block = get_irn_node_nr(block),
+		.pos   = pos,
+	};
+	return set_find(execcount_t, profile, &query, sizeof(query), hash_execcount(&query));
+}
+
+static void set_execcount(const ir_node *block, int pos, uint64_t count)
+{
+	execcount_t const query = {
+		.block = get_irn_node_nr(block),
+		.pos   = pos,
+		.count = count > UINT32_MAX ? UINT32_MAX : (uint32_t)count,
+	};
+	DBG((dbg, LEVEL_4, "execcount(%+F, %d): %u\n", block, pos, query.count));
+	(void)set_insert(execcount_t, profile, &query, sizeof(query), hash_execcount(&query));
+}
+
+bool ir_profile_has_data(void)
+{
+	return profile != NULL;
+}
+
+uint32_t ir_profile_get_block_execcount(const ir_node *block)
+{
+	execcount_t const *const ec = find_execcount(block, -1);
 	if (ec != NULL) {
 		return ec->count;
 	} else {
@@ -84,36 +148,53 @@ uint32_t ir_profile_get_block_execcount(const ir_node *block)
 	}
 }
 
-/**
- * Block walker, count number of blocks.
- */
-static void block_counter(ir_node *bb, void *data)
+void ir_profile_set_block_execcount(const ir_node *block, uint32_t count)
 {
-	unsigned *const count = (unsigned*)data;
-	(void)bb;
-	++*count;
+	if (profile == NULL) {
+		FIRM_DBG_REGISTER(dbg, "firm.ir.profile");
+		profile       = new_set(cmp_execcount, 16);
+		value_profile = new_set(cmp_value_profile, 16);
+	}
+	set_execcount(block, -1, count);
 }
 
-/**
- * Returns the number of blocks the given graph.
- */
-static unsigned int get_irg_n_blocks(ir_graph *irg)
+bool ir_profile_is_block_cold(const ir_node *block)
 {
-	unsigned int count = 0;
-	irg_block_walk_graph(irg, block_counter, NULL, &count);
-	return count;
+	execcount_t const *const ec = find_execcount(block, -1);
+	if (ec == NULL || ec->count != 0)
+		return false;
+	ir_graph *const irg = get_irn_irg(block);
+	return ir_profile_get_block_execcount(get_irg_start_block(irg)) != 0;
 }
 
-/**
- * Returns the number of basic blocks in the current ir program.
- */
-static unsigned int get_irp_n_blocks(void)
+bool ir_profile_get_edge_execfreq(const ir_node *block, int pos, double *freq)
 {
-	unsigned int count = 0;
-	foreach_irp_irg(i, irg) {
-		count += get_irg_n_blocks(irg);
-	}
-	return count;
+	execcount_t const *const ec = find_execcount(block, pos);
+	if (ec == NULL)
+		return false;
+
+	/* normalize like the block frequencies */
+	ir_graph *const irg   = get_irn_irg(block);
+	uint32_t  const entry = ir_profile_get_block_execcount(get_irg_start_block(irg));
+	if (entry == 0)
+		return false;
+	double const f = (double)ec->count / entry;
+	*freq = f < MIN_EXECFREQ ? MIN_EXECFREQ : f;
+	return true;
+}
+
+unsigned ir_profile_get_values(const ir_node *node,
+                               ir_profile_value_t values[IR_PROFILE_N_VALUES])
+{
+	if (value_profile == NULL)
+		return 0;
+	value_profile_t query;
+	query.node = get_irn_node_nr(node);
+	value_profile_t const *const vp = set_find(value_profile_t, value_profile, &query, sizeof(query), hash_value_profile(&query));
+	if (vp == NULL)
+		return 0;
+	memcpy(values, vp->values, vp->n_values * sizeof(*values));
+	return vp->n_values;
 }
 
 /* vcg helper */
@@ -123,7 +204,255 @@ static void dump_profile_node_info(void *ctx, FILE *f, const ir_node *irn)
 	if (is_Block(irn)) {
 		unsigned int execcount = ir_profile_get_block_execcount(irn);
 		fprintf(f, "profiled execution count: %u\n", execcount);
+		for (int i = 0, n = get_Block_n_cfgpreds(irn); i < n; ++i) {
+			execcount_t const *const ec = find_execcount(irn, i);
+			if (ec != NULL)
+				fprintf(f, "profiled count of edge %d: %u\n", i, ec->count);
+		}
+	} else if (is_Switch(irn) || is_Call(irn)) {
+		ir_profile_value_t values[IR_PROFILE_N_VALUES];
+		unsigned const n_values = ir_profile_get_values(irn, values);
+		for (unsigned i = 0; i < n_values; ++i) {
+			if (values[i].callee != NULL) {
+				ir_fprintf(f, "profiled callee %F: %u\n", values[i].callee,
+				           values[i].count);
+			} else {
+				fprintf(f, "profiled value %" PRIu64 ": %u\n", values[i].value,
+				        values[i].count);
+			}
+		}
+	}
+}
+
+/**
+ * A CFG edge for edge profiling.
+ */
+typedef struct profile_edge_t {
+	unsigned src;     /**< index of the source block */
+	unsigned dst;     /**< index of the target block */
+	int      pos;     /**< cfgpred position in the target, -1 if virtual */
+	unsigned weight;  /**< heavier edges are put into the spanning tree first */
+	unsigned counter; /**< counter index or NO_COUNTER for tree edges */
+	int64_t  count;   /**< execution count, -1 while unknown */
+} profile_edge_t;
+
+/**
+ * The numbering of blocks, counters and value sites of a graph. It is
+ * computed the same way when instrumenting and when reading the profile, so
+ * the counters need no further description in the profile.
+ */
+typedef struct profile_cfg_t {
+	ir_graph        *irg;
+	ir_node        **blocks;     /**< blocks in block walk order */
+	unsigned        *block_nr;   /**< block index by node index */
+	unsigned        *n_succs;    /**< cfg successors by block index */
+	profile_edge_t  *edges;      /**< CFG edges, NULL when counting blocks */
+	ir_node        **sites;      /**< Switch nodes and indirect Calls */
+	unsigned         n_counters;
+	uint32_t         checksum;   /**< identifies the CFG shape */
+} profile_cfg_t;
+
+static void collect_block(ir_node *bb, void *data)
+{
+	profile_cfg_t *const cfg = (profile_cfg_t*)data;
+	cfg->block_nr[get_irn_idx(bb)] = ARR_LEN(cfg->blocks);
+	ARR_APP1(ir_node*, cfg->blocks, bb);
+}
+
+static void collect_site(ir_node *node, void *data)
+{
+	profile_cfg_t *const cfg = (profile_cfg_t*)data;
+	if (is_Switch(node) || (is_Call(node) && !is_Address(get_Call_ptr(node))))
+		ARR_APP1(ir_node*, cfg->sites, node);
+}
+
+static unsigned get_block_nr(const profile_cfg_t *cfg, const ir_node *bb)
+{
+	return cfg->block_nr[get_irn_idx(bb)];
+}
+
+/** FNV-1a on words. */
+static uint32_t checksum_add(uint32_t checksum, uint32_t value)
+{
+	return (checksum ^ value) * 16777619u;
+}
+
+static unsigned get_block_loop_depth(const ir_node *bb)
+{
+	ir_loop const *const loop = get_irn_loop(bb);
+	return loop != NULL ? get_loop_depth(loop) : 0;
+}
+
+static void add_edge(profile_cfg_t *cfg, unsigned src, unsigned dst, int pos)
+{
+	ir_node *const end = get_irg_end_block(cfg->irg);
+	unsigned       weight;
+	if (cfg->blocks[dst] == end) {
+		/* edges into the end block cannot be instrumented */
+		weight = UINT_MAX;
+	} else {
+		unsigned const src_depth = get_block_loop_depth(cfg->blocks[src]);
+		unsigned const dst_depth = get_block_loop_depth(cfg->blocks[dst]);
+		weight = MIN(src_depth, dst_depth);
 	}
+	profile_edge_t const edge = {
+		.src     = src,
+		.dst     = dst,
+		.pos     = pos,
+		.weight  = weight,
+		.counter = NO_COUNTER,
+		.count   = -1,
+	};
+	ARR_APP1(profile_edge_t, cfg->edges, edge);
+}
+
+typedef struct edge_order_t {
+	unsigned weight;
+	unsigned edge;
+} edge_order_t;
+
+static int cmp_edge_order(const void *a, const void *b)
+{
+	const edge_order_t *oa = (const edge_order_t*)a;
+	const edge_order_t *ob = (const edge_order_t*)b;
+	if (oa->weight != ob->weight)
+		return QSORT_CMP(ob->weight, oa->weight);
+	return QSORT_CMP(oa->edge, ob->edge);
+}
+
+/**
+ * Collects the CFG edges and chooses the edges to instrument: Only edges
+ * outside of a maximum spanning tree get a counter, the counts of the tree
+ * edges follow from flow conservation (Ball and Larus). Edges in deeper loops
+ * are put into the tree first.
+ */
+static void build_spanning_tree(profile_cfg_t *cfg)
+{
+	ir_graph *const irg      = cfg->irg;
+	size_t    const n_blocks = ARR_LEN(cfg->blocks);
+	unsigned  const end      = get_block_nr(cfg, get_irg_end_block(irg));
+	unsigned  const start    = get_block_nr(cfg, get_irg_start_block(irg));
+
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
+
+	cfg->edges   = NEW_ARR_F(profile_edge_t, 0);
+	cfg->n_succs = XMALLOCNZ(unsigned, n_blocks);
+	bool *const has_end_edge = XMALLOCNZ(bool, n_blocks);
+	for (unsigned b = 0; b < n_blocks; ++b) {
+		ir_node *const bb = cfg->blocks[b];
+		for (int pos = 0, arity = get_Block_n_cfgpreds(bb); pos < arity; ++pos) {
+			ir_node *const pred = get_Block_cfgpred_block(bb, pos);
+			if (pred == NULL)
+				continue;
+			unsigned const src = get_block_nr(cfg, pred);
+			++cfg->n_succs[src];
+			/* parallel edges into the end block are counted as one */
+			if (b == end) {
+				if (has_end_edge[src])
+					continue;
+				has_end_edge[src] = true;
+			}
+			add_edge(cfg, src, b, pos);
+		}
+	}
+	free(has_end_edge);
+
+	/* Virtual edges conserve the flow in every block: from blocks without
+	 * successors into the end block and from the end block to the start. */
+	for (unsigned b = 0; b < n_blocks; ++b) {
+		if (b != end && cfg->n_succs[b] == 0)
+			add_edge(cfg, b, end, -1);
+	}
+	add_edge(cfg, end, start, -1);
+
+	size_t        const n_edges = ARR_LEN(cfg->edges);
+	edge_order_t *const order   = XMALLOCN(edge_order_t, n_edges);
+	for (size_t i = 0; i < n_edges; ++i) {
+		order[i].weight = cfg->edges[i].weight;
+		order[i].edge   = i;
+	}
+	QSORT(order, n_edges, cmp_edge_order);
+
+	int *const uf = XMALLOCN(int, n_blocks);
+	uf_init(uf, n_blocks);
+	bool *const counted = XMALLOCNZ(bool, n_edges);
+	for (size_t i = 0; i < n_edges; ++i) {
+		profile_edge_t const *const edge = &cfg->edges[order[i].edge];
+		int const src = uf_find(uf, edge->src);
+		int const dst = uf_find(uf, edge->dst);
+		if (src != dst) {
+			uf_union(uf, src, dst);
+		} else {
+			/* the edges into the end block form a star */
+			assert(edge->dst != end);
+			counted[order[i].edge] = true;
+		}
+	}
+
+	/* number the counters in edge order */
+	cfg->n_counters = 0;
+	for (size_t i = 0; i < n_edges; ++i) {
+		if (counted[i])
+			cfg->edges[i].counter = cfg->n_counters++;
+	}
+
+	free(counted);
+	free(uf);
+	free(order);
+}
+
+static void build_profile_cfg(profile_cfg_t *cfg, ir_graph *irg,
+                              ir_profile_flags_t flags)
+{
+	memset(cfg, 0, sizeof(*cfg));
+	cfg->irg      = irg;
+	cfg->blocks   = NEW_ARR_F(ir_node*, 0);
+	cfg->block_nr = XMALLOCN(unsigned, get_irg_last_idx(irg));
+	irg_block_walk_graph(irg, collect_block, NULL, cfg);
+
+	cfg->sites = NEW_ARR_F(ir_node*, 0);
+	if (flags & ir_profile_values)
+		irg_walk_graph(irg, collect_site, NULL, cfg);
+
+	if (flags & ir_profile_edges) {
+		build_spanning_tree(cfg);
+	} else {
+		cfg->n_counters = ARR_LEN(cfg->blocks);
+	}
+
+	ir_entity *const entity   = get_irg_entity(irg);
+	uint32_t         checksum = 2166136261u;
+	checksum = checksum_add(checksum, hash_str(get_entity_ld_name(entity)));
+	checksum = checksum_add(checksum, ARR_LEN(cfg->blocks));
+	for (size_t b = 0, n = ARR_LEN(cfg->blocks); b < n; ++b) {
+		ir_node *const bb    = cfg->blocks[b];
+		int      const arity = get_Block_n_cfgpreds(bb);
+		checksum = checksum_add(checksum, arity);
+		for (int pos = 0; pos < arity; ++pos) {
+			ir_node *const pred = get_Block_cfgpred_block(bb, pos);
+			checksum = checksum_add(checksum, pred != NULL ? get_block_nr(cfg, pred) + 1 : 0);
+		}
+	}
+	checksum = checksum_add(checksum, ARR_LEN(cfg->sites));
+	for (size_t i = 0, n = ARR_LEN(cfg->sites); i < n; ++i)
+		checksum = checksum_add(checksum, get_irn_opcode(cfg->sites[i]));
+	cfg->checksum = checksum;
+}
+
+static void free_profile_cfg(profile_cfg_t *cfg)
+{
+	if (cfg->edges != NULL)
+		DEL_ARR_F(cfg->edges);
+	DEL_ARR_F(cfg->sites);
+	DEL_ARR_F(cfg->blocks);
+	free(cfg->n_succs);
+	free(cfg->block_nr);
+}
+
+static size_t get_record_words(const profile_cfg_t *cfg)
+{
+	return RECORD_HEADER_WORDS + cfg->n_counters
+	     + ARR_LEN(cfg->sites) * VALUE_SITE_WORDS;
 }
 
 /**
@@ -164,16 +493,55 @@ static ir_entity *get_init_firmprof_ref(void)
 	return new_entity(get_glob_type(), init_name, init_type);
 }
 
+/**
+ * Returns an entity representing the __firmprof_value function from
+ * libfirmprof, the equivalent of:
+ * extern void __firmprof_value(uint *site, uintptr_t value)
+ */
+static ir_entity *get_firmprof_value_ref(ir_mode *value_mode)
+{
+	ident   *const name    = new_id_from_str("__firmprof_value");
+	ir_type *const type    = new_type_method(2, 0, false, cc_cdecl_set, mtp_no_property);
+	ir_type *const uintptr = new_type_pointer(get_type_for_mode(mode_Iu));
+
+	set_method_param_type(type, 0, uintptr);
+	set_method_param_type(type, 1, get_type_for_mode(value_mode));
+
+	return new_entity(get_glob_type(), name, type);
+}
+
+/**
+ * Returns an entity representing the __firmprof_call function from
+ * libfirmprof, the equivalent of:
+ * extern void __firmprof_call(uint *site, void *target,
+ *                             void *const *functions, uint n_functions)
+ */
+static ir_entity *get_firmprof_call_ref(void)
+{
+	ident   *const name    = new_id_from_str("__firmprof_call");
+	ir_type *const type    = new_type_method(4, 0, false, cc_cdecl_set, mtp_no_property);
+	ir_type *const uint    = get_type_for_mode(mode_Iu);
+	ir_type *const uintptr = new_type_pointer(uint);
+	ir_type *const ptr     = new_type_pointer(get_type_for_mode(mode_Bu));
+
+	set_method_param_type(type, 0, uintptr);
+	set_method_param_type(type, 1, ptr);
+	set_method_param_type(type, 2, new_type_pointer(ptr));
+	set_method_param_type(type, 3, uint);
+
+	return new_entity(get_glob_type(), name, type);
+}
+
 /**
  * Generates a new irg which calls the initializer
  *
  * Pseudocode:
  *    static void __firmprof_initializer(void) __attribute__ ((constructor))
  *    {
- *        __init_firmprof(ent_filename, bblock_counts, n_blocks);
+ *        __init_firmprof(ent_filename, counters, n_words);
  *    }
  */
-static ir_graph *gen_initializer_irg(ir_entity *ent_filename, ir_entity *bblock_counts, int n_blocks)
+static ir_graph *gen_initializer_irg(ir_entity *ent_filename, ir_entity *counter_array, int n_words)
 {
 	ident     *const name  = new_id_from_str("__firmprof_initializer");
 	ir_type   *const owner = get_glob_type();
@@ -186,8 +554,8 @@ static ir_graph *gen_initializer_irg(ir_entity *ent_filename, ir_entity *bblock_
 	ir_entity *const init_ent  = get_init_firmprof_ref();
 	ir_node   *const callee    = new_r_Address(irg, init_ent);
 	ir_node   *const filename  = new_r_Address(irg, ent_filename);
-	ir_node   *const counters  = new_r_Address(irg, bblock_counts);
-	ir_node   *const size      = new_r_Const_long(irg, mode_Iu, n_blocks);
+	ir_node   *const counters  = new_r_Address(irg, counter_array);
+	ir_node   *const size      = new_r_Const_long(irg, mode_Iu, n_words);
 	ir_node   *const ins[]     = { filename, counters, size };
 	ir_type   *const call_type = get_entity_type(init_ent);
 	ir_node   *const call      = new_r_Call(bb, init_mem, callee, ARRAY_SIZE(ins), ins, call_type);
@@ -201,12 +569,47 @@ static ir_graph *gen_initializer_irg(ir_entity *ent_filename, ir_entity *bblock_
 	return irg;
 }
 
+typedef struct instrument_env_t {
+	ir_entity *counters;    /**< the counter array */
+	ir_entity *value_func;  /**< __firmprof_value */
+	ir_entity *call_func;   /**< __firmprof_call */
+	ir_entity *functions;   /**< addresses of all functions in irp order */
+	ir_mode   *value_mode;  /**< mode of profiled values */
+	unsigned   n_functions;
+} instrument_env_t;
+
 /**
- * Instrument a block with code needed for profiling.
+ * Appends instrumentation code to a block. @p first is the memory operation
+ * of the code, which lacks a memory argument yet, @p mem its memory result.
+ * The block link points to the memory result of the last code in the block,
+ * which in turn links to the first memory operation in the block.
+ */
+static void append_instrumentation(ir_node *bb, ir_node *first, ir_node *mem)
+{
+	ir_node *const last = (ir_node*)get_irn_link(bb);
+	if (last != NULL) {
+		set_memop_mem(first, last);
+		set_irn_link(mem, get_irn_link(last));
+	} else {
+		set_irn_link(mem, first);
+	}
+	set_irn_link(bb, mem);
+}
+
+static ir_node *get_word_address(ir_node *bb, ir_node *address, unsigned word)
+{
+	ir_graph *const irg      = get_irn_irg(bb);
+	ir_mode  *const mode_off = get_reference_offset_mode(get_irn_mode(address));
+	ir_node  *const cnst     = new_r_Const_long(irg, mode_off, get_mode_size_bytes(mode_Iu) * word);
+	return new_r_Add(bb, address, cnst);
+}
+
+/**
+ * Instrument a block with code incrementing the counter at index @p word.
  * This just inserts the instruction nodes, it doesn't connect the memory
  * nodes in a meaningful way.
  */
-static void instrument_block(ir_node *const bb, ir_node *const address, unsigned int const id)
+static void instrument_block(ir_node *const bb, ir_node *const address, unsigned int const word)
 {
 	ir_graph *const irg = get_irn_irg(bb);
 
@@ -218,9 +621,7 @@ static void instrument_block(ir_node *const bb, ir_node *const address, unsigned
 	ir_type *const type_ctr = get_array_element_type(type_arr);
 	ir_mode *const mode_ctr = get_type_mode(type_ctr);
 	ir_node *const unknown  = new_r_Unknown(irg, mode_M);
-	ir_mode *const mode_off = get_reference_offset_mode(get_irn_mode(address));
-	ir_node *const cnst     = new_r_Const_long(irg, mode_off, get_mode_size_bytes(mode_ctr) * id);
-	ir_node *const offset   = new_r_Add(bb, address, cnst);
+	ir_node *const offset   = get_word_address(bb, address, word);
 	ir_node *const load     = new_r_Load(bb, unknown, offset, mode_ctr, type_arr, cons_none);
 	ir_node *const lmem     = new_r_Proj(load, mode_M, pn_Load_M);
 	ir_node *const proji    = new_r_Proj(load, mode_ctr, pn_Load_res);
@@ -229,85 +630,193 @@ static void instrument_block(ir_node *const bb, ir_node *const address, unsigned
 	ir_node *const store    = new_r_Store(bb, lmem, offset, add, type_arr, cons_none);
 	ir_node *const smem     = new_r_Proj(store, mode_M, pn_Store_M);
 
-	set_irn_link(bb, smem);
-	set_irn_link(smem, load);
+	append_instrumentation(bb, load, smem);
 }
 
 /**
- * SSA Construction for instrumentation code memory.
- *
- * This introduces a new memory node and connects it to the instrumentation
- * codes, inserting phiM nodes as necessary. Note that afterwards, the new
- * memory is not connected to any return nodes and thus still dead.
+ * Returns the block counting a non-tree edge, splitting the edge if it is
+ * critical.
  */
-static void fix_ssa(ir_node *const bb, void *const data)
+static ir_node *get_edge_counter_block(profile_cfg_t *cfg,
+                                       const profile_edge_t *edge)
 {
-	(void)data;
+	ir_node *const src = cfg->blocks[edge->src];
+	ir_node *const dst = cfg->blocks[edge->dst];
+	if (edge->pos < 0) {
+		/* the edge to the start block is taken once per call, the others
+		 * from blocks without successors once per execution of the block */
+		return dst == get_irg_start_block(cfg->irg) ? dst : src;
+	}
+	if (get_Block_n_cfgpreds(dst) == 1)
+		return dst;
+	if (cfg->n_succs[edge->src] == 1)
+		return src;
+
+	ir_graph *const irg  = cfg->irg;
+	ir_node  *const pred = get_Block_cfgpred(dst, edge->pos);
+	int       const opt  = get_optimize();
+	set_optimize(0);
+	ir_node *const block = new_r_Block(irg, 1, &pred);
+	ir_node *const jmp   = new_r_Jmp(block);
+	set_optimize(opt);
+	set_Block_cfgpred(dst, edge->pos, jmp);
+	set_irn_link(block, NULL);
+	ARR_APP1(ir_node*, cfg->blocks, block);
+	return block;
+}
 
-	ir_graph *const irg = get_irn_irg(bb);
+/**
+ * Instrument a Switch or an indirect Call with a call recording the selector
+ * or the call target in the value site at index @p word.
+ */
+static void instrument_site(const instrument_env_t *env, ir_node *address,
+                            ir_node *site, unsigned word)
+{
+	ir_node  *const bb        = get_nodes_block(site);
+	ir_graph *const irg       = get_irn_irg(bb);
+	ir_node  *const unknown   = new_r_Unknown(irg, mode_M);
+	ir_node  *const site_addr = get_word_address(bb, address, word);
+	ir_node        *call;
+	if (is_Switch(site)) {
+		ir_node *const selector = get_Switch_selector(site);
+		ir_node *const value    = new_r_Conv(bb, selector, env->value_mode);
+		ir_node *const callee   = new_r_Address(irg, env->value_func);
+		ir_node *const ins[]    = { site_addr, value };
+		ir_type *const type     = get_entity_type(env->value_func);
+		call = new_r_Call(bb, unknown, callee, ARRAY_SIZE(ins), ins, type);
+	} else {
+		ir_node *const callee    = new_r_Address(irg, env->call_func);
+		ir_node *const functions = new_r_Address(irg, env->functions);
+		ir_node *const n_funcs   = new_r_Const_long(irg, mode_Iu, env->n_functions);
+		ir_node *const ins[]     = { site_addr, get_Call_ptr(site), functions, n_funcs };
+		ir_type *const type      = get_entity_type(env->call_func);
+		call = new_r_Call(bb, unknown, callee, ARRAY_SIZE(ins), ins, type);
+	}
+	ir_node *const mem = new_r_Proj(call, mode_M, pn_Call_M);
+	append_instrumentation(bb, call, mem);
+}
 
-	/* end blocks are not instrumented, skip! */
-	if (bb == get_irg_end_block(irg))
-		return;
+static ir_node *get_mem_out(ir_node **mem_in, ir_node *bb);
+
+/**
+ * SSA Construction for instrumentation code memory.
+ *
+ * Returns the instrumentation memory at the start of a block, inserting phiM
+ * nodes as necessary. Note that the new memory is not connected to any
+ * return nodes and thus still dead.
+ */
+static ir_node *get_mem_in(ir_node **mem_in, ir_node *bb)
+{
+	unsigned const idx = get_irn_idx(bb);
+	if (mem_in[idx] != NULL)
+		return mem_in[idx];
 
-	ir_node  *mem;
-	int const arity = get_Block_n_cfgpreds(bb);
+	ir_graph *const irg   = get_irn_irg(bb);
+	int       const arity = get_Block_n_cfgpreds(bb);
+	ir_node        *mem;
 	if (bb == get_irg_start_block(irg)) {
 		mem = get_irg_initial_mem(irg);
 	} else if (arity == 1) {
+		/* break cycles of unreachable blocks */
+		mem_in[idx] = new_r_NoMem(irg);
 		ir_node *const pred = get_Block_cfgpred_block(bb, 0);
-		mem = pred ? (ir_node*)get_irn_link(pred) : new_r_NoMem(irg);
+		mem = pred ? get_mem_out(mem_in, pred) : new_r_NoMem(irg);
 	} else {
-		ir_node **ins = ALLOCAN(ir_node*, arity);
+		ir_node  *const unknown = new_r_Unknown(irg, mode_M);
+		ir_node **const ins     = ALLOCAN(ir_node*, arity);
+		for (int n = arity; n-- != 0;)
+			ins[n] = unknown;
+		int const opt = get_optimize();
+		set_optimize(0);
+		mem = new_r_Phi(bb, arity, ins, mode_M);
+		set_optimize(opt);
+		mem_in[idx] = mem;
+
 		for (int n = arity; n-- != 0;) {
 			ir_node *const pred = get_Block_cfgpred_block(bb, n);
-			ins[n] = pred ? (ir_node*)get_irn_link(pred) : new_r_NoMem(irg);
+			set_Phi_pred(mem, n, pred ? get_mem_out(mem_in, pred) : new_r_NoMem(irg));
 		}
-		mem = new_r_Phi(bb, arity, ins, mode_M);
 	}
-
-	/* The block link fields point to the projm from the instrumentation code,
-	 * the projm in turn links to the initial load which lacks a memory
-	 * argument at this point. */
-	ir_node *const proj = (ir_node*)get_irn_link(bb);
-	ir_node *const load = (ir_node*)get_irn_link(proj);
-	set_Load_mem(load, mem);
+	mem_in[idx] = mem;
+	return mem;
 }
 
 /**
- * Instrument a single block.
+ * Returns the instrumentation memory at the end of a block.
  */
-static void block_instrument_walker(ir_node *bb, void *data)
+static ir_node *get_mem_out(ir_node **mem_in, ir_node *bb)
+{
+	ir_node *const last = (ir_node*)get_irn_link(bb);
+	return last != NULL ? last : get_mem_in(mem_in, bb);
+}
+
+static void fix_ssa(ir_node **mem_in, ir_node *bb)
 {
-	block_id_walker_data_t *wd = (block_id_walker_data_t*)data;
-	instrument_block(bb, wd->counters, wd->id);
-	++wd->id;
+	ir_node *const last = (ir_node*)get_irn_link(bb);
+	if (last == NULL)
+		return;
+	ir_node *const first = (ir_node*)get_irn_link(last);
+	set_memop_mem(first, get_mem_in(mem_in, bb));
 }
 
 /**
  * Synchronize the original memory input of node with the additional operand
  * from the profiling code.
  */
-static ir_node *sync_mem(ir_node *bb, ir_node *mem)
+static ir_node *sync_mem(ir_node **mem_in, ir_node *bb, ir_node *mem)
 {
-	ir_node *const ins[] = { (ir_node*)get_irn_link(bb), mem };
+	ir_node *const prof_mem = get_mem_out(mem_in, bb);
+	/* no profiling code on the way to this block */
+	if (prof_mem == get_irg_initial_mem(get_irn_irg(bb)))
+		return mem;
+	ir_node *const ins[] = { prof_mem, mem };
 	return new_r_Sync(bb, ARRAY_SIZE(ins), ins);
 }
 
 /**
- * Instrument a single ir_graph, counters should point to the bblock
- * counters array.
+ * Instrument a single ir_graph, its record in the counter array starts at
+ * index @p base.
  */
-static void instrument_irg(ir_graph *irg, ir_entity *counters, block_id_walker_data_t *wd)
+static void instrument_irg(ir_graph *irg, profile_cfg_t *cfg, unsigned base,
+                           const instrument_env_t *env)
 {
+	size_t const n_blocks = ARR_LEN(cfg->blocks);
+	size_t const n_sites  = ARR_LEN(cfg->sites);
+	if (cfg->n_counters == 0 && n_sites == 0)
+		return;
+
 	/* generate a node pointing to the count array */
-	wd->counters = new_r_Address(irg, counters);
+	ir_node *const address = new_r_Address(irg, env->counters);
 
 	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
+	for (size_t b = 0; b < n_blocks; ++b)
+		set_irn_link(cfg->blocks[b], NULL);
+
+	unsigned const counters = base + RECORD_HEADER_WORDS;
+	bool           split    = false;
+	if (cfg->edges == NULL) {
+		/* instrument each block in the current irg */
+		for (size_t b = 0; b < n_blocks; ++b)
+			instrument_block(cfg->blocks[b], address, counters + b);
+	} else {
+		for (size_t i = 0, n = ARR_LEN(cfg->edges); i < n; ++i) {
+			profile_edge_t const *const edge = &cfg->edges[i];
+			if (edge->counter == NO_COUNTER)
+				continue;
+			ir_node *const bb = get_edge_counter_block(cfg, edge);
+			split |= bb != cfg->blocks[edge->src] && bb != cfg->blocks[edge->dst];
+			instrument_block(bb, address, counters + edge->counter);
+		}
+	}
+
+	unsigned const sites = counters + cfg->n_counters;
+	for (size_t i = 0; i < n_sites; ++i)
+		instrument_site(env, address, cfg->sites[i], sites + i * VALUE_SITE_WORDS);
 
-	/* instrument each block in the current irg */
-	irg_block_walk_graph(irg, block_instrument_walker, NULL, wd);
-	irg_block_walk_graph(irg, fix_ssa, NULL, NULL);
+	/* split edges appended their blocks */
+	ir_node **const mem_in = XMALLOCNZ(ir_node*, get_irg_last_idx(irg));
+	for (size_t b = 0, n = ARR_LEN(cfg->blocks); b < n; ++b)
+		fix_ssa(mem_in, cfg->blocks[b]);
 
 	/* connect the new memory nodes to the return nodes */
 	ir_node *const endbb = get_irg_end_block(irg);
@@ -321,11 +830,11 @@ static void instrument_irg(ir_graph *irg, ir_entity *counters, block_id_walker_d
 		switch (get_irn_opcode(node)) {
 		case iro_Return:
 			mem = get_Return_mem(node);
-			set_Return_mem(node, sync_mem(bb, mem));
+			set_Return_mem(node, sync_mem(mem_in, bb, mem));
 			break;
 		case iro_Raise:
 			mem = get_Raise_mem(node);
-			set_Raise_mem(node, sync_mem(bb, mem));
+			set_Raise_mem(node, sync_mem(mem_in, bb, mem));
 			break;
 		case iro_Bad:
 			break;
@@ -343,23 +852,25 @@ static void instrument_irg(ir_graph *irg, ir_entity *counters, block_id_walker_d
 		if (is_Call(node)) {
 			ir_node *const bb  = get_nodes_block(node);
 			ir_node *const mem = get_Call_mem(node);
-			set_Call_mem(node, sync_mem(bb, mem));
+			set_Call_mem(node, sync_mem(mem_in, bb, mem));
 		}
 	}
 
+	free(mem_in);
 	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+	if (split)
+		clear_irg_properties(irg, IR_GRAPH_PROPERTIES_CONTROL_FLOW);
 }
 
 /**
  * Creates a new entity representing the equivalent of
- * static <element_mode> <name>[<length>];
+ * static <element_type> <name>[<length>];
  */
-static ir_entity *new_array_entity(ident *const name, ir_mode *const element_mode, unsigned const length, ir_linkage const linkage)
+static ir_entity *new_array_entity(char const *const name, ir_type *const element_type, unsigned const length, ir_linkage const linkage)
 {
-	ir_type *const element_type = get_type_for_mode(element_mode);
-	ir_type *const array_type   = new_type_array(element_type, length);
-	ident   *const id           = new_id_from_str(name);
-	ir_type *const owner        = get_glob_type();
+	ir_type *const array_type = new_type_array(element_type, length);
+	ident   *const id         = new_id_from_str(name);
+	ir_type *const owner      = get_glob_type();
 	return new_global_entity(owner, id, array_type, ir_visibility_private, linkage);
 }
 
@@ -372,7 +883,7 @@ static ir_entity *new_static_string_entity(char const *const name, char const *c
 	/* Create the type for a fixed-length string */
 	ir_mode   *const mode   = mode_Bs;
 	size_t     const length = strlen(string) + 1;
-	ir_entity *const result = new_array_entity(name, mode, length, IR_LINKAGE_CONSTANT);
+	ir_entity *const result = new_array_entity(name, get_type_for_mode(mode), length, IR_LINKAGE_CONSTANT);
 
 	/* There seems to be no simpler way to do this. Or at least, cparser
 	 * does exactly the same thing... */
@@ -387,35 +898,106 @@ static ir_entity *new_static_string_entity(char const *const name, char const *c
 	return result;
 }
 
-ir_graph *ir_profile_instrument(const char *filename)
+static void set_word(ir_initializer_t *init, size_t index, uint32_t value)
+{
+	ir_tarval *const tv = new_tarval_from_long(value, mode_Iu);
+	set_initializer_compound_value(init, index, create_initializer_tarval(tv));
+}
+
+/**
+ * Creates the table of all function addresses, which maps indirect call
+ * targets to functions.
+ */
+static ir_entity *new_functions_entity(void)
+{
+	size_t     const n_irgs  = get_irp_n_irgs();
+	ir_type   *const ptr     = new_type_pointer(get_type_for_mode(mode_Bu));
+	ir_entity *const result  = new_array_entity("__FIRMPROF__FUNCTIONS", ptr, n_irgs, IR_LINKAGE_CONSTANT);
+	ir_graph  *const const_irg = get_const_code_irg();
+
+	ir_initializer_t *const contents = create_initializer_compound(n_irgs);
+	foreach_irp_irg(i, irg) {
+		ir_entity *const entity = get_irg_entity(irg);
+		if (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN)
+			continue;
+		ir_node *const address = new_r_Address(const_irg, entity);
+		set_initializer_compound_value(contents, i, create_initializer_const(address));
+	}
+	set_entity_initializer(result, contents);
+
+	return result;
+}
+
+ir_graph *ir_profile_instrument(const char *filename, ir_profile_flags_t flags)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.ir.profile");
 
 	/* Don't do anything for modules without code. Else the linker will
 	 * complain. */
-	if (get_irp_n_irgs() == 0)
+	size_t const n_irgs = get_irp_n_irgs();
+	if (n_irgs == 0)
 		return NULL;
 
-	/* count the number of block first */
-	unsigned const n_blocks = get_irp_n_blocks();
+	/* number blocks, counters and value sites first */
+	profile_cfg_t *const cfgs    = XMALLOCN(profile_cfg_t, n_irgs);
+	size_t               n_words = PROFILE_HEADER_WORDS;
+	bool                 has_switch = false;
+	bool                 has_icall  = false;
+	foreach_irp_irg(i, irg) {
+		profile_cfg_t *const cfg = &cfgs[i];
+		build_profile_cfg(cfg, irg, flags);
+		n_words += get_record_words(cfg);
+		for (size_t s = 0, n = ARR_LEN(cfg->sites); s < n; ++s) {
+			if (is_Switch(cfg->sites[s])) {
+				has_switch = true;
+			} else {
+				has_icall = true;
+			}
+		}
+	}
 
 	/* create all the necessary types and entities. Note that the
 	 * types must have a fixed layout, because we are already running in the
 	 * backend */
-	ir_entity *const bblock_counts = new_array_entity("__FIRMPROF__BLOCK_COUNTS", mode_Iu, n_blocks, IR_LINKAGE_DEFAULT);
+	ir_type   *const uint     = get_type_for_mode(mode_Iu);
+	ir_entity *const counters = new_array_entity("__FIRMPROF__COUNTERS", uint, n_words, IR_LINKAGE_DEFAULT);
+	ir_initializer_t *const init = create_initializer_compound(n_words);
+	set_word(init, 0, PROFILE_MAGIC);
+	set_word(init, 1, PROFILE_VERSION);
+	set_word(init, 2, flags);
+	set_word(init, 3, n_irgs);
 
 	ir_entity *const ent_filename = new_static_string_entity("__FIRMPROF__FILE_NAME", filename);
 
-	/* initialize block id array and instrument blocks */
-	block_id_walker_data_t wd = { .id = 0 };
-	foreach_irp_irg_r(i, irg) {
-		instrument_irg(irg, bblock_counts, &wd);
+	instrument_env_t env = {
+		.counters    = counters,
+		.value_mode  = get_mode_size_bits(mode_P) > 32 ? mode_Lu : mode_Iu,
+		.n_functions = n_irgs,
+	};
+	if (has_switch)
+		env.value_func = get_firmprof_value_ref(env.value_mode);
+	if (has_icall) {
+		env.call_func = get_firmprof_call_ref();
+		env.functions = new_functions_entity();
 	}
 
-	return gen_initializer_irg(ent_filename, bblock_counts, n_blocks);
+	size_t base = PROFILE_HEADER_WORDS;
+	foreach_irp_irg(i, irg) {
+		profile_cfg_t *const cfg = &cfgs[i];
+		set_word(init, base,     cfg->checksum);
+		set_word(init, base + 1, cfg->n_counters);
+		set_word(init, base + 2, ARR_LEN(cfg->sites));
+		instrument_irg(irg, cfg, base, &env);
+		base += get_record_words(cfg);
+		free_profile_cfg(cfg);
+	}
+	free(cfgs);
+	set_entity_initializer(counters, init);
+
+	return gen_initializer_irg(ent_filename, counters, n_words);
 }
 
-static unsigned int *parse_profile(const char *filename, unsigned int num_blocks)
+static uint32_t *parse_profile(const char *filename)
 {
 	FILE *const f = fopen(filename, "rb");
 	if (!f) {
@@ -432,23 +1014,22 @@ static unsigned int *parse_profile(const char *filename, unsigned int num_blocks
 		goto end;
 	}
 
-	result = XMALLOCN(unsigned int, num_blocks);
-
 	/* The profiling output format is defined to be a sequence of integer
 	 * values stored little endian format. */
-	for (unsigned i = 0; i < num_blocks; ++i) {
-		unsigned char bytes[4];
-		if ((ret = fread(bytes, 1, 4, f)) < 1)
-			break;
-
-		result[i] = (bytes[0] <<  0) | (bytes[1] <<  8)
-		          | (bytes[2] << 16) | (bytes[3] << 24);
+	result = NEW_ARR_F(uint32_t, 0);
+	unsigned char bytes[4];
+	while (fread(bytes, 1, 4, f) == 4) {
+		uint32_t const word = (uint32_t)bytes[0] << 0
+		                    | (uint32_t)bytes[1] << 8
+		                    | (uint32_t)bytes[2] << 16
+		                    | (uint32_t)bytes[3] << 24;
+		ARR_APP1(uint32_t, result, word);
 	}
 
-	if (ret < 1) {
-		DBG((dbg, LEVEL_4, "Failed to read counters... (size: %u)\n",
-			sizeof(unsigned int) * num_blocks));
-		free(result);
+	if (ARR_LEN(result) < PROFILE_HEADER_WORDS
+	    || result[0] != PROFILE_MAGIC || result[1] != PROFILE_VERSION) {
+		DBG((dbg, LEVEL_2, "Unsupported profile version\n"));
+		DEL_ARR_F(result);
 		result = NULL;
 	}
 
@@ -458,24 +1039,143 @@ end:
 }
 
 /**
- * Reads the corresponding profile info file if it exists.
+ * Computes the counts of the spanning tree edges. The virtual edges conserve
+ * the flow in every block, so a block with a single unknown edge determines
+ * its count.
  */
-static void block_associate_walker(ir_node *bb, void *env)
+static void solve_edge_counts(profile_cfg_t *cfg, const uint32_t *counters)
 {
-	block_assoc_t *b = (block_assoc_t*)env;
-	execcount_t query;
+	size_t const n_blocks = ARR_LEN(cfg->blocks);
+	size_t const n_edges  = ARR_LEN(cfg->edges);
+
+	/* known incoming minus known outgoing flow */
+	int64_t  *const balance   = XMALLOCNZ(int64_t, n_blocks);
+	unsigned *const n_unknown = XMALLOCNZ(unsigned, n_blocks);
+	unsigned *const first     = XMALLOCNZ(unsigned, n_blocks + 1);
+	unsigned *const incident  = XMALLOCN(unsigned, 2 * n_edges);
+	for (size_t i = 0; i < n_edges; ++i) {
+		profile_edge_t *const edge = &cfg->edges[i];
+		++first[edge->src + 1];
+		++first[edge->dst + 1];
+		if (edge->counter != NO_COUNTER) {
+			edge->count = counters[edge->counter];
+			balance[edge->dst] += edge->count;
+			balance[edge->src] -= edge->count;
+		} else {
+			++n_unknown[edge->src];
+			++n_unknown[edge->dst];
+		}
+	}
+	for (size_t b = 0; b < n_blocks; ++b)
+		first[b + 1] += first[b];
+	unsigned *const fill = XMALLOCN(unsigned, n_blocks);
+	memcpy(fill, first, n_blocks * sizeof(*fill));
+	for (size_t i = 0; i < n_edges; ++i) {
+		incident[fill[cfg->edges[i].src]++] = i;
+		incident[fill[cfg->edges[i].dst]++] = i;
+	}
+	free(fill);
 
-	query.block = get_irn_node_nr(bb);
-	query.count = b->counters[b->i++];
-	DBG((dbg, LEVEL_4, "execcount(%+F, %u): %u\n", bb, query.block, query.count));
-	(void)set_insert(execcount_t, profile, &query, sizeof(query), query.block);
+	unsigned *worklist = NEW_ARR_F(unsigned, 0);
+	for (size_t b = 0; b < n_blocks; ++b) {
+		if (n_unknown[b] == 1)
+			ARR_APP1(unsigned, worklist, b);
+	}
+	while (ARR_LEN(worklist) > 0) {
+		unsigned const b = worklist[ARR_LEN(worklist) - 1];
+		ARR_SHRINKLEN(worklist, ARR_LEN(worklist) - 1);
+		if (n_unknown[b] != 1)
+			continue;
+
+		profile_edge_t *edge = NULL;
+		for (unsigned i = first[b]; i < first[b + 1]; ++i) {
+			edge = &cfg->edges[incident[i]];
+			if (edge->count < 0)
+				break;
+		}
+		assert(edge != NULL && edge->count < 0);
+		int64_t count = edge->dst == b ? -balance[b] : balance[b];
+		/* calls of exit() and the like break the flow conservation */
+		if (count < 0)
+			count = 0;
+		edge->count = count;
+		balance[edge->dst] += count;
+		balance[edge->src] -= count;
+		--n_unknown[edge->src];
+		--n_unknown[edge->dst];
+		unsigned const other = edge->dst == b ? edge->src : edge->dst;
+		if (n_unknown[other] == 1)
+			ARR_APP1(unsigned, worklist, other);
+	}
+	DEL_ARR_F(worklist);
+
+	for (size_t i = 0; i < n_edges; ++i) {
+		if (cfg->edges[i].count < 0)
+			cfg->edges[i].count = 0;
+	}
+
+	free(incident);
+	free(first);
+	free(n_unknown);
+	free(balance);
 }
 
-static void irp_associate_blocks(block_assoc_t *env)
+static int cmp_profile_values(const void *a, const void *b)
 {
-	foreach_irp_irg_r(i, irg) {
-		irg_block_walk_graph(irg, block_associate_walker, NULL, env);
+	const ir_profile_value_t *va = (const ir_profile_value_t*)a;
+	const ir_profile_value_t *vb = (const ir_profile_value_t*)b;
+	return QSORT_CMP(vb->count, va->count);
+}
+
+static void associate_values(ir_node *site, const uint32_t *words)
+{
+	value_profile_t entry;
+	memset(&entry, 0, sizeof(entry));
+	entry.node = get_irn_node_nr(site);
+	for (unsigned i = 0; i < IR_PROFILE_N_VALUES; ++i) {
+		uint32_t const *const slot = &words[3 * i];
+		if (slot[2] == 0)
+			continue;
+		ir_profile_value_t *const value = &entry.values[entry.n_values++];
+		value->value = slot[0] | (uint64_t)slot[1] << 32;
+		value->count = slot[2];
+		if (is_Call(site) && value->value < get_irp_n_irgs())
+			value->callee = get_irg_entity(get_irp_irg(value->value));
+	}
+	QSORT(entry.values, entry.n_values, cmp_profile_values);
+	(void)set_insert(value_profile_t, value_profile, &entry, sizeof(entry), hash_value_profile(&entry));
+}
+
+/**
+ * Associates the counters of a profile record with the blocks, edges and
+ * value sites of a graph.
+ */
+static void associate_record(profile_cfg_t *cfg, const uint32_t *counters)
+{
+	size_t const n_blocks = ARR_LEN(cfg->blocks);
+	if (cfg->edges == NULL) {
+		for (size_t b = 0; b < n_blocks; ++b)
+			set_execcount(cfg->blocks[b], -1, counters[b]);
+	} else {
+		solve_edge_counts(cfg, counters);
+
+		ir_node  *const end          = get_irg_end_block(cfg->irg);
+		uint64_t *const block_counts = XMALLOCNZ(uint64_t, n_blocks);
+		for (size_t i = 0, n = ARR_LEN(cfg->edges); i < n; ++i) {
+			profile_edge_t const *const edge = &cfg->edges[i];
+			ir_node              *const dst  = cfg->blocks[edge->dst];
+			block_counts[edge->dst] += edge->count;
+			if (edge->pos >= 0 && dst != end)
+				set_execcount(dst, edge->pos, edge->count);
+		}
+		for (size_t b = 0; b < n_blocks; ++b)
+			set_execcount(cfg->blocks[b], -1, block_counts[b]);
+		free(block_counts);
 	}
+
+	const uint32_t *const sites = counters + cfg->n_counters;
+	for (size_t i = 0, n = ARR_LEN(cfg->sites); i < n; ++i)
+		associate_values(cfg->sites[i], sites + i * VALUE_SITE_WORDS);
 }
 
 void ir_profile_free(void)
@@ -484,6 +1184,10 @@ void ir_profile_free(void)
 		del_set(profile);
 		profile = NULL;
 	}
+	if (value_profile) {
+		del_set(value_profile);
+		value_profile = NULL;
+	}
 
 	if (hook != NULL) {
 		dump_remove_node_info_callback(hook);
@@ -495,19 +1199,51 @@ bool ir_profile_read(const char *filename)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.ir.profile");
 
-	unsigned n_blocks = get_irp_n_blocks();
-	block_assoc_t env = {
-		.i        = 0,
-		.counters = parse_profile(filename, n_blocks)
-	};
-	if (!env.counters)
+	uint32_t *const words = parse_profile(filename);
+	if (!words)
 		return false;
 
+	size_t const n_words = ARR_LEN(words);
+	if (words[3] != get_irp_n_irgs()) {
+		DBG((dbg, LEVEL_2, "Profile is for a different program\n"));
+		DEL_ARR_F(words);
+		return false;
+	}
+	ir_profile_flags_t const flags = (ir_profile_flags_t)words[2];
+
 	ir_profile_free();
-	profile = new_set(cmp_execcount, 16);
+	profile       = new_set(cmp_execcount, 16);
+	value_profile = new_set(cmp_value_profile, 16);
+
+	size_t pos = PROFILE_HEADER_WORDS;
+	foreach_irp_irg(i, irg) {
+		if (pos + RECORD_HEADER_WORDS > n_words) {
+			DBG((dbg, LEVEL_2, "Profile is truncated\n"));
+			break;
+		}
+		uint32_t const checksum   = words[pos];
+		uint32_t const n_counters = words[pos + 1];
+		uint32_t const n_sites    = words[pos + 2];
+		size_t   const next       = pos + RECORD_HEADER_WORDS + n_counters
+		                          + (size_t)n_sites * VALUE_SITE_WORDS;
+		if (next > n_words) {
+			DBG((dbg, LEVEL_2, "Profile is truncated\n"));
+			break;
+		}
 
-	irp_associate_blocks(&env);
-	free(env.counters);
+		profile_cfg_t cfg;
+		build_profile_cfg(&cfg, irg, flags);
+		if (cfg.checksum != checksum || cfg.n_counters != n_counters
+		    || ARR_LEN(cfg.sites) != n_sites) {
+			/* the function falls back to estimated frequencies */
+			DBG((dbg, LEVEL_2, "Profile does not match %+F\n", irg));
+		} else {
+			associate_record(&cfg, words + pos + RECORD_HEADER_WORDS);
+		}
+		free_profile_cfg(&cfg);
+		pos = next;
+	}
+	DEL_ARR_F(words);
 
 	/* register the vcg hook */
 	hook = dump_add_node_info_callback(dump_profile_node_info, NULL);
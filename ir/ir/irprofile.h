@@ -17,13 +17,33 @@
 
 #include "firm_types.h"
 
+/** Number of values recorded per value profiling site. */
+#define IR_PROFILE_N_VALUES 4
+
+typedef enum ir_profile_flags_t {
+	/** count the executions of every basic block */
+	ir_profile_blocks = 0,
+	/** count control flow edges, with counters only on edges outside of a
+	 * spanning tree of the CFG */
+	ir_profile_edges  = 1U << 0,
+	/** record the most frequent Switch selectors and indirect call targets */
+	ir_profile_values = 1U << 1,
+} ir_profile_flags_t;
+
+/** A profiled value of a Switch selector or an indirect call target. */
+typedef struct ir_profile_value_t {
+	uint64_t   value;  /**< the selector or the index of the callee */
+	ir_entity *callee; /**< the callee of an indirect call, NULL if unknown */
+	uint32_t   count;  /**< how often the value occurred */
+} ir_profile_value_t;
+
 /**
  * Instruments all irgs in the program with profile code.
- * The final code will have a counter for each basic block which is
- * incremented in that block. After the program has run the info is written
- * to @p filename.
+ * The final code will have a counter for each basic block (or each
+ * instrumented edge, see @p flags) which is incremented in that block.
+ * After the program has run the info is written to @p filename.
  */
-ir_graph *ir_profile_instrument(const char *filename);
+ir_graph *ir_profile_instrument(const char *filename, ir_profile_flags_t flags);
 
 /**
  * Reads the corresponding profile info file if it exists and returns a
@@ -37,11 +57,45 @@ bool ir_profile_read(const char *filename);
  */
 void ir_profile_free(void);
 
+/**
+ * Check whether a profile has been read.
+ */
+bool ir_profile_has_data(void);
+
 /**
  * Get block execution count as determined be profiling
  */
 uint32_t ir_profile_get_block_execcount(const ir_node *block);
 
+/**
+ * Sets the execution count of @p block as if it had been read from a profile.
+ * Used to test the passes which use the profile.
+ */
+void ir_profile_set_block_execcount(const ir_node *block, uint32_t count);
+
+/**
+ * Check whether @p block was never executed in a profiled run which executed
+ * its function.
+ * @return false if the profile contains no data for the block
+ */
+bool ir_profile_is_block_cold(const ir_node *block);
+
+/**
+ * Get the execution frequency of the control flow edge into @p block at
+ * cfgpred @p pos, relative to the function entry, as determined by edge
+ * profiling.
+ * @return false if the profile contains no data for the edge
+ */
+bool ir_profile_get_edge_execfreq(const ir_node *block, int pos, double *freq);
+
+/**
+ * Get the most frequent values of a Switch selector or of the target of an
+ * indirect Call, ordered by decreasing count.
+ * @return the number of values stored to @p values
+ */
+unsigned ir_profile_get_values(const ir_node *node,
+                               ir_profile_value_t values[IR_PROFILE_N_VALUES]);
+
 /**
  * Initializes exec_freq structure for an irg based on profile data
  */
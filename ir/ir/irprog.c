@@ -23,6 +23,7 @@
 #define INITAL_PROG_NAME "no_name_set"
 
 ir_prog *irp;
+ir_mutex_t irp_mutex = IR_MUTEX_INITIALIZER;
 ir_prog *get_irp(void) { return irp; }
 void set_irp(ir_prog *new_irp)
 {
@@ -94,10 +95,10 @@ void free_ir_prog(void)
 	if (irp == NULL)
 		return;
 
-	/* must iterate backwards here */
-	foreach_irp_irg_r(i, irg) {
-		free_ir_graph(irg);
-	}
+	/* must iterate backwards here, stub graphs are freed without reading
+	 * them */
+	for (size_t i = get_irp_n_irgs(); i-- > 0;)
+		free_ir_graph(get_irp_irg_or_stub(i));
 
 	/* free entities first to avoid entity types being destroyed before
 	 * the entities using them */
@@ -159,7 +160,10 @@ ir_type *(get_tls_type)(void)
 
 ir_entity *ir_get_global(ident *name)
 {
-	return pmap_get(ir_entity, irp->globals, name);
+	ir_mutex_lock(&irp_mutex);
+	ir_entity *const entity = pmap_get(ir_entity, irp->globals, name);
+	ir_mutex_unlock(&irp_mutex);
+	return entity;
 }
 
 void add_irp_irg(ir_graph *irg)
@@ -212,7 +216,9 @@ void add_irp_type(ir_type *typ)
 {
 	assert(typ != NULL);
 	assert(irp);
+	ir_mutex_lock(&irp_mutex);
 	ARR_APP1(ir_type *, irp->types, typ);
+	ir_mutex_unlock(&irp_mutex);
 }
 
 void remove_irp_type(ir_type *typ)
@@ -220,6 +226,7 @@ void remove_irp_type(ir_type *typ)
 	size_t i, l;
 	assert(typ);
 
+	ir_mutex_lock(&irp_mutex);
 	l = ARR_LEN(irp->types);
 	for (i = 0; i < l; ++i) {
 		if (irp->types[i] == typ) {
@@ -230,6 +237,7 @@ void remove_irp_type(ir_type *typ)
 			break;
 		}
 	}
+	ir_mutex_unlock(&irp_mutex);
 }
 
 size_t (get_irp_n_types) (void)
@@ -17,6 +17,7 @@
 #include "array.h"
 #include "callgraph.h"
 #include "irmemory.h"
+#include "irthread.h"
 #include "pmap.h"
 #include "typerep.h"
 
@@ -43,6 +44,7 @@ struct ir_prog {
 	ir_graph  *main_irg;            /**< The entry point to the compiled program
 	                                     or NULL if no point exists. */
 	ir_graph **graphs;              /**< A list of all graphs in the ir. */
+	size_t     n_stub_irgs;         /**< graphs not read from a file yet */
 	pmap      *globals;             /**< Map identifiers to global entities. */
 	/** This graph holds nodes for global entity initialization expressions.
 	 * It is not a function. */
@@ -98,7 +100,22 @@ static inline size_t get_irp_n_irgs_(void)
 	return ARR_LEN(irp->graphs);
 }
 
+/**
+ * Returns @p irg, or if it is a stub graph the graph read from its file
+ * in its place. This is not thread safe, ir_pipeline_run() gets all graphs
+ * before it starts its threads.
+ */
+ir_graph *materialize_irg(ir_graph *irg);
+
 static inline ir_graph *get_irp_irg_(size_t pos)
+{
+	assert(pos < ARR_LEN(irp->graphs));
+	ir_graph *const irg = irp->graphs[pos];
+	return irp->n_stub_irgs == 0 ? irg : materialize_irg(irg);
+}
+
+/** Returns the graph at position @p pos without reading stub graphs. */
+static inline ir_graph *get_irp_irg_or_stub(size_t pos)
 {
 	assert(pos < ARR_LEN(irp->graphs));
 	return irp->graphs[pos];
@@ -116,10 +133,16 @@ static inline ir_type *get_irp_type_(size_t pos)
 	return irp->types[pos];
 }
 
+/**
+ * Serializes changes of the type list, of compound members and of the map of
+ * global entities while several threads create types and entities.
+ */
+extern ir_mutex_t irp_mutex;
+
 /** Returns a new, unique number to number nodes or the like. */
 static inline long get_irp_new_node_nr(void)
 {
-	return irp->max_node_nr++;
+	return ir_atomic_fetch_inc(&irp->max_node_nr);
 }
 
 static inline size_t get_irp_new_irg_idx(void)
@@ -0,0 +1,150 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief     Value number table for common subexpression elimination.
+ */
+#include "irvaluetable.h"
+
+#include "bitfiddle.h"
+#include "xmalloc.h"
+#include <assert.h>
+#include <stdlib.h>
+
+/** Minimum number of buckets. */
+#define MIN_BUCKETS     32
+/** Old buckets migrated per insertion while the table grows. Growing doubles
+ * the bucket count at half load, so the migration is always finished before
+ * the next growth starts. */
+#define MIGRATE_BUCKETS 4
+
+static ir_valuetable_entry_t *find_in(ir_valuetable_cmp_func cmp,
+                                      ir_valuetable_entry_t *entries,
+                                      size_t n_buckets, const ir_node *node,
+                                      unsigned hash)
+{
+	size_t const mask = n_buckets - 1;
+	size_t       pos  = hash & mask;
+	for (size_t num_probes = 0;; ) {
+		ir_valuetable_entry_t *const entry = &entries[pos];
+		if (entry->node == NULL)
+			return entry;
+		if (entry->hash == hash && cmp(entry->node, node) == 0)
+			return entry;
+		++num_probes;
+		pos = (pos + num_probes) & mask;
+		assert(num_probes < n_buckets);
+	}
+}
+
+static void migrate(ir_valuetable_t *table, size_t n)
+{
+	ir_valuetable_entry_t *const old = table->old_entries;
+	size_t const n_old = table->n_old_buckets;
+	size_t const mask  = table->n_buckets - 1;
+	size_t       pos   = table->migrate_pos;
+	for (size_t const end = pos + n < n_old ? pos + n : n_old; pos < end;
+	     ++pos) {
+		ir_valuetable_entry_t const *const entry = &old[pos];
+		if (entry->node == NULL)
+			continue;
+		/* entries in the table are unique, so just find a free bucket */
+		size_t p = entry->hash & mask;
+		for (size_t num_probes = 0; table->entries[p].node != NULL; )
+			p = (p + ++num_probes) & mask;
+		table->entries[p] = *entry;
+	}
+	table->migrate_pos = pos;
+	if (pos == n_old) {
+		free(old);
+		table->old_entries   = NULL;
+		table->n_old_buckets = 0;
+	}
+}
+
+static void grow(ir_valuetable_t *table)
+{
+	/* the previous migration is finished early on purpose, see above */
+	if (table->old_entries != NULL)
+		migrate(table, table->n_old_buckets);
+
+	table->old_entries   = table->entries;
+	table->n_old_buckets = table->n_buckets;
+	table->migrate_pos   = 0;
+	table->n_buckets    *= 2;
+	table->entries       = XMALLOCNZ(ir_valuetable_entry_t, table->n_buckets);
+}
+
+ir_valuetable_t *new_ir_valuetable(ir_valuetable_cmp_func cmp,
+                                   size_t expected_elements)
+{
+	size_t n_buckets = ceil_po2(2 * expected_elements);
+	if (n_buckets < MIN_BUCKETS)
+		n_buckets = MIN_BUCKETS;
+
+	ir_valuetable_t *const table = XMALLOCZ(ir_valuetable_t);
+	table->cmp       = cmp;
+	table->n_buckets = n_buckets;
+	table->entries   = XMALLOCNZ(ir_valuetable_entry_t, n_buckets);
+	return table;
+}
+
+void del_ir_valuetable(ir_valuetable_t *table)
+{
+	free(table->old_entries);
+	free(table->entries);
+	free(table);
+}
+
+ir_node *ir_valuetable_insert(ir_valuetable_t *table, ir_node *node,
+                              unsigned hash)
+{
+	ir_valuetable_entry_t *const entry
+		= find_in(table->cmp, table->entries, table->n_buckets, node, hash);
+	if (entry->node != NULL)
+		return entry->node;
+
+	if (table->old_entries != NULL) {
+		ir_valuetable_entry_t *const old
+			= find_in(table->cmp, table->old_entries, table->n_old_buckets,
+			          node, hash);
+		if (old->node != NULL)
+			return old->node;
+	}
+
+	entry->node = node;
+	entry->hash = hash;
+	++table->n_entries;
+
+	if (table->old_entries != NULL)
+		migrate(table, MIGRATE_BUCKETS);
+	if (table->n_entries > table->n_buckets / 2)
+		grow(table);
+	return node;
+}
+
+size_t ir_valuetable_size(const ir_valuetable_t *table)
+{
+	return table->n_entries;
+}
+
+void ir_valuetable_visit(const ir_valuetable_t *table,
+                         void (*visit)(ir_node *node, void *env), void *env)
+{
+	for (size_t i = 0; i < table->n_old_buckets; ++i) {
+		/* buckets before migrate_pos are in the new array already */
+		if (i < table->migrate_pos)
+			continue;
+		ir_node *const node = table->old_entries[i].node;
+		if (node != NULL)
+			visit(node, env);
+	}
+	for (size_t i = 0; i < table->n_buckets; ++i) {
+		ir_node *const node = table->entries[i].node;
+		if (node != NULL)
+			visit(node, env);
+	}
+}
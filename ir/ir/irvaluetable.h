@@ -0,0 +1,73 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief     Value number table for common subexpression elimination.
+ * @note      Open addressing with the hash of each node stored next to it, so
+ *            neither lookups nor growing recompute node hashes. When the
+ *            table grows, the old entries are migrated a few buckets per
+ *            insertion instead of all at once.
+ */
+#ifndef FIRM_IR_IRVALUETABLE_H
+#define FIRM_IR_IRVALUETABLE_H
+
+#include <stddef.h>
+
+#include "firm_types.h"
+
+/**
+ * Compares two nodes, returns 0 if they compute the same value.
+ */
+typedef int (*ir_valuetable_cmp_func)(const ir_node *a, const ir_node *b);
+
+typedef struct ir_valuetable_entry_t {
+	ir_node  *node;
+	unsigned  hash;
+} ir_valuetable_entry_t;
+
+typedef struct ir_valuetable_t {
+	ir_valuetable_cmp_func  cmp;
+	ir_valuetable_entry_t  *entries;     /**< Current bucket array. */
+	size_t                  n_buckets;   /**< Power of two. */
+	size_t                  n_entries;   /**< Entries in both arrays. */
+	ir_valuetable_entry_t  *old_entries; /**< Array being migrated or NULL. */
+	size_t                  n_old_buckets;
+	size_t                  migrate_pos; /**< Next old bucket to migrate. */
+} ir_valuetable_t;
+
+/**
+ * Creates a value table for roughly @p expected_elements nodes, comparing
+ * nodes with @p cmp.
+ */
+ir_valuetable_t *new_ir_valuetable(ir_valuetable_cmp_func cmp,
+                                   size_t expected_elements);
+
+/**
+ * Frees a value table.
+ */
+void del_ir_valuetable(ir_valuetable_t *table);
+
+/**
+ * Looks up a node equal to @p node with hash @p hash. If there is none,
+ * @p node is inserted.
+ *
+ * @return the node found or @p node
+ */
+ir_node *ir_valuetable_insert(ir_valuetable_t *table, ir_node *node,
+                              unsigned hash);
+
+/**
+ * Returns the number of nodes in the table.
+ */
+size_t ir_valuetable_size(const ir_valuetable_t *table);
+
+/**
+ * Calls @p visit for every node in the table.
+ */
+void ir_valuetable_visit(const ir_valuetable_t *table,
+                         void (*visit)(ir_node *node, void *env), void *env);
+
+#endif
@@ -637,11 +637,17 @@ static int verify_node_Call(const ir_node *n)
 	return fine;
 }
 
+/** Vector modes have integer or float elements and count as numeric. */
+static int mode_is_num_or_vector(const ir_mode *mode)
+{
+	return mode_is_num(mode) || mode_is_vector(mode);
+}
+
 static int verify_node_Add(const ir_node *n)
 {
 	bool     fine = true;
 	ir_mode *mode = get_irn_mode(n);
-	if (mode_is_num(mode)) {
+	if (mode_is_num_or_vector(mode)) {
 		fine &= check_mode_same_input(n, n_Add_left, "left");
 		fine &= check_mode_same_input(n, n_Add_right, "right");
 	} else if (mode_is_reference(mode)) {
@@ -669,7 +675,7 @@ static int verify_node_Sub(const ir_node *n)
 {
 	bool     fine = true;
 	ir_mode *mode = get_irn_mode(n);
-	if (mode_is_num(mode)) {
+	if (mode_is_num_or_vector(mode)) {
 		ir_mode *mode_left = get_irn_mode(get_Sub_left(n));
 		if (mode_is_reference(mode_left)) {
 			fine &= check_input_mode(n, n_Sub_right, "right", mode_left);
@@ -689,14 +695,14 @@ static int verify_node_Sub(const ir_node *n)
 
 static int verify_node_Minus(const ir_node *n)
 {
-	bool fine = check_mode_func(n, mode_is_num, "numeric");
+	bool fine = check_mode_func(n, mode_is_num_or_vector, "numeric");
 	fine &= check_mode_same_input(n, n_Minus_op, "op");
 	return fine;
 }
 
 static int verify_node_Mul(const ir_node *n)
 {
-	bool fine = check_mode_func(n, mode_is_num, "numeric");
+	bool fine = check_mode_func(n, mode_is_num_or_vector, "numeric");
 	fine &= check_mode_same_input(n, n_Mul_left, "left");
 	fine &= check_mode_same_input(n, n_Mul_right, "right");
 	return fine;
@@ -717,7 +723,7 @@ static int verify_node_Div(const ir_node *n)
 	fine &= check_input_mode(n, n_Div_left, "left", mode);
 	fine &= check_input_mode(n, n_Div_right, "right", mode);
 	fine &= check_input_mode(n, n_Div_mem, "mem", mode_M);
-	if (!mode_is_num(mode)) {
+	if (!mode_is_num_or_vector(mode)) {
 		warn(n, "div resmode is not a numeric mode");
 		fine = false;
 	}
@@ -738,9 +744,11 @@ static int verify_node_Mod(const ir_node *n)
 	return fine;
 }
 
+/** The bitwise operations also work on vectors of integers. */
 static int mode_is_intb(const ir_mode *mode)
 {
-	return mode_is_int(mode) || mode == mode_b;
+	return mode_is_int(mode) || mode == mode_b
+	    || (mode_is_vector(mode) && mode_is_int(get_vector_element_mode(mode)));
 }
 
 static int verify_node_And(const ir_node *n)
@@ -926,6 +934,25 @@ static int verify_node_Sync(const ir_node *n)
 	return fine;
 }
 
+static int verify_node_Pack(const ir_node *n)
+{
+	if (!check_mode_func(n, mode_is_vector, "vector"))
+		return false;
+	bool     fine    = true;
+	ir_mode *mode    = get_irn_mode(n);
+	int      n_elems = get_Pack_n_elems(n);
+	if ((unsigned)n_elems != get_vector_n_elements(mode)) {
+		warn(n, "%+F has %d inputs but its mode %+F has %u elements", n,
+		     n_elems, mode, get_vector_n_elements(mode));
+		fine = false;
+	}
+	ir_mode *element_mode = get_vector_element_mode(mode);
+	for (int i = 0; i < n_elems; ++i) {
+		fine &= check_input_mode(n, i, NULL, element_mode);
+	}
+	return fine;
+}
+
 static int verify_node_Confirm(const ir_node *n)
 {
 	bool fine = check_mode_same_input(n, n_Confirm_value, "value");
@@ -1335,6 +1362,7 @@ void ir_register_verify_node_ops(void)
 	set_op_verify(op_Not,      verify_node_Not);
 	set_op_verify(op_Offset,   verify_node_int);
 	set_op_verify(op_Or,       verify_node_Or);
+	set_op_verify(op_Pack,     verify_node_Pack);
 	set_op_verify(op_Phi,      verify_node_Phi);
 	set_op_verify(op_Proj,     verify_node_Proj);
 	set_op_verify(op_Raise,    verify_node_Raise);
@@ -1370,8 +1398,8 @@ static bool has_multiple_X_succs(const ir_node *node)
 	    || (is_fragile_op(node) && ir_throws_exception(node));
 }
 
-static unsigned n_returns;
-static bool     properties_fine;
+static THREAD_LOCAL unsigned n_returns;
+static THREAD_LOCAL bool     properties_fine;
 
 static void check_simple_properties(ir_node *node, void *env)
 {
@@ -2316,7 +2316,7 @@ static int cmp_conv_tp(const void *elt, const void *key, size_t size)
  */
 void ir_register_dw_lower_function(ir_op *op, lower_dw_func func)
 {
-	op->ops.generic = (op_func)func;
+	get_op_generic(op)->generic = (op_func)func;
 }
 
 static void enqueue_preds(ir_node *node)
@@ -2354,7 +2354,7 @@ static void lower_node(ir_node *node)
 	}
 
 	ir_op        *op   = get_irn_op(node);
-	lower_dw_func func = (lower_dw_func) op->ops.generic;
+	lower_dw_func func = (lower_dw_func) get_op_generic(op)->generic;
 	if (func == NULL)
 		return;
 
@@ -84,7 +84,7 @@ static void lower_mode(ir_node *n, void *env)
 {
 	(void)env;
 	ir_op                *op         = get_irn_op(n);
-	lower_softfloat_func  lower_func = (lower_softfloat_func) op->ops.generic;
+	lower_softfloat_func  lower_func = (lower_softfloat_func) get_op_generic(op)->generic;
 	ir_mode              *mode       = get_irn_mode(n);
 	if (lower_func != NULL) {
 		lower_func(n);
@@ -100,7 +100,7 @@ static void lower_mode(ir_node *n, void *env)
 static void lower_node(ir_node *n, void *env)
 {
 	ir_op                *op         = get_irn_op(n);
-	lower_softfloat_func  lower_func = (lower_softfloat_func) op->ops.generic;
+	lower_softfloat_func  lower_func = (lower_softfloat_func) get_op_generic(op)->generic;
 	if (lower_func != NULL) {
 		bool *changed = (bool*)env;
 		*changed |= lower_func(n);
@@ -744,7 +744,7 @@ static bool lower_Sub(ir_node *n)
 static void ir_register_softloat_lower_function(ir_op *op,
                                                 lower_softfloat_func func)
 {
-	op->ops.generic = (op_func)func;
+	get_op_generic(op)->generic = (op_func)func;
 }
 
 static void make_binop_type(ir_type **const memoized, ir_type *const left,
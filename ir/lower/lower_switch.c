@@ -7,8 +7,15 @@
  * @file
  * @brief   Lowering of Switches if necessary or advantageous.
  * @author  Moritz Kroll
+ *
+ * The sorted cases of a Switch are partitioned into clusters: Dense ranges
+ * become jump tables, cases in a range smaller than a machine word with few
+ * different targets are tested with bit masks and all remaining cases are
+ * compared one by one. A binary tree of compares, split at the weighted
+ * median of the execution frequencies, dispatches to the clusters.
  */
 #include "array.h"
+#include "execfreq.h"
 #include "ircons.h"
 #include "irgopt.h"
 #include "irgwalk.h"
@@ -17,9 +24,16 @@
 #include "irouts_t.h"
 #include "lowering.h"
 #include "panic.h"
+#include "tv_t.h"
 #include "util.h"
+#include <math.h>
 #include <stdbool.h>
 
+/** Maximum number of clusters tested one after another instead of a tree. */
+#define MAX_CHAIN_LENGTH 3
+/** Maximum number of different targets of a bit test cluster. */
+#define MAX_BIT_TEST_TARGETS 3
+
 typedef struct walk_env_t {
 	ir_nodeset_t  processed;
 	ir_mode      *selector_mode;
@@ -29,61 +43,42 @@ typedef struct walk_env_t {
 } walk_env_t;
 
 typedef struct target_t {
-	ir_node *block;     /**< block that is targetted */
-	uint16_t n_entries; /**< number of table entries targetting this block */
-	uint16_t i;
+	ir_node  *block;     /**< block that is targetted */
+	ir_node **preds;     /**< the new control flow predecessors of the block */
+	unsigned  n_entries; /**< number of table entries targetting this block */
 } target_t;
 
+typedef enum cluster_kind_t {
+	cluster_case,     /**< a single entry, tested with a compare */
+	cluster_bit_test, /**< entries in a small range, tested with bit masks */
+	cluster_table,    /**< a dense range of entries, uses a jump table */
+} cluster_kind_t;
+
+typedef struct cluster_t {
+	cluster_kind_t               kind;
+	const ir_switch_table_entry *entries;   /**< the entries of the cluster */
+	size_t                       first;     /**< index of the first entry */
+	unsigned                     n_entries;
+	ir_tarval                   *min;
+	ir_tarval                   *max;
+	double                       weight;    /**< estimated frequency */
+} cluster_t;
+
 typedef struct switch_info_t {
+	walk_env_t  *env;
 	ir_node     *switchn;
-	ir_tarval   *switch_min;
-	ir_tarval   *switch_max;
-	ir_node     *default_block;
-	unsigned     num_cases;
+	ir_node     *selector;
+	ir_mode     *unsigned_mode; /**< unsigned mode of the selector */
+	unsigned     n_outs;
 	target_t    *targets;
-	ir_node    **defusers;    /**< the Projs pointing to the default case */
+	double      *weights;       /**< estimated frequency of each entry */
+	ir_node    **misses;        /**< control flow leaving a cluster test */
 } switch_info_t;
 
-/**
- * analyze enough to decide if we should lower the switch
- */
-static void analyse_switch0(switch_info_t *info, ir_node *switchn)
-{
-	const ir_switch_table *table      = get_Switch_table(switchn);
-	size_t                 n_entries  = ir_switch_table_get_n_entries(table);
-	ir_mode               *mode       = get_irn_mode(get_Switch_selector(switchn));
-	ir_tarval             *switch_min = get_mode_max(mode);
-	ir_tarval             *switch_max = get_mode_min(mode);
-	unsigned               num_cases  = 0;
-
-	for (size_t e = 0; e < n_entries; ++e) {
-		const ir_switch_table_entry *entry
-			= ir_switch_table_get_entry_const(table, e);
-		if (entry->pn == pn_Switch_default)
-			continue;
-
-		if (tarval_cmp(entry->min, switch_min) == ir_relation_less)
-			switch_min = entry->min;
-		if (tarval_cmp(entry->max, switch_max) == ir_relation_greater)
-			switch_max = entry->max;
-
-		++num_cases;
-	}
-
-	info->switchn    = switchn;
-	info->switch_min = switch_min;
-	info->switch_max = switch_max;
-	info->num_cases  = num_cases;
-}
-
-/**
- * Analyse the stuff that anayse_switch0() left out
- */
-static void analyse_switch1(switch_info_t *info)
+static void analyse_switch(switch_info_t *info, ir_node *switchn)
 {
-	const ir_node  *switchn   = info->switchn;
-	unsigned        n_outs    = get_Switch_n_outs(switchn);
-	target_t       *targets   = XMALLOCNZ(target_t, n_outs);
+	unsigned  n_outs  = get_Switch_n_outs(switchn);
+	target_t *targets = XMALLOCNZ(target_t, n_outs);
 	foreach_irn_out_r(switchn, i, proj) {
 		unsigned pn     = get_Proj_num(proj);
 		ir_node *target = get_irn_out(proj, 0);
@@ -91,6 +86,7 @@ static void analyse_switch1(switch_info_t *info)
 		assert((unsigned)pn < n_outs);
 		assert(targets[(unsigned)pn].block == NULL);
 		targets[(unsigned)pn].block = target;
+		targets[(unsigned)pn].preds = NEW_ARR_F(ir_node*, 0);
 	}
 
 	const ir_switch_table *table = get_Switch_table(switchn);
@@ -105,8 +101,15 @@ static void analyse_switch1(switch_info_t *info)
 		++target->n_entries;
 	}
 
-	info->default_block = targets[pn_Switch_default].block;
+	ir_node *selector = get_Switch_selector(switchn);
+	ir_mode *mode     = get_irn_mode(selector);
+	info->switchn       = switchn;
+	info->selector      = selector;
+	info->unsigned_mode = mode_is_signed(mode) ? find_unsigned_mode(mode)
+	                                           : mode;
+	info->n_outs        = n_outs;
 	info->targets       = targets;
+	info->misses        = NEW_ARR_F(ir_node*, 0);
 }
 
 static int compare_entries(const void *a, const void *b)
@@ -127,247 +130,549 @@ static int compare_entries(const void *a, const void *b)
 	return 1;
 }
 
-static void normalize_table(ir_node *switchn, ir_mode *new_mode,
-                            ir_tarval *delta)
+/**
+ * Sort the table entries and remove the entries of the default target.
+ */
+static void normalize_table(ir_node *switchn)
 {
 	ir_switch_table *table = get_Switch_table(switchn);
 	QSORT(table->entries, table->n_entries, compare_entries);
 
-	/* subtract delta from min/max values and remove default pn entries */
+	/* default entries have been sorted to the end, cut off list there */
 	for (size_t e = 0, n_entries = ir_switch_table_get_n_entries(table);
 	     e < n_entries; ++e) {
-		ir_switch_table_entry *entry = ir_switch_table_get_entry(table, e);
-
-		/* default entries have been sorted to the end, cut off list there */
+		const ir_switch_table_entry *entry
+			= ir_switch_table_get_entry_const(table, e);
 		if (entry->pn == pn_Switch_default) {
 			table->n_entries = e;
 			break;
 		}
+	}
+}
 
-		ir_tarval *min = entry->min;
-		min = tarval_convert_to(min, new_mode);
-		if (delta != NULL)
-			min = tarval_sub(min, delta);
+/**
+ * Estimate how often each entry is taken. The frequencies of the target
+ * blocks are used if they are known (from the estimation or from a profile),
+ * else all entries are equally likely.
+ */
+static void compute_weights(switch_info_t *info)
+{
+	const ir_switch_table *table     = get_Switch_table(info->switchn);
+	size_t                 n_entries = ir_switch_table_get_n_entries(table);
+	double                *weights   = XMALLOCN(double, n_entries);
 
-		if (entry->min == entry->max) {
-			entry->min = min;
-			entry->max = min;
-		} else {
-			ir_tarval *max = entry->max;
-			max = tarval_convert_to(max, new_mode);
-			if (delta != NULL)
-				max = tarval_sub(max, delta);
-			entry->min = min;
-			entry->max = max;
+	bool have_freqs = true;
+	for (size_t e = 0; e < n_entries; ++e) {
+		const ir_switch_table_entry *entry
+			= ir_switch_table_get_entry_const(table, e);
+		if (get_block_execfreq(info->targets[entry->pn].block) <= 0.0) {
+			have_freqs = false;
+			break;
 		}
 	}
+
+	for (size_t e = 0; e < n_entries; ++e) {
+		const ir_switch_table_entry *entry
+			= ir_switch_table_get_entry_const(table, e);
+		const target_t *target = &info->targets[entry->pn];
+		weights[e] = have_freqs
+		           ? get_block_execfreq(target->block) / target->n_entries
+		           : 1.0;
+	}
+	info->weights = weights;
 }
 
-static void create_out_of_bounds_check(switch_info_t *info)
+/**
+ * Returns max - min as unsigned number, saturated at UINT64_MAX.
+ */
+static uint64_t get_distance(const switch_info_t *info, ir_tarval *min,
+                             ir_tarval *max)
 {
-	/* should already be normalized to zero */
-	assert(tarval_is_null(info->switch_min));
-
-	/* create out-of-bounds check */
-	ir_node  *switchn    = info->switchn;
-	ir_graph *irg        = get_irn_irg(switchn);
-	dbg_info *dbgi       = get_irn_dbg_info(switchn);
-	ir_node  *selector   = get_Switch_selector(switchn);
-	ir_node  *block      = get_nodes_block(switchn);
-	ir_node  *max_const  = new_r_Const(irg, info->switch_max);
-	ir_node  *cmp        = new_rd_Cmp(dbgi, block, selector, max_const,
-	                                  ir_relation_less_equal);
-	ir_node  *oob_cond   = new_rd_Cond(dbgi, block, cmp);
-	ir_node  *proj_true  = new_r_Proj(oob_cond, mode_X, pn_Cond_true);
-	ir_node  *proj_false = new_r_Proj(oob_cond, mode_X, pn_Cond_false);
+	ir_tarval *distance = tarval_sub(max, min);
+	distance = tarval_convert_to(distance, info->unsigned_mode);
+	if (!tarval_is_uint64(distance))
+		return UINT64_MAX;
+	return get_tarval_uint64(distance);
+}
+
+static void add_cluster(switch_info_t *info, cluster_t **clusters,
+                        cluster_kind_t kind, size_t first, size_t end)
+{
+	const ir_switch_table *table = get_Switch_table(info->switchn);
+	const ir_switch_table_entry *entries
+		= ir_switch_table_get_entry_const(table, first);
+
+	double weight = 0.0;
+	for (size_t e = first; e < end; ++e)
+		weight += info->weights[e];
+
+	cluster_t cluster = {
+		.kind      = kind,
+		.entries   = entries,
+		.first     = first,
+		.n_entries = end - first,
+		.min       = entries[0].min,
+		.max       = entries[end - first - 1].max,
+		.weight    = weight,
+	};
+	ARR_APP1(cluster_t, *clusters, cluster);
+}
 
-	ir_node **default_preds = NEW_ARR_F(ir_node*, 0);
-	ARR_APP1(ir_node*, default_preds, proj_false);
+static bool is_bit_test_profitable(unsigned n_targets, unsigned n_compares)
+{
+	switch (n_targets) {
+	case 1:  return n_compares >= 3;
+	case 2:  return n_compares >= 5;
+	default: return n_compares >= 6;
+	}
+}
 
-	/* create new block containing the switch */
-	ir_node *in[]      = { proj_true };
-	ir_node *new_block = new_r_Block(irg, ARRAY_SIZE(in), in);
-	set_nodes_block(switchn, new_block);
+/**
+ * Partition the entries [first, end), which do not belong to a jump table,
+ * into bit test and case clusters.
+ */
+static void find_bit_tests(switch_info_t *info, cluster_t **clusters,
+                           size_t first, size_t end)
+{
+	const ir_switch_table *table = get_Switch_table(info->switchn);
+	unsigned word_bits = get_mode_size_bits(info->env->selector_mode);
+
+	for (size_t i = first; i < end; ) {
+		const ir_switch_table_entry *start
+			= ir_switch_table_get_entry_const(table, i);
+		unsigned pns[MAX_BIT_TEST_TARGETS];
+		unsigned n_pns      = 0;
+		unsigned n_compares = 0;
+		size_t   best_end   = i;
+		for (size_t j = i; j < end; ++j) {
+			const ir_switch_table_entry *entry
+				= ir_switch_table_get_entry_const(table, j);
+			if (get_distance(info, start->min, entry->max) >= word_bits)
+				break;
+
+			unsigned p = 0;
+			while (p < n_pns && pns[p] != entry->pn)
+				++p;
+			if (p == n_pns) {
+				if (n_pns == MAX_BIT_TEST_TARGETS)
+					break;
+				pns[n_pns++] = entry->pn;
+			}
+			/* a range needs two compares, a single value one */
+			n_compares += entry->min == entry->max ? 1 : 2;
+			if (is_bit_test_profitable(n_pns, n_compares))
+				best_end = j + 1;
+		}
 
-	/* adjust projs */
-	ir_node *default_block = NULL;
-	foreach_irn_out_r(switchn, i, proj) {
-		unsigned pn = get_Proj_num(proj);
-		if (pn == pn_Switch_default) {
-			assert(default_block == NULL);
-			default_block = get_irn_out(proj, 0);
-			ARR_APP1(ir_node*, default_preds, proj);
+		if (best_end > i + 1) {
+			add_cluster(info, clusters, cluster_bit_test, i, best_end);
+			i = best_end;
+		} else {
+			add_cluster(info, clusters, cluster_case, i, i + 1);
+			++i;
 		}
-		set_nodes_block(proj, new_block);
 	}
+}
 
-	/* adapt default block */
-	size_t n_default_preds = ARR_LEN(default_preds);
-	if (n_default_preds > 1) {
-		/* create new intermediate blocks so we don't have critical edges */
-		for (size_t p = 0; p < n_default_preds; ++p) {
-			ir_node *pred        = default_preds[p];
-			ir_node *bin[]       = { pred };
-			ir_node *split_block = new_r_Block(irg, ARRAY_SIZE(bin), bin);
+/**
+ * Partition the sorted entries into as few clusters as possible. Jump tables
+ * need more than small_switch entries and less than spare_size holes.
+ */
+static cluster_t *find_clusters(switch_info_t *info)
+{
+	const ir_switch_table *table     = get_Switch_table(info->switchn);
+	size_t                 n_entries = ir_switch_table_get_n_entries(table);
+	const walk_env_t      *env       = info->env;
+
+	/* n_parts[i] is the minimal number of clusters for the entries from i on,
+	 * table_end[i] the end of the jump table starting at i (or i + 1) */
+	size_t *n_parts   = XMALLOCN(size_t, n_entries + 1);
+	size_t *table_end = XMALLOCN(size_t, n_entries);
+	n_parts[n_entries] = 0;
+	for (size_t i = n_entries; i-- > 0; ) {
+		const ir_switch_table_entry *start
+			= ir_switch_table_get_entry_const(table, i);
+		n_parts[i]   = n_parts[i + 1] + 1;
+		table_end[i] = i + 1;
+		for (size_t j = i + 1; j < n_entries; ++j) {
+			const ir_switch_table_entry *entry
+				= ir_switch_table_get_entry_const(table, j);
+			/* the number of holes only grows with further entries */
+			uint64_t spare = get_distance(info, start->min, entry->max)
+			               - (j - i);
+			if (spare >= env->spare_size)
+				break;
+			if (j - i + 1 > env->small_switch
+			    && n_parts[j + 1] + 1 <= n_parts[i]) {
+				n_parts[i]   = n_parts[j + 1] + 1;
+				table_end[i] = j + 1;
+			}
+		}
+	}
 
-			default_preds[p] = new_r_Jmp(split_block);
+	cluster_t *clusters = NEW_ARR_F(cluster_t, 0);
+	size_t     first    = 0;
+	for (size_t i = 0; i < n_entries; ) {
+		if (table_end[i] == i + 1) {
+			++i;
+			continue;
 		}
+		find_bit_tests(info, &clusters, first, i);
+		add_cluster(info, &clusters, cluster_table, i, table_end[i]);
+		i     = table_end[i];
+		first = i;
 	}
-	set_irn_in(default_block, n_default_preds, default_preds);
+	find_bit_tests(info, &clusters, first, n_entries);
+
+	free(table_end);
+	free(n_parts);
+	return clusters;
+}
 
-	DEL_ARR_F(default_preds);
+static void connect_to_target(target_t *target, ir_node *cf)
+{
+	assert(target->block != NULL);
+	ARR_APP1(ir_node*, target->preds, cf);
+}
+
+static void connect_to_default(switch_info_t *info, ir_node *cf)
+{
+	connect_to_target(&info->targets[pn_Switch_default], cf);
 }
 
 /**
- * normalize switch to work on an unsigned input with the first case at 0
+ * Create selector - min in the unsigned mode of the selector.
  */
-static bool normalize_switch(switch_info_t *info, ir_mode *selector_mode)
+static ir_node *create_offset(const switch_info_t *info, ir_node *block,
+                              ir_tarval *min)
 {
-	ir_node   *switchn  = info->switchn;
-	ir_node   *block    = get_nodes_block(switchn);
-	ir_node   *selector = get_Switch_selector(switchn);
-	ir_mode   *mode     = get_irn_mode(selector);
-	ir_tarval *min      = info->switch_min;
-	if (mode_is_signed(mode)) {
-		mode             = find_unsigned_mode(mode);
-		selector         = new_r_Conv(block, selector, mode);
-		min              = tarval_convert_to(min, mode);
-		info->switch_min = min;
-		info->switch_max = tarval_convert_to(info->switch_max, mode);
+	dbg_info *dbgi     = get_irn_dbg_info(info->switchn);
+	ir_mode  *mode     = info->unsigned_mode;
+	ir_node  *selector = info->selector;
+	if (get_irn_mode(selector) != mode)
+		selector = new_rd_Conv(dbgi, block, selector, mode);
+
+	ir_tarval *umin = tarval_convert_to(min, mode);
+	if (tarval_is_null(umin))
+		return selector;
+	ir_node *min_const = new_r_Const(get_irn_irg(block), umin);
+	return new_rd_Sub(dbgi, block, selector, min_const);
+}
+
+/**
+ * Create a Cond testing offset <= max - min for an offset created by
+ * create_offset().
+ */
+static ir_node *create_range_cond(const switch_info_t *info, ir_node *block,
+                                  ir_node *offset, ir_tarval *min,
+                                  ir_tarval *max)
+{
+	dbg_info  *dbgi      = get_irn_dbg_info(info->switchn);
+	ir_tarval *max_delta = tarval_convert_to(tarval_sub(max, min),
+	                                         info->unsigned_mode);
+	ir_node   *max_const = new_r_Const(get_irn_irg(block), max_delta);
+	ir_node   *cmp       = new_rd_Cmp(dbgi, block, offset, max_const,
+	                                  ir_relation_less_equal);
+	return new_rd_Cond(dbgi, block, cmp);
+}
+
+/**
+ * Create an if (selector == caseval) Cond node (and handle the special case
+ * of ranged cases)
+ */
+static ir_node *create_case_cond(const switch_info_t *info, ir_node *block,
+                                 const ir_switch_table_entry *entry)
+{
+	if (entry->min != entry->max) {
+		ir_node *offset = create_offset(info, block, entry->min);
+		return create_range_cond(info, block, offset, entry->min, entry->max);
 	}
 
-	/* normalize so switch_min is at 0 */
-	ir_tarval *delta = NULL;
-	if (min != get_mode_null(mode)) {
-		ir_graph *irg       = get_irn_irg(switchn);
-		ir_node  *min_const = new_r_Const(irg, min);
-		dbg_info *dbgi      = get_irn_dbg_info(switchn);
-		selector = new_rd_Sub(dbgi, block, selector, min_const);
-
-		info->switch_max = tarval_sub(info->switch_max, min);
-		info->switch_min = get_mode_null(mode);
-		delta            = min;
+	dbg_info *dbgi     = get_irn_dbg_info(info->switchn);
+	ir_node  *minconst = new_r_Const(get_irn_irg(block), entry->min);
+	ir_node  *cmp      = new_rd_Cmp(dbgi, block, info->selector, minconst,
+	                                ir_relation_equal);
+	return new_rd_Cond(dbgi, block, cmp);
+}
+
+typedef struct bit_test_t {
+	unsigned   pn;
+	ir_tarval *mask;
+	double     weight;
+} bit_test_t;
+
+static int compare_bit_tests(const void *a, const void *b)
+{
+	const bit_test_t *test0 = (const bit_test_t*)a;
+	const bit_test_t *test1 = (const bit_test_t*)b;
+	if (test0->weight != test1->weight)
+		return test0->weight < test1->weight ? 1 : -1;
+	return QSORT_CMP(test0->pn, test1->pn);
+}
+
+/**
+ * Test (1 << offset) & mask != 0 for the mask of each target of the cluster,
+ * the most frequent target first.
+ */
+static void create_bit_tests(switch_info_t *info, ir_node *block,
+                             const cluster_t *cluster, ir_node *offset)
+{
+	ir_graph *irg  = get_irn_irg(block);
+	dbg_info *dbgi = get_irn_dbg_info(info->switchn);
+	ir_mode  *mode = info->env->selector_mode;
+
+	bit_test_t tests[MAX_BIT_TEST_TARGETS];
+	unsigned   n_tests = 0;
+	for (unsigned e = 0; e < cluster->n_entries; ++e) {
+		const ir_switch_table_entry *entry = &cluster->entries[e];
+		unsigned t = 0;
+		while (t < n_tests && tests[t].pn != entry->pn)
+			++t;
+		if (t == n_tests) {
+			assert(n_tests < MAX_BIT_TEST_TARGETS);
+			tests[t].pn     = entry->pn;
+			tests[t].mask   = get_mode_null(mode);
+			tests[t].weight = 0.0;
+			++n_tests;
+		}
+
+		uint64_t low  = get_distance(info, cluster->min, entry->min);
+		uint64_t high = get_distance(info, cluster->min, entry->max);
+		for (uint64_t bit = low; bit <= high; ++bit) {
+			ir_tarval *value = tarval_shl_unsigned(get_mode_one(mode), bit);
+			tests[t].mask = tarval_or(tests[t].mask, value);
+		}
+		tests[t].weight += info->weights[cluster->first + e];
 	}
+	QSORT(tests, n_tests, compare_bit_tests);
+
+	if (get_irn_mode(offset) != mode)
+		offset = new_rd_Conv(dbgi, block, offset, mode);
+	ir_node *one  = new_r_Const(irg, get_mode_one(mode));
+	ir_node *bit  = new_rd_Shl(dbgi, block, one, offset);
+	ir_node *zero = new_r_Const(irg, get_mode_null(mode));
+	for (unsigned t = 0; t < n_tests; ++t) {
+		ir_node *mask  = new_r_Const(irg, tests[t].mask);
+		ir_node *and   = new_rd_And(dbgi, block, bit, mask);
+		ir_node *cmp   = new_rd_Cmp(dbgi, block, and, zero,
+		                            ir_relation_less_greater);
+		ir_node *cond  = new_rd_Cond(dbgi, block, cmp);
+		ir_node *ptrue = new_r_Proj(cond, mode_X, pn_Cond_true);
+		connect_to_target(&info->targets[tests[t].pn], ptrue);
+
+		/* values in the range of the cluster not matching any case */
+		ir_node *pfalse = new_r_Proj(cond, mode_X, pn_Cond_false);
+		if (t + 1 == n_tests) {
+			connect_to_default(info, pfalse);
+		} else {
+			ir_node *in[] = { pfalse };
+			block = new_r_Block(irg, ARRAY_SIZE(in), in);
+		}
+	}
+}
 
-	/* if we have a selector_mode set, then the we will have a switch node,
-	 * we have to construct an out-of-bounds check then and after that convert
-	 * the switch/selector to the backends desired switch mode */
-	if (selector_mode != NULL) {
-		set_Switch_selector(switchn, selector);
-		create_out_of_bounds_check(info);
-
-		selector = new_r_Conv(block, selector, selector_mode);
-		mode     = selector_mode;
-		info->switch_min = tarval_convert_to(info->switch_min, mode);
-		info->switch_max = tarval_convert_to(info->switch_max, mode);
-		if (delta != NULL)
-			delta = tarval_convert_to(delta, mode);
-		set_Switch_selector(switchn, selector);
+/**
+ * Create a Switch with a table from 0 to the size of the cluster.
+ */
+static void create_jump_table(switch_info_t *info, ir_node *block,
+                              const cluster_t *cluster, ir_node *offset)
+{
+	ir_graph *irg  = get_irn_irg(block);
+	dbg_info *dbgi = get_irn_dbg_info(info->switchn);
+	ir_mode  *mode = info->env->selector_mode;
+
+	unsigned        *new_pns = XMALLOCNZ(unsigned, info->n_outs);
+	unsigned         n_outs  = pn_Switch_max + 1;
+	ir_switch_table *table   = ir_new_switch_table(irg, cluster->n_entries);
+	for (unsigned e = 0; e < cluster->n_entries; ++e) {
+		const ir_switch_table_entry *entry = &cluster->entries[e];
+		if (new_pns[entry->pn] == 0)
+			new_pns[entry->pn] = n_outs++;
+
+		ir_tarval *min = tarval_sub(entry->min, cluster->min);
+		min = tarval_convert_to(min, info->unsigned_mode);
+		min = tarval_convert_to(min, mode);
+		ir_tarval *max = min;
+		if (entry->min != entry->max) {
+			max = tarval_sub(entry->max, cluster->min);
+			max = tarval_convert_to(max, info->unsigned_mode);
+			max = tarval_convert_to(max, mode);
+		}
+		ir_switch_table_set(table, e, min, max, new_pns[entry->pn]);
 	}
 
-	normalize_table(switchn, mode, delta);
-	return true;
+	if (get_irn_mode(offset) != mode)
+		offset = new_rd_Conv(dbgi, block, offset, mode);
+	ir_node *switchn = new_rd_Switch(dbgi, block, offset, n_outs, table);
+	ir_nodeset_insert(&info->env->processed, switchn);
+
+	ir_node *pdefault = new_r_Proj(switchn, mode_X, pn_Switch_default);
+	connect_to_default(info, pdefault);
+	for (unsigned pn = 0; pn < info->n_outs; ++pn) {
+		if (new_pns[pn] == 0)
+			continue;
+		ir_node *proj = new_r_Proj(switchn, mode_X, new_pns[pn]);
+		connect_to_target(&info->targets[pn], proj);
+	}
+	free(new_pns);
 }
 
 /**
- * Create an if (selector == caseval) Cond node (and handle the special case
- * of ranged cases)
+ * Create the test of a cluster in block. Control flow for values outside of
+ * the range of the cluster is appended to info->misses.
  */
-static ir_node *create_case_cond(const ir_switch_table_entry *entry,
-                                 dbg_info *dbgi, ir_node *block,
-                                 ir_node *selector)
+static void create_cluster_test(switch_info_t *info, ir_node *block,
+                                const cluster_t *cluster, bool check_range)
 {
-	ir_graph *irg      = get_irn_irg(block);
-	ir_node  *minconst = new_r_Const(irg, entry->min);
+	if (cluster->kind == cluster_case) {
+		const ir_switch_table_entry *entry  = &cluster->entries[0];
+		target_t                    *target = &info->targets[entry->pn];
+		if (!check_range) {
+			connect_to_target(target, new_r_Jmp(block));
+			return;
+		}
+		ir_node *cond = create_case_cond(info, block, entry);
+		connect_to_target(target, new_r_Proj(cond, mode_X, pn_Cond_true));
+		ARR_APP1(ir_node*, info->misses,
+		         new_r_Proj(cond, mode_X, pn_Cond_false));
+		return;
+	}
+
+	ir_node *offset = create_offset(info, block, cluster->min);
+	if (check_range) {
+		ir_node *cond = create_range_cond(info, block, offset, cluster->min,
+		                                  cluster->max);
+		ARR_APP1(ir_node*, info->misses,
+		         new_r_Proj(cond, mode_X, pn_Cond_false));
+		ir_node *in[] = { new_r_Proj(cond, mode_X, pn_Cond_true) };
+		block = new_r_Block(get_irn_irg(block), ARRAY_SIZE(in), in);
+	}
 
-	ir_node  *cmp;
-	if (entry->min == entry->max) {
-		cmp = new_rd_Cmp(dbgi, block, selector, minconst, ir_relation_equal);
+	if (cluster->kind == cluster_bit_test) {
+		create_bit_tests(info, block, cluster, offset);
 	} else {
-		ir_tarval *adjusted_max = tarval_sub(entry->max, entry->min);
-		ir_node   *sub          = new_rd_Sub(dbgi, block, selector, minconst);
-		ir_node   *maxconst     = new_r_Const(irg, adjusted_max);
-		cmp = new_rd_Cmp(dbgi, block, sub, maxconst, ir_relation_less_equal);
+		assert(cluster->kind == cluster_table);
+		create_jump_table(info, block, cluster, offset);
 	}
-	return new_rd_Cond(dbgi, block, cmp);
 }
 
-static void connect_to_target(target_t *target, ir_node *cf)
+static int compare_cluster_weights(const void *a, const void *b)
+{
+	const cluster_t *cluster0 = (const cluster_t*)a;
+	const cluster_t *cluster1 = (const cluster_t*)b;
+	if (cluster0->weight != cluster1->weight)
+		return cluster0->weight < cluster1->weight ? 1 : -1;
+	return QSORT_CMP(cluster0->first, cluster1->first);
+}
+
+/**
+ * Test a few clusters one after another, the most frequent one first. The
+ * selector is known to be in [low, high].
+ */
+static void create_chain(switch_info_t *info, ir_node *block,
+                         cluster_t *clusters, size_t n_clusters,
+                         ir_tarval *low, ir_tarval *high)
 {
-	ir_node *block     = target->block;
-	unsigned n_entries = target->n_entries;
-	if (get_Block_n_cfgpreds(block) != (int)n_entries) {
-		ir_node **new_in = ALLOCAN(ir_node*, n_entries);
-		ir_graph *irg    = get_irn_irg(block);
-		ir_node  *dummy  = new_r_Dummy(irg, mode_X);
-		for (unsigned i = 0; i < n_entries; ++i) {
-			new_in[i] = dummy;
+	QSORT(clusters, n_clusters, compare_cluster_weights);
+
+	ir_graph *irg = get_irn_irg(block);
+	for (size_t c = 0; c < n_clusters; ++c) {
+		const cluster_t *cluster = &clusters[c];
+		bool check_range = cluster->min != low || cluster->max != high;
+		ARR_SETLEN(ir_node*, info->misses, 0);
+		create_cluster_test(info, block, cluster, check_range);
+
+		size_t n_misses = ARR_LEN(info->misses);
+		if (c + 1 == n_clusters) {
+			for (size_t m = 0; m < n_misses; ++m)
+				connect_to_default(info, info->misses[m]);
+		} else {
+			assert(n_misses > 0);
+			block = new_r_Block(irg, n_misses, info->misses);
 		}
-		set_irn_in(block, n_entries, new_in);
-		assert(target->i == 0);
 	}
-	assert(target->i < n_entries);
-	set_Block_cfgpred(target->block, target->i++, cf);
 }
 
 /**
- * Creates an if cascade realizing binary search.
+ * Creates a binary search tree over the clusters, splitting them where the
+ * weights of both halves are closest. The selector is known to be in
+ * [low, high].
  */
-static void create_if_cascade(switch_info_t *info, ir_node *block,
-                              ir_switch_table_entry *curcases,
-                              unsigned numcases)
+static void create_tree(switch_info_t *info, ir_node *block,
+                        cluster_t *clusters, size_t n_clusters,
+                        ir_tarval *low, ir_tarval *high)
 {
-	ir_graph      *irg      = get_irn_irg(block);
-	const ir_node *switchn  = info->switchn;
-	dbg_info      *dbgi     = get_irn_dbg_info(switchn);
-	ir_node       *selector = get_Switch_selector(switchn);
+	if (n_clusters <= MAX_CHAIN_LENGTH) {
+		create_chain(info, block, clusters, n_clusters, low, high);
+		return;
+	}
 
-	if (numcases == 0) {
-		/* zero cases: "goto default;" */
-		ARR_APP1(ir_node*, info->defusers, new_r_Jmp(block));
-	} else if (numcases == 1) {
-		/*only one case: "if (sel == val) goto target else goto default;"*/
-		const ir_switch_table_entry *entry = &curcases[0];
-		ir_node *cond      = create_case_cond(entry, dbgi, block, selector);
-		ir_node *trueproj  = new_r_Proj(cond, mode_X, pn_Cond_true);
-		ir_node *falseproj = new_r_Proj(cond, mode_X, pn_Cond_false);
-
-		connect_to_target(&info->targets[entry->pn], trueproj);
-		ARR_APP1(ir_node*, info->defusers, falseproj);
-	} else if (numcases == 2) {
-		/* only two cases: "if (sel == val[0]) goto target[0];" */
-		const ir_switch_table_entry *entry0 = &curcases[0];
-		const ir_switch_table_entry *entry1 = &curcases[1];
-		ir_node *cond      = create_case_cond(entry0, dbgi, block, selector);
-		ir_node *trueproj  = new_r_Proj(cond, mode_X, pn_Cond_true);
-		ir_node *falseproj = new_r_Proj(cond, mode_X, pn_Cond_false);
-		connect_to_target(&info->targets[entry0->pn], trueproj);
-
-		ir_node *in[]    = { falseproj };
-		ir_node *neblock = new_r_Block(irg, ARRAY_SIZE(in), in);
-
-		/* second part: "else if (sel == val[1]) goto target[1] else goto default;" */
-		ir_node *cond1      = create_case_cond(entry1, dbgi, neblock, selector);
-		ir_node *trueproj1  = new_r_Proj(cond1, mode_X, pn_Cond_true);
-		ir_node *falseproj1 = new_r_Proj(cond1, mode_X, pn_Cond_false);
-		connect_to_target(&info->targets[entry1->pn], trueproj1);
-		ARR_APP1(ir_node*, info->defusers, falseproj1);
-	} else {
-		/* recursive case: split cases in the middle */
-		unsigned midcase = numcases / 2;
-		const ir_switch_table_entry *entry = &curcases[midcase];
-		ir_node *val = new_r_Const(irg, entry->min);
-		ir_node *cmp = new_rd_Cmp(dbgi, block, selector, val, ir_relation_less);
-		ir_node *cond = new_rd_Cond(dbgi, block, cmp);
+	double total = 0.0;
+	for (size_t c = 0; c < n_clusters; ++c)
+		total += clusters[c].weight;
+
+	size_t split     = 1;
+	double left      = clusters[0].weight;
+	double best_diff = fabs(total - 2 * left);
+	for (size_t c = 2; c < n_clusters; ++c) {
+		left += clusters[c - 1].weight;
+		double diff = fabs(total - 2 * left);
+		if (diff < best_diff) {
+			best_diff = diff;
+			split     = c;
+		}
+	}
+
+	ir_graph  *irg   = get_irn_irg(block);
+	dbg_info  *dbgi  = get_irn_dbg_info(info->switchn);
+	ir_tarval *pivot = clusters[split].min;
+	ir_node   *val   = new_r_Const(irg, pivot);
+	ir_node   *cmp   = new_rd_Cmp(dbgi, block, info->selector, val,
+	                              ir_relation_less);
+	ir_node   *cond  = new_rd_Cond(dbgi, block, cmp);
+
+	ir_node *ltin[]  = { new_r_Proj(cond, mode_X, pn_Cond_true) };
+	ir_node *ltblock = new_r_Block(irg, ARRAY_SIZE(ltin), ltin);
 
-		ir_node *ltin[]  = { new_r_Proj(cond, mode_X, pn_Cond_true) };
-		ir_node *ltblock = new_r_Block(irg, ARRAY_SIZE(ltin), ltin);
+	ir_node *gein[]  = { new_r_Proj(cond, mode_X, pn_Cond_false) };
+	ir_node *geblock = new_r_Block(irg, ARRAY_SIZE(gein), gein);
+
+	ir_tarval *one = get_mode_one(get_tarval_mode(pivot));
+	create_tree(info, ltblock, clusters, split, low, tarval_sub(pivot, one));
+	create_tree(info, geblock, clusters + split, n_clusters - split, pivot,
+	            high);
+}
 
-		ir_node *gein[]  = { new_r_Proj(cond, mode_X, pn_Cond_false) };
-		ir_node *geblock = new_r_Block(irg, ARRAY_SIZE(gein), gein);
+/**
+ * Replace the control flow predecessors of the targets by the new ones.
+ */
+static void connect_targets(switch_info_t *info)
+{
+	ir_graph *irg = get_irn_irg(info->switchn);
+	for (unsigned pn = 0; pn < info->n_outs; ++pn) {
+		target_t *target = &info->targets[pn];
+		if (target->block == NULL)
+			continue;
 
-		create_if_cascade(info, ltblock, curcases, midcase);
-		create_if_cascade(info, geblock, curcases + midcase, numcases - midcase);
+		ir_node **preds   = target->preds;
+		size_t    n_preds = ARR_LEN(preds);
+		if (n_preds == 0) {
+			ir_node *in[] = { new_r_Bad(irg, mode_X) };
+			set_irn_in(target->block, ARRAY_SIZE(in), in);
+		} else {
+			/* create new intermediate blocks so the jump tables have no
+			 * critical edges */
+			for (size_t p = 0; n_preds > 1 && p < n_preds; ++p) {
+				ir_node *pred = preds[p];
+				if (!is_Proj(pred) || !is_Switch(get_Proj_pred(pred)))
+					continue;
+				ir_node *bin[]       = { pred };
+				ir_node *split_block = new_r_Block(irg, ARRAY_SIZE(bin), bin);
+				preds[p] = new_r_Jmp(split_block);
+			}
+			set_irn_in(target->block, n_preds, preds);
+		}
+		DEL_ARR_F(preds);
 	}
 }
 
@@ -395,44 +700,28 @@ static void find_switch_nodes(ir_node *block, void *ctx)
 		return;
 
 	switch_info_t info;
-	analyse_switch0(&info, switchn);
-
-	/*
-	 * Here we have: num_cases and [switch_min, switch_max] interval.
-	 * We do an if-cascade if there are too many spare numbers.
-	 */
-	ir_mode   *selector_mode = get_irn_mode(get_Switch_selector(switchn));
-	ir_tarval *spare = tarval_sub(info.switch_max, info.switch_min);
-	ir_mode   *mode  = find_unsigned_mode(selector_mode);
-	spare = tarval_convert_to(spare, mode);
-	ir_tarval *num_cases_minus_one
-		= new_tarval_from_long(info.num_cases-1, mode);
-	spare = tarval_sub(spare, num_cases_minus_one);
-	ir_tarval *spare_size = new_tarval_from_long(env->spare_size, mode);
-	bool lower_switch = info.num_cases <= env->small_switch
-		|| (tarval_cmp(spare, spare_size) & ir_relation_greater_equal);
-
-	if (!lower_switch) {
-		/* we won't decompose the switch. But we must add an out-of-bounds
-		 * check */
-		env->changed |= normalize_switch(&info, env->selector_mode);
-		return;
+	info.env = env;
+	normalize_table(switchn);
+	analyse_switch(&info, switchn);
+	compute_weights(&info);
+
+	cluster_t *clusters   = find_clusters(&info);
+	size_t     n_clusters = ARR_LEN(clusters);
+	ir_node   *sblock     = get_nodes_block(switchn);
+	if (n_clusters == 0) {
+		/* zero cases: "goto default;" */
+		connect_to_default(&info, new_r_Jmp(sblock));
+	} else {
+		ir_mode *mode = get_irn_mode(info.selector);
+		create_tree(&info, sblock, clusters, n_clusters, get_mode_min(mode),
+		            get_mode_max(mode));
 	}
+	connect_targets(&info);
+	env->changed = true;
 
-	normalize_table(switchn, selector_mode, NULL);
-	analyse_switch1(&info);
-
-	/* Now create the if cascade */
-	env->changed  = true;
-	info.defusers = NEW_ARR_F(ir_node*, 0);
-	block         = get_nodes_block(switchn);
-	ir_switch_table *table = get_Switch_table(switchn);
-	create_if_cascade(&info, block, table->entries, table->n_entries);
-
-	/* Connect new default case users */
-	set_irn_in(info.default_block, ARR_LEN(info.defusers), info.defusers);
-
-	DEL_ARR_F(info.defusers);
+	DEL_ARR_F(clusters);
+	DEL_ARR_F(info.misses);
+	free(info.weights);
 	free(info.targets);
 }
 
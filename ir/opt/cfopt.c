@@ -12,7 +12,7 @@
  * transforms pointless conditional jumps into undonciditonal ones.
  */
 #include "debug.h"
-#include "iredges_t.h"
+#include "irdom.h"
 #include "irgmod.h"
 #include "irgraph_t.h"
 #include "irgwalk.h"
@@ -224,6 +224,15 @@ static unsigned optimize_pointless_forks(ir_node *block, unsigned n_cfgpreds,
 	return new_n_cfgpreds;
 }
 
+/**
+ * Returns true if @p node was replaced by exchange(). Depending on whether out
+ * edges are active, it became an Id or a Deleted node.
+ */
+static bool is_exchanged(ir_node const *node)
+{
+	return is_Id(node) || is_Deleted(node);
+}
+
 static void exchange_phi(ir_node *old, ir_node *new)
 {
 	if (get_Phi_loop(old)) {
@@ -276,6 +285,7 @@ static bool try_merge_blocks(ir_node *block, unsigned pred_pos)
 	if (!is_Block_removable(block))
 		set_Block_removable(pred_block, false);
 	assert(get_Block_entity(block) == NULL);
+	dom_merge_block(block, pred_block);
 	exchange(block, pred_block);
 	return true;
 }
@@ -458,6 +468,7 @@ static void merge_empty_predecessors(ir_node *block, unsigned new_n_cfgpreds)
 			in[n++] = predpred;
 		}
 		/* Merge blocks to preserve keep alive edges. */
+		dom_merge_block(predb, block);
 		exchange(predb, block);
 	}
 	assert(n == new_n_cfgpreds);
@@ -498,7 +509,7 @@ again:;
 		bool bail_out = optimize_block(predb, changed);
 		/* bail out if recursion changed our current block (may happen in
 		 * endless loops only reachable by keep-alive edges) */
-		if (bail_out || is_Id(block) || is_Id(predb))
+		if (bail_out || is_exchanged(block) || is_exchanged(predb))
 			return false;
 
 		++real_preds;
@@ -544,9 +555,6 @@ void optimize_cf(ir_graph *irg)
 {
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE
 	                         | IR_GRAPH_PROPERTY_ONE_RETURN);
-	/* we have some hacky is_Id() checks here so exchange must not use Deleted
-	 * nodes because out edges are active. */
-	edges_deactivate(irg);
 	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_MARK | IR_RESOURCE_PHI_LIST
 	                        | IR_RESOURCE_IRN_LINK);
 
@@ -581,6 +589,9 @@ void optimize_cf(ir_graph *irg)
 
 	ir_free_resources(irg, IR_RESOURCE_BLOCK_MARK | IR_RESOURCE_PHI_LIST
 	                     | IR_RESOURCE_IRN_LINK);
-	confirm_irg_properties(irg, global_changed ? IR_GRAPH_PROPERTIES_NONE
-	                                           : IR_GRAPH_PROPERTIES_ALL);
+	/* the dominance information was updated with each merge, removing
+	 * pointless forks does not change it */
+	confirm_irg_properties(irg, global_changed
+	                       ? IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
+	                       : IR_GRAPH_PROPERTIES_ALL);
 }
@@ -353,5 +353,6 @@ void place_code(ir_graph *irg)
 	place_late(irg, &worklist);
 
 	deq_free(&worklist);
-	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_CONTROL_FLOW);
+	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_CONTROL_FLOW
+	                       | IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
 }
@@ -43,6 +43,7 @@
 #include "pmap.h"
 #include "set.h"
 #include "tv_t.h"
+#include "xmalloc.h"
 #include <assert.h>
 
 /* define this to check that all type translations are monotone */
@@ -182,10 +183,13 @@ static inline bool is_reachable(const node_t *node)
 DEBUG_ONLY(static firm_dbg_module_t *dbg;)
 
 /** The what reason. */
-DEBUG_ONLY(static const char *what_reason;)
+DEBUG_ONLY(static THREAD_LOCAL const char *what_reason;)
 
 /** Next partition number. */
-DEBUG_ONLY(static unsigned part_nr = 0;)
+DEBUG_ONLY(static THREAD_LOCAL unsigned part_nr = 0;)
+
+/** The compute function of each opcode. */
+static THREAD_LOCAL compute_func *compute_funcs;
 
 /* forward */
 static node_t *identity(node_t *node);
@@ -556,8 +560,8 @@ static void sort_irn_outs(node_t *node)
 {
 	ir_node  *irn    = node->node;
 	unsigned  n_outs = get_irn_n_outs(irn);
-	QSORT(irn->o.out->edges, n_outs, cmp_def_use_edge);
-	node->max_user_input = n_outs > 0 ? irn->o.out->edges[n_outs-1].pos : -1;
+	QSORT(irn->cold->o.out->edges, n_outs, cmp_def_use_edge);
+	node->max_user_input = n_outs > 0 ? irn->cold->o.out->edges[n_outs-1].pos : -1;
 }
 
 /**
@@ -803,22 +807,22 @@ static void move_edges_to_leader(node_t *x)
 		ir_node *p    = pred->node;
 		unsigned n    = get_irn_n_outs(p);
 		for (unsigned j = 0; j < pred->n_followers; ++j) {
-			ir_def_use_edge edge = p->o.out->edges[j];
+			ir_def_use_edge edge = p->cold->o.out->edges[j];
 			if (edge.pos == i && edge.use == irn) {
 				/* found a follower edge to x, move it to the leader */
 				/* remove this edge from the follower set */
 				--pred->n_followers;
-				p->o.out->edges[j] = p->o.out->edges[pred->n_followers];
+				p->cold->o.out->edges[j] = p->cold->o.out->edges[pred->n_followers];
 
 				/* sort it into the leader set */
 				unsigned k;
 				for (k = pred->n_followers+1; k < n; ++k) {
-					if (p->o.out->edges[k].pos >= edge.pos)
+					if (p->cold->o.out->edges[k].pos >= edge.pos)
 						break;
-					p->o.out->edges[k-1] = p->o.out->edges[k];
+					p->cold->o.out->edges[k-1] = p->cold->o.out->edges[k];
 				}
 				/* place the new edge here */
-				p->o.out->edges[k-1] = edge;
+				p->cold->o.out->edges[k-1] = edge;
 
 				/* edge found and moved */
 				break;
@@ -992,7 +996,7 @@ static bool step(step_env *env)
 		/* let n be the first node in unwalked */
 		node_t *n = env->unwalked;
 		while (env->index < n->n_followers) {
-			const ir_def_use_edge *edge = &n->node->o.out->edges[env->index];
+			const ir_def_use_edge *edge = &n->node->cold->o.out->edges[env->index];
 
 			/* let m be n.F.def_use[index] */
 			node_t *m = get_irn_node(edge->use);
@@ -1285,7 +1289,7 @@ static void collect_touched(list_head *list, int idx, environment_t *env)
 
 		/* for all edges in x.L.def_use_{idx} */
 		while (x->next_edge < num_edges) {
-			const ir_def_use_edge *edge = &x->node->o.out->edges[x->next_edge];
+			const ir_def_use_edge *edge = &x->node->cold->o.out->edges[x->next_edge];
 
 			/* check if we have necessary edges */
 			if (edge->pos > idx)
@@ -1343,7 +1347,7 @@ static void collect_commutative_touched(list_head *list, environment_t *env)
 
 		/* for all edges in x.L.def_use_{idx} */
 		while (x->next_edge < num_edges) {
-			const ir_def_use_edge *edge = &x->node->o.out->edges[x->next_edge];
+			const ir_def_use_edge *edge = &x->node->cold->o.out->edges[x->next_edge];
 			ir_node               *succ;
 
 			/* check if we have necessary edges */
@@ -2296,7 +2300,7 @@ static void compute(node_t *node)
 		}
 	}
 
-	compute_func func = (compute_func)node->node->op->ops.generic;
+	compute_func func = compute_funcs[get_irn_opcode(node->node)];
 	if (func != NULL)
 		func(node);
 }
@@ -2521,12 +2525,12 @@ static void segregate_def_use_chain_1(const ir_node *follower, node_t *leader)
 	ir_node *l = leader->node;
 	unsigned n = get_irn_n_outs(l);
 	for (unsigned i = leader->n_followers; i < n; ++i) {
-		if (l->o.out->edges[i].use == follower) {
-			ir_def_use_edge t = l->o.out->edges[i];
+		if (l->cold->o.out->edges[i].use == follower) {
+			ir_def_use_edge t = l->cold->o.out->edges[i];
 
 			for (unsigned j = i; j-- > leader->n_followers; )
-				l->o.out->edges[j+1] = l->o.out->edges[j];
-			l->o.out->edges[leader->n_followers] = t;
+				l->cold->o.out->edges[j+1] = l->cold->o.out->edges[j];
+			l->cold->o.out->edges[leader->n_followers] = t;
 			++leader->n_followers;
 			break;
 		}
@@ -3121,7 +3125,7 @@ static void apply_end(ir_node *end, environment_t *env)
 
 static void set_compute_func(ir_op *op, compute_func func)
 {
-	op->ops.generic = (op_func)func;
+	compute_funcs[get_op_code(op)] = func;
 }
 
 /**
@@ -3130,10 +3134,10 @@ static void set_compute_func(ir_op *op, compute_func func)
 static void set_compute_functions(void)
 {
 	/* set the default compute function */
-	for (size_t i = 0, n = ir_get_n_opcodes(); i < n; ++i) {
-		ir_op *op = ir_get_opcode(i);
-		op->ops.generic = (op_func)default_compute;
-	}
+	size_t const n_opcodes = ir_get_n_opcodes();
+	compute_funcs = XMALLOCN(compute_func, n_opcodes);
+	for (size_t i = 0; i < n_opcodes; ++i)
+		compute_funcs[i] = default_compute;
 
 	/* set specific functions */
 	set_compute_func(op_Add,     compute_Add);
@@ -3270,6 +3274,8 @@ void combo(ir_graph *irg)
 	DEL_ARR_F(env.kept_memory);
 	del_set(env.opcode2id_map);
 	obstack_free(&env.obst, NULL);
+	free(compute_funcs);
+	compute_funcs = NULL;
 
 	/* restore value_of() default behavior */
 	set_value_of_func(NULL);
@@ -10,6 +10,7 @@
  *           Michael Beck
  */
 #include "ircons.h"
+#include "irdom.h"
 #include "irgopt.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
@@ -70,6 +71,7 @@ insert:;
 			ir_node *jmp = new_r_Jmp(new_block);
 			/* set successor of new block */
 			set_irn_n(block, i, jmp);
+			dom_insert_block(new_block, block);
 			cenv->changed = true;
 		}
 	}
@@ -83,10 +85,11 @@ void remove_critical_cf_edges_ex(ir_graph *irg, int ignore_exception_edges)
 
 	irg_block_walk_graph(irg, NULL, walk_critical_cf_edges, &env);
 	if (env.changed) {
-		/* control flow changed */
+		/* control flow changed, but the dominance information was updated */
 		clear_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL
 			& ~(IR_GRAPH_PROPERTY_ONE_RETURN
-				| IR_GRAPH_PROPERTY_MANY_RETURNS));
+				| IR_GRAPH_PROPERTY_MANY_RETURNS
+				| IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE));
 	}
 	add_irg_properties(irg, IR_GRAPH_PROPERTY_NO_CRITICAL_EDGES);
 }
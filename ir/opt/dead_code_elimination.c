@@ -13,7 +13,10 @@
  * The only drawback is that the nodes still take up memory. This phase fixes
  * this by copying all (reachable) nodes to a new obstack and throwing away
  * the old one.
+ * compact_graph() additionally orders the copies, so that the nodes of a
+ * block end up next to each other in memory.
  */
+#include "array.h"
 #include "cgana.h"
 #include "iredges_t.h"
 #include "irgraph_t.h"
@@ -26,6 +29,9 @@
 #include "irtools.h"
 #include "pmap.h"
 #include "vrp.h"
+#include "xmalloc.h"
+#include <limits.h>
+#include <stdlib.h>
 
 /**
  * Reroute the inputs of a node from nodes in the old graph to copied nodes in
@@ -42,7 +48,7 @@ static void copy_node_dce(ir_node *node, void *env)
 	(void)env;
 	ir_node *new_node = exact_copy(node);
 	/* preserve the node numbers for easier debugging */
-	new_node->node_nr = node->node_nr;
+	new_node->cold->node_nr = node->cold->node_nr;
 	set_irn_link(node, new_node);
 }
 
@@ -50,13 +56,21 @@ static void copy_node_dce(ir_node *node, void *env)
  * Copies the graph reachable from the End node to the obstack
  * in irg. Then fixes the fields containing nodes of the graph.
  *
- * @param copy_node_nr  If non-zero, the node number will be copied
+ * @param order  the nodes to copy in the order of copying, if NULL they are
+ *               copied in walker order
  */
-static void copy_graph_env(ir_graph *irg)
+static void copy_graph_env(ir_graph *irg, ir_node *const *order)
 {
 	/* copy nodes */
 	ir_node *anchor = irg->anchor;
-	irg_walk_in_or_dep(anchor, copy_node_dce, rewire_inputs, NULL);
+	if (order == NULL) {
+		irg_walk_in_or_dep(anchor, copy_node_dce, rewire_inputs, NULL);
+	} else {
+		for (size_t i = 0, n = ARR_LEN(order); i < n; ++i)
+			copy_node_dce(order[i], NULL);
+		for (size_t i = 0, n = ARR_LEN(order); i < n; ++i)
+			rewire_inputs(order[i], NULL);
+	}
 
 	/* fix the anchor */
 	ir_node *new_anchor = (ir_node*)get_irn_link(anchor);
@@ -64,15 +78,7 @@ static void copy_graph_env(ir_graph *irg)
 	irg->anchor = new_anchor;
 }
 
-/**
- * Copies all reachable nodes to a new obstack.  Removes bad inputs
- * from block nodes and the corresponding inputs from Phi nodes.
- * Merges single exit blocks with single entry blocks and removes
- * 1-input Phis.
- * Adds all new nodes to a new hash table for CSE.  Does not
- * perform CSE, so the hash table might contain common subexpressions.
- */
-void dead_node_elimination(ir_graph *irg)
+static void copy_to_new_obstack(ir_graph *irg, ir_node *const *order)
 {
 	edges_deactivate(irg);
 
@@ -96,9 +102,97 @@ void dead_node_elimination(ir_graph *irg)
 
 	/* Copy the graph from the old to the new obstack */
 	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
-	copy_graph_env(irg);
+	copy_graph_env(irg, order);
 	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
 
 	/* Free memory from old unoptimized obstack */
 	obstack_free(&graveyard_obst, 0);  /* First empty the obstack ... */
 }
+
+/**
+ * Copies all reachable nodes to a new obstack.  Removes bad inputs
+ * from block nodes and the corresponding inputs from Phi nodes.
+ * Merges single exit blocks with single entry blocks and removes
+ * 1-input Phis.
+ * Adds all new nodes to a new hash table for CSE.  Does not
+ * perform CSE, so the hash table might contain common subexpressions.
+ */
+void dead_node_elimination(ir_graph *irg)
+{
+	copy_to_new_obstack(irg, NULL);
+}
+
+typedef struct compact_entry_t {
+	ir_node  *node;
+	unsigned  key;   /**< 2 * block rank, + 1 for nodes in the block */
+	unsigned  seq;   /**< position in walker order */
+} compact_entry_t;
+
+typedef struct compact_env_t {
+	unsigned        *block_rank; /**< postorder number of blocks by index */
+	unsigned         n_blocks;
+	compact_entry_t *entries;
+} compact_env_t;
+
+static void number_block(ir_node *block, void *data)
+{
+	compact_env_t *const env = (compact_env_t*)data;
+	env->block_rank[get_irn_idx(block)] = env->n_blocks++;
+}
+
+static void collect_node(ir_node *node, void *data)
+{
+	compact_env_t *const env   = (compact_env_t*)data;
+	ir_node       *const block = is_Block(node) ? node
+	                           : is_Anchor(node) ? NULL : get_nodes_block(node);
+	unsigned             key   = UINT_MAX;
+	if (block != NULL && is_Block(block)) {
+		unsigned const post = env->block_rank[get_irn_idx(block)];
+		if (post != UINT_MAX)
+			key = 2 * (env->n_blocks - 1 - post) + (node != block);
+	}
+	compact_entry_t const entry = {
+		.node = node, .key = key, .seq = (unsigned)ARR_LEN(env->entries),
+	};
+	ARR_APP1(compact_entry_t, env->entries, entry);
+}
+
+static int cmp_compact_entry(void const *a, void const *b)
+{
+	compact_entry_t const *const ea = (compact_entry_t const*)a;
+	compact_entry_t const *const eb = (compact_entry_t const*)b;
+	if (ea->key != eb->key)
+		return ea->key < eb->key ? -1 : 1;
+	return ea->seq < eb->seq ? -1 : ea->seq > eb->seq;
+}
+
+void compact_graph(ir_graph *irg)
+{
+	assert(!irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_CONSTRUCTION));
+
+	compact_env_t env;
+	unsigned const n_idx = get_irg_last_idx(irg);
+	env.block_rank = XMALLOCN(unsigned, n_idx);
+	env.n_blocks   = 0;
+	env.entries    = NEW_ARR_F(compact_entry_t, 0);
+	for (unsigned i = 0; i < n_idx; ++i)
+		env.block_rank[i] = UINT_MAX;
+
+	/* Blocks go in reverse postorder, each followed by its nodes. Within a
+	 * block the nodes keep the order in which the graph walker reaches them,
+	 * so later walks run through memory sequentially. Unreachable blocks and
+	 * the Anchor go last. */
+	irg_block_walk_graph(irg, NULL, number_block, &env);
+	irg_walk_in_or_dep(irg->anchor, collect_node, NULL, &env);
+	size_t const n_nodes = ARR_LEN(env.entries);
+	qsort(env.entries, n_nodes, sizeof(*env.entries), cmp_compact_entry);
+
+	ir_node **const order = NEW_ARR_F(ir_node*, n_nodes);
+	for (size_t i = 0; i < n_nodes; ++i)
+		order[i] = env.entries[i].node;
+	DEL_ARR_F(env.entries);
+	free(env.block_rank);
+
+	copy_to_new_obstack(irg, order);
+	DEL_ARR_F(order);
+}
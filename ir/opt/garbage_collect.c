@@ -137,7 +137,9 @@ void garbage_collect_entities(void)
 	/* remove graphs of non-visited functions
 	 * (we have to count backwards, because freeing the graph moves the last
 	 *  graph in the list to the free position) */
-	foreach_irp_irg_r(i, irg) {
+	for (size_t i = get_irp_n_irgs(); i-- > 0;) {
+		/* unreachable stub graphs are freed without reading them */
+		ir_graph  *irg    = get_irp_irg_or_stub(i);
 		ir_entity *entity = get_irg_entity(irg);
 
 		if (entity_visited(entity))
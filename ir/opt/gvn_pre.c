@@ -100,15 +100,15 @@ typedef struct pre_env {
 	char            first_iter;   /* non-zero for first fixed point iteration */
 	int             iteration;    /* iteration counter */
 #if OPTIMIZE_NODES
-	pset           *value_table;   /* standard value table*/
-	pset           *gvnpre_values; /* GVN-PRE value table */
+	ir_valuetable_t *value_table;   /* standard value table*/
+	ir_valuetable_t *gvnpre_values; /* GVN-PRE value table */
 #endif
 } pre_env;
 
-static pre_env *environment;
+static THREAD_LOCAL pre_env *environment;
 
 /* custom GVN value map */
-static ir_nodehashmap_t value_map;
+static THREAD_LOCAL ir_nodehashmap_t value_map;
 
 /* debug module handle */
 DEBUG_ONLY(static firm_dbg_module_t *dbg;)
@@ -133,7 +133,7 @@ typedef struct gvnpre_statistics {
 	int infinite_loops;
 } gvnpre_statistics;
 
-static gvnpre_statistics *gvnpre_stats = NULL;
+static THREAD_LOCAL gvnpre_statistics *gvnpre_stats = NULL;
 
 static void init_stats(void)
 {
@@ -224,11 +224,8 @@ static void dump_all_expgen_sets(block_info *list)
  * Compares node collisions in value table.
  * Modified identities_cmp().
  */
-static int compare_gvn_identities(const void *elt, const void *key)
+static int compare_gvn_identities(const ir_node *a, const ir_node *b)
 {
-	ir_node *a = (ir_node *)elt;
-	ir_node *b = (ir_node *)key;
-
 	if (a == b)
 		return 0;
 
@@ -1838,9 +1835,9 @@ void do_gvn_pre(ir_graph *irg)
 	set_opt_global_cse(1);
 	/* new_identities() */
 	if (irg->value_table != NULL)
-		del_pset(irg->value_table);
-	/* initially assumed nodes in pset are 512 */
-	irg->value_table = new_pset(compare_gvn_identities, 512);
+		del_ir_valuetable(irg->value_table);
+	/* initially assumed nodes in the table are 512 */
+	irg->value_table = new_ir_valuetable(compare_gvn_identities, 512);
 #if OPTIMIZE_NODES
 	env.gvnpre_values = irg->value_table;
 #endif
@@ -1867,7 +1864,7 @@ void do_gvn_pre(ir_graph *irg)
 
 #if OPTIMIZE_NODES
 	irg->value_table = env.value_table;
-	del_pset(irg->value_table);
+	del_ir_valuetable(irg->value_table);
 	irg->value_table = env.gvnpre_values;
 #endif
 
@@ -11,6 +11,7 @@
 #include "cdep_t.h"
 #include "debug.h"
 #include "ircons.h"
+#include "irdom.h"
 #include "irgmod.h"
 #include "irgopt.h"
 #include "irgwalk.h"
@@ -19,6 +20,7 @@
 #include "irtools.h"
 #include "pdeq.h"
 #include "target_t.h"
+#include "util.h"
 #include <assert.h>
 #include <stdbool.h>
 
@@ -193,12 +195,15 @@ static void split_block(ir_node *block, int i, int j)
 		set_irn_in(phi, k, ins);
 	}
 
+	ir_node *const moved       = get_irn_n(pred_block, j);
+	ir_node *const moved_block = get_nodes_block(moved);
 	int k;
 	for (k = 0; k < i; ++k) ins[k] = get_Block_cfgpred(block, k);
-	ins[k++] = get_irn_n(pred_block, j);
+	ins[k++] = moved;
 	for (; k < arity; ++k) ins[k] = get_Block_cfgpred(block, k);
 	ins[k++] = get_Block_cfgpred(block, i);
 	set_irn_in(block, k, ins);
+	dom_insert_edge(moved_block, block);
 
 	int       new_pred_arity = get_irn_arity(pred_block) - 1;
 	ir_node **pred_ins       = ALLOCAN(ir_node*, new_pred_arity);
@@ -218,10 +223,12 @@ static void split_block(ir_node *block, int i, int j)
 
 	for (k = 0; k != j;              ++k) pred_ins[k] = get_irn_n(pred_block, k);
 	for (;      k != new_pred_arity; ++k) pred_ins[k] = get_irn_n(pred_block, k + 1);
+	set_irn_in(pred_block, k, pred_ins);
+	dom_delete_edge(moved_block, pred_block);
 	if (k == 1) {
-		exchange(pred_block, get_nodes_block(pred_ins[0]));
-	} else {
-		set_irn_in(pred_block, k, pred_ins);
+		ir_node *const single_pred_block = get_nodes_block(pred_ins[0]);
+		dom_merge_block(pred_block, single_pred_block);
+		exchange(pred_block, single_pred_block);
 	}
 }
 
@@ -248,6 +255,7 @@ static void prepare_path(ir_node *block, int i, const ir_node *dependency)
 			break;
 
 		ir_node *pred_pred_block = get_nodes_block(pred_pred);
+		dom_merge_block(pred, pred_pred_block);
 		exchange(pred, pred_pred_block);
 		pred = pred_pred_block;
 	}
@@ -382,8 +390,15 @@ restart:;
 				} while (phi != NULL);
 
 				/* move mux operands into mux_block */
-				exchange(get_Block_cfgpred_block(block, i), mux_block);
-				exchange(get_Block_cfgpred_block(block, j), mux_block);
+				ir_node *const arms[] = {
+					get_Block_cfgpred_block(block, i),
+					get_Block_cfgpred_block(block, j),
+				};
+				for (size_t k = 0; k < ARRAY_SIZE(arms); ++k) {
+					ir_node *const arm = arms[k];
+					dom_merge_block(arm, mux_block);
+					exchange(arm, mux_block);
+				}
 
 				if (arity == 2) {
 					unsigned mark;
@@ -391,6 +406,7 @@ restart:;
 					mark =  get_Block_mark(mux_block) | get_Block_mark(block);
 					/* mark both block just to be sure, should be enough to mark mux_block */
 					set_Block_mark(mux_block, mark);
+					dom_merge_block(block, mux_block);
 					exchange(block, mux_block);
 					return;
 				} else {
@@ -440,6 +456,19 @@ static void collect_phis(ir_node *node, void *env)
 	}
 }
 
+/**
+ * Block walker: Clear the flag @p env if a control flow edge into the block
+ * was replaced by a Bad.
+ */
+static void find_removed_edge(ir_node *block, void *env)
+{
+	bool *keep_dominance = (bool*)env;
+	foreach_irn_in(block, i, pred) {
+		if (is_Bad(skip_Tuple(pred)))
+			*keep_dominance = false;
+	}
+}
+
 static void fill_waitq(ir_node *node, void *env) {
 	deq_t *waitq = (deq_t*)env;
 	deq_push_pointer_right(waitq, node);
@@ -484,8 +513,13 @@ void opt_if_conv_cb(ir_graph *irg, arch_allow_ifconv_func callback)
 
 	ir_free_resources(irg, IR_RESOURCE_BLOCK_MARK | IR_RESOURCE_PHI_LIST);
 
+	/* the dominance information was updated with each change */
+	bool keep_dominance = true;
 	if (env.changed) {
 		local_optimize_graph(irg);
+		/* The local optimizations drop the dominance information, but they
+		 * only change the control flow by removing edges. */
+		irg_block_walk_graph(irg, find_removed_edge, NULL, &keep_dominance);
 	}
 
 	free_cdep(irg);
@@ -493,6 +527,8 @@ void opt_if_conv_cb(ir_graph *irg, arch_allow_ifconv_func callback)
 	confirm_irg_properties(irg,
 		IR_GRAPH_PROPERTY_NO_CRITICAL_EDGES
 		| IR_GRAPH_PROPERTY_ONE_RETURN);
+	if (keep_dominance)
+		add_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
 }
 
 void opt_if_conv(ir_graph *irg)
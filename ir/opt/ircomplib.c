@@ -16,17 +16,21 @@
 #include "typerep.h"
 #include <assert.h>
 
+/** Keeps threads lowering graphs from creating an entity twice. */
+static ir_mutex_t compilerlib_mutex = IR_MUTEX_INITIALIZER;
+
 ir_entity *create_compilerlib_entity(char const *const name, ir_type *mt)
 {
 	ident *ld_name = ir_platform_mangle_global(name);
 
+	ir_mutex_lock(&compilerlib_mutex);
 	/* Look for existing entity. */
 	ir_entity *entity = ir_get_global(ld_name);
-	if (entity != NULL)
-		return entity;
-
-	/* Create a new one */
-	ir_type *glob = get_glob_type();
-	entity = new_entity(glob, ld_name, mt);
+	if (entity == NULL) {
+		/* Create a new one */
+		ir_type *glob = get_glob_type();
+		entity = new_entity(glob, ld_name, mt);
+	}
+	ir_mutex_unlock(&compilerlib_mutex);
 	return entity;
 }
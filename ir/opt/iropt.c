@@ -137,7 +137,7 @@ static ir_tarval *default_value_of(const ir_node *n)
 		return tarval_unknown;
 }
 
-value_of_func value_of_ptr = default_value_of;
+THREAD_LOCAL value_of_func value_of_ptr = default_value_of;
 
 void set_value_of_func(value_of_func func)
 {
@@ -7585,6 +7585,20 @@ static bool always_optimize(unsigned const iro)
 		iro == iro_Proj;
 }
 
+/**
+ * Returns whether @p node operates on values of a vector mode. The
+ * transformations only know about scalar values and leave such nodes alone.
+ */
+static bool is_vector_node(const ir_node *node)
+{
+	switch (get_irn_opcode(node)) {
+	case iro_Div:   return mode_is_vector(get_Div_resmode(node));
+	case iro_Load:  return mode_is_vector(get_Load_mode(node));
+	case iro_Store: return mode_is_vector(get_irn_mode(get_Store_value(node)));
+	default:        return mode_is_vector(get_irn_mode(node));
+	}
+}
+
 /**
  * Tries several [inplace] [optimizing] transformations and returns an
  * equivalent node.  The difference to equivalent_node() is that these
@@ -7641,7 +7655,7 @@ restart:;
 	if (get_opt_algebraic_simplification() ||
 		(iro == iro_Cond) ||
 		(iro == iro_Proj)) {    /* Flags tested local. */
-		if (n->op->ops.transform_node != NULL) {
+		if (n->op->ops.transform_node != NULL && !is_vector_node(n)) {
 			n = n->op->ops.transform_node(n);
 			if (n != old_n)
 				goto restart;
@@ -7741,11 +7755,8 @@ void ir_register_opt_node_ops(void)
  * in a graph. */
 #define N_IR_NODES 512
 
-static int identities_cmp(const void *elt, const void *key)
+static int identities_cmp(const ir_node *a, const ir_node *b)
 {
-	ir_node *a = (ir_node *)elt;
-	ir_node *b = (ir_node *)key;
-
 	if (a == b)
 		return 0;
 
@@ -7753,11 +7764,6 @@ static int identities_cmp(const void *elt, const void *key)
 	    (get_irn_mode(a) != get_irn_mode(b)))
 	    return 1;
 
-	/* compare if a's in and b's in are of equal length */
-	int irn_arity_a = get_irn_arity(a);
-	if (irn_arity_a != get_irn_arity(b))
-		return 1;
-
 	/* blocks are never the same */
 	if (is_Block(a))
 		return 1;
@@ -7794,12 +7800,8 @@ static int identities_cmp(const void *elt, const void *key)
 	}
 
 	/* compare a->in[0..ins] with b->in[0..ins] */
-	for (int i = 0; i < irn_arity_a; ++i) {
-		ir_node *pred_a = get_irn_n(a, i);
-		ir_node *pred_b = get_irn_n(b, i);
-		if (pred_a != pred_b)
-			return 1;
-	}
+	if (!a->op->ops.inputs_equal(a, b))
+		return 1;
 
 	/* here, we already know that the nodes are identical except their
 	 * attributes */
@@ -7814,13 +7816,15 @@ unsigned ir_node_hash(const ir_node *node)
 void new_identities(ir_graph *irg)
 {
 	del_identities(irg);
-	irg->value_table = new_pset(identities_cmp, N_IR_NODES);
+	irg->value_table = new_ir_valuetable(identities_cmp, N_IR_NODES);
 }
 
 void del_identities(ir_graph *irg)
 {
-	if (irg->value_table != NULL)
-		del_pset(irg->value_table);
+	if (irg->value_table != NULL) {
+		del_ir_valuetable(irg->value_table);
+		irg->value_table = NULL;
+	}
 }
 
 static int cmp_node_nr(const void *a, const void *b)
@@ -7874,15 +7878,15 @@ void ir_normalize_node(ir_node *n)
 
 ir_node *identify_remember(ir_node *n)
 {
-	ir_graph *irg         = get_irn_irg(n);
-	pset     *value_table = irg->value_table;
+	ir_graph        *irg         = get_irn_irg(n);
+	ir_valuetable_t *value_table = irg->value_table;
 
 	if (value_table == NULL)
 		return n;
 
 	ir_normalize_node(n);
 	/* lookup or insert in hash table with given hash key. */
-	ir_node *nn = (ir_node *)pset_insert(value_table, n, ir_node_hash(n));
+	ir_node *nn = ir_valuetable_insert(value_table, n, ir_node_hash(n));
 
 	/* nn is reachable again */
 	if (nn != n)
@@ -7922,9 +7926,7 @@ void add_identities(ir_node *node)
 
 void visit_all_identities(ir_graph *irg, irg_walk_func visit, void *env)
 {
-	foreach_pset(irg->value_table, ir_node, node) {
-		visit(node, env);
-	}
+	ir_valuetable_visit(irg->value_table, visit, env);
 }
 
 ir_node *optimize_node(ir_node *n)
@@ -7951,6 +7953,8 @@ ir_node *optimize_node(ir_node *n)
 				oldn = (ir_node *)alloca(node_size);
 
 				memcpy(oldn, n, node_size);
+				oldn->cold = ALLOCAN(ir_node_cold, 1);
+				*oldn->cold = *n->cold;
 				size_t n_in = ARR_LEN(n->in);
 				oldn->in = ALLOCAN(ir_node*, n_in);
 
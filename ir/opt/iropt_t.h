@@ -79,7 +79,7 @@ ir_node *optimize_in_place_2(ir_node *n);
  */
 typedef ir_tarval *(*value_of_func)(const ir_node *self);
 
-extern value_of_func value_of_ptr;
+extern THREAD_LOCAL value_of_func value_of_ptr;
 
 /**
  * Set a new value_of function.
@@ -12,6 +12,7 @@
 #include "array.h"
 #include "debug.h"
 #include "ircons.h"
+#include "irdom.h"
 #include "iredges_t.h"
 #include "irgmod.h"
 #include "irgopt.h"
@@ -44,8 +45,8 @@ static void add_pred(ir_node *node, ir_node *x)
 	set_irn_in(node, n + 1, ins);
 }
 
-static ir_node *ssa_second_def;
-static ir_node *ssa_second_def_block;
+static THREAD_LOCAL ir_node *ssa_second_def;
+static THREAD_LOCAL ir_node *ssa_second_def_block;
 
 static ir_node *search_def_and_create_phis(ir_node *block, ir_mode *mode,
                                            bool first)
@@ -197,6 +198,7 @@ static void split_critical_edge(ir_node *block, int pos)
 	ir_node  *new_block = new_r_Block(irg, ARRAY_SIZE(in), in);
 	ir_node  *new_jmp   = new_r_Jmp(new_block);
 	set_Block_cfgpred(block, pos, new_jmp);
+	dom_insert_block(new_block, block);
 }
 
 typedef struct jumpthreading_env_t {
@@ -258,6 +260,7 @@ static void copy_and_fix(const jumpthreading_env_t *env, ir_node *block,
 			/* edge is a Keep edge. If the end block is unreachable via normal
 			 * control flow, we must maintain end's reachability with Keeps. */
 			keep_alive(copy_block);
+			dom_insert_edge(copy_block, get_irg_end_block(get_irn_irg(block)));
 			continue;
 		}
 		/* ignore control flow */
@@ -409,9 +412,11 @@ static ir_node *find_const_or_confirm(jumpthreading_env_t *env, ir_node *jump,
 		assert(get_Block_n_cfgpreds(env->true_block) == 1);
 		if (block == get_Block_cfgpred_block(env->true_block, 0)) {
 			if (evaluated == 0) {
-				ir_graph *irg = get_irn_irg(block);
-				ir_node  *bad = new_r_Bad(irg, mode_X);
+				ir_graph *irg    = get_irn_irg(block);
+				ir_node  *bad    = new_r_Bad(irg, mode_X);
+				ir_node  *target = get_edge_src_irn(get_irn_out_edge_first(jump));
 				exchange(jump, bad);
+				dom_delete_edge(block, target);
 			} else if (evaluated == 1) {
 				dbg_info *dbgi = get_irn_dbg_info(skip_Proj(jump));
 				ir_node  *jmp  = new_rd_Jmp(dbgi, get_nodes_block(jump));
@@ -429,6 +434,7 @@ static ir_node *find_const_or_confirm(jumpthreading_env_t *env, ir_node *jump,
 
 		/* adjust true_block to point directly towards our jump */
 		add_pred(env->true_block, jump);
+		dom_insert_edge(block, env->true_block);
 
 		split_critical_edge(env->true_block, 0);
 
@@ -482,6 +488,7 @@ static ir_node *find_candidate(jumpthreading_env_t *env, ir_node *jump,
 
 		/* adjust true_block to point directly towards our jump */
 		add_pred(env->true_block, jump);
+		dom_insert_edge(block, env->true_block);
 
 		split_critical_edge(env->true_block, 0);
 
@@ -590,6 +597,17 @@ static void thread_jumps(ir_node* block, void* data)
 			[pn_Cond_true]  = is_true ? jmp : bad,
 		};
 		turn_into_tuple(cond, ARRAY_SIZE(in), in);
+
+		/* the exit of the Cond not taken is gone now */
+		unsigned const dead_pn = is_true ? pn_Cond_false : pn_Cond_true;
+		foreach_out_edge(cond, edge) {
+			ir_node *const proj = get_edge_src_irn(edge);
+			if (get_Proj_num(proj) != dead_pn)
+				continue;
+			foreach_out_edge(proj, proj_edge) {
+				dom_delete_edge(cond_block, get_edge_src_irn(proj_edge));
+			}
+		}
 		*changed = true;
 		return;
 	}
@@ -609,6 +627,7 @@ static void thread_jumps(ir_node* block, void* data)
 		/* We might thread the condition block of an infinite loop,
 		 * such that there is no path to End anymore. */
 		keep_alive(block);
+		dom_insert_edge(block, get_irg_end_block(irg));
 
 		/* we have to remove the edge towards the pred as the pred now
 		 * jumps into the true_block. We also have to shorten Phis
@@ -626,7 +645,11 @@ static void thread_jumps(ir_node* block, void* data)
 			}
 		}
 
+		ir_node *const pred_block
+			= get_Block_cfgpred_block(env.cnst_pred, cnst_pos);
 		set_Block_cfgpred(env.cnst_pred, cnst_pos, badX);
+		if (pred_block != NULL)
+			dom_delete_edge(pred_block, env.cnst_pred);
 	}
 
 	/* the graph is changed now */
@@ -659,7 +682,8 @@ void opt_jumpthreading(ir_graph* irg)
 	if (changed) {
 		/* we tend to produce a lot of duplicated keep edges, remove them */
 		remove_End_Bads_and_doublets(get_irg_end(irg));
-		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_NONE);
+		/* the dominance information was updated with each change */
+		confirm_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
 	} else {
 		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
 	}
@@ -94,7 +94,7 @@ typedef struct block_info_t {
 } block_info_t;
 
 /** the master visited flag for loop detection. */
-static unsigned master_visited;
+static THREAD_LOCAL unsigned master_visited;
 
 #define INC_MASTER()       ++master_visited
 #define MARK_NODE(info)    (info)->visited = master_visited
@@ -379,6 +379,10 @@ static bool is_contained_in(ir_mode *const load_mode, const base_offset_t *const
 	if (load_mode == prev_mode)
 		return true;
 
+	/* vector values cannot be taken apart */
+	if (mode_is_vector(load_mode) || mode_is_vector(prev_mode))
+		return false;
+
 	ir_mode_arithmetic prev_arithmetic = get_mode_arithmetic(prev_mode);
 	ir_mode_arithmetic load_arithmetic = get_mode_arithmetic(load_mode);
 	return (prev_arithmetic == irma_twos_complement &&
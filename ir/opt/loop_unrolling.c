@@ -10,6 +10,8 @@
  */
 #include "lcssa_t.h"
 #include "irtools.h"
+#include "irdom.h"
+#include "array.h"
 #include "xmalloc.h"
 #include "debug.h"
 #include <assert.h>
@@ -578,6 +580,7 @@ static bool unroll_loop(ir_loop *const loop, unsigned factor)
 		}
 	}
 
+	ir_node **copies = NEW_ARR_F(ir_node*, 0);
 	for (unsigned j = 1; j < factor; ++j) {
 
 		// step 1: duplicate blocks
@@ -586,6 +589,7 @@ static bool unroll_loop(ir_loop *const loop, unsigned factor)
 			if (*element.kind == k_ir_node) {
 				assert(is_Block(element.node));
 				duplicate_block(element.node);
+				ARR_APP1(ir_node*, copies, get_irn_link(element.node));
 			}
 		}
 
@@ -605,6 +609,9 @@ static bool unroll_loop(ir_loop *const loop, unsigned factor)
 	if (fully_unroll) {
 		rewire_fully_unrolled(loop, header);
 	}
+	// the header keeps its dominator, only the loop and its copies changed
+	dom_update_subtree(header, copies, ARR_LEN(copies));
+	DEL_ARR_F(copies);
 	pset_new_destroy(&loop_blocks);
 	return fully_unroll;
 }
@@ -667,7 +674,7 @@ void unroll_loops(ir_graph *const irg, unsigned factor, unsigned maxsize)
 		duplicate_innermost_loops(get_irg_loop(irg), factor, maxsize, true);
 		free_loop_information(irg);
 		ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
-		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
+		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
 	} while (reanalyze);
 	DB((dbg, LEVEL_1, "%+F: %d loops unrolled\n", irg, n_loops_unrolled));
 }
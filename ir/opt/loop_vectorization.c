@@ -0,0 +1,688 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Vectorization of simple counted loops.
+ *
+ * Handles innermost loops made of a header, which compares an induction
+ * variable with a loop invariant bound, and a single body block, whose loads
+ * and stores access consecutive elements of arrays. A copy of the loop is
+ * placed in front of it, which computes all element values with vector modes
+ * and advances the induction variable by the number of vector elements. The
+ * original loop runs the remaining iterations afterwards. The vector loop is
+ * skipped if the stored arrays overlap with other accessed arrays at runtime.
+ */
+#include "iroptimize.h"
+
+#include "array.h"
+#include "bitfiddle.h"
+#include "debug.h"
+#include "ircons.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irloop_t.h"
+#include "irmode_t.h"
+#include "irnode_t.h"
+#include "irnodeset.h"
+#include "irouts_t.h"
+#include "lcssa_t.h"
+#include "pmap.h"
+#include "target_t.h"
+#include "tv.h"
+#include "util.h"
+#include "xmalloc.h"
+
+/** Maximal number of runtime overlap checks in front of a vector loop. */
+#define MAX_OVERLAP_CHECKS 6
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
+
+/** Two array bases, which have to be at least a vector size apart. */
+typedef struct overlap_check_t {
+	ir_node *base0;
+	ir_node *base1;
+} overlap_check_t;
+
+typedef struct vec_loop_t {
+	ir_node        *header;     /**< the block testing the loop condition */
+	ir_node        *body;       /**< the only other block of the loop */
+	int             entry_pos;  /**< header predecessor entering the loop */
+	int             back_pos;   /**< header predecessor of the back edge */
+	ir_node        *iv;         /**< Phi of the induction variable */
+	ir_node        *mem;        /**< Phi of the memory */
+	ir_node        *bound;      /**< the loop runs while iv < bound */
+	ir_node        *cmp;        /**< the comparison of iv and bound */
+	unsigned        elem_size;  /**< size of the accessed elements in bytes */
+	unsigned        n_lanes;    /**< number of elements per vector */
+	unsigned        n_stores;
+	ir_nodeset_t    accesses;   /**< Loads and Stores of the loop */
+	ir_nodeset_t    addr_nodes; /**< address computations of the accesses */
+	ir_nodeset_t    vec_nodes;  /**< nodes computing one value per element */
+	pmap           *splats;     /**< invariant values used as vectors */
+	ir_node       **load_bases;
+	ir_node       **store_bases;
+	overlap_check_t checks[MAX_OVERLAP_CHECKS];
+	unsigned        n_checks;
+	pmap           *copies;     /**< nodes of the loop to their vector copy */
+	ir_node        *vec_body;   /**< body block of the vector loop */
+} vec_loop_t;
+
+static bool is_in_loop(vec_loop_t const *const vl, ir_node const *const node)
+{
+	ir_node const *const block = get_nodes_block(node);
+	return block == vl->header || block == vl->body;
+}
+
+static bool is_Const_value(ir_node const *const node, long const value)
+{
+	if (!is_Const(node))
+		return false;
+	ir_tarval *const tv = get_Const_tarval(node);
+	return tarval_is_long(tv) && get_tarval_long(tv) == value;
+}
+
+static bool is_supported(vec_loop_t const *const vl, ir_op const *const op,
+                         ir_mode *const element_mode)
+{
+	ir_mode *const mode = get_vector_mode(element_mode, vl->n_lanes);
+	return ir_target.vector_op_supported(op, mode);
+}
+
+/**
+ * Finds header and body of the loop and the induction variable, which
+ * counts up by one while it is less than an invariant bound.
+ */
+static bool analyze_shape(vec_loop_t *const vl, ir_loop *const loop)
+{
+	if (get_loop_n_elements(loop) != 2)
+		return false;
+	ir_node *blocks[2];
+	for (size_t i = 0; i < 2; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind != k_ir_node)
+			return false;
+		blocks[i] = element.node;
+	}
+	bool     const swap   = get_Block_n_cfgpreds(blocks[0]) == 1;
+	ir_node *const header = blocks[swap];
+	ir_node *const body   = blocks[!swap];
+	if (get_Block_n_cfgpreds(header) != 2 || get_Block_n_cfgpreds(body) != 1)
+		return false;
+	vl->header = header;
+	vl->body   = body;
+
+	ir_node *const body_pred = get_Block_cfgpred(body, 0);
+	if (!is_Proj(body_pred))
+		return false;
+	ir_node *const cond = get_Proj_pred(body_pred);
+	if (!is_Cond(cond) || get_nodes_block(cond) != header)
+		return false;
+	ir_node *const back_pred = get_Block_cfgpred(header, 1);
+	vl->back_pos  = is_Jmp(back_pred) && get_nodes_block(back_pred) == body;
+	vl->entry_pos = !vl->back_pos;
+	ir_node *const back  = get_Block_cfgpred(header, vl->back_pos);
+	ir_node *const entry = get_Block_cfgpred(header, vl->entry_pos);
+	if (!is_Jmp(back) || get_nodes_block(back) != body || is_in_loop(vl, entry))
+		return false;
+
+	ir_node *const cmp = get_Cond_selector(cond);
+	if (!is_Cmp(cmp) || get_nodes_block(cmp) != header)
+		return false;
+	ir_relation relation = get_Cmp_relation(cmp);
+	if (get_Proj_num(body_pred) == pn_Cond_false)
+		relation = get_negated_relation(relation);
+	ir_node *iv    = get_Cmp_left(cmp);
+	ir_node *bound = get_Cmp_right(cmp);
+	if (!is_Phi(iv) || get_nodes_block(iv) != header) {
+		iv       = bound;
+		bound    = get_Cmp_left(cmp);
+		relation = get_inversed_relation(relation);
+	}
+	relation &= ~ir_relation_unordered;
+	if (relation != ir_relation_less || !is_Phi(iv)
+	    || get_nodes_block(iv) != header || !mode_is_int(get_irn_mode(iv))
+	    || is_in_loop(vl, bound))
+		return false;
+
+	/* the increment must only be used by the Phi */
+	ir_node *const next = get_Phi_pred(iv, vl->back_pos);
+	if (!is_Add(next) || get_irn_n_outs(next) != 1)
+		return false;
+	ir_node *const left  = get_Add_left(next);
+	ir_node *const right = get_Add_right(next);
+	if (!(left == iv && is_Const_one(right))
+	    && !(right == iv && is_Const_one(left)))
+		return false;
+
+	vl->iv    = iv;
+	vl->bound = bound;
+	vl->cmp   = cmp;
+	return true;
+}
+
+/**
+ * Matches the address base + iv * elem_size of an access and returns base,
+ * which is invariant. The address computation is recorded.
+ */
+static ir_node *get_access_base(vec_loop_t *const vl, ir_node *const ptr)
+{
+	if (!is_Add(ptr) || !is_in_loop(vl, ptr))
+		return NULL;
+	ir_node *base   = get_Add_left(ptr);
+	ir_node *offset = get_Add_right(ptr);
+	if (!mode_is_reference(get_irn_mode(base))) {
+		base   = offset;
+		offset = get_Add_left(ptr);
+	}
+	if (is_in_loop(vl, base))
+		return NULL;
+
+	unsigned const size  = vl->elem_size;
+	ir_node       *index = NULL;
+	if (is_Mul(offset)) {
+		ir_node *const left  = get_Mul_left(offset);
+		ir_node *const right = get_Mul_right(offset);
+		if (is_Const_value(right, size))
+			index = left;
+		else if (is_Const_value(left, size))
+			index = right;
+	} else if (is_Shl(offset) && is_po2_or_zero(size)) {
+		if (is_Const_value(get_Shl_right(offset), log2_floor(size)))
+			index = get_Shl_left(offset);
+	} else if (size == 1) {
+		index = offset;
+		offset = NULL;
+	}
+	if (index == NULL)
+		return NULL;
+
+	ir_node *conv = NULL;
+	if (is_Conv(index)) {
+		/* the induction variable does not overflow, so extending it keeps
+		 * the elements consecutive */
+		ir_mode *const mode = get_irn_mode(index);
+		conv  = index;
+		index = get_Conv_op(conv);
+		if (!mode_is_int(mode)
+		    || get_mode_size_bits(mode) < get_mode_size_bits(get_irn_mode(index)))
+			return NULL;
+	}
+	if (index != vl->iv)
+		return NULL;
+
+	ir_nodeset_insert(&vl->addr_nodes, ptr);
+	if (offset != NULL)
+		ir_nodeset_insert(&vl->addr_nodes, offset);
+	if (conv != NULL)
+		ir_nodeset_insert(&vl->addr_nodes, conv);
+	return base;
+}
+
+static bool analyze_access(vec_loop_t *const vl, ir_node *const node)
+{
+	ir_node *ptr;
+	ir_mode *mode;
+	if (is_Load(node)) {
+		if (get_Load_volatility(node) == volatility_is_volatile)
+			return false;
+		ptr  = get_Load_ptr(node);
+		mode = get_Load_mode(node);
+	} else {
+		if (get_Store_volatility(node) == volatility_is_volatile)
+			return false;
+		ptr  = get_Store_ptr(node);
+		mode = get_irn_mode(get_Store_value(node));
+	}
+	if (ir_throws_exception(node) || (!mode_is_int(mode) && !mode_is_float(mode)))
+		return false;
+	unsigned const size = get_mode_size_bytes(mode);
+	if (vl->elem_size == 0)
+		vl->elem_size = size;
+	else if (size != vl->elem_size)
+		return false;
+
+	ir_node *const base = get_access_base(vl, ptr);
+	if (base == NULL)
+		return false;
+	ir_nodeset_insert(&vl->accesses, node);
+	if (is_Load(node)) {
+		ARR_APP1(ir_node*, vl->load_bases, base);
+	} else {
+		ARR_APP1(ir_node*, vl->store_bases, base);
+		++vl->n_stores;
+	}
+	return true;
+}
+
+/**
+ * Checks that @p node computes one value per element, i.e. it is loaded,
+ * computed from such values or invariant.
+ */
+static bool analyze_value(vec_loop_t *const vl, ir_node *const node)
+{
+	ir_mode *const mode = get_irn_mode(node);
+	if ((!mode_is_int(mode) && !mode_is_float(mode))
+	    || get_mode_size_bytes(mode) != vl->elem_size)
+		return false;
+	if (!is_in_loop(vl, node)) {
+		if (!is_supported(vl, op_Pack, mode))
+			return false;
+		pmap_insert(vl->splats, node, NULL);
+		return true;
+	}
+	if (ir_nodeset_contains(&vl->vec_nodes, node))
+		return true;
+
+	if (is_Proj(node)) {
+		ir_node *const pred = get_Proj_pred(node);
+		if (is_Load(pred) && get_Proj_num(node) == pn_Load_res) {
+			if (!ir_nodeset_contains(&vl->accesses, pred)
+			    || !is_supported(vl, op_Load, mode))
+				return false;
+			ir_nodeset_insert(&vl->vec_nodes, node);
+			return true;
+		}
+		if (is_Div(pred) && get_Proj_num(node) == pn_Div_res) {
+			if (ir_throws_exception(pred) || !is_supported(vl, op_Div, mode))
+				return false;
+			ir_nodeset_insert(&vl->vec_nodes, node);
+			ir_nodeset_insert(&vl->vec_nodes, pred);
+			return analyze_value(vl, get_Div_left(pred))
+			    && analyze_value(vl, get_Div_right(pred));
+		}
+		return false;
+	}
+
+	switch (get_irn_opcode(node)) {
+	case iro_Add:
+	case iro_And:
+	case iro_Eor:
+	case iro_Mul:
+	case iro_Or:
+	case iro_Sub:
+		break;
+	default:
+		return false;
+	}
+	if (!is_supported(vl, get_irn_op(node), mode))
+		return false;
+	ir_nodeset_insert(&vl->vec_nodes, node);
+	foreach_irn_in(node, i, pred) {
+		if (!analyze_value(vl, pred))
+			return false;
+	}
+	return true;
+}
+
+/** Checks that @p node is part of the loop structure or of the memory chain. */
+static bool is_loop_node(vec_loop_t *const vl, ir_node *const node)
+{
+	switch (get_irn_opcode(node)) {
+	case iro_Phi:
+		if (node == vl->iv)
+			return true;
+		if (get_irn_mode(node) != mode_M || vl->mem != NULL
+		    || get_nodes_block(node) != vl->header)
+			return false;
+		vl->mem = node;
+		return true;
+	case iro_Proj: {
+		ir_node *const pred = get_Proj_pred(node);
+		if (is_Cond(pred))
+			return get_Cond_selector(pred) == vl->cmp;
+		return get_irn_mode(node) == mode_M
+		    && (ir_nodeset_contains(&vl->accesses, pred)
+		        || ir_nodeset_contains(&vl->vec_nodes, pred));
+	}
+	case iro_Add:
+		return node == get_Phi_pred(vl->iv, vl->back_pos);
+	case iro_Cmp:
+		return node == vl->cmp;
+	case iro_Cond:
+		return get_Cond_selector(node) == vl->cmp;
+	case iro_Jmp:
+		return get_nodes_block(node) == vl->body;
+	case iro_Sync:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool needs_overlap_check(ir_node const *const base0,
+                                ir_node const *const base1)
+{
+	if (base0 == base1)
+		return false;
+	return !is_Address(base0) || !is_Address(base1)
+	    || get_Address_entity(base0) == get_Address_entity(base1);
+}
+
+static bool add_overlap_check(vec_loop_t *const vl, ir_node *const store_base,
+                              ir_node *const base)
+{
+	if (!needs_overlap_check(store_base, base))
+		return true;
+	for (unsigned i = 0; i < vl->n_checks; ++i) {
+		overlap_check_t const *const check = &vl->checks[i];
+		if ((check->base0 == store_base && check->base1 == base)
+		    || (check->base0 == base && check->base1 == store_base))
+			return true;
+	}
+	if (vl->n_checks == MAX_OVERLAP_CHECKS)
+		return false;
+	vl->checks[vl->n_checks].base0 = store_base;
+	vl->checks[vl->n_checks].base1 = base;
+	++vl->n_checks;
+	return true;
+}
+
+static bool analyze_loop(vec_loop_t *const vl, ir_loop *const loop)
+{
+	if (!analyze_shape(vl, loop))
+		return false;
+
+	ir_node *const blocks[] = { vl->header, vl->body };
+	for (size_t b = 0; b < ARRAY_SIZE(blocks); ++b) {
+		foreach_irn_out_r(blocks[b], i, node) {
+			if ((is_Load(node) || is_Store(node)) && !analyze_access(vl, node))
+				return false;
+		}
+	}
+	if (vl->n_stores == 0)
+		return false;
+	if (vl->elem_size > ir_target.vector_size
+	    || ir_target.vector_size % vl->elem_size != 0)
+		return false;
+	vl->n_lanes = ir_target.vector_size / vl->elem_size;
+	if (vl->n_lanes < 2)
+		return false;
+
+	foreach_ir_nodeset(&vl->accesses, node, iter) {
+		if (!is_Store(node))
+			continue;
+		ir_node *const value = get_Store_value(node);
+		if (!is_supported(vl, op_Store, get_irn_mode(value))
+		    || !analyze_value(vl, value))
+			return false;
+	}
+
+	/* everything else in the loop has to belong to the loop structure */
+	for (size_t b = 0; b < ARRAY_SIZE(blocks); ++b) {
+		foreach_irn_out_r(blocks[b], i, node) {
+			if (is_Block(node) || is_End(node)
+			    || ir_nodeset_contains(&vl->accesses, node)
+			    || ir_nodeset_contains(&vl->addr_nodes, node)
+			    || ir_nodeset_contains(&vl->vec_nodes, node))
+				continue;
+			if (!is_loop_node(vl, node)) {
+				DB((dbg, LEVEL_2, "%+F: cannot vectorize %+F\n", blocks[b],
+				    node));
+				return false;
+			}
+		}
+	}
+	if (vl->mem == NULL)
+		return false;
+
+	for (size_t s = 0, n_s = ARR_LEN(vl->store_bases); s != n_s; ++s) {
+		ir_node *const store_base = vl->store_bases[s];
+		for (size_t o = 0, n_o = ARR_LEN(vl->store_bases); o != n_o; ++o) {
+			if (!add_overlap_check(vl, store_base, vl->store_bases[o]))
+				return false;
+		}
+		for (size_t o = 0, n_o = ARR_LEN(vl->load_bases); o != n_o; ++o) {
+			if (!add_overlap_check(vl, store_base, vl->load_bases[o]))
+				return false;
+		}
+	}
+	return true;
+}
+
+static ir_node *widen(vec_loop_t *vl, ir_node *node);
+
+static ir_node *widen_operand(vec_loop_t *const vl, ir_node *const node)
+{
+	if (is_in_loop(vl, node))
+		return widen(vl, node);
+	ir_node *const splat = pmap_get(ir_node, vl->splats, node);
+	assert(splat != NULL);
+	return splat;
+}
+
+static bool is_vector_input(ir_node const *const node, int const pos)
+{
+	switch (get_irn_opcode(node)) {
+	case iro_Div:   return pos == n_Div_left || pos == n_Div_right;
+	case iro_Store: return pos == n_Store_value;
+	case iro_Proj:  return false;
+	default:        return true;
+	}
+}
+
+/**
+ * Returns the copy of @p node in the vector loop, which computes the values
+ * of all elements at once.
+ */
+static ir_node *widen(vec_loop_t *const vl, ir_node *const node)
+{
+	if (!is_in_loop(vl, node))
+		return node;
+	ir_node *copy = pmap_get(ir_node, vl->copies, node);
+	if (copy != NULL)
+		return copy;
+
+	copy = exact_copy(node);
+	set_nodes_block(copy, vl->vec_body);
+	pmap_insert(vl->copies, node, copy);
+	bool const is_vector = ir_nodeset_contains(&vl->vec_nodes, node)
+	                    || is_Store(node);
+	foreach_irn_in(node, i, pred) {
+		ir_node *const new_pred = is_vector && is_vector_input(node, i)
+			? widen_operand(vl, pred) : widen(vl, pred);
+		set_irn_n(copy, i, new_pred);
+	}
+
+	/* the accessed types stay the element types, so alias analysis still
+	 * relates the vector accesses to the scalar ones */
+	if (is_Load(node)) {
+		set_Load_mode(copy, get_vector_mode(get_Load_mode(node), vl->n_lanes));
+		set_Load_unaligned(copy, align_non_aligned);
+	} else if (is_Store(node)) {
+		set_Store_unaligned(copy, align_non_aligned);
+	} else if (is_Div(node)) {
+		ir_mode *const mode = get_Div_resmode(node);
+		set_Div_resmode(copy, get_vector_mode(mode, vl->n_lanes));
+	} else if (is_vector) {
+		ir_mode *const mode = get_irn_mode(node);
+		set_irn_mode(copy, get_vector_mode(mode, vl->n_lanes));
+	}
+	return copy;
+}
+
+/** Builds the condition to enter the vector loop in @p block. */
+static ir_node *build_guard(vec_loop_t const *const vl, ir_node *const block)
+{
+	/* the bound has to be large enough to subtract the vector length */
+	ir_graph  *const irg   = get_irn_irg(block);
+	ir_node   *const bound = vl->bound;
+	ir_mode   *const mode  = get_irn_mode(bound);
+	ir_tarval *const lanes = new_tarval_from_long(vl->n_lanes, mode);
+	ir_tarval *const min   = mode_is_signed(mode)
+		? tarval_add(get_mode_min(mode), lanes) : lanes;
+	ir_node   *guard       = new_r_Cmp(block, bound, new_r_Const(irg, min),
+	                                   ir_relation_greater_equal);
+
+	/* the difference of the bases must not be smaller than the vector size,
+	 * i.e. -span < diff < span must be false */
+	long const span = (long)(vl->n_lanes * vl->elem_size);
+	for (unsigned i = 0; i < vl->n_checks; ++i) {
+		overlap_check_t const *const check = &vl->checks[i];
+		ir_node *const diff  = new_r_Sub(block, check->base0, check->base1);
+		ir_mode *const dmode = get_irn_mode(diff);
+		ir_mode *const umode = find_unsigned_mode(dmode);
+		ir_node *const bias  = new_r_Const_long(irg, dmode, span - 1);
+		ir_node *const sum   = new_r_Add(block, diff, bias);
+		ir_node *const conv  = new_r_Conv(block, sum, umode);
+		ir_node *const limit = new_r_Const_long(irg, umode, 2 * span - 1);
+		ir_node *const apart = new_r_Cmp(block, conv, limit,
+		                                 ir_relation_greater_equal);
+		guard = new_r_And(block, guard, apart);
+	}
+	return guard;
+}
+
+/**
+ * Places the vector loop on the entry edge of the loop. The original loop
+ * continues with the iterations the vector loop left over.
+ */
+static void vectorize_loop(vec_loop_t *const vl)
+{
+	ir_node  *const header = vl->header;
+	ir_graph *const irg    = get_irn_irg(header);
+	ir_node  *const entry  = get_Block_cfgpred(header, vl->entry_pos);
+	ir_node  *const iv0    = get_Phi_pred(vl->iv, vl->entry_pos);
+	ir_node  *const mem0   = get_Phi_pred(vl->mem, vl->entry_pos);
+	ir_mode  *const mode   = get_irn_mode(vl->iv);
+
+	/* guard */
+	ir_node *const pre   = new_r_Block(irg, 1, &entry);
+	ir_node *const guard = build_guard(vl, pre);
+	ir_node *const cond  = new_r_Cond(pre, guard);
+	ir_node *const enter = new_r_Proj(cond, mode_X, pn_Cond_true);
+	ir_node *const skip  = new_r_Proj(cond, mode_X, pn_Cond_false);
+	foreach_pmap(vl->splats, splat) {
+		ir_node  *const value = (ir_node*)splat->key;
+		ir_node **const in    = ALLOCAN(ir_node*, vl->n_lanes);
+		for (unsigned i = 0; i < vl->n_lanes; ++i)
+			in[i] = value;
+		ir_mode *const vmode = get_vector_mode(get_irn_mode(value), vl->n_lanes);
+		splat->value = new_r_Pack(pre, vl->n_lanes, in, vmode);
+	}
+
+	/* vector loop header, the back edge is filled in later */
+	ir_node *const limit    = new_r_Sub(pre, vl->bound,
+	                                    new_r_Const_long(irg, mode, vl->n_lanes));
+	ir_node *const dummy_x  = new_r_Dummy(irg, mode_X);
+	ir_node *const vh_in[]  = { enter, dummy_x };
+	ir_node *const vec_head = new_r_Block(irg, ARRAY_SIZE(vh_in), vh_in);
+	ir_node *const iv_in[]  = { iv0, new_r_Dummy(irg, mode) };
+	ir_node *const vec_iv   = new_r_Phi(vec_head, ARRAY_SIZE(iv_in), iv_in, mode);
+	ir_node *const mem_in[] = { mem0, new_r_Dummy(irg, mode_M) };
+	ir_node *const vec_mem  = new_r_Phi(vec_head, ARRAY_SIZE(mem_in), mem_in,
+	                                    mode_M);
+	ir_node *const vec_cmp  = new_r_Cmp(vec_head, vec_iv, limit,
+	                                    ir_relation_less_equal);
+	ir_node *const vec_cond = new_r_Cond(vec_head, vec_cmp);
+	ir_node *const loop_x   = new_r_Proj(vec_cond, mode_X, pn_Cond_true);
+	ir_node *const exit_x   = new_r_Proj(vec_cond, mode_X, pn_Cond_false);
+
+	/* vector loop body */
+	vl->vec_body = new_r_Block(irg, 1, &loop_x);
+	pmap_insert(vl->copies, vl->iv, vec_iv);
+	pmap_insert(vl->copies, vl->mem, vec_mem);
+	ir_node *const next_mem = widen(vl, get_Phi_pred(vl->mem, vl->back_pos));
+	ir_node *const step     = new_r_Const_long(irg, mode, vl->n_lanes);
+	ir_node *const next_iv  = new_r_Add(vl->vec_body, vec_iv, step);
+	set_irn_n(vec_head, 1, new_r_Jmp(vl->vec_body));
+	set_Phi_pred(vec_iv, 1, next_iv);
+	set_Phi_pred(vec_mem, 1, next_mem);
+
+	/* the original loop starts where the vector loop stopped */
+	ir_node *const join_in[] = { skip, exit_x };
+	ir_node *const join      = new_r_Block(irg, ARRAY_SIZE(join_in), join_in);
+	ir_node *const join_iv_in[]  = { iv0, vec_iv };
+	ir_node *const join_mem_in[] = { mem0, vec_mem };
+	ir_node *const join_iv   = new_r_Phi(join, ARRAY_SIZE(join_iv_in),
+	                                     join_iv_in, mode);
+	ir_node *const join_mem  = new_r_Phi(join, ARRAY_SIZE(join_mem_in),
+	                                     join_mem_in, mode_M);
+	set_irn_n(header, vl->entry_pos, new_r_Jmp(join));
+	set_Phi_pred(vl->iv, vl->entry_pos, join_iv);
+	set_Phi_pred(vl->mem, vl->entry_pos, join_mem);
+
+	DB((dbg, LEVEL_1, "vectorized %+F with %u lanes and %u overlap checks\n",
+	    header, vl->n_lanes, vl->n_checks));
+}
+
+static void collect_innermost_loops(ir_loop *const loop, ir_loop ***const res)
+{
+	bool         innermost  = true;
+	size_t const n_elements = get_loop_n_elements(loop);
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element const element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_loop) {
+			collect_innermost_loops(element.son, res);
+			innermost = false;
+		}
+	}
+	if (innermost)
+		ARR_APP1(ir_loop*, *res, loop);
+}
+
+static void init_vec_loop(vec_loop_t *const vl)
+{
+	memset(vl, 0, sizeof(*vl));
+	ir_nodeset_init(&vl->accesses);
+	ir_nodeset_init(&vl->addr_nodes);
+	ir_nodeset_init(&vl->vec_nodes);
+	vl->splats      = pmap_create();
+	vl->copies      = pmap_create();
+	vl->load_bases  = NEW_ARR_F(ir_node*, 0);
+	vl->store_bases = NEW_ARR_F(ir_node*, 0);
+}
+
+static void free_vec_loop(vec_loop_t *const vl)
+{
+	DEL_ARR_F(vl->store_bases);
+	DEL_ARR_F(vl->load_bases);
+	pmap_destroy(vl->copies);
+	pmap_destroy(vl->splats);
+	ir_nodeset_destroy(&vl->vec_nodes);
+	ir_nodeset_destroy(&vl->addr_nodes);
+	ir_nodeset_destroy(&vl->accesses);
+}
+
+void vectorize_loops(ir_graph *const irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.loop-vectorization");
+	if (ir_target.vector_size == 0 || ir_target.vector_op_supported == NULL) {
+		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
+		return;
+	}
+
+	assure_lcssa(irg);
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS
+	                         | IR_GRAPH_PROPERTY_NO_BADS
+	                         | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
+
+	/* analyze all loops first, the transformation invalidates the outs */
+	ir_loop **loops = NEW_ARR_F(ir_loop*, 0);
+	collect_innermost_loops(get_irg_loop(irg), &loops);
+	size_t     const n_loops = ARR_LEN(loops);
+	vec_loop_t      *vls     = XMALLOCN(vec_loop_t, n_loops);
+	bool      *const found   = XMALLOCN(bool, n_loops);
+	for (size_t i = 0; i < n_loops; ++i) {
+		init_vec_loop(&vls[i]);
+		found[i] = loops[i] != get_irg_loop(irg)
+		        && analyze_loop(&vls[i], loops[i]);
+	}
+
+	bool changed = false;
+	for (size_t i = 0; i < n_loops; ++i) {
+		if (found[i]) {
+			vectorize_loop(&vls[i]);
+			changed = true;
+		}
+		free_vec_loop(&vls[i]);
+	}
+	free(found);
+	free(vls);
+	DEL_ARR_F(loops);
+
+	confirm_irg_properties(irg, changed ? IR_GRAPH_PROPERTIES_NONE
+	                                    : IR_GRAPH_PROPERTIES_ALL);
+}
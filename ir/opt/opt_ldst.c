@@ -119,7 +119,7 @@ typedef struct ldst_env_t {
 } ldst_env;
 
 /* the one and only environment */
-static ldst_env env;
+static THREAD_LOCAL ldst_env env;
 
 #ifdef DEBUG_libfirm
 
@@ -1430,7 +1430,7 @@ static void reroute_all_mem_users(ir_node *omem, ir_node *nmem)
 	}
 
 	/* all edges previously point to omem now point to nmem */
-	nmem->o.out = omem->o.out;
+	nmem->cold->o.out = omem->cold->o.out;
 }
 
 /**
@@ -1471,7 +1471,7 @@ static void reroute_mem_through(ir_node *omem, ir_node *nmem, ir_node *pass_bl)
 	   temporary obstack here. This should be no problem, as we invalidate the
 	   edges at the end either. */
 	/* first entry is used for the length */
-	nmem->o.out = new_out;
+	nmem->cold->o.out = new_out;
 }
 
 /**
@@ -0,0 +1,467 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Runs optimization passes over all graphs with several threads.
+ *
+ * Consecutive graph passes form a stage. A stage is split into tasks, one
+ * per graph, or one per recursion cycle of the callgraph if a pass of the
+ * stage wants its callees optimized first. Each worker keeps a deque of
+ * ready tasks: it takes new work from the bottom of its own deque and steals
+ * from the top of the others when it runs dry. Finishing a task makes the
+ * tasks of its callers ready, which the finishing worker continues with.
+ * Tasks are whole pass sequences on a graph, so a single lock for all deques
+ * is not contended.
+ */
+#include "iroptimize.h"
+
+#include "array.h"
+#include "irflag_t.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irhooks.h"
+#include "irmemory.h"
+#include "irnode_t.h"
+#include "irprog_t.h"
+#include "irthread.h"
+#include "util.h"
+#include "xmalloc.h"
+
+typedef enum pipeline_pass_kind_t {
+	PASS_GRAPH,      /**< runs on each graph in any order */
+	PASS_CALLGRAPH,  /**< runs on each graph after its callees */
+	PASS_PROG,       /**< runs once on the whole program */
+} pipeline_pass_kind_t;
+
+typedef struct pipeline_pass_t {
+	pipeline_pass_kind_t kind;
+	opt_ptr              graph_pass;
+	void               (*prog_pass)(void);
+} pipeline_pass_t;
+
+struct ir_pipeline_t {
+	pipeline_pass_t *passes;
+};
+
+/** The graphs of one task: a single graph or a recursion cycle. */
+typedef struct pipeline_task_t pipeline_task_t;
+struct pipeline_task_t {
+	ir_graph        **graphs;    /**< graphs, callees first if possible */
+	pipeline_task_t **callers;   /**< tasks waiting for this one */
+	unsigned          n_pending; /**< callee tasks not finished yet */
+	pipeline_task_t  *mark;      /**< last caller linked to this task */
+};
+
+/** Ready tasks of a worker. */
+typedef struct task_deque_t {
+	pipeline_task_t **tasks;
+	size_t            top;    /**< other workers steal here */
+	size_t            bottom; /**< the owner pushes and pops here */
+} task_deque_t;
+
+typedef struct stage_t {
+	pipeline_pass_t const *passes;
+	size_t                 n_passes;
+	ir_mutex_t             mutex;
+	ir_cond_t              ready;       /**< signalled on new tasks and on
+	                                         the end of the stage */
+	task_deque_t          *deques;
+	unsigned               n_workers;
+	size_t                 n_remaining; /**< tasks not finished yet */
+	optimization_state_t   opt_state;   /**< flags of the calling thread */
+} stage_t;
+
+typedef struct worker_t {
+	stage_t    *stage;
+	unsigned    id;
+	ir_thread_t thread;
+} worker_t;
+
+ir_pipeline_t *new_ir_pipeline(void)
+{
+	ir_pipeline_t *pipeline = XMALLOCZ(ir_pipeline_t);
+	pipeline->passes = NEW_ARR_F(pipeline_pass_t, 0);
+	return pipeline;
+}
+
+void free_ir_pipeline(ir_pipeline_t *pipeline)
+{
+	DEL_ARR_F(pipeline->passes);
+	free(pipeline);
+}
+
+static void add_pass(ir_pipeline_t *pipeline, pipeline_pass_kind_t kind,
+                     opt_ptr graph_pass, void (*prog_pass)(void))
+{
+	pipeline_pass_t const pass = { kind, graph_pass, prog_pass };
+	ARR_APP1(pipeline_pass_t, pipeline->passes, pass);
+}
+
+void ir_pipeline_add_graph_pass(ir_pipeline_t *pipeline, opt_ptr pass)
+{
+	add_pass(pipeline, PASS_GRAPH, pass, NULL);
+}
+
+void ir_pipeline_add_callgraph_pass(ir_pipeline_t *pipeline, opt_ptr pass)
+{
+	add_pass(pipeline, PASS_CALLGRAPH, pass, NULL);
+}
+
+void ir_pipeline_add_prog_pass(ir_pipeline_t *pipeline, void (*pass)(void))
+{
+	add_pass(pipeline, PASS_PROG, NULL, pass);
+}
+
+static pipeline_task_t *new_task(void)
+{
+	pipeline_task_t *task = XMALLOCZ(pipeline_task_t);
+	task->graphs  = NEW_ARR_F(ir_graph*, 0);
+	task->callers = NEW_ARR_F(pipeline_task_t*, 0);
+	return task;
+}
+
+static void free_task(pipeline_task_t *task)
+{
+	DEL_ARR_F(task->callers);
+	DEL_ARR_F(task->graphs);
+	free(task);
+}
+
+/** Callgraph information of a graph while the tasks are built. */
+typedef struct graph_info_t {
+	ir_graph       **callees;  /**< directly called graphs */
+	unsigned         dfn;      /**< depth first number, 0 if unvisited */
+	unsigned         low;      /**< lowest dfn reachable */
+	bool             on_stack;
+	pipeline_task_t *task;
+} graph_info_t;
+
+typedef struct scc_env_t {
+	ir_graph        **stack;
+	pipeline_task_t **tasks;
+	unsigned          next_dfn;
+} scc_env_t;
+
+static graph_info_t *get_graph_info(ir_graph const *irg)
+{
+	return (graph_info_t*)get_irg_link(irg);
+}
+
+static void collect_callee(ir_node *node, void *data)
+{
+	if (!is_Call(node))
+		return;
+	ir_entity *const callee = get_Call_callee(node);
+	if (callee == NULL)
+		return;
+	ir_graph *const callee_irg = get_entity_irg(callee);
+	if (callee_irg == NULL)
+		return;
+	graph_info_t *const info = (graph_info_t*)data;
+	ARR_APP1(ir_graph*, info->callees, callee_irg);
+}
+
+/**
+ * Tarjan's algorithm on the graphs. Recursion cycles are emitted before
+ * the graphs calling them.
+ */
+static void scc_visit(scc_env_t *env, ir_graph *irg)
+{
+	graph_info_t *const info = get_graph_info(irg);
+	info->dfn      = ++env->next_dfn;
+	info->low      = info->dfn;
+	info->on_stack = true;
+	ARR_APP1(ir_graph*, env->stack, irg);
+
+	for (size_t i = 0, n = ARR_LEN(info->callees); i < n; ++i) {
+		ir_graph     *const callee      = info->callees[i];
+		graph_info_t *const callee_info = get_graph_info(callee);
+		if (callee_info == NULL)
+			continue;
+		if (callee_info->dfn == 0) {
+			scc_visit(env, callee);
+			info->low = MIN(info->low, callee_info->low);
+		} else if (callee_info->on_stack) {
+			info->low = MIN(info->low, callee_info->dfn);
+		}
+	}
+
+	if (info->low != info->dfn)
+		return;
+
+	pipeline_task_t *const task = new_task();
+	ir_graph             *member;
+	do {
+		member = env->stack[ARR_LEN(env->stack) - 1];
+		ARR_SHRINKLEN(env->stack, ARR_LEN(env->stack) - 1);
+		graph_info_t *const member_info = get_graph_info(member);
+		member_info->on_stack = false;
+		member_info->task     = task;
+		ARR_APP1(ir_graph*, task->graphs, member);
+	} while (member != irg);
+	ARR_APP1(pipeline_task_t*, env->tasks, task);
+}
+
+/**
+ * Creates the tasks of a stage. With @p ordered set, the tasks follow the
+ * callgraph and a task only gets ready after the tasks of its callees.
+ * The returned tasks are sorted such that callees come first.
+ */
+static pipeline_task_t **create_tasks(bool ordered)
+{
+	pipeline_task_t **tasks = NEW_ARR_F(pipeline_task_t*, 0);
+	if (!ordered) {
+		foreach_irp_irg(i, irg) {
+			pipeline_task_t *const task = new_task();
+			ARR_APP1(ir_graph*, task->graphs, irg);
+			ARR_APP1(pipeline_task_t*, tasks, task);
+		}
+		return tasks;
+	}
+
+	size_t        const n_irgs = get_irp_n_irgs();
+	graph_info_t *const infos  = XMALLOCNZ(graph_info_t, n_irgs);
+	irp_reserve_resources(irp, IRP_RESOURCE_IRG_LINK);
+	foreach_irp_irg(i, irg) {
+		graph_info_t *const info = &infos[i];
+		info->callees = NEW_ARR_F(ir_graph*, 0);
+		set_irg_link(irg, info);
+	}
+	/* callee graphs not registered in the program have no info */
+	foreach_irp_irg(i, irg) {
+		irg_walk_graph(irg, NULL, collect_callee, &infos[i]);
+	}
+
+	scc_env_t env = { NEW_ARR_F(ir_graph*, 0), tasks, 0 };
+	foreach_irp_irg(i, irg) {
+		if (infos[i].dfn == 0)
+			scc_visit(&env, irg);
+	}
+	DEL_ARR_F(env.stack);
+	tasks = env.tasks;
+
+	for (size_t t = 0, n = ARR_LEN(tasks); t < n; ++t) {
+		pipeline_task_t *const task = tasks[t];
+		for (size_t g = 0, n_graphs = ARR_LEN(task->graphs); g < n_graphs; ++g) {
+			graph_info_t const *const info = get_graph_info(task->graphs[g]);
+			for (size_t c = 0, n_callees = ARR_LEN(info->callees); c < n_callees; ++c) {
+				graph_info_t const *const callee_info
+					= get_graph_info(info->callees[c]);
+				if (callee_info == NULL)
+					continue;
+				pipeline_task_t *const callee_task = callee_info->task;
+				if (callee_task == task || callee_task->mark == task)
+					continue;
+				callee_task->mark = task;
+				ARR_APP1(pipeline_task_t*, callee_task->callers, task);
+				++task->n_pending;
+			}
+		}
+	}
+
+	foreach_irp_irg(i, irg) {
+		DEL_ARR_F(infos[i].callees);
+		set_irg_link(irg, NULL);
+	}
+	irp_free_resources(irp, IRP_RESOURCE_IRG_LINK);
+	free(infos);
+	return tasks;
+}
+
+static void run_task(stage_t const *stage, pipeline_task_t const *task)
+{
+	for (size_t p = 0; p < stage->n_passes; ++p) {
+		opt_ptr const pass = stage->passes[p].graph_pass;
+		for (size_t g = 0, n = ARR_LEN(task->graphs); g < n; ++g) {
+			pass(task->graphs[g]);
+		}
+	}
+}
+
+static void push_task(task_deque_t *deque, pipeline_task_t *task)
+{
+	deque->tasks[deque->bottom++] = task;
+}
+
+/** Take a task from the own deque or steal one. Called with the lock held. */
+static pipeline_task_t *take_task(stage_t *stage, unsigned id)
+{
+	task_deque_t *const own = &stage->deques[id];
+	if (own->bottom > own->top)
+		return own->tasks[--own->bottom];
+
+	for (unsigned i = 1; i < stage->n_workers; ++i) {
+		task_deque_t *const victim
+			= &stage->deques[(id + i) % stage->n_workers];
+		if (victim->bottom > victim->top)
+			return victim->tasks[victim->top++];
+	}
+	return NULL;
+}
+
+/** Release the callers of a finished task. Called with the lock held. */
+static void finish_task(stage_t *stage, unsigned id,
+                        pipeline_task_t const *task)
+{
+	task_deque_t *const own    = &stage->deques[id];
+	bool                wakeup = --stage->n_remaining == 0;
+	for (size_t i = 0, n = ARR_LEN(task->callers); i < n; ++i) {
+		pipeline_task_t *const caller = task->callers[i];
+		if (--caller->n_pending > 0)
+			continue;
+		/* start over in a drained deque. Each task is pushed only once, so
+		 * the deque cannot overflow either way. */
+		if (own->top == own->bottom)
+			own->top = own->bottom = 0;
+		push_task(own, caller);
+		wakeup = true;
+	}
+	if (wakeup)
+		ir_cond_broadcast(&stage->ready);
+}
+
+static void *run_worker(void *data)
+{
+	worker_t *const worker = (worker_t*)data;
+	stage_t  *const stage  = worker->stage;
+	restore_optimization_state(&stage->opt_state);
+
+	ir_mutex_lock(&stage->mutex);
+	for (;;) {
+		pipeline_task_t *const task = take_task(stage, worker->id);
+		if (task == NULL) {
+			if (stage->n_remaining == 0)
+				break;
+			ir_cond_wait(&stage->ready, &stage->mutex);
+			continue;
+		}
+		ir_mutex_unlock(&stage->mutex);
+		run_task(stage, task);
+		ir_mutex_lock(&stage->mutex);
+		finish_task(stage, worker->id, task);
+	}
+	ir_mutex_unlock(&stage->mutex);
+	return NULL;
+}
+
+static void run_stage_parallel(stage_t *stage, pipeline_task_t **tasks)
+{
+	size_t   const n_tasks   = ARR_LEN(tasks);
+	unsigned const n_workers = stage->n_workers;
+	stage->deques      = XMALLOCNZ(task_deque_t, n_workers);
+	stage->n_remaining = n_tasks;
+	for (unsigned w = 0; w < n_workers; ++w)
+		stage->deques[w].tasks = XMALLOCN(pipeline_task_t*, n_tasks);
+
+	/* deal the ready tasks out, the callees first */
+	unsigned next = 0;
+	for (size_t t = 0; t < n_tasks; ++t) {
+		if (tasks[t]->n_pending > 0)
+			continue;
+		push_task(&stage->deques[next], tasks[t]);
+		next = (next + 1) % n_workers;
+	}
+	/* workers pop from the bottom, so reverse to start with the callees */
+	for (unsigned w = 0; w < n_workers; ++w) {
+		task_deque_t *const deque = &stage->deques[w];
+		for (size_t l = 0, r = deque->bottom; l + 1 < r; ++l, --r) {
+			pipeline_task_t *const t = deque->tasks[l];
+			deque->tasks[l]     = deque->tasks[r - 1];
+			deque->tasks[r - 1] = t;
+		}
+	}
+
+	ir_mutex_init(&stage->mutex);
+	ir_cond_init(&stage->ready);
+	save_optimization_state(&stage->opt_state);
+	/* Analyse the global entities before the workers start, graph passes
+	 * only use this analysis and its invalidation is delayed until after
+	 * the stage. */
+	assure_irp_globals_entity_usage_computed();
+
+	worker_t *const workers = XMALLOCNZ(worker_t, n_workers);
+	ir_threads_running = true;
+	for (unsigned w = 0; w < n_workers; ++w) {
+		workers[w].stage = stage;
+		workers[w].id    = w;
+		if (w > 0)
+			ir_thread_create(&workers[w].thread, run_worker, &workers[w]);
+	}
+	run_worker(&workers[0]);
+	for (unsigned w = 1; w < n_workers; ++w)
+		ir_thread_join(workers[w].thread);
+	ir_threads_running = false;
+	set_irp_globals_entity_usage_state(ir_entity_usage_not_computed);
+
+	free(workers);
+	ir_cond_destroy(&stage->ready);
+	ir_mutex_destroy(&stage->mutex);
+	for (unsigned w = 0; w < n_workers; ++w)
+		free(stage->deques[w].tasks);
+	free(stage->deques);
+}
+
+static void run_stage(pipeline_pass_t const *passes, size_t n_passes,
+                      unsigned n_threads)
+{
+	bool ordered = false;
+	for (size_t p = 0; p < n_passes; ++p)
+		ordered |= passes[p].kind == PASS_CALLGRAPH;
+
+	stage_t stage;
+	memset(&stage, 0, sizeof(stage));
+	stage.passes    = passes;
+	stage.n_passes  = n_passes;
+	stage.n_workers = n_threads;
+
+	pipeline_task_t **const tasks = create_tasks(ordered);
+	if (n_threads > 1 && ARR_LEN(tasks) > 1) {
+		run_stage_parallel(&stage, tasks);
+	} else {
+		/* the tasks are sorted callees first */
+		for (size_t t = 0, n = ARR_LEN(tasks); t < n; ++t)
+			run_task(&stage, tasks[t]);
+	}
+
+	for (size_t t = 0, n = ARR_LEN(tasks); t < n; ++t)
+		free_task(tasks[t]);
+	DEL_ARR_F(tasks);
+}
+
+/**
+ * Hook callbacks are not expected to be thread-safe. Only the dumper
+ * callback does not run while optimizing.
+ */
+static bool have_optimization_hooks(void)
+{
+	for (unsigned h = 0; h < hook_last; ++h) {
+		if (h != hook_node_info && hooks[h] != NULL)
+			return true;
+	}
+	return false;
+}
+
+void ir_pipeline_run(ir_pipeline_t *pipeline, unsigned n_threads)
+{
+	assert(!ir_threads_running);
+	if (n_threads == 0 || have_optimization_hooks())
+		n_threads = 1;
+
+	pipeline_pass_t const *const passes   = pipeline->passes;
+	size_t                 const n_passes = ARR_LEN(passes);
+	for (size_t p = 0; p < n_passes; ) {
+		if (passes[p].kind == PASS_PROG) {
+			passes[p].prog_pass();
+			++p;
+			continue;
+		}
+		size_t end = p;
+		while (end < n_passes && passes[end].kind != PASS_PROG)
+			++end;
+		run_stage(&passes[p], end - p, n_threads);
+		p = end;
+	}
+}
@@ -0,0 +1,472 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Packs isomorphic scalar operations of a block into vector
+ *          operations (superword level parallelism).
+ *
+ * Stores to consecutive addresses are the seeds: Their values form the lanes
+ * of a vector, and the operands of the values with the same operation form
+ * the lanes of the next vector, down to Loads from consecutive addresses.
+ * Lanes which cannot be packed are gathered from the scalar values. A pack is
+ * only built if the saved scalar operations outweigh the gathers.
+ */
+#include "iroptimize.h"
+
+#include "array.h"
+#include "debug.h"
+#include "heights.h"
+#include "ircons.h"
+#include "iredges_t.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irmode_t.h"
+#include "irnode_t.h"
+#include "panic.h"
+#include "target_t.h"
+#include "tv.h"
+#include "util.h"
+#include "xmalloc.h"
+
+#include <stdlib.h>
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
+
+/** A memory access at a constant offset from a base address. */
+typedef struct access_t {
+	ir_node *node;
+	ir_node *base;
+	long     offset;
+} access_t;
+
+typedef struct slp_env_t {
+	ir_heights_t *heights;
+	ir_node      *block;
+	unsigned      n_lanes;
+	ir_mode      *vmode;     /**< vector mode of the current tree */
+	bool         *packed;    /**< decisions of the analysis in preorder */
+	size_t        next;      /**< next decision to use while building */
+	int           benefit;   /**< scalar operations saved by packing */
+	int           cost;      /**< operations needed to gather lanes */
+} slp_env_t;
+
+static access_t get_access(ir_node *const node, ir_node *const ptr)
+{
+	access_t access = { node, ptr, 0 };
+	if (is_Add(ptr)) {
+		ir_node *const left  = get_Add_left(ptr);
+		ir_node *const right = get_Add_right(ptr);
+		ir_node *const cnst  = is_Const(right) ? right : left;
+		ir_node *const base  = cnst == right ? left : right;
+		if (is_Const(cnst) && mode_is_reference(get_irn_mode(base))
+		    && tarval_is_long(get_Const_tarval(cnst))) {
+			access.base   = base;
+			access.offset = get_Const_long(cnst);
+		}
+	}
+	return access;
+}
+
+static ir_node *get_mem_proj(ir_node const *const node)
+{
+	foreach_out_edge(node, edge) {
+		ir_node *const proj = get_edge_src_irn(edge);
+		if (is_Proj(proj) && get_irn_mode(proj) == mode_M)
+			return proj;
+	}
+	return NULL;
+}
+
+static bool is_simple_access(ir_node const *const node)
+{
+	if (is_Load(node))
+		return get_Load_volatility(node) == volatility_non_volatile
+		    && !ir_throws_exception(node);
+	if (is_Store(node))
+		return get_Store_volatility(node) == volatility_non_volatile
+		    && !ir_throws_exception(node);
+	return false;
+}
+
+/**
+ * Checks that the accesses of @p lanes start at consecutive addresses from
+ * the same base in lane order.
+ */
+static bool are_consecutive(ir_node *const *const lanes, unsigned const n_lanes,
+                            unsigned const size)
+{
+	access_t const first = is_Load(lanes[0])
+		? get_access(lanes[0], get_Load_ptr(lanes[0]))
+		: get_access(lanes[0], get_Store_ptr(lanes[0]));
+	for (unsigned i = 1; i < n_lanes; ++i) {
+		access_t const access = is_Load(lanes[i])
+			? get_access(lanes[i], get_Load_ptr(lanes[i]))
+			: get_access(lanes[i], get_Store_ptr(lanes[i]));
+		if (access.base != first.base
+		    || access.offset != first.offset + (long)(i * size))
+			return false;
+	}
+	return true;
+}
+
+static bool contains(ir_node *const *const lanes, unsigned const n_lanes,
+                     ir_node const *const node)
+{
+	for (unsigned i = 0; i < n_lanes; ++i) {
+		if (lanes[i] == node)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Checks that all other accesses of @p lanes come before @p last in the
+ * memory chain. Only nodes accepted by @p is_between may be in the chain
+ * between the accesses.
+ */
+static bool comes_last(ir_node *const *const lanes, unsigned const n_lanes,
+                       ir_node *const last,
+                       bool (*is_between)(ir_node const *node))
+{
+	ir_node *node = last;
+	for (unsigned found = 1; found < n_lanes;) {
+		ir_node *const mem = get_memop_mem(node);
+		if (!is_Proj(mem))
+			return false;
+		node = get_Proj_pred(mem);
+		if (get_nodes_block(node) != get_nodes_block(last))
+			return false;
+		if (contains(lanes, n_lanes, node))
+			++found;
+		else if (!is_between(node))
+			return false;
+	}
+	return true;
+}
+
+/** Returns the access of @p lanes, which comes last in the memory chain. */
+static ir_node *get_last_access(ir_node *const *const lanes,
+                                unsigned const n_lanes,
+                                bool (*is_between)(ir_node const *node))
+{
+	for (unsigned i = 0; i < n_lanes; ++i) {
+		if (comes_last(lanes, n_lanes, lanes[i], is_between))
+			return lanes[i];
+	}
+	return NULL;
+}
+
+static bool is_load_between(ir_node const *const node)
+{
+	return is_Load(node) && is_simple_access(node);
+}
+
+static bool is_nothing_between(ir_node const *const node)
+{
+	(void)node;
+	return false;
+}
+
+/** Checks that no lane depends on another one. */
+static bool are_independent(slp_env_t *const env, ir_node *const *const lanes)
+{
+	for (unsigned i = 0; i < env->n_lanes; ++i) {
+		for (unsigned j = 0; j < env->n_lanes; ++j) {
+			if (i != j && heights_reachable_in_block(env->heights, lanes[i],
+			                                         lanes[j]))
+				return false;
+		}
+	}
+	return true;
+}
+
+static bool can_pack(slp_env_t *const env, ir_node *const *const lanes)
+{
+	ir_node *const first = lanes[0];
+	ir_mode *const mode  = get_irn_mode(first);
+	unsigned const op    = get_irn_opcode(first);
+	for (unsigned i = 0; i < env->n_lanes; ++i) {
+		ir_node *const lane = lanes[i];
+		if (get_nodes_block(lane) != env->block || get_irn_mode(lane) != mode
+		    || get_irn_opcode(lane) != op || get_irn_n_edges(lane) != 1
+		    || contains(lanes, i, lane))
+			return false;
+	}
+
+	switch (op) {
+	case iro_Add:
+	case iro_And:
+	case iro_Eor:
+	case iro_Mul:
+	case iro_Or:
+	case iro_Sub:
+		if (!ir_target.vector_op_supported(get_irn_op(first), env->vmode))
+			return false;
+		return are_independent(env, lanes);
+
+	case iro_Proj: {
+		ir_node **const loads = ALLOCAN(ir_node*, env->n_lanes);
+		for (unsigned i = 0; i < env->n_lanes; ++i) {
+			loads[i] = get_Proj_pred(lanes[i]);
+			if (!is_Load(loads[i]) || get_Proj_num(lanes[i]) != pn_Load_res
+			    || !is_simple_access(loads[i]))
+				return false;
+		}
+		return ir_target.vector_op_supported(op_Load, env->vmode)
+		    && are_consecutive(loads, env->n_lanes, get_mode_size_bytes(mode))
+		    && get_last_access(loads, env->n_lanes, is_load_between) != NULL;
+	}
+
+	default:
+		return false;
+	}
+}
+
+static bool is_splat(ir_node *const *const lanes, unsigned const n_lanes)
+{
+	for (unsigned i = 1; i < n_lanes; ++i) {
+		if (lanes[i] != lanes[0])
+			return false;
+	}
+	return true;
+}
+
+/** Collects the lanes of input @p pos of the nodes in @p lanes. */
+static ir_node **get_operand_lanes(slp_env_t const *const env,
+                                   ir_node *const *const lanes, int const pos)
+{
+	ir_node **const operands = XMALLOCN(ir_node*, env->n_lanes);
+	for (unsigned i = 0; i < env->n_lanes; ++i)
+		operands[i] = get_irn_n(lanes[i], pos);
+	return operands;
+}
+
+/**
+ * Decides for @p lanes and their operands whether they are packed and sums
+ * up benefit and cost.
+ */
+static void analyze_lanes(slp_env_t *const env, ir_node *const *const lanes)
+{
+	bool const packed = can_pack(env, lanes);
+	ARR_APP1(bool, env->packed, packed);
+	if (!packed) {
+		/* a splat takes one shuffle, other gathers one insert per lane */
+		env->cost += is_splat(lanes, env->n_lanes) ? 1 : (int)env->n_lanes;
+		return;
+	}
+
+	env->benefit += env->n_lanes - 1;
+	if (is_Proj(lanes[0]))
+		return;
+	for (int pos = 0, arity = get_irn_arity(lanes[0]); pos < arity; ++pos) {
+		ir_node **const operands = get_operand_lanes(env, lanes, pos);
+		analyze_lanes(env, operands);
+		free(operands);
+	}
+}
+
+static ir_node *build_load(slp_env_t *const env, ir_node *const *const lanes)
+{
+	ir_node **const loads = ALLOCAN(ir_node*, env->n_lanes);
+	for (unsigned i = 0; i < env->n_lanes; ++i)
+		loads[i] = get_Proj_pred(lanes[i]);
+
+	/* the vector load takes the place of the last load, the others are
+	 * removed from the memory chain */
+	ir_node *const last  = get_last_access(loads, env->n_lanes, is_load_between);
+	ir_node *const first = loads[0];
+	ir_node *const load  = new_rd_Load(get_irn_dbg_info(first), env->block,
+	                                   get_Load_mem(last), get_Load_ptr(first),
+	                                   env->vmode, get_Load_type(first),
+	                                   cons_unaligned);
+	ir_node *const mem   = new_r_Proj(load, mode_M, pn_Load_M);
+	for (unsigned i = 0; i < env->n_lanes; ++i) {
+		ir_node *const proj = get_mem_proj(loads[i]);
+		if (proj != NULL)
+			exchange(proj, loads[i] == last ? mem : get_Load_mem(loads[i]));
+	}
+	return new_r_Proj(load, env->vmode, pn_Load_res);
+}
+
+static ir_node *build_lanes(slp_env_t *const env, ir_node *const *const lanes)
+{
+	if (!env->packed[env->next++]) {
+		ir_mode *const mode = get_vector_mode(get_irn_mode(lanes[0]),
+		                                      env->n_lanes);
+		return new_r_Pack(env->block, env->n_lanes, lanes, mode);
+	}
+	if (is_Proj(lanes[0]))
+		return build_load(env, lanes);
+
+	ir_node *in[2];
+	for (int pos = 0; pos < 2; ++pos) {
+		ir_node **const operands = get_operand_lanes(env, lanes, pos);
+		in[pos] = build_lanes(env, operands);
+		free(operands);
+	}
+	dbg_info *const dbgi  = get_irn_dbg_info(lanes[0]);
+	ir_node  *const block = env->block;
+	switch (get_irn_opcode(lanes[0])) {
+	case iro_Add: return new_rd_Add(dbgi, block, in[0], in[1]);
+	case iro_And: return new_rd_And(dbgi, block, in[0], in[1]);
+	case iro_Eor: return new_rd_Eor(dbgi, block, in[0], in[1]);
+	case iro_Mul: return new_rd_Mul(dbgi, block, in[0], in[1]);
+	case iro_Or:  return new_rd_Or(dbgi, block, in[0], in[1]);
+	case iro_Sub: return new_rd_Sub(dbgi, block, in[0], in[1]);
+	default:      panic("unexpected packed %+F", lanes[0]);
+	}
+}
+
+/**
+ * Tries to replace the Stores in @p lanes, which store to consecutive
+ * addresses, by a vector Store.
+ */
+static bool pack_stores(slp_env_t *const env, ir_node *const *const lanes)
+{
+	ir_node *const first = lanes[0];
+	ir_mode *const mode  = get_irn_mode(get_Store_value(first));
+	env->vmode = get_vector_mode(mode, env->n_lanes);
+	if (!ir_target.vector_op_supported(op_Store, env->vmode)
+	    || !ir_target.vector_op_supported(op_Pack, env->vmode))
+		return false;
+
+	/* the Stores must follow each other in the memory chain, and no value
+	 * may depend on them */
+	ir_node *const last = get_last_access(lanes, env->n_lanes,
+	                                      is_nothing_between);
+	if (last == NULL || get_mem_proj(last) == NULL)
+		return false;
+	ir_node **const values = ALLOCAN(ir_node*, env->n_lanes);
+	for (unsigned i = 0; i < env->n_lanes; ++i) {
+		ir_node *const store = lanes[i];
+		if (store != last && get_irn_n_edges(get_mem_proj(store)) != 1)
+			return false;
+		values[i] = get_Store_value(store);
+		if (get_irn_mode(values[i]) != mode)
+			return false;
+		if (get_nodes_block(values[i]) != env->block)
+			continue;
+		for (unsigned j = 0; j < env->n_lanes; ++j) {
+			if (heights_reachable_in_block(env->heights, values[i], lanes[j]))
+				return false;
+		}
+	}
+
+	env->packed  = NEW_ARR_F(bool, 0);
+	env->next    = 0;
+	env->benefit = env->n_lanes - 1;
+	env->cost    = 0;
+	analyze_lanes(env, values);
+	bool const profitable = env->benefit > env->cost;
+	DB((dbg, LEVEL_2, "%+F: packing stores from %+F saves %d and costs %d\n",
+	    env->block, first, env->benefit, env->cost));
+	if (profitable) {
+		/* building the value changes the memory chain of the Loads, so look
+		 * for the memory in front of the first Store afterwards */
+		ir_node *const value = build_lanes(env, values);
+		ir_node       *mem   = get_Store_mem(last);
+		for (unsigned i = 1; i < env->n_lanes; ++i)
+			mem = get_Store_mem(get_Proj_pred(mem));
+
+		ir_node *const store = new_rd_Store(get_irn_dbg_info(first), env->block,
+		                                    mem, get_Store_ptr(first), value,
+		                                    get_Store_type(first),
+		                                    cons_unaligned);
+		exchange(get_mem_proj(last), new_r_Proj(store, mode_M, pn_Store_M));
+		DB((dbg, LEVEL_1, "%+F: packed %u stores into %+F\n", env->block,
+		    env->n_lanes, store));
+	}
+	DEL_ARR_F(env->packed);
+	return profitable;
+}
+
+static int cmp_access(void const *const a, void const *const b)
+{
+	access_t const *const access_a = (access_t const*)a;
+	access_t const *const access_b = (access_t const*)b;
+	long const idx_a = get_irn_idx(access_a->base);
+	long const idx_b = get_irn_idx(access_b->base);
+	if (idx_a != idx_b)
+		return idx_a < idx_b ? -1 : 1;
+	ir_mode *const mode_a = get_irn_mode(get_Store_value(access_a->node));
+	ir_mode *const mode_b = get_irn_mode(get_Store_value(access_b->node));
+	if (mode_a != mode_b)
+		return get_mode_size_bits(mode_a) < get_mode_size_bits(mode_b) ? -1 : 1;
+	if (access_a->offset != access_b->offset)
+		return access_a->offset < access_b->offset ? -1 : 1;
+	return get_irn_idx(access_a->node) < get_irn_idx(access_b->node) ? -1 : 1;
+}
+
+/** Packs one group of Stores in @p block, returns whether it succeeded. */
+static bool pack_block(slp_env_t *const env, ir_node *const block)
+{
+	access_t *stores = NEW_ARR_F(access_t, 0);
+	foreach_out_edge(block, edge) {
+		ir_node *const node = get_edge_src_irn(edge);
+		if (!is_Store(node) || !is_simple_access(node))
+			continue;
+		ir_mode *const mode = get_irn_mode(get_Store_value(node));
+		if (mode_is_int(mode) || mode_is_float(mode))
+			ARR_APP1(access_t, stores, get_access(node, get_Store_ptr(node)));
+	}
+	size_t const n_stores = ARR_LEN(stores);
+	QSORT_ARR(stores, cmp_access);
+
+	env->block = block;
+	bool changed = false;
+	for (size_t i = 0; !changed && i < n_stores; ++i) {
+		ir_mode *const mode = get_irn_mode(get_Store_value(stores[i].node));
+		unsigned const size = get_mode_size_bytes(mode);
+		if (size == 0 || ir_target.vector_size % size != 0)
+			continue;
+		env->n_lanes = ir_target.vector_size / size;
+		if (env->n_lanes < 2 || i + env->n_lanes > n_stores)
+			continue;
+		ir_node **const lanes = ALLOCAN(ir_node*, env->n_lanes);
+		for (unsigned l = 0; l < env->n_lanes; ++l)
+			lanes[l] = stores[i + l].node;
+		if (are_consecutive(lanes, env->n_lanes, size))
+			changed = pack_stores(env, lanes);
+	}
+	DEL_ARR_F(stores);
+	return changed;
+}
+
+static void collect_block(ir_node *const block, void *const env)
+{
+	ir_node ***const blocks = (ir_node***)env;
+	ARR_APP1(ir_node*, *blocks, block);
+}
+
+void slp_vectorize(ir_graph *const irg)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.slp-vectorization");
+	if (ir_target.vector_size == 0 || ir_target.vector_op_supported == NULL) {
+		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
+		return;
+	}
+
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
+	ir_node **blocks = NEW_ARR_F(ir_node*, 0);
+	irg_block_walk_graph(irg, collect_block, NULL, &blocks);
+
+	slp_env_t env;
+	memset(&env, 0, sizeof(env));
+	env.heights = heights_new(irg);
+	bool changed = false;
+	for (size_t i = 0, n = ARR_LEN(blocks); i != n; ++i) {
+		while (pack_block(&env, blocks[i])) {
+			heights_recompute_block(env.heights, blocks[i]);
+			changed = true;
+		}
+	}
+	heights_free(env.heights);
+	DEL_ARR_F(blocks);
+
+	confirm_irg_properties(irg, changed ? IR_GRAPH_PROPERTIES_CONTROL_FLOW
+	                                    : IR_GRAPH_PROPERTIES_ALL);
+}
@@ -101,8 +101,11 @@ void remove_unreachable_code(ir_graph *irg)
 	irg_walk_graph(irg, unreachable_to_bad, NULL, &changed);
 	changed |= remove_unreachable_keeps(irg);
 
+	/* only edges out of unreachable blocks were removed, which does not
+	 * change the dominance of the reachable ones */
 	confirm_irg_properties(irg, changed
 		? IR_GRAPH_PROPERTY_NO_CRITICAL_EDGES
+		| IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
 		| IR_GRAPH_PROPERTY_NO_TUPLES
 		| IR_GRAPH_PROPERTY_ONE_RETURN
 		| IR_GRAPH_PROPERTY_MANY_RETURNS
@@ -11,6 +11,7 @@
  */
 #include "statev_t.h"
 
+#include "compiler.h"
 #include "irprintf.h"
 #include "stat_timing.h"
 #include "util.h"
@@ -25,10 +26,10 @@
 
 int (stat_ev_enabled) = 0;
 
-static FILE          *stat_ev_file;
-static int            stat_ev_timer_sp;
-static timing_ticks_t stat_ev_timer_elapsed[MAX_TIMER];
-static timing_ticks_t stat_ev_timer_start[MAX_TIMER];
+static FILE                       *stat_ev_file;
+static THREAD_LOCAL int            stat_ev_timer_sp;
+static THREAD_LOCAL timing_ticks_t stat_ev_timer_elapsed[MAX_TIMER];
+static THREAD_LOCAL timing_ticks_t stat_ev_timer_start[MAX_TIMER];
 
 static regex_t  regex;
 static regex_t *filter;
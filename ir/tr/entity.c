@@ -268,9 +268,11 @@ void set_entity_ld_ident(ir_entity *const ent, ident *const ld_ident)
 		if (is_segment_type(owner) && !(owner->flags & tf_info)
 		 && get_entity_visibility(ent) != ir_visibility_private) {
 			pmap *globals = irp->globals;
+			ir_mutex_lock(&irp_mutex);
 			pmap_insert(globals, old_ident, NULL);
 			assert(NULL == pmap_get(ir_entity, globals, ld_ident));
 			pmap_insert(globals, ld_ident, ent);
+			ir_mutex_unlock(&irp_mutex);
 		}
 	}
 }
@@ -845,7 +847,8 @@ int entity_has_definition(const ir_entity *entity)
 {
 	switch (get_entity_kind(entity)) {
 	case IR_ENTITY_METHOD:
-		return get_entity_irg(entity) != NULL
+		/* no need to read a stub graph */
+		return entity->attr.mtd_attr.irg != NULL
 		    && (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN) == 0;
 
 	case IR_ENTITY_NORMAL:
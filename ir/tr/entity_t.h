@@ -18,6 +18,7 @@
 
 #include "compiler.h"
 #include "ident.h"
+#include "irprog_t.h"
 #include "panic.h"
 #include "type_t.h"
 #include "typerep.h"
@@ -407,7 +408,8 @@ static inline ir_graph *_get_entity_irg(const ir_entity *ent)
 {
 	assert(ent->firm_tag == k_entity);
 	assert(ent->kind == IR_ENTITY_METHOD);
-	return ent->attr.mtd_attr.irg;
+	ir_graph *const irg = ent->attr.mtd_attr.irg;
+	return irp->n_stub_irgs == 0 || irg == NULL ? irg : materialize_irg(irg);
 }
 
 static inline ir_graph *_get_entity_linktime_irg(const ir_entity *entity)
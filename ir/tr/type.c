@@ -822,6 +822,7 @@ const char *get_compound_name(const ir_type *tp)
 void remove_compound_member(ir_type *type, ir_entity *member)
 {
 	assert(is_compound_type(type));
+	ir_mutex_lock(&irp_mutex);
 	for (size_t i = 0, n = ARR_LEN(type->attr.compound.members); i < n; ++i) {
 		if (get_compound_member(type, i) != member)
 			continue;
@@ -836,11 +837,13 @@ void remove_compound_member(ir_type *type, ir_entity *member)
 		}
 		break;
 	}
+	ir_mutex_unlock(&irp_mutex);
 }
 
 void add_compound_member(ir_type *type, ir_entity *entity)
 {
 	assert(is_compound_type(type));
+	ir_mutex_lock(&irp_mutex);
 	/* try to detect double-add */
 	ARR_APP1(ir_entity *, type->attr.compound.members, entity);
 	/* Add segment members to globals map. */
@@ -852,6 +855,7 @@ void add_compound_member(ir_type *type, ir_entity *entity)
 		assert(NULL == pmap_get(ir_entity, globals, id));
 		pmap_insert(globals, id, entity);
 	}
+	ir_mutex_unlock(&irp_mutex);
 }
 
 int is_code_type(ir_type const *const type)
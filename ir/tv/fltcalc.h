@@ -46,6 +46,12 @@ typedef struct fp_value fp_value;
 /** Returns the size in bytes of an fp_value */
 unsigned fc_get_value_size(void);
 
+/**
+ * Copy @p value to @p dest. Padding bytes in @p dest are cleared, so equal
+ * values can be compared bytewise afterwards.
+ */
+void fc_copy(fp_value *dest, const fp_value *value);
+
 void fc_val_from_str(const char *str, size_t len, fp_value *result);
 
 /** get the representation of a floating point value
@@ -21,9 +21,21 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define SC_MASK      ((sc_word)0xFF)
-#define SC_RESULT(x) ((x) & SC_MASK)
-#define SC_CARRY(x)  ((unsigned)(x) >> SC_BITS)
+#define SC_MASK      ((sc_word)~(sc_word)0)
+#define SC_RESULT(x) ((sc_word)((x) & SC_MASK))
+#define SC_BYTES     (SC_BITS / CHAR_BIT)
+
+/* double width type for multiplication and division by a single word */
+#if SC_BITS == 8 || SC_BITS == 16
+typedef uint32_t sc_dword;
+#define HAVE_SC_DWORD
+#elif SC_BITS == 32
+typedef uint64_t sc_dword;
+#define HAVE_SC_DWORD
+#elif defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 sc_dword;
+#define HAVE_SC_DWORD
+#endif
 
 static char *output_buffer = NULL;  /**< buffer for output */
 static unsigned bit_pattern_size;   /**< maximum number of bits */
@@ -37,12 +49,13 @@ void sc_zero(sc_word *buffer)
 
 static sc_word sex_digit(unsigned x)
 {
-	return (SC_MASK << (x+1)) & SC_MASK;
+	/* shift in two steps, x+1 may be SC_BITS */
+	return SC_RESULT(SC_MASK << x << 1);
 }
 
 static sc_word max_digit(unsigned x)
 {
-	return (1u << x) - 1;
+	return SC_RESULT(((sc_word)1 << x) - 1);
 }
 
 static sc_word min_digit(unsigned x)
@@ -50,6 +63,77 @@ static sc_word min_digit(unsigned x)
 	return SC_MASK - max_digit(x);
 }
 
+/** Returns the index of the highest set bit of a non-zero word. */
+static unsigned word_highest_bit(sc_word word)
+{
+	assert(word != 0);
+#if SC_BITS > 32
+	uint32_t const high = (uint32_t)(word >> 32);
+	if (high != 0)
+		return 63 - nlz(high);
+#endif
+	return 31 - nlz((uint32_t)word);
+}
+
+/** Returns the index of the lowest set bit of a non-zero word. */
+static unsigned word_lowest_bit(sc_word word)
+{
+	assert(word != 0);
+#if SC_BITS > 32
+	uint32_t const low = (uint32_t)word;
+	if (low == 0)
+		return 32 + ntz((uint32_t)(word >> 32));
+	return ntz(low);
+#else
+	return ntz(word);
+#endif
+}
+
+static unsigned word_popcount(sc_word word)
+{
+#if SC_BITS > 32
+	return popcount((uint32_t)word) + popcount((uint32_t)(word >> 32));
+#else
+	return popcount(word);
+#endif
+}
+
+/**
+ * Returns the low word of a*b + c + d and stores the high word in *high.
+ * The result always fits into two words: (b-1)*(b-1) + 2*(b-1) = b*b-1.
+ */
+static inline sc_word mul_add(sc_word a, sc_word b, sc_word c, sc_word d,
+                              sc_word *high)
+{
+#ifdef HAVE_SC_DWORD
+	sc_dword const res = (sc_dword)a * b + c + d;
+	*high = (sc_word)(res >> SC_BITS);
+	return (sc_word)res;
+#else
+	/* pen-and-paper multiplication with half words */
+	unsigned const half      = SC_BITS / 2;
+	sc_word  const half_mask = ((sc_word)1 << half) - 1;
+	sc_word  const a_lo      = a & half_mask;
+	sc_word  const a_hi      = a >> half;
+	sc_word  const b_lo      = b & half_mask;
+	sc_word  const b_hi      = b >> half;
+	sc_word  const lolo      = a_lo * b_lo;
+	sc_word  const lohi      = a_lo * b_hi;
+	sc_word  const hilo      = a_hi * b_lo;
+	sc_word  const mid       = (lolo >> half) + (lohi & half_mask)
+	                         + (hilo & half_mask);
+	sc_word        lo        = (lolo & half_mask) | (mid << half);
+	sc_word        hi        = a_hi * b_hi + (lohi >> half) + (hilo >> half)
+	                         + (mid >> half);
+	lo += c;
+	hi += lo < c;
+	lo += d;
+	hi += lo < d;
+	*high = hi;
+	return lo;
+#endif
+}
+
 void sc_not(const sc_word *val, sc_word *buffer)
 {
 	for (unsigned counter = 0; counter<calc_buffer_size; counter++)
@@ -108,9 +192,11 @@ void sc_add(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 {
 	sc_word carry = 0;
 	for (unsigned counter = 0; counter < calc_buffer_size; ++counter) {
-		unsigned const sum = val1[counter] + val2[counter] + carry;
-		buffer[counter] = SC_RESULT(sum);
-		carry           = SC_CARRY(sum);
+		sc_word const v1   = val1[counter];
+		sc_word const sum1 = SC_RESULT(v1 + carry);
+		sc_word const sum  = SC_RESULT(sum1 + val2[counter]);
+		buffer[counter] = sum;
+		carry           = (sum1 < v1) | (sum < sum1);
 	}
 }
 
@@ -147,7 +233,7 @@ void sc_mul(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 		sc_word outer = val2[c_outer];
 		if (outer == 0)
 			continue;
-		unsigned carry = 0; /* container for carries */
+		sc_word carry = 0; /* container for carries */
 		for (unsigned c_inner = 0; c_inner < max_value_size; c_inner++) {
 			sc_word inner = val1[c_inner];
 			/* do the following calculation:
@@ -156,11 +242,6 @@ void sc_mul(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 			 * val2[c_outer]. This is the usual pen-and-paper multiplication
 			 */
 
-			/* multiplicate the two digits */
-			unsigned const mul = inner*outer;
-			/* add old value to result of multiplication and the carry */
-			unsigned const sum = temp_buffer[c_inner+c_outer] + mul + carry;
-
 			/* all carries together result in new carry. This is always
 			 * smaller than the base b:
 			 * Both multiplicands, the carry and the value already in the
@@ -172,8 +253,9 @@ void sc_mul(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 			 * most
 			 * (b*b-1)rem b = -1rem b = b-1
 			 */
-			temp_buffer[c_inner + c_outer] = SC_RESULT(sum);
-			carry                          = SC_CARRY(sum);
+			temp_buffer[c_inner + c_outer]
+				= mul_add(inner, outer, temp_buffer[c_inner + c_outer], carry,
+				          &carry);
 		}
 
 		/* A carry may hang over */
@@ -184,18 +266,26 @@ void sc_mul(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 	if (sign)
 		sc_neg(temp_buffer, buffer);
 	else
-		memcpy(buffer, temp_buffer, calc_buffer_size);
+		memcpy(buffer, temp_buffer, calc_buffer_size * sizeof(sc_word));
 }
 
-/**
- * Shift the buffer to left and add an sc digit
- */
-static void sc_push(sc_word digit, sc_word *buffer)
+/** Compares two values interpreted as unsigned numbers. */
+static ir_relation sc_ucomp(const sc_word *val1, const sc_word *val2)
 {
-	for (unsigned counter = calc_buffer_size - 1; counter-- > 0; ) {
-		buffer[counter+1] = buffer[counter];
+	/* loop until two digits differ, the values are equal if there
+	 * are no such two digits */
+	unsigned counter = calc_buffer_size - 1;
+	while (val1[counter] == val2[counter]) {
+		if (counter == 0)
+			return ir_relation_equal;
+		counter--;
 	}
-	buffer[0] = digit;
+
+	/* the leftmost digit is the most significant, so this returns
+	 * the correct result.
+	 * This implies the digit enum is ordered */
+	return val1[counter] > val2[counter]
+	     ? ir_relation_greater : ir_relation_less;
 }
 
 bool sc_divmod(const sc_word *dividend, const sc_word *divisor,
@@ -243,31 +333,38 @@ bool sc_divmod(const sc_word *dividend, const sc_word *divisor,
 		goto end;
 
 	case ir_relation_less: /* dividend < divisor */
-		memcpy(rem, dividend, calc_buffer_size);
+		memcpy(rem, dividend, calc_buffer_size * sizeof(sc_word));
 		goto end;
 
 	default: /* unluckily division is necessary :( */
 		break;
 	}
 
-	for (unsigned c_dividend = calc_buffer_size; c_dividend-- > 0; ) {
-		sc_push(dividend[c_dividend], rem);
-		sc_push(0, quot);
-
-		if (sc_comp(rem, divisor) != ir_relation_less) {
-			/* remainder >= divisor */
-			/* subtract until the remainder becomes negative, this should
-			 * be faster than comparing remainder with divisor  */
-			sc_add(rem, minus_divisor, rem);
+#ifdef HAVE_SC_DWORD
+	if (sc_get_highest_set_bit(divisor) < SC_BITS) {
+		/* short division by a single word */
+		sc_word const d = divisor[0];
+		sc_dword      r = 0;
+		for (unsigned c_dividend = calc_buffer_size; c_dividend-- > 0; ) {
+			sc_dword const cur = (r << SC_BITS) | dividend[c_dividend];
+			quot[c_dividend] = (sc_word)(cur / d);
+			r                = cur % d;
+		}
+		rem[0] = (sc_word)r;
+		goto end;
+	}
+#endif
 
-			while (!sc_is_negative(rem)) {
-				/* TODO can this generate carry or is masking redundant? */
-				quot[0] = SC_RESULT(quot[0] + 1);
-				sc_add(rem, minus_divisor, rem);
-			}
+	/* shift-subtract long division, the remainder is always smaller than the
+	 * (positive) divisor, so shifting it left cannot overflow */
+	for (int bit = sc_get_highest_set_bit(dividend); bit >= 0; --bit) {
+		sc_shlI(rem, 1, rem);
+		if (sc_get_bit_at(dividend, bit))
+			rem[0] |= 1;
 
-			/* subtracted one too much */
-			sc_add(rem, divisor, rem);
+		if (sc_ucomp(rem, divisor) != ir_relation_less) {
+			sc_add(rem, minus_divisor, rem);
+			sc_set_bit_at(quot, bit);
 		}
 	}
 end:
@@ -292,10 +389,11 @@ void sc_zero_extend(sc_word *buffer, unsigned from_bits)
 	unsigned bit  = from_bits % SC_BITS;
 	unsigned word = from_bits / SC_BITS;
 	if (bit > 0) {
-		memset(&buffer[word+1], 0, calc_buffer_size-(word+1));
+		memset(&buffer[word+1], 0,
+		       (calc_buffer_size-(word+1)) * sizeof(sc_word));
 		buffer[word] &= max_digit(bit);
 	} else {
-		memset(&buffer[word], 0, calc_buffer_size-word);
+		memset(&buffer[word], 0, (calc_buffer_size-word) * sizeof(sc_word));
 	}
 }
 
@@ -376,60 +474,38 @@ bool sc_val_from_str(bool negative, unsigned base, const char *str, size_t len,
 
 void sc_val_from_long(long value, sc_word *buffer)
 {
-	bool sign       = value < 0;
-	bool is_minlong = value == LONG_MIN;
-
-	/* use absolute value, special treatment of MIN_LONG to avoid overflow */
-	if (sign) {
-		if (is_minlong)
-			value = -(value+1);
-		else
-			value = -value;
-	}
-
-	sc_zero(buffer);
-
-	sc_word *pos = buffer;
-	while ((value != 0) && (pos < buffer + calc_buffer_size)) {
-		*pos++ = value & SC_MASK;
-		value >>= SC_BITS;
-	}
+	sc_val_from_ulong((unsigned long)value, buffer);
 
-	if (sign) {
-		if (is_minlong)
-			sc_inc(buffer);
-
-		sc_neg(buffer, buffer);
-	}
+	unsigned const long_bits = sizeof(long) * CHAR_BIT;
+	if (value < 0 && long_bits < calc_buffer_size * SC_BITS)
+		sc_sign_extend(buffer, long_bits);
 }
 
 void sc_val_from_ulong(unsigned long value, sc_word *buffer)
 {
-	sc_word *pos = buffer;
-
-	while (pos < buffer + calc_buffer_size) {
-		*pos++ = value & SC_MASK;
-		value >>= SC_BITS;
+	uint64_t v = value;
+	for (unsigned i = 0; i < calc_buffer_size; ++i) {
+		buffer[i] = SC_RESULT(v);
+		/* shift in two steps, SC_BITS may be the width of v */
+		v >>= SC_BITS / 2;
+		v >>= SC_BITS / 2;
 	}
 }
 
 long sc_val_to_long(const sc_word *val)
 {
 	unsigned long l = 0;
-	unsigned max_buffer_index = (sizeof(long)*8)/SC_BITS;
-	for (unsigned i = max_buffer_index; i-- > 0; ) {
-		assert(l <= (ULONG_MAX>>SC_BITS) && "signed shift overflow");
-		l = (l << SC_BITS) + val[i];
-	}
+	for (unsigned i = 0;
+	     i * SC_BITS < sizeof(long) * CHAR_BIT && i < calc_buffer_size; ++i)
+		l |= (unsigned long)val[i] << (i * SC_BITS);
 	return l;
 }
 
 uint64_t sc_val_to_uint64(const sc_word *val)
 {
 	uint64_t res = 0;
-	for (unsigned i = calc_buffer_size; i-- > 0; ) {
-		res = (res << SC_BITS) + val[i];
-	}
+	for (unsigned i = 0; i * SC_BITS < 64 && i < calc_buffer_size; ++i)
+		res |= (uint64_t)val[i] << (i * SC_BITS);
 	return res;
 }
 
@@ -477,20 +553,7 @@ ir_relation sc_comp(const sc_word* const val1, const sc_word* const val2)
 	if (val1_negative != val2_negative)
 		return val1_negative ? ir_relation_less : ir_relation_greater;
 
-	/* loop until two digits differ, the values are equal if there
-	 * are no such two digits */
-	unsigned counter = calc_buffer_size - 1;
-	while (val1[counter] == val2[counter]) {
-		if (counter == 0)
-			return ir_relation_equal;
-		counter--;
-	}
-
-	/* the leftmost digit is the most significant, so this returns
-	 * the correct result.
-	 * This implies the digit enum is ordered */
-	return val1[counter] > val2[counter]
-	     ? ir_relation_greater : ir_relation_less;
+	return sc_ucomp(val1, val2);
 }
 
 int sc_get_highest_set_bit(const sc_word *value)
@@ -498,7 +561,7 @@ int sc_get_highest_set_bit(const sc_word *value)
 	for (unsigned counter = calc_buffer_size; counter-- > 0; ) {
 		sc_word word = value[counter];
 		if (word != 0)
-			return counter*SC_BITS + (31 - nlz(word));
+			return counter*SC_BITS + word_highest_bit(word);
 	}
 	return -1;
 }
@@ -508,7 +571,7 @@ int sc_get_highest_clear_bit(const sc_word *value)
 	for (unsigned counter = calc_buffer_size; counter-- > 0; ) {
 		sc_word word = value[counter] ^ SC_MASK;
 		if (word != 0)
-			return counter*SC_BITS + (31 - nlz(word));
+			return counter*SC_BITS + word_highest_bit(word);
 	}
 	return -1;
 }
@@ -519,7 +582,7 @@ int sc_get_lowest_set_bit(const sc_word *value)
 	     ++counter) {
 		sc_word word = value[counter];
 		if (word != 0)
-			return (counter * SC_BITS) + ntz(word);
+			return (counter * SC_BITS) + word_lowest_bit(word);
 	}
 	return -1;
 }
@@ -527,13 +590,13 @@ int sc_get_lowest_set_bit(const sc_word *value)
 void sc_set_bit_at(sc_word *value, unsigned pos)
 {
 	unsigned nibble = pos / SC_BITS;
-	value[nibble] |= 1 << (pos % SC_BITS);
+	value[nibble] |= (sc_word)1 << (pos % SC_BITS);
 }
 
 void sc_clear_bit_at(sc_word *value, unsigned pos)
 {
 	unsigned nibble = pos / SC_BITS;
-	value[nibble] &= ~(1 << (pos % SC_BITS));
+	value[nibble] &= ~((sc_word)1 << (pos % SC_BITS));
 }
 
 bool sc_is_zero(const sc_word *value, unsigned bits)
@@ -565,18 +628,16 @@ bool sc_is_negative(const sc_word *value)
 
 unsigned char sc_sub_bits(const sc_word *value, unsigned len, unsigned byte_ofs)
 {
-	if (byte_ofs*SC_BITS >= len)
+	unsigned const bit_ofs = byte_ofs * CHAR_BIT;
+	if (bit_ofs >= len)
 		return 0;
 
-	assert(SC_BITS == CHAR_BIT);
-	sc_word val = value[byte_ofs];
+	sc_word val = value[bit_ofs / SC_BITS] >> (bit_ofs % SC_BITS);
 	// Mask out if we are at the end
-	if (byte_ofs == (len/SC_BITS)-1) {
-		unsigned bit = len % SC_BITS;
-		if (bit != 0)
-			val &= max_digit(bit);
-	}
-	return val;
+	unsigned const remaining = len - bit_ofs;
+	if (remaining < CHAR_BIT)
+		val &= max_digit(remaining);
+	return (unsigned char)val;
 }
 
 unsigned sc_popcount(const sc_word *value, unsigned bits)
@@ -584,12 +645,12 @@ unsigned sc_popcount(const sc_word *value, unsigned bits)
 	unsigned res = 0;
 	unsigned full_words = bits/SC_BITS;
 	for (unsigned i = 0; i < full_words; ++i) {
-		res += popcount(value[i]);
+		res += word_popcount(value[i]);
 	}
 	unsigned remaining_bits = bits%SC_BITS;
 	if (remaining_bits != 0) {
 		sc_word mask = max_digit(remaining_bits);
-		res += popcount(value[full_words] & mask);
+		res += word_popcount(value[full_words] & mask);
 	}
 
 	return res;
@@ -600,10 +661,11 @@ void sc_val_from_bytes(unsigned char const *const bytes, size_t n_bytes,
 {
 	assert(n_bytes*CHAR_BIT <= (size_t)calc_buffer_size*SC_BITS);
 
-	sc_word *p = buffer;
-	assert(SC_BITS == CHAR_BIT);
-	memcpy(p, bytes, n_bytes);
-	memset(p+n_bytes, 0, buffer+calc_buffer_size-p);
+	sc_zero(buffer);
+	for (size_t i = 0; i < n_bytes; ++i) {
+		buffer[i / SC_BYTES]
+			|= (sc_word)bytes[i] << (i % SC_BYTES * CHAR_BIT);
+	}
 }
 
 void sc_val_to_bytes(const sc_word *buffer, unsigned char *const dest,
@@ -611,55 +673,41 @@ void sc_val_to_bytes(const sc_word *buffer, unsigned char *const dest,
 {
 	assert(dest_len*CHAR_BIT <= (size_t)calc_buffer_size*SC_BITS);
 
-	assert(SC_BITS == CHAR_BIT);
-	memcpy(dest, buffer, dest_len);
+	for (size_t i = 0; i < dest_len; ++i) {
+		dest[i] = (unsigned char)(buffer[i / SC_BYTES]
+		                          >> (i % SC_BYTES * CHAR_BIT));
+	}
 }
 
 void sc_val_from_bits(unsigned char const *const bytes, unsigned from,
                       unsigned to, sc_word *buffer)
 {
 	assert(from < to);
-	assert((to - from) / CHAR_BIT <= calc_buffer_size);
-	assert(CHAR_BIT == 8);
-	assert(SC_BITS == CHAR_BIT);
-
-	sc_word *p = buffer;
-
-	/* see which is the lowest and highest byte, special case if they are
-	 * the same. */
-	const unsigned char *const low      = &bytes[from/CHAR_BIT];
-	const unsigned char *const high     = &bytes[(to-1)/CHAR_BIT];
-	const unsigned             low_bit  = from%CHAR_BIT;
-	const unsigned             high_bit = (to-1)%CHAR_BIT + 1;
-	if (low == high) {
-		uint32_t val
-			= ((uint32_t)*low << (32-high_bit)) >> (32-high_bit+low_bit);
-		*p++ = val & SC_MASK;
-		goto clear_rest;
-	}
-
-	/* lowest byte gets applied partially */
-	uint32_t val = ((uint32_t)*low) >> low_bit;
-	*p     = val & SC_MASK;
-	*(p+1) = 0;
-	unsigned bit = (CHAR_BIT-low_bit)%SC_BITS;
-	p += (CHAR_BIT-low_bit)/SC_BITS;
-	/* fully apply bytes in the middle (but note that they may affect up to 2
-	 * units of the destination number) */
-	for (const unsigned char *mid = low+1; mid < high; ++mid) {
-		uint32_t mval = ((uint32_t)*mid) << bit;
-		*p++   |= (mval >> 0)       & SC_MASK;
-		*p      = (mval >> SC_BITS) & SC_MASK;
-	}
-	/* partially apply the highest byte */
-	uint32_t hval = ((uint32_t)(*high) << (32-high_bit)) >> (32-high_bit-bit);
-	*p++ |= (hval >> 0)       & SC_MASK;
-	if ((hval >> SC_BITS) != 0)
-		*p++ = (hval >> SC_BITS) & SC_MASK;
-
-clear_rest:
-	assert(p <= buffer + calc_buffer_size);
-	memset(p, 0, buffer+calc_buffer_size - p);
+	assert(to - from <= calc_buffer_size * SC_BITS);
+
+	sc_zero(buffer);
+
+	/* apply the source bytes one by one, each of them may affect up to 2
+	 * units of the destination number */
+	for (unsigned b = from / CHAR_BIT; b <= (to-1) / CHAR_BIT; ++b) {
+		unsigned       val = bytes[b];
+		unsigned const pos = b * CHAR_BIT;
+		/* partially apply the highest byte */
+		if (to - pos < CHAR_BIT)
+			val &= (1u << (to - pos)) - 1;
+		/* partially apply the lowest byte */
+		unsigned dest_bit = 0;
+		if (pos < from)
+			val >>= from - pos;
+		else
+			dest_bit = pos - from;
+
+		unsigned const word = dest_bit / SC_BITS;
+		unsigned const bit  = dest_bit % SC_BITS;
+		buffer[word] |= SC_RESULT((sc_word)val << bit);
+		if (bit > SC_BITS - CHAR_BIT && (val >> (SC_BITS - bit)) != 0)
+			buffer[word+1] |= (sc_word)(val >> (SC_BITS - bit));
+	}
 }
 
 const char *sc_print(const sc_word *value, unsigned bits, enum base_t base,
@@ -679,26 +727,19 @@ char *sc_print_buf(char *buf, size_t buf_len, const sc_word *value,
 	*(--pos) = '\0';
 	assert(pos >= buf);
 
-	unsigned n_full_words   = bits / SC_BITS;
-	unsigned remaining_bits = bits % SC_BITS;
+	unsigned n_full_words = bits / SC_BITS;
 	switch (base) {
 	case SC_HEX: {
-		assert(SC_BITS == 8);
-		unsigned counter = 0;
-		for ( ; counter < n_full_words; ++counter) {
-			sc_word x = value[counter];
-			*(--pos) = digits[(x >> 0) & 0xf];
-			*(--pos) = digits[(x >> 4) & 0xf];
-		}
-
-		/* last nibble must be masked */
-		if (remaining_bits != 0) {
-			sc_word mask = max_digit(remaining_bits);
-			sc_word x    = value[counter++] & mask;
-			*(--pos) = digits[(x >> 0) & 0xf];
-			*(--pos) = digits[(x >> 4) & 0xf];
-			assert(pos >= buf);
+		unsigned const n_nibbles = (bits + 3) / 4;
+		for (unsigned nibble = 0; nibble < n_nibbles; ++nibble) {
+			unsigned const bit = nibble * 4;
+			unsigned       x   = (value[bit / SC_BITS] >> (bit % SC_BITS)) & 0xf;
+			/* last nibble must be masked */
+			if (bits - bit < 4)
+				x &= (1u << (bits - bit)) - 1;
+			*(--pos) = digits[x];
 		}
+		assert(pos >= buf);
 
 		/* now kill zeros */
 		assert(pos >= buf);
@@ -829,7 +870,7 @@ void sc_shlI(const sc_word *value, unsigned shift_count, sc_word *buffer)
 	}
 
 	/* fill up with zeros */
-	memset(buffer, 0, shift_words);
+	memset(buffer, 0, shift_words * sizeof(sc_word));
 }
 
 void sc_shl(const sc_word *val1, const sc_word *val2, sc_word *buffer)
@@ -839,46 +880,51 @@ void sc_shl(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 	sc_shlI(val1, shift_count, buffer);
 }
 
-bool sc_shrI(const sc_word *value, unsigned shift_count, sc_word *buffer)
+/**
+ * Shift @p value right by @p shift_count bits (which must be smaller than the
+ * buffer size) and fill the upper words with @p fill.
+ */
+static void shift_right(const sc_word *value, unsigned shift_count,
+                        sc_word fill, sc_word *buffer)
 {
-	if (shift_count >= calc_buffer_size*SC_BITS) {
-		bool carry_flag = !sc_is_zero(value, calc_buffer_size*SC_BITS);
-		sc_zero(buffer);
-		return carry_flag;
-	}
-
-	unsigned shift_words = shift_count / SC_BITS;
-	unsigned shift_bits  = shift_count % SC_BITS;
-
-	/* determine carry flag */
-	bool carry_flag = false;
-	for (unsigned i = 0; i < shift_words; ++i) {
-		if (value[i] != 0) {
-			carry_flag = true;
-			break;
-		}
-	}
+	unsigned const shift_words = shift_count / SC_BITS;
+	unsigned const shift_bits  = shift_count % SC_BITS;
+	unsigned const limit       = calc_buffer_size - shift_words;
 
-	/* shift to the right */
 	if (shift_bits == 0) {
 		/* fast path */
-		for (unsigned i = 0; i < calc_buffer_size-shift_words; ++i) {
+		for (unsigned i = 0; i < limit; ++i) {
 			buffer[i] = value[i+shift_words];
 		}
 	} else {
 		sc_word val = value[shift_words];
-		carry_flag |= val & max_digit(shift_bits);
-		for (unsigned i = 0; i < calc_buffer_size-shift_words; ++i) {
+		for (unsigned i = 0; i < limit; ++i) {
 			unsigned next_pos = i+shift_words+1;
-			sc_word  next = next_pos < calc_buffer_size ? value[next_pos] : 0;
+			sc_word  next     = next_pos < calc_buffer_size ? value[next_pos]
+			                                                : fill;
 			buffer[i] = SC_RESULT(val >> shift_bits)
 			          | SC_RESULT(next << (SC_BITS - shift_bits));
 			val = next;
 		}
 	}
 
-	/* fill upper words with zero */
-	memset(&buffer[calc_buffer_size-shift_words], 0, shift_words);
+	/* fill upper words */
+	for (unsigned i = limit; i < calc_buffer_size; ++i)
+		buffer[i] = fill;
+}
+
+bool sc_shrI(const sc_word *value, unsigned shift_count, sc_word *buffer)
+{
+	if (shift_count >= calc_buffer_size*SC_BITS) {
+		bool carry_flag = !sc_is_zero(value, calc_buffer_size*SC_BITS);
+		sc_zero(buffer);
+		return carry_flag;
+	}
+
+	/* determine carry flag */
+	bool carry_flag = !sc_is_zero(value, shift_count);
+
+	shift_right(value, shift_count, 0, buffer);
 	return carry_flag;
 }
 
@@ -897,49 +943,19 @@ bool sc_shrsI(const sc_word *value, unsigned shift_count, unsigned bitsize,
 	/* if shifting far enough the result is either 0 or -1 */
 	if (shift_count >= bitsize) {
 		bool carry_flag = !sc_is_zero(value, calc_buffer_size*SC_BITS);
-		assert(SC_BITS <= CHAR_BIT);
-		memset(buffer, sign, calc_buffer_size);
+		for (unsigned i = 0; i < calc_buffer_size; ++i)
+			buffer[i] = sign;
 		return carry_flag;
 	}
 
-	unsigned shift_words = shift_count / SC_BITS;
-	unsigned shift_bits  = shift_count % SC_BITS;
-
 	/* determine carry flag */
-	bool carry_flag = false;
-	for (unsigned i = 0; i < shift_words; ++i) {
-		if (value[i] != 0) {
-			carry_flag = true;
-			break;
-		}
-	}
-
-	/* TODO: bitsize % SC_BITS != 0 not implemented yet */
-	assert(bitsize % SC_BITS == 0);
-	unsigned limit = bitsize / SC_BITS;
-
-	/* shift to the right */
-	if (shift_bits == 0) {
-		/* fast path */
-		for (unsigned i = 0; i < limit-shift_words; ++i) {
-			buffer[i] = value[i+shift_words];
-		}
-	} else {
-		sc_word val = value[shift_words];
-		carry_flag |= val & max_digit(shift_bits);
-		for (unsigned i = 0; i < limit-shift_words; ++i) {
-			unsigned next_pos = i+shift_words+1;
-			sc_word next = next_pos<limit ? value[next_pos] : sign;
-			buffer[i] = SC_RESULT(val >> shift_bits)
-			          | SC_RESULT(next << (SC_BITS - shift_bits));
-			val = next;
-		}
-	}
+	bool carry_flag = !sc_is_zero(value, shift_count);
 
-	/* fill upper words with extended sign */
-	assert(SC_BITS <= CHAR_BIT);
-	memset(&buffer[limit-shift_words], sign,
-	       calc_buffer_size-(limit-shift_words));
+	/* shift the value sign extended from bitsize */
+	sc_word *temp = ALLOCAN(sc_word, calc_buffer_size);
+	memcpy(temp, value, calc_buffer_size * sizeof(sc_word));
+	sc_sign_extend(temp, bitsize);
+	shift_right(temp, shift_count, sign, buffer);
 	return carry_flag;
 }
 
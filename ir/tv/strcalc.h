@@ -16,9 +16,25 @@
 #include <stdlib.h>
 #include "firm_types.h"
 
-#define SC_BITS 8
+/**
+ * Number of bits in a single limb of a strcalc value. Values are stored as
+ * arrays of sc_word in little endian limb order.
+ */
+#ifndef SC_BITS
+#define SC_BITS 64
+#endif
 
+#if SC_BITS == 8
 typedef uint8_t sc_word;
+#elif SC_BITS == 16
+typedef uint16_t sc_word;
+#elif SC_BITS == 32
+typedef uint32_t sc_word;
+#elif SC_BITS == 64
+typedef uint64_t sc_word;
+#else
+#error "unsupported SC_BITS"
+#endif
 
 /**
  * The output mode for integer values.
@@ -27,8 +27,9 @@
 #include "irmode_t.h"
 #include "irnode_t.h"
 #include "irprintf.h"
+#include "irthread.h"
+#include "obst.h"
 #include "panic.h"
-#include "set.h"
 #include "strcalc.h"
 #include "util.h"
 #include "xmalloc.h"
@@ -42,8 +43,21 @@
  * constant target values */
 #define N_CONSTANTS 2048
 
+typedef struct tarval_set_t tarval_set_t;
+
+#define HashSet         tarval_set_t
+#define ValueType       ir_tarval*
+#define ADDITIONAL_DATA struct obstack obst; /**< holds the tarvals */
+#include "hashset.h"
+#undef ADDITIONAL_DATA
+#undef ValueType
+#undef HashSet
+
 /** A set containing all existing tarvals. */
-static struct set *tarvals = NULL;
+static tarval_set_t tarvals;
+/** Protects tarvals and tarval_stats while worker threads run. */
+static ir_mutex_t tarvals_mutex = IR_MUTEX_INITIALIZER;
+static tarval_statistics_t tarval_stats;
 
 static unsigned sc_value_length;
 static unsigned fp_value_size;
@@ -54,25 +68,65 @@ static bool wrap_on_overflow = true;
 /** Hash a tarval. */
 static unsigned hash_tv(ir_tarval const *const tv)
 {
-	return hash_combine(hash_ptr(tv->mode), hash_data(tv->value, tv->length));
+	return hash_combine(hash_ptr(tv->mode), hash_data((unsigned char const*)tv->value, tv->length));
 }
 
-static int cmp_tv(const void *p1, const void *p2, size_t n)
+static bool tv_equal(ir_tarval const *const tv1, ir_tarval const *const tv2)
 {
-	(void)n;
-	ir_tarval const *const tv1 = (ir_tarval const*)p1;
-	ir_tarval const *const tv2 = (ir_tarval const*)p2;
 	if (tv1->mode != tv2->mode)
-		return 1;
+		return false;
 	assert(tv1->length == tv2->length);
-	return memcmp(tv1->value, tv2->value, tv1->length);
+	return memcmp(tv1->value, tv2->value, tv1->length) == 0;
+}
+
+/** Copy a new tarval into the arena of the tarval set. */
+static ir_tarval *copy_tarval(tarval_set_t *const set, ir_tarval const *const tv)
+{
+	return (ir_tarval*)obstack_copy(&set->obst, tv,
+	                                sizeof(ir_tarval) + tv->length);
+}
+
+static void count_probes(size_t const num_probes, bool const found)
+{
+	++tarval_stats.lookups;
+	tarval_stats.hits   += found;
+	tarval_stats.probes += num_probes;
+	if (num_probes > tarval_stats.max_probes)
+		tarval_stats.max_probes = num_probes;
 }
 
+#define HashSet                   tarval_set_t
+#define ValueType                 ir_tarval*
+#define NullValue                 NULL
+#define DeletedValue              ((ir_tarval*)-1)
+#define KeyType                   ir_tarval const*
+#define GetKey(value)             (value)
+#define InitData(self,value,key)  (value) = copy_tarval(self, key)
+#define Hash(self,key)            hash_tv(key)
+#define KeysEqual(self,key1,key2) tv_equal(key1, key2)
+#define CountProbes(self,num_probes,found) count_probes(num_probes, found)
+#define SCALAR_RETURN
+#define SetRangeEmpty(ptr,size)   memset(ptr, 0, (size) * sizeof((ptr)[0]))
+#define ADDITIONAL_INIT           obstack_init(&self->obst);
+#define ADDITIONAL_TERM           obstack_free(&self->obst, NULL);
+
+void tarval_set_init_size(tarval_set_t *self, size_t expected_elements);
+#define hashset_init_size tarval_set_init_size
+void tarval_set_destroy(tarval_set_t *self);
+#define hashset_destroy   tarval_set_destroy
+ir_tarval *tarval_set_insert(tarval_set_t *self, ir_tarval const *key);
+#define hashset_insert    tarval_set_insert
+size_t tarval_set_size(tarval_set_t const *self);
+#define hashset_size      tarval_set_size
+
+#include "hashset.c.h"
+
 static ir_tarval *identify_tarval(ir_tarval const *const tv)
 {
-	unsigned hash = hash_tv(tv);
-	return set_insert(ir_tarval, tarvals, tv, sizeof(ir_tarval) + tv->length,
-	                  hash);
+	ir_mutex_lock(&tarvals_mutex);
+	ir_tarval *const res = tarval_set_insert(&tarvals, tv);
+	ir_mutex_unlock(&tarvals_mutex);
+	return res;
 }
 
 static ir_tarval *get_fp_tarval(const fp_value *value, ir_mode *mode)
@@ -81,7 +135,7 @@ static ir_tarval *get_fp_tarval(const fp_value *value, ir_mode *mode)
 	tv->kind   = k_tarval;
 	tv->mode   = mode;
 	tv->length = fp_value_size;
-	memcpy(tv->value, value, fp_value_size);
+	fc_copy((fp_value*)tv->value, value);
 	return identify_tarval(tv);
 }
 
@@ -217,6 +271,7 @@ ir_tarval *new_tarval_from_str(const char *str, size_t len, ir_mode *mode)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		break;
 	}
@@ -475,6 +530,7 @@ void init_mode_values(ir_mode* mode)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 		mode->all_one   = tarval_bad;
 		mode->min       = tarval_bad;
 		mode->max       = tarval_bad;
@@ -502,6 +558,7 @@ int tarval_is_negative(ir_tarval const *const a)
 	case irms_auxiliary:
 	case irms_internal_boolean:
 	case irms_data:
+	case irms_vector:
 		break;
 	}
 	panic("invalid mode sort");
@@ -566,6 +623,7 @@ ir_relation tarval_cmp(ir_tarval const *const a, ir_tarval const *const b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 		break;
 	}
 	panic("invalid mode sort");
@@ -617,6 +675,7 @@ ir_tarval *tarval_convert_to(ir_tarval const *const src,
 		case irms_internal_boolean:
 		case irms_auxiliary:
 		case irms_data:
+		case irms_vector:
 			break;
 		}
 		/* the rest can't be converted */
@@ -629,7 +688,7 @@ ir_tarval *tarval_convert_to(ir_tarval const *const src,
 		case irms_reference:
 		case irms_int_number: {
 			sc_word *const buffer = ALLOCAN(sc_word, sc_value_length);
-			memcpy(buffer, src->value, sc_value_length);
+			memcpy(buffer, src->value, sc_value_length * sizeof(sc_word));
 			return get_int_tarval_overflow(buffer, dst_mode);
 		}
 
@@ -650,6 +709,7 @@ ir_tarval *tarval_convert_to(ir_tarval const *const src,
 		}
 		case irms_auxiliary:
 		case irms_data:
+		case irms_vector:
 		case irms_internal_boolean:
 			break;
 		}
@@ -658,7 +718,7 @@ ir_tarval *tarval_convert_to(ir_tarval const *const src,
 	case irms_reference:
 		if (get_mode_arithmetic(dst_mode) == irma_twos_complement) {
 			sc_word *const buffer = ALLOCAN(sc_word, sc_value_length);
-			memcpy(buffer, src->value, sc_value_length);
+			memcpy(buffer, src->value, sc_value_length * sizeof(sc_word));
 			unsigned bits = get_mode_size_bits(src->mode);
 			if (mode_is_signed(src->mode)) {
 				sc_sign_extend(buffer, bits);
@@ -671,6 +731,7 @@ ir_tarval *tarval_convert_to(ir_tarval const *const src,
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		return tarval_bad;
 	}
@@ -723,6 +784,7 @@ ir_tarval *tarval_neg(ir_tarval const *const a)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		break;
 	}
@@ -758,6 +820,7 @@ ir_tarval *tarval_add(ir_tarval const *a, ir_tarval const *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		return tarval_bad;
 	}
@@ -799,6 +862,7 @@ ir_tarval *tarval_sub(ir_tarval const *a, ir_tarval const *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		return tarval_bad;
 	}
@@ -827,6 +891,7 @@ ir_tarval *tarval_mul(ir_tarval const *const a, ir_tarval const *const b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		return tarval_bad;
 	}
@@ -858,6 +923,7 @@ ir_tarval *tarval_div(ir_tarval const *const a, ir_tarval const *const b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		panic("operation not defined on mode");
 	}
@@ -1022,7 +1088,7 @@ ir_tarval *tarval_shr(ir_tarval const *const a, ir_tarval const *const b)
 
 	sc_word *const temp = ALLOCAN(sc_word, sc_value_length);
 	/* workaround for unnecessary internal higher precision */
-	memcpy(temp, a->value, sc_value_length);
+	memcpy(temp, a->value, sc_value_length * sizeof(sc_word));
 	sc_zero_extend(temp, get_mode_size_bits(a_mode));
 	sc_shr(temp, temp_val, temp);
 	return get_int_tarval(temp, a_mode);
@@ -1040,7 +1106,7 @@ ir_tarval *tarval_shr_unsigned(ir_tarval const *const a, unsigned b)
 
 	sc_word *const temp = ALLOCAN(sc_word, sc_value_length);
 	/* workaround for unnecessary internal higher precision */
-	memcpy(temp, a->value, sc_value_length);
+	memcpy(temp, a->value, sc_value_length * sizeof(sc_word));
 	sc_zero_extend(temp, get_mode_size_bits(a->mode));
 	sc_shrI(temp, (long)b, temp);
 	return get_int_tarval(temp, mode);
@@ -1148,6 +1214,7 @@ const char *ir_tarval_to_ascii(char *buf, size_t len, ir_tarval const *tv)
 		return buf;
 	}
 	case irms_data:
+	case irms_vector:
 	case irms_auxiliary:
 		if (tv == tarval_bad)
 			return "bad";
@@ -1178,6 +1245,7 @@ ir_tarval *ir_tarval_from_ascii(const char *buf, ir_mode *mode)
 		return get_fp_tarval(buffer, mode);
 	}
 	case irms_data:
+	case irms_vector:
 	case irms_auxiliary:
 		if (streq(buf, "bad"))
 			return tarval_bad;
@@ -1241,13 +1309,13 @@ unsigned get_tarval_magnitude(ir_tarval const *tv)
 	assert(get_mode_arithmetic(tv->mode) == irma_twos_complement);
 	unsigned const size = get_mode_size_bits(tv->mode);
 	unsigned const neg  = tarval_get_bit(tv, size - 1);
-	unsigned const ext  = neg ? (1U << SC_BITS) - 1 : 0;
+	unsigned const ext  = neg ? UCHAR_MAX : 0;
 
 	unsigned l = get_mode_size_bytes(tv->mode);
 	for (unsigned i = l; i-- != 0;) {
 		unsigned char const v = get_tarval_sub_bits(tv, i);
 		if (v != ext)
-			return i * SC_BITS + (32 - nlz(v ^ ext)) + 1;
+			return i * CHAR_BIT + (32 - nlz(v ^ ext)) + 1;
 	}
 
 	return 1;
@@ -1317,21 +1385,29 @@ int tarval_get_wrap_on_overflow(void)
 	return wrap_on_overflow;
 }
 
+void tarval_get_statistics(tarval_statistics_t *const stats)
+{
+	*stats           = tarval_stats;
+	stats->n_tarvals = tarval_set_size(&tarvals);
+}
+
 static ir_tarval *make_b_tarval(unsigned char const val)
 {
-	ir_tarval *const tv = XMALLOCFZ(ir_tarval, value, sc_value_length);
-	tv->kind     = k_tarval;
-	tv->length   = sc_value_length;
-	tv->value[0] = val;
+	unsigned   const size = sc_value_length * sizeof(sc_word);
+	ir_tarval *const tv   = XMALLOCFZ(ir_tarval, value, size);
+	tv->kind   = k_tarval;
+	tv->length = size;
+	sc_val_from_ulong(val, tv->value);
 	/* mode will be set later */
 	return tv;
 }
 
 void init_tarval_1(void)
 {
-	/* initialize the sets holding the tarvals with a comparison function and
-	 * an initial size, which is the expected number of constants */
-	tarvals = new_set(cmp_tv, N_CONSTANTS);
+	/* initialize the set holding the tarvals with an initial size, which is
+	 * the expected number of constants */
+	tarval_set_init_size(&tarvals, N_CONSTANTS);
+	memset(&tarval_stats, 0, sizeof(tarval_stats));
 	/* calls init_strcalc() with needed size */
 	init_fltcalc(128);
 
@@ -1359,7 +1435,7 @@ void init_tarval_2(void)
 void finish_tarval(void)
 {
 	finish_strcalc();
-	del_set(tarvals); tarvals = NULL;
+	tarval_set_destroy(&tarvals);
 }
 
 bool tarval_in_range(ir_tarval const *const min, ir_tarval const *const val, ir_tarval const *const max)
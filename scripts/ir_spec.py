@@ -705,6 +705,16 @@ class Or(Binop):
     flags = ["commutative"]
 
 
+@op
+class Pack(Node):
+    """Builds a value of a vector mode from scalar values. Input n becomes
+    element n of the vector, so the number of inputs has to match the number
+    of elements of the vector mode and all inputs have its element mode."""
+    arity = "variable"
+    input_name = "elem"
+    flags = []
+
+
 @op
 class Phi(Node):
     """Choose a value based on control flow. A phi node has 1 input for each
@@ -193,6 +193,28 @@ void (set_{{node.name}}_{{attr.name}})(ir_node *node, {{attr.type}} {{attr.name}
 {%- endfor -%}
 {% endfor %}
 
+{%- if not spec.external %}
+{%- for node in nodes %}
+{%- if node.arity is number %}
+
+static int inputs_equal_{{node.name}}(const ir_node *a, const ir_node *b)
+{
+	{%- if node.arity == 0 %}
+	(void)a;
+	(void)b;
+	return true;
+	{%- else %}
+	return
+	{%- for i in range(node.arity) %} {% if i > 0 %}&& {% endif %}get_irn_n(a, {{i}}) == get_irn_n(b, {{i}})
+	{%- if not loop.last %}
+	   {% endif %}
+	{%- endfor %};
+	{%- endif %}
+}
+{%- endif %}
+{%- endfor %}
+{% endif %}
+
 void {{spec.name}}_init_opcodes(void)
 {
 	{%- if spec.external %}
@@ -218,6 +240,9 @@ void {{spec.name}}_init_opcodes(void)
 	{%- if "fragile" in node.flags: %}
 	ir_op_set_fragile_indices(op_{{node.name}}, pn_{{node.name}}_X_regular, {% if node.only_regular -%} (unsigned)-1 {%- else -%} pn_{{node.name}}_X_except {%- endif -%});
 	{%- endif -%}
+	{%- if not spec.external and node.arity is number %}
+	op_{{node.name}}->ops.inputs_equal = inputs_equal_{{node.name}};
+	{%- endif -%}
 	{%- endfor %}
 }
 
@@ -3,12 +3,22 @@
  * This file is a supplement to libFirm. It is public domain.
  *  @author Matthias Braun, Steven Schaefer
  */
+#include <stdatomic.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
-/* Prevent the compiler from mangling the name of this function. */
+/* Number of values per value profiling site, IR_PROFILE_N_VALUES in
+ * libFirm. */
+#define N_VALUES 4
+
+/* Prevent the compiler from mangling the name of these functions. */
 void __init_firmprof(const char*, unsigned int*, size_t)
      asm("__init_firmprof");
+void __firmprof_value(unsigned*, uintptr_t)
+     asm("__firmprof_value");
+void __firmprof_call(unsigned*, void*, void *const*, unsigned)
+     asm("__firmprof_call");
 
 typedef struct _profile_counter_t {
 	const char *filename;
@@ -22,7 +32,8 @@ static profile_counter_t *counters = NULL;
 /**
  * Write counter values to profiling output file.
  * We define our output format to be a sequence of 32-bit unsigned integer
- * values stored in little endian format.
+ * values stored in little endian format. The compiler initializes the
+ * version and layout information in the counter array itself.
  */
 void write_little_endian(unsigned *counter, unsigned len, FILE *f)
 {
@@ -86,3 +97,117 @@ void __init_firmprof(const char *filename,
 
 	counters = counter;
 }
+
+/**
+ * Record a value in a value profiling site, which holds (low word, high word,
+ * count) for the N_VALUES most frequent values. An unknown value replaces the
+ * least frequent one and takes over its count (space saving), so frequent
+ * values are never undercounted.
+ */
+void __firmprof_value(unsigned *site, uintptr_t value)
+{
+	unsigned  lo  = (unsigned)value;
+	unsigned  hi  = (unsigned)((unsigned long long)value >> 32);
+	unsigned *min = site;
+	unsigned  i;
+
+	for (i = 0; i < N_VALUES; ++i) {
+		unsigned *slot = &site[3 * i];
+		if (slot[2] == 0 || (slot[0] == lo && slot[1] == hi)) {
+			slot[0] = lo;
+			slot[1] = hi;
+			++slot[2];
+			return;
+		}
+		if (slot[2] < min[2])
+			min = slot;
+	}
+
+	min[0] = lo;
+	min[1] = hi;
+	++min[2];
+}
+
+/* Number of entries in the cache of resolved call targets, a power of 2. */
+#define CALL_CACHE_SIZE 1024
+
+/**
+ * An entry of the call target cache. The profiled program may call from
+ * several threads, so the entries are guarded by a sequence lock: a writer
+ * makes seq odd while it updates the entry, a reader only uses an entry
+ * whose seq is even and did not change while reading it.
+ */
+typedef struct call_cache_entry_t {
+	atomic_uint      seq;
+	atomic_uintptr_t functions;
+	atomic_uintptr_t target;
+	atomic_uint      index;
+} call_cache_entry_t;
+
+/** Resolved indirect call targets, indexed by a hash of the target. */
+static call_cache_entry_t call_cache[CALL_CACHE_SIZE];
+
+/** Returns the cached index of target, n_functions + 1 on a cache miss. */
+static unsigned lookup_call(call_cache_entry_t *entry, uintptr_t target,
+                            uintptr_t functions, unsigned n_functions)
+{
+	unsigned  seq = atomic_load_explicit(&entry->seq, memory_order_acquire);
+	uintptr_t cached_target;
+	uintptr_t cached_functions;
+	unsigned  index;
+
+	if (seq & 1)
+		return n_functions + 1;
+	cached_target    = atomic_load_explicit(&entry->target,
+	                                        memory_order_relaxed);
+	cached_functions = atomic_load_explicit(&entry->functions,
+	                                        memory_order_relaxed);
+	index            = atomic_load_explicit(&entry->index,
+	                                        memory_order_relaxed);
+	atomic_thread_fence(memory_order_acquire);
+	if (atomic_load_explicit(&entry->seq, memory_order_relaxed) != seq
+	    || cached_target != target || cached_functions != functions)
+		return n_functions + 1;
+	return index;
+}
+
+/** Caches the index of target, unless another thread updates the entry. */
+static void update_call(call_cache_entry_t *entry, uintptr_t target,
+                        uintptr_t functions, unsigned index)
+{
+	unsigned seq = atomic_load_explicit(&entry->seq, memory_order_relaxed);
+
+	if ((seq & 1)
+	    || !atomic_compare_exchange_strong_explicit(&entry->seq, &seq, seq + 1,
+	                                                memory_order_acquire,
+	                                                memory_order_relaxed))
+		return;
+	atomic_thread_fence(memory_order_release);
+	atomic_store_explicit(&entry->target, target, memory_order_relaxed);
+	atomic_store_explicit(&entry->functions, functions, memory_order_relaxed);
+	atomic_store_explicit(&entry->index, index, memory_order_relaxed);
+	atomic_store_explicit(&entry->seq, seq + 2, memory_order_release);
+}
+
+/**
+ * Record the target of an indirect call as index into the functions of its
+ * translation unit, n_functions if it is none of them. The function table is
+ * only searched when the target misses the cache.
+ */
+void __firmprof_call(unsigned *site, void *target, void *const *functions,
+                     unsigned n_functions)
+{
+	uintptr_t           hash  = (uintptr_t)target * 2654435761u;
+	call_cache_entry_t *entry = &call_cache[(hash >> 16) % CALL_CACHE_SIZE];
+	unsigned            i     = lookup_call(entry, (uintptr_t)target,
+	                                        (uintptr_t)functions, n_functions);
+
+	if (i > n_functions) {
+		for (i = 0; i < n_functions; ++i) {
+			if (functions[i] == target)
+				break;
+		}
+		update_call(entry, (uintptr_t)target, (uintptr_t)functions, i);
+	}
+	__firmprof_value(site, i);
+}
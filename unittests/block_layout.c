@@ -0,0 +1,229 @@
+/*
+ * Generate ia32 assembly for a function with a hand-set profile and check
+ * the block layout: blocks which were never executed go to the cold part
+ * of the function in .text.unlikely, a block which its predecessor falls
+ * through into stays right behind it, and the code behind a jump table of
+ * the cold part continues in the cold section.
+ */
+#include "firm.h"
+#include "irprofile.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N_CASES 8
+
+typedef struct block_t {
+	long  nr;
+	bool  hot;
+	char *pos; /**< comment of the block in the assembly */
+} block_t;
+
+static block_t blocks[N_CASES + 8];
+static size_t  n_blocks;
+
+static ir_node *add_block(ir_node *block, bool hot)
+{
+	block_t *const b = &blocks[n_blocks++];
+	b->nr  = get_irn_node_nr(block);
+	b->hot = hot;
+	ir_profile_set_block_execcount(block, hot ? 10 : 0);
+	return block;
+}
+
+static ir_node *new_block(ir_node *pred)
+{
+	ir_node *block = new_immBlock();
+	add_immBlock_pred(block, pred);
+	mature_immBlock(block);
+	set_cur_block(block);
+	return block;
+}
+
+static void new_return(ir_node *value)
+{
+	ir_node *ret = new_Return(get_store(), 1, &value);
+	add_immBlock_pred(get_irg_end_block(get_current_ir_graph()), ret);
+}
+
+/**
+ * int layout(int *p, int sel, int x)
+ * {
+ *     if (x < 0) {
+ *         switch (sel) { case i: return 3 * i; }  // never executed
+ *         return 0;
+ *     }
+ *     try { return *p + 1; }  // the block behind the Load was never executed
+ *     catch (...) { return -1; }  // never executed
+ * }
+ */
+static void build_layout(long *load_block, long *behind_block)
+{
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *ptr_type = new_type_pointer(int_type);
+	ir_type *mtp = new_type_method(3, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, ptr_type);
+	set_method_param_type(mtp, 1, int_type);
+	set_method_param_type(mtp, 2, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str("layout"), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 0);
+	set_current_ir_graph(irg);
+
+	ir_node *args  = get_irg_args(irg);
+	ir_node *p     = new_Proj(args, mode_P, 0);
+	ir_node *sel   = new_Proj(args, mode_Is, 1);
+	ir_node *x     = new_Proj(args, mode_Is, 2);
+	ir_node *start = get_cur_block();
+	ir_node *cond  = new_Cond(new_Cmp(x, new_Const_long(mode_Is, 0),
+	                                  ir_relation_less));
+	mature_immBlock(start);
+	add_block(start, true);
+
+	add_block(new_block(new_Proj(cond, mode_X, pn_Cond_true)), false);
+	ir_switch_table *table = ir_new_switch_table(irg, N_CASES);
+	for (unsigned i = 0; i < N_CASES; ++i) {
+		ir_tarval *value = new_tarval_from_long(i, mode_Is);
+		ir_switch_table_set(table, i, value, value, i + 1);
+	}
+	ir_node *switchn = new_Switch(sel, N_CASES + 1, table);
+	/* switch lowering replaces the default block */
+	ir_profile_set_block_execcount(new_block(new_Proj(switchn, mode_X, 0)), 0);
+	new_return(new_Const_long(mode_Is, 0));
+	for (unsigned pn = 1; pn <= N_CASES; ++pn) {
+		add_block(new_block(new_Proj(switchn, mode_X, pn)), false);
+		new_return(new_Const_long(mode_Is, 3 * (pn - 1)));
+	}
+
+	ir_node *common = add_block(new_block(new_Proj(cond, mode_X,
+	                                               pn_Cond_false)), true);
+	*load_block = get_irn_node_nr(common);
+	ir_node *load   = new_Load(get_store(), p, mode_Is, int_type, cons_none);
+	ir_set_throws_exception(load, true);
+	set_store(new_Proj(load, mode_M, pn_Load_M));
+	ir_node *value   = new_Proj(load, mode_Is, pn_Load_res);
+	ir_node *regular = new_Proj(load, mode_X, pn_Load_X_regular);
+	ir_node *except  = new_Proj(load, mode_X, pn_Load_X_except);
+
+	/* hot, because its predecessor falls through into it */
+	ir_node *behind = add_block(new_block(regular), true);
+	*behind_block = get_irn_node_nr(behind);
+	new_return(new_Add(value, new_Const_long(mode_Is, 1)));
+
+	add_block(new_block(except), false);
+	new_return(new_Const_long(mode_Is, -1));
+
+	irg_finalize_cons(irg);
+}
+
+static char *read_file(FILE *file)
+{
+	long const size = ftell(file);
+	char      *text = malloc(size + 1);
+	rewind(file);
+	if (fread(text, 1, size, file) != (size_t)size) {
+		free(text);
+		return NULL;
+	}
+	text[size] = '\0';
+	return text;
+}
+
+/** Finds the verbose assembler comment of @p block. */
+static char *find_block(char *text, long nr)
+{
+	char comment[64];
+	snprintf(comment, sizeof(comment), "/* Block BB[%ld:", nr);
+	return strstr(text, comment);
+}
+
+int main(void)
+{
+	ir_init();
+	if (!ir_target_set("i686-linux-gnu")) {
+		printf("*** cannot set target\n");
+		return 1;
+	}
+	ir_target_init();
+
+	long load_block;
+	long behind_block;
+	build_layout(&load_block, &behind_block);
+
+	FILE *out = tmpfile();
+	be_main(out, "block_layout");
+	char *text = read_file(out);
+	fclose(out);
+	if (text == NULL) {
+		printf("*** cannot read the assembly\n");
+		return 1;
+	}
+
+	bool  fine = true;
+	char *cold = strstr(text, "layout.cold:");
+	char *end  = cold != NULL ? strstr(cold, "# -- End  layout") : NULL;
+	if (cold == NULL || end == NULL) {
+		printf("*** layout has no cold part\n");
+		fine = false;
+		cold = end = text + strlen(text);
+	} else {
+		/* the cold part starts in .text.unlikely */
+		char *section = cold;
+		while (section > text && strncmp(section, ".section", 8) != 0)
+			--section;
+		if (strncmp(section, ".section\t.text.unlikely", 23) != 0) {
+			printf("*** the cold part is not in .text.unlikely\n");
+			fine = false;
+		}
+	}
+
+	for (size_t i = 0; i < n_blocks; ++i) {
+		block_t *const b = &blocks[i];
+		b->pos = find_block(text, b->nr);
+		if (b->pos == NULL) {
+			printf("*** Block %ld is missing in the assembly\n", b->nr);
+			fine = false;
+		} else if (b->hot != (b->pos < cold) || b->pos > end) {
+			printf("*** Block %ld is in the %s part\n", b->nr,
+			       b->hot ? "cold" : "hot");
+			fine = false;
+		}
+	}
+
+	/* nothing between the Load and the block it falls through into */
+	char *load_pos   = find_block(text, load_block);
+	char *behind_pos = find_block(text, behind_block);
+	if (load_pos != NULL && behind_pos != NULL) {
+		char *next = strstr(load_pos + 1, "/* Block BB[");
+		if (next != behind_pos) {
+			printf("*** the fallthrough block does not follow the Load\n");
+			fine = false;
+		}
+	}
+
+	/* the jump table is emitted in the cold part, afterwards the code
+	 * continues in the cold section */
+	char *table = strstr(cold, ".section\t.rodata");
+	if (table == NULL || table > end) {
+		printf("*** no jump table in the cold part\n");
+		fine = false;
+	} else {
+		char *next = strstr(table, "\t.section\t.text");
+		char *text = strstr(table, "\t.text\n");
+		if (text != NULL && (next == NULL || text < next))
+			next = text;
+		if (next == NULL || next > end
+		    || strncmp(next, "\t.section\t.text.unlikely", 24) != 0) {
+			printf("*** the code behind the jump table is not in "
+			       ".text.unlikely\n");
+			fine = false;
+		}
+	}
+
+	if (!fine)
+		fputs(text, stdout);
+	free(text);
+	ir_finish();
+	return fine ? 0 : 1;
+}
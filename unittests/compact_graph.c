@@ -0,0 +1,169 @@
+/*
+ * Check that compact_graph() frees the memory of dead nodes, keeps the
+ * reachable ones and numbers them block by block. Then compile a graph with
+ * the backend compacting it first and run the code.
+ */
+#include "firm.h"
+#include "jit.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define N_DEAD 1000
+#define N_LIVE 20
+
+/** int select(int a, int b) { return a < b ? a * b * ... : b - a - ...; }
+ * The nodes of both branches are built alternately, with many nodes nobody
+ * uses in between. */
+static ir_graph *build_select(char const *name)
+{
+	ir_type *int_type = new_type_primitive(mode_Is);
+	ir_type *mtp = new_type_method(2, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_param_type(mtp, 1, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 0);
+	set_current_ir_graph(irg);
+
+	/* keep the nodes as built */
+	set_optimize(0);
+	ir_node *a           = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_node *b           = new_Proj(get_irg_args(irg), mode_Is, 1);
+	ir_node *cond        = new_Cond(new_Cmp(a, b, ir_relation_less));
+	ir_node *start_block = get_cur_block();
+	mature_immBlock(start_block);
+
+	ir_node *then_block = new_immBlock();
+	add_immBlock_pred(then_block, new_Proj(cond, mode_X, pn_Cond_true));
+	mature_immBlock(then_block);
+	ir_node *else_block = new_immBlock();
+	add_immBlock_pred(else_block, new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(else_block);
+
+	ir_node *then_value = a;
+	ir_node *else_value = b;
+	for (int i = 0; i < N_DEAD; ++i) {
+		if (i < N_LIVE) {
+			then_value = new_r_Mul(then_block, then_value, b);
+			else_value = new_r_Sub(else_block, else_value, a);
+		}
+		ir_node *c = new_r_Const_long(irg, mode_Is, i);
+		new_r_Add(i % 2 == 0 ? then_block : else_block, a, c);
+	}
+
+	ir_node *join = new_immBlock();
+	add_immBlock_pred(join, new_r_Jmp(then_block));
+	add_immBlock_pred(join, new_r_Jmp(else_block));
+	mature_immBlock(join);
+	set_cur_block(join);
+	ir_node *phi_ins[] = { then_value, else_value };
+	ir_node *result    = new_Phi(2, phi_ins, mode_Is);
+	ir_node *ret       = new_Return(get_store(), 1, &result);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+
+	irg_finalize_cons(irg);
+	set_optimize(1);
+	return irg;
+}
+
+static void count_node(ir_node *node, void *env)
+{
+	(void)node;
+	++*(unsigned*)env;
+}
+
+static unsigned count_nodes(ir_graph *irg)
+{
+	unsigned n = 0;
+	irg_walk_anchors(irg, count_node, NULL, &n);
+	return n;
+}
+
+/** A block must have a smaller index than its nodes, and the nodes of a
+ * block must not be interleaved with those of other blocks. */
+static void check_order(ir_node *node, void *env)
+{
+	bool *const fine = (bool*)env;
+	if (is_Block(node) || is_Anchor(node))
+		return;
+	ir_node *const block = get_nodes_block(node);
+	if (get_irn_idx(block) > get_irn_idx(node))
+		*fine = false;
+	ir_graph *const irg = get_irn_irg(node);
+	for (unsigned i = get_irn_idx(block) + 1; i < get_irn_idx(node); ++i) {
+		ir_node *const other = get_idx_irn(irg, i);
+		if (is_Block(other) || get_nodes_block(other) != block)
+			*fine = false;
+	}
+}
+
+int main(void)
+{
+	ir_init();
+
+	size_t    const allocated_before = ir_get_node_memory_allocated();
+	ir_graph *const irg              = build_select("select");
+	size_t    const allocated        = ir_get_node_memory_allocated()
+	                                   - allocated_before;
+	size_t    const used_before      = get_irg_memory_used(irg);
+	unsigned  const n_nodes          = count_nodes(irg);
+
+	compact_graph(irg);
+
+	size_t const used_after = get_irg_memory_used(irg);
+	bool         fine       = true;
+	irg_walk_graph(irg, check_order, NULL, &fine);
+	printf("%u nodes, %zu bytes allocated, %zu bytes used before and %zu "
+	       "after compaction\n", n_nodes, allocated, used_before, used_after);
+
+	if (!irg_verify(irg)) {
+		printf("*** compacted graph does not verify\n");
+		fine = false;
+	}
+	if (count_nodes(irg) != n_nodes || get_irg_last_idx(irg) != n_nodes) {
+		printf("*** compaction changed the reachable nodes\n");
+		fine = false;
+	}
+	if (used_after >= used_before || allocated < used_before / 2) {
+		printf("*** memory accounting is off\n");
+		fine = false;
+	}
+
+	/* the same graph compacted by the backend */
+	if (!ir_target_set("x86_64-linux-gnu") || ir_target_option("compact") != 1) {
+		printf("*** cannot set target\n");
+		return 1;
+	}
+	ir_target_init();
+	ir_graph *const be_irg = build_select("be_select");
+	be_lower_for_target();
+	ir_jit_segment_t  *const segment  = be_new_jit_segment();
+	ir_jit_function_t *const function = be_jit_compile(segment, be_irg);
+	if (function == NULL) {
+		printf("*** compacted graph could not be compiled\n");
+		fine = false;
+	} else {
+		void *const code = be_jit_load_function(segment, function);
+		int (*select)(int a, int b);
+		memcpy(&select, &code, sizeof(code));
+		for (int a = -3; a <= 3; a += 3) {
+			unsigned then_value = (unsigned)a;
+			unsigned else_value = 2;
+			for (int i = 0; i < N_LIVE; ++i) {
+				then_value *= 2;
+				else_value -= (unsigned)a;
+			}
+			unsigned const expected = a < 2 ? then_value : else_value;
+			if ((unsigned)select(a, 2) != expected) {
+				printf("*** select(%d, 2) is wrong\n", a);
+				fine = false;
+			}
+		}
+	}
+	be_destroy_jit_segment(segment);
+
+	ir_finish();
+	return fine ? 0 : 1;
+}
@@ -0,0 +1,259 @@
+/*
+ * Run the control flow optimizations which update the dominance information
+ * incrementally and compare the dominator tree they keep with the one
+ * computed from scratch.
+ */
+#include "firm.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+#define MAX_BLOCKS 256
+
+enum { VAR_I, VAR_S, VAR_A, N_VARS };
+
+typedef struct block_info_t {
+	ir_node *block;
+	ir_node *idom;
+	int      depth;
+	bool     dominates; /**< dominates the block at (i * 7) % n_blocks */
+} block_info_t;
+
+static block_info_t infos[MAX_BLOCKS];
+static int          n_infos;
+
+static ir_node *jump_to(ir_node *target)
+{
+	add_immBlock_pred(target, new_Jmp());
+	return target;
+}
+
+static void enter(ir_node *block)
+{
+	mature_immBlock(block);
+	set_cur_block(block);
+}
+
+/**
+ * int f(int x)
+ * {
+ *     int s = 0;
+ *     for (int i = 0; i < trip; ++i) {
+ *         int a = x < s ? 1 : 2;
+ *         if (a == 1) s = s + x; else s = s - i;
+ *     }
+ *     return s;
+ * }
+ *
+ * with an empty block in front of the loop and behind it.
+ */
+static ir_graph *build_graph(char const *name, long trip)
+{
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp = new_type_method(1, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg = new_ir_graph(ent, N_VARS);
+	set_current_ir_graph(irg);
+
+	ir_node *x = new_Proj(get_irg_args(irg), mode_Is, 0);
+	set_value(VAR_I, new_Const_long(mode_Is, 0));
+	set_value(VAR_S, new_Const_long(mode_Is, 0));
+	ir_node *pre    = new_immBlock();
+	ir_node *header = new_immBlock();
+	mature_immBlock(get_cur_block());
+	enter(jump_to(pre));
+	jump_to(header);
+
+	set_cur_block(header);
+	ir_node *i    = get_value(VAR_I, mode_Is);
+	ir_node *cmp  = new_Cmp(i, new_Const_long(mode_Is, trip), ir_relation_less);
+	ir_node *cond = new_Cond(cmp);
+	ir_node *body = new_immBlock();
+	ir_node *exit = new_immBlock();
+	add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_true));
+	add_immBlock_pred(exit, new_Proj(cond, mode_X, pn_Cond_false));
+
+	enter(body);
+	ir_node *s     = get_value(VAR_S, mode_Is);
+	ir_node *cond0 = new_Cond(new_Cmp(x, s, ir_relation_less));
+	ir_node *then0 = new_immBlock();
+	ir_node *else0 = new_immBlock();
+	ir_node *join0 = new_immBlock();
+	add_immBlock_pred(then0, new_Proj(cond0, mode_X, pn_Cond_true));
+	add_immBlock_pred(else0, new_Proj(cond0, mode_X, pn_Cond_false));
+	enter(then0);
+	set_value(VAR_A, new_Const_long(mode_Is, 1));
+	jump_to(join0);
+	enter(else0);
+	set_value(VAR_A, new_Const_long(mode_Is, 2));
+	jump_to(join0);
+
+	enter(join0);
+	ir_node *a     = get_value(VAR_A, mode_Is);
+	ir_node *cond1 = new_Cond(new_Cmp(a, new_Const_long(mode_Is, 1),
+	                                  ir_relation_equal));
+	ir_node *then1 = new_immBlock();
+	ir_node *else1 = new_immBlock();
+	ir_node *latch = new_immBlock();
+	add_immBlock_pred(then1, new_Proj(cond1, mode_X, pn_Cond_true));
+	add_immBlock_pred(else1, new_Proj(cond1, mode_X, pn_Cond_false));
+	enter(then1);
+	set_value(VAR_S, new_Add(get_value(VAR_S, mode_Is), x));
+	jump_to(latch);
+	enter(else1);
+	set_value(VAR_S, new_Sub(get_value(VAR_S, mode_Is),
+	                         get_value(VAR_I, mode_Is)));
+	jump_to(latch);
+
+	enter(latch);
+	set_value(VAR_I, new_Add(get_value(VAR_I, mode_Is),
+	                         new_Const_long(mode_Is, 1)));
+	jump_to(header);
+	mature_immBlock(header);
+
+	enter(exit);
+	ir_node *post = new_immBlock();
+	enter(jump_to(post));
+	ir_node *res = get_value(VAR_S, mode_Is);
+	ir_node *ret = new_Return(get_store(), 1, &res);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static void collect_block(ir_node *block, void *env)
+{
+	(void)env;
+	if (n_infos < MAX_BLOCKS)
+		infos[n_infos].block = block;
+	++n_infos;
+}
+
+static int count_blocks(ir_graph *irg)
+{
+	n_infos = 0;
+	irg_block_walk_graph(irg, collect_block, NULL, NULL);
+	return n_infos;
+}
+
+/** Compares the dominance information kept by @p pass with the one computed
+ * from scratch. */
+static bool check_dominance(ir_graph *irg, char const *pass)
+{
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE)) {
+		printf("*** %s does not keep the dominance information\n", pass);
+		return false;
+	}
+	if (count_blocks(irg) > MAX_BLOCKS) {
+		printf("*** %s created too many blocks\n", pass);
+		return false;
+	}
+	for (int i = 0; i < n_infos; ++i) {
+		block_info_t *info  = &infos[i];
+		ir_node      *other = infos[(i * 7) % n_infos].block;
+		info->depth     = get_Block_dom_depth(info->block);
+		info->idom      = info->depth > 0 ? get_Block_idom(info->block) : NULL;
+		info->dominates = info->depth > 0 && get_Block_dom_depth(other) > 0
+		                  && block_dominates(info->block, other);
+	}
+
+	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
+	                        | IR_GRAPH_PROPERTY_CONSISTENT_OUTS);
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+
+	bool fine = true;
+	for (int i = 0; i < n_infos; ++i) {
+		block_info_t const *info  = &infos[i];
+		ir_node            *other = infos[(i * 7) % n_infos].block;
+		int                 depth = get_Block_dom_depth(info->block);
+		ir_node            *idom  = depth > 0 ? get_Block_idom(info->block)
+		                                      : NULL;
+		if ((depth > 0) != (info->depth > 0) || idom != info->idom
+		    || (depth > 0 && depth != info->depth)) {
+			ir_printf("*** %s: wrong dominator of %+F in %+F\n", pass,
+			          info->block, irg);
+			fine = false;
+		}
+		bool dom = depth > 0 && get_Block_dom_depth(other) > 0
+		           && block_dominates(info->block, other);
+		if (dom != info->dominates) {
+			ir_printf("*** %s: wrong dominance of %+F over %+F in %+F\n", pass,
+			          info->block, other, irg);
+			fine = false;
+		}
+	}
+	return fine;
+}
+
+static int allow_ifconv(ir_node const *sel, ir_node const *mux_false,
+                        ir_node const *mux_true)
+{
+	(void)sel;
+	(void)mux_false;
+	(void)mux_true;
+	return true;
+}
+
+static void if_conv(ir_graph *irg)
+{
+	opt_if_conv_cb(irg, allow_ifconv);
+}
+
+static void unroll(ir_graph *irg)
+{
+	unroll_loops(irg, 4, 100);
+}
+
+typedef struct pass_t {
+	char const *name;
+	void      (*run)(ir_graph *irg);
+} pass_t;
+
+static pass_t const passes[] = {
+	{ "unroll_loops",  unroll            },
+	{ "optimize_cf",   optimize_cf       },
+	{ "jumpthreading", opt_jumpthreading },
+	{ "if_conv",       if_conv           },
+};
+#define N_PASSES (sizeof(passes) / sizeof(*passes))
+
+/** Runs @p pass with consistent dominance information and checks that it
+ * changed the control flow and kept the dominance information. */
+static bool run_pass(ir_graph *irg, pass_t const *pass)
+{
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+	int const n_blocks = count_blocks(irg);
+	pass->run(irg);
+	irg_verify(irg);
+	if (count_blocks(irg) == n_blocks) {
+		ir_printf("*** %s did not change the control flow of %+F\n",
+		          pass->name, irg);
+		return false;
+	}
+	return check_dominance(irg, pass->name);
+}
+
+int main(void)
+{
+	ir_init();
+
+	bool fine = true;
+	/* each pass on its own, the unrolled loops are unrolled partially and
+	 * completely */
+	for (size_t p = 0; p < N_PASSES; ++p) {
+		for (long trip = 3; trip <= 8; trip += 5) {
+			char name[32];
+			snprintf(name, sizeof(name), "%s%ld", passes[p].name, trip);
+			fine &= run_pass(build_graph(name, trip), &passes[p]);
+		}
+	}
+
+	/* the passes one after another on the graph the previous one changed */
+	ir_graph *irg = build_graph("all", 8);
+	for (size_t p = 0; p < N_PASSES; ++p)
+		fine &= run_pass(irg, &passes[p]);
+
+	ir_finish();
+	return fine ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+/*
+ * Change the control flow of a graph randomly, update the dominance
+ * information incrementally and compare it with the dominance information
+ * computed from scratch.
+ */
+#include "firm.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define N_BLOCKS   40
+#define MAX_BLOCKS 400
+#define N_ROUNDS   200
+#define N_CHANGES  8
+
+static ir_node  *blocks[MAX_BLOCKS];
+static int       n_blocks;
+/** Control flow nodes which currently do not jump anywhere. */
+static ir_node  *free_jumps[2 * N_BLOCKS];
+static int       n_free_jumps;
+static unsigned  seed = 42;
+
+static unsigned next_random(unsigned limit)
+{
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 8) % limit;
+}
+
+static void add_block_pred(ir_node *block, ir_node *pred)
+{
+	int       arity = get_Block_n_cfgpreds(block);
+	ir_node **in    = (ir_node**)malloc((arity + 1) * sizeof(*in));
+	for (int i = 0; i < arity; ++i)
+		in[i] = get_Block_cfgpred(block, i);
+	in[arity] = pred;
+	set_irn_in(block, arity + 1, in);
+	free(in);
+}
+
+/** Builds blocks ending in Conds with random targets and keeps them all alive
+ * to avoid endless loops without a path to End. */
+static ir_graph *build_graph(void)
+{
+	ir_type *int_type = new_type_primitive(mode_Is);
+	ir_type *mtp = new_type_method(1, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str("f"), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 0);
+	set_current_ir_graph(irg);
+
+	ir_node *x = new_Proj(get_irg_args(irg), mode_Is, 0);
+	blocks[0] = get_cur_block();
+	for (int i = 1; i < N_BLOCKS; ++i)
+		blocks[i] = new_immBlock();
+	ir_node *exit = new_immBlock();
+	blocks[N_BLOCKS] = exit;
+	n_blocks         = N_BLOCKS + 1;
+
+	for (int i = 0; i < N_BLOCKS; ++i) {
+		set_cur_block(blocks[i]);
+		ir_node *cmp  = new_Cmp(x, new_Const_long(mode_Is, i), ir_relation_less);
+		ir_node *cond = new_Cond(cmp);
+		ir_node *t    = new_Proj(cond, mode_X, pn_Cond_true);
+		ir_node *f    = new_Proj(cond, mode_X, pn_Cond_false);
+		/* mostly jump forward, so most blocks are reachable at first */
+		int target = i + 1 + (int)next_random(3);
+		add_immBlock_pred(target < N_BLOCKS ? blocks[target] : exit, t);
+		add_immBlock_pred(blocks[next_random(N_BLOCKS - 1) + 1], f);
+		keep_alive(blocks[i]);
+	}
+	for (int i = 0; i < N_BLOCKS; ++i)
+		mature_immBlock(blocks[i]);
+	mature_immBlock(exit);
+	set_cur_block(exit);
+	ir_node *ret = new_Return(get_store(), 1, &x);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static ir_node *random_block(void)
+{
+	return blocks[next_random(n_blocks - 1) + 1];
+}
+
+/** Removes a random control flow edge. */
+static void delete_edge(ir_graph *irg)
+{
+	ir_node *block = random_block();
+	int      arity = get_Block_n_cfgpreds(block);
+	if (arity == 0 || n_free_jumps == (int)(sizeof(free_jumps)
+	                                        / sizeof(*free_jumps)))
+		return;
+	int      pos  = (int)next_random(arity);
+	ir_node *pred = get_Block_cfgpred(block, pos);
+	if (is_Bad(pred) || !is_Proj(pred))
+		return;
+	free_jumps[n_free_jumps++] = pred;
+	set_irn_n(block, pos, new_r_Bad(irg, mode_X));
+	dom_delete_edge(get_nodes_block(pred), block);
+}
+
+/** Lets a control flow node without target jump to a random block. */
+static void insert_edge(void)
+{
+	if (n_free_jumps == 0)
+		return;
+	int      i    = (int)next_random(n_free_jumps);
+	ir_node *pred = free_jumps[i];
+	free_jumps[i] = free_jumps[--n_free_jumps];
+	ir_node *block = random_block();
+	add_block_pred(block, pred);
+	dom_insert_edge(get_nodes_block(pred), block);
+}
+
+/** Places a new block on a random control flow edge. */
+static void insert_block(ir_graph *irg)
+{
+	ir_node *succ  = random_block();
+	int      arity = get_Block_n_cfgpreds(succ);
+	if (arity == 0 || n_blocks == MAX_BLOCKS)
+		return;
+	int      pos  = (int)next_random(arity);
+	ir_node *pred = get_Block_cfgpred(succ, pos);
+	if (is_Bad(pred))
+		return;
+	ir_node *block = new_r_Block(irg, 1, &pred);
+	set_irn_n(succ, pos, new_r_Jmp(block));
+	keep_alive(block);
+	blocks[n_blocks++] = block;
+	dom_insert_block(block, succ);
+}
+
+static void count_block(ir_node *block, void *env)
+{
+	(void)block;
+	++*(int*)env;
+}
+
+int main(void)
+{
+	ir_init();
+
+	ir_graph *irg  = build_graph();
+	bool      fine = true;
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+
+	ir_node *idoms[MAX_BLOCKS];
+	int      depths[MAX_BLOCKS];
+	bool     dominates[MAX_BLOCKS];
+	for (int r = 0; r < N_ROUNDS && fine; ++r) {
+		for (int c = 0; c < N_CHANGES; ++c) {
+			switch (next_random(3)) {
+			case 0: delete_edge(irg);  break;
+			case 1: insert_edge();     break;
+			case 2: insert_block(irg); break;
+			}
+		}
+
+		int n_reachable = 0;
+		for (int i = 0; i < n_blocks; ++i) {
+			depths[i] = get_Block_dom_depth(blocks[i]);
+			idoms[i]  = depths[i] > 0 ? get_Block_idom(blocks[i]) : NULL;
+			if (depths[i] > 0)
+				++n_reachable;
+		}
+		for (int i = 0; i < n_blocks; ++i) {
+			ir_node *other = blocks[(i * 7 + r) % n_blocks];
+			dominates[i] = depths[i] > 0 && get_Block_dom_depth(other) > 0
+			               && block_dominates(blocks[i], other);
+		}
+		int n_in_tree = 0;
+		dom_tree_walk_irg(irg, count_block, NULL, &n_in_tree);
+
+		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
+		                        | IR_GRAPH_PROPERTY_CONSISTENT_OUTS);
+		assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+
+		/* the End block is in the tree, too */
+		if (n_in_tree != n_reachable + 1) {
+			printf("*** round %d: dominator tree has %d blocks instead of %d\n",
+			       r, n_in_tree, n_reachable + 1);
+			fine = false;
+		}
+		for (int i = 0; i < n_blocks; ++i) {
+			ir_node *block = blocks[i];
+			int      depth = get_Block_dom_depth(block);
+			ir_node *idom  = depth > 0 ? get_Block_idom(block) : NULL;
+			if ((depth > 0) != (depths[i] > 0) || idom != idoms[i]
+			    || (depth > 0 && depth != depths[i])) {
+				ir_printf("*** round %d: wrong dominator of %+F\n", r, block);
+				fine = false;
+			}
+			ir_node *other = blocks[(i * 7 + r) % n_blocks];
+			bool dom = depth > 0 && get_Block_dom_depth(other) > 0
+			           && block_dominates(block, other);
+			if (dom != dominates[i]) {
+				ir_printf("*** round %d: wrong dominance of %+F over %+F\n",
+				          r, block, other);
+				fine = false;
+			}
+		}
+	}
+
+	ir_finish();
+	return fine ? 0 : 1;
+}
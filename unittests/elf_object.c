@@ -0,0 +1,354 @@
+/*
+ * Write an ELF object file for a small amd64 program with be_main_object()
+ * and check its header, sections, symbols and relocations. Where a C
+ * compiler is available, the object is linked and run as well.
+ */
+#include "firm.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OBJECT_FILE "elf_object.o"
+#define MAIN_FILE   "elf_object_main.c"
+#define EXE_FILE    "elf_object_exe"
+
+enum {
+	EM_X86_64      = 62,
+	SHT_PROGBITS   = 1,
+	SHT_SYMTAB     = 2,
+	SHT_STRTAB     = 3,
+	SHT_RELA       = 4,
+	SHF_ALLOC      = 0x2,
+	SHF_EXECINSTR  = 0x4,
+	STB_GLOBAL     = 1,
+	STT_OBJECT     = 1,
+	STT_FUNC       = 2,
+	SHN_UNDEF      = 0,
+	SHDR_SIZE      = 64,
+	SYM_SIZE       = 24,
+	RELA_SIZE      = 24,
+};
+
+static ir_type *get_int_type(void)
+{
+	static ir_type *int_type;
+	if (int_type == NULL)
+		int_type = new_type_primitive(mode_Is);
+	return int_type;
+}
+
+static ir_entity *new_function(char const *name)
+{
+	ir_type *mtp = new_type_method(1, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, get_int_type());
+	set_method_res_type(mtp, 0, get_int_type());
+	return new_entity(get_glob_type(), new_id_from_str(name), mtp);
+}
+
+static void finish_graph(ir_graph *irg, ir_node *value)
+{
+	ir_node *ret = new_Return(get_store(), 1, &value);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+}
+
+/**
+ * int counter = 5;
+ * int ext_add(int x);
+ * int add3(int x) { return x + 3; }
+ * int call_ext(int x) { return ext_add(x) + counter; }
+ */
+static void build_program(void)
+{
+	ir_entity *counter = new_entity(get_glob_type(),
+	                                new_id_from_str("counter"),
+	                                get_int_type());
+	ir_tarval *five = new_tarval_from_long(5, mode_Is);
+	set_entity_initializer(counter, create_initializer_tarval(five));
+
+	ir_entity *ext_add = new_function("ext_add");
+
+	ir_graph *add3 = new_ir_graph(new_function("add3"), 0);
+	set_current_ir_graph(add3);
+	ir_node *x = new_Proj(get_irg_args(add3), mode_Is, 0);
+	finish_graph(add3, new_Add(x, new_Const_long(mode_Is, 3)));
+
+	ir_graph *call_ext = new_ir_graph(new_function("call_ext"), 0);
+	set_current_ir_graph(call_ext);
+	ir_node *arg  = new_Proj(get_irg_args(call_ext), mode_Is, 0);
+	ir_node *call = new_Call(get_store(), new_Address(ext_add), 1, &arg,
+	                         get_entity_type(ext_add));
+	set_store(new_Proj(call, mode_M, pn_Call_M));
+	ir_node *res  = new_Proj(new_Proj(call, mode_T, pn_Call_T_result),
+	                         mode_Is, 0);
+	ir_node *load = new_Load(get_store(), new_Address(counter), mode_Is,
+	                         get_int_type(), cons_none);
+	set_store(new_Proj(load, mode_M, pn_Load_M));
+	finish_graph(call_ext, new_Add(res, new_Proj(load, mode_Is, pn_Load_res)));
+}
+
+static uint64_t read_le(unsigned char const *p, unsigned size)
+{
+	uint64_t v = 0;
+	for (unsigned i = size; i-- > 0; )
+		v = v << 8 | p[i];
+	return v;
+}
+
+typedef struct object_t {
+	unsigned char *data;
+	long           size;
+	unsigned       n_sections;
+	unsigned char *sections;
+	char const    *shstrtab;
+} object_t;
+
+static unsigned char *section(object_t const *obj, unsigned i)
+{
+	return obj->sections + i * SHDR_SIZE;
+}
+
+static char const *section_name(object_t const *obj, unsigned i)
+{
+	return obj->shstrtab + read_le(section(obj, i), 4);
+}
+
+static unsigned find_section(object_t const *obj, char const *name)
+{
+	for (unsigned i = 1; i < obj->n_sections; ++i) {
+		if (strcmp(section_name(obj, i), name) == 0)
+			return i;
+	}
+	return 0;
+}
+
+static unsigned char *section_data(object_t const *obj, unsigned i)
+{
+	return obj->data + read_le(section(obj, i) + 24, 8);
+}
+
+static uint64_t section_size(object_t const *obj, unsigned i)
+{
+	return read_le(section(obj, i) + 32, 8);
+}
+
+static bool read_object(object_t *obj)
+{
+	FILE *file = fopen(OBJECT_FILE, "rb");
+	if (file == NULL)
+		return false;
+	fseek(file, 0, SEEK_END);
+	obj->size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	obj->data = (unsigned char*)malloc(obj->size);
+	bool const fine = fread(obj->data, 1, obj->size, file)
+	                  == (size_t)obj->size;
+	fclose(file);
+	if (!fine || obj->size < 64)
+		return false;
+
+	obj->n_sections = read_le(obj->data + 60, 2);
+	obj->sections   = obj->data + read_le(obj->data + 40, 8);
+	unsigned const shstrndx = read_le(obj->data + 62, 2);
+	obj->shstrtab = (char const*)section_data(obj, shstrndx);
+	return obj->sections + obj->n_sections * SHDR_SIZE
+	       <= obj->data + obj->size;
+}
+
+static bool check_header(object_t const *obj)
+{
+	unsigned char const *d = obj->data;
+	if (memcmp(d, "\177ELF", 4) != 0 || d[4] != 2 || d[5] != 1) {
+		printf("*** no little endian ELF64 file\n");
+		return false;
+	}
+	if (read_le(d + 16, 2) != 1 || read_le(d + 18, 2) != EM_X86_64) {
+		printf("*** no relocatable x86_64 object\n");
+		return false;
+	}
+	return true;
+}
+
+static bool check_sections(object_t const *obj)
+{
+	bool           fine = true;
+	unsigned const text = find_section(obj, ".text");
+	if (text == 0 || read_le(section(obj, text) + 4, 4) != SHT_PROGBITS
+	    || read_le(section(obj, text) + 8, 8)
+	       != (SHF_ALLOC | SHF_EXECINSTR)) {
+		printf("*** .text missing or wrong\n");
+		fine = false;
+	}
+	unsigned const data = find_section(obj, ".data");
+	if (data == 0 || section_size(obj, data) < 4
+	    || read_le(section_data(obj, data), 4) != 5) {
+		printf("*** .data does not hold the initializer of counter\n");
+		fine = false;
+	}
+	unsigned const symtab = find_section(obj, ".symtab");
+	if (symtab == 0 || read_le(section(obj, symtab) + 4, 4) != SHT_SYMTAB) {
+		printf("*** .symtab missing\n");
+		fine = false;
+	} else {
+		unsigned const strtab = read_le(section(obj, symtab) + 40, 4);
+		if (read_le(section(obj, strtab) + 4, 4) != SHT_STRTAB) {
+			printf("*** .symtab does not link to a string table\n");
+			fine = false;
+		}
+	}
+	unsigned const rela = find_section(obj, ".rela.text");
+	if (rela == 0 || read_le(section(obj, rela) + 4, 4) != SHT_RELA
+	    || read_le(section(obj, rela) + 44, 4) != text
+	    || read_le(section(obj, rela) + 40, 4) != symtab) {
+		printf("*** .rela.text missing or wrong\n");
+		fine = false;
+	}
+	return fine;
+}
+
+/** Returns the symbol table index of @p name, 0 if there is none. */
+static unsigned find_symbol(object_t const *obj, char const *name,
+                            unsigned char const **sym)
+{
+	unsigned const       symtab  = find_section(obj, ".symtab");
+	unsigned const       strtab  = read_le(section(obj, symtab) + 40, 4);
+	char const    *const strings = (char const*)section_data(obj, strtab);
+	unsigned char *const syms    = section_data(obj, symtab);
+	unsigned const       n_syms  = section_size(obj, symtab) / SYM_SIZE;
+	for (unsigned i = 1; i < n_syms; ++i) {
+		unsigned char *const s = syms + i * SYM_SIZE;
+		if (strcmp(strings + read_le(s, 4), name) == 0) {
+			*sym = s;
+			return i;
+		}
+	}
+	return 0;
+}
+
+static bool check_symbol(object_t const *obj, char const *name,
+                         unsigned type, unsigned shndx)
+{
+	unsigned char const *sym;
+	if (find_symbol(obj, name, &sym) == 0) {
+		printf("*** symbol %s missing\n", name);
+		return false;
+	}
+	unsigned const info = sym[4];
+	if (info >> 4 != STB_GLOBAL || (info & 0xF) != type
+	    || read_le(sym + 6, 2) != shndx) {
+		printf("*** symbol %s has the wrong binding, type or section\n",
+		       name);
+		return false;
+	}
+	return true;
+}
+
+static bool has_relocation(object_t const *obj, unsigned sym_idx)
+{
+	unsigned const       rela   = find_section(obj, ".rela.text");
+	unsigned char *const relocs = section_data(obj, rela);
+	unsigned const       n      = section_size(obj, rela) / RELA_SIZE;
+	for (unsigned i = 0; i < n; ++i) {
+		if (read_le(relocs + i * RELA_SIZE + 8, 8) >> 32 == sym_idx)
+			return true;
+	}
+	return false;
+}
+
+static bool check_symbols(object_t const *obj)
+{
+	unsigned const text = find_section(obj, ".text");
+	unsigned const data = find_section(obj, ".data");
+	bool fine = check_symbol(obj, "add3", STT_FUNC, text);
+	fine &= check_symbol(obj, "call_ext", STT_FUNC, text);
+	fine &= check_symbol(obj, "counter", STT_OBJECT, data);
+	if (!fine)
+		return false;
+
+	unsigned char const *sym;
+	unsigned const ext_add = find_symbol(obj, "ext_add", &sym);
+	if (ext_add == 0 || read_le(sym + 6, 2) != SHN_UNDEF) {
+		printf("*** ext_add is not an undefined symbol\n");
+		return false;
+	}
+	if (!has_relocation(obj, ext_add)) {
+		printf("*** the call of ext_add is not relocated\n");
+		return false;
+	}
+	if (!has_relocation(obj, find_symbol(obj, "counter", &sym))) {
+		printf("*** the load of counter is not relocated\n");
+		return false;
+	}
+	return true;
+}
+
+/** Links the object with a main function and runs it. */
+static bool check_linked(void)
+{
+	if (system("cc --version >/dev/null 2>&1") != 0) {
+		printf("no C compiler, object not linked\n");
+		return true;
+	}
+	FILE *file = fopen(MAIN_FILE, "w");
+	if (file == NULL)
+		return false;
+	fputs("extern int counter;\n"
+	      "int add3(int);\n"
+	      "int call_ext(int);\n"
+	      "int ext_add(int x) { return x * 2; }\n"
+	      "int main(void)\n"
+	      "{\n"
+	      "\tif (add3(4) != 7 || call_ext(10) != 25)\n"
+	      "\t\treturn 1;\n"
+	      "\tcounter = 1;\n"
+	      "\treturn call_ext(3) == 7 ? 0 : 1;\n"
+	      "}\n", file);
+	fclose(file);
+
+	bool fine = system("cc -no-pie -o " EXE_FILE " " MAIN_FILE " "
+	                   OBJECT_FILE) == 0;
+	if (!fine)
+		printf("*** linking the object failed\n");
+	else if (system("./" EXE_FILE) != 0) {
+		printf("*** the linked program computed wrong results\n");
+		fine = false;
+	}
+	remove(MAIN_FILE);
+	remove(EXE_FILE);
+	return fine;
+}
+
+int main(void)
+{
+	ir_init();
+	if (!ir_target_set("x86_64-linux-gnu")) {
+		printf("*** cannot set target\n");
+		return 1;
+	}
+	ir_target_init();
+	build_program();
+
+	FILE *output = fopen(OBJECT_FILE, "wb");
+	if (output == NULL || be_main_object(output, "elf_object.c") != 0) {
+		printf("*** writing the object file failed\n");
+		return 1;
+	}
+	fclose(output);
+	ir_finish();
+
+	object_t obj;
+	memset(&obj, 0, sizeof(obj));
+	bool fine = read_object(&obj);
+	if (!fine)
+		printf("*** object file truncated\n");
+	fine = fine && check_header(&obj) && check_sections(&obj)
+	       && check_symbols(&obj);
+	free(obj.data);
+	fine = fine && check_linked();
+
+	remove(OBJECT_FILE);
+	return fine ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+/*
+ * Check that the sparse solver for execution frequencies agrees with the
+ * dense one.
+ */
+#include "execfreq_t.h"
+#include "firm.h"
+#include "irgraph_t.h"
+#include "xmalloc.h"
+#include <assert.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+
+static unsigned seed;
+static ir_node *selector;
+
+static unsigned rand_next(void)
+{
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) & 0x7fff;
+}
+
+static ir_node *new_cond(void)
+{
+	ir_node *cmp = new_Cmp(selector, new_Const_long(mode_Is, rand_next()),
+	                       ir_relation_less);
+	return new_Cond(cmp);
+}
+
+/* Build a random structured statement in the current block. */
+static void build_stmt(int depth)
+{
+	unsigned kind = depth > 0 ? rand_next() % 5 : 0;
+	switch (kind) {
+	case 0:
+		return;
+
+	case 1: {
+		/* sequence */
+		build_stmt(depth - 1);
+		build_stmt(depth - 1);
+		return;
+	}
+
+	case 2: {
+		/* if-then-else */
+		ir_node *cond = new_cond();
+		ir_node *join = new_immBlock();
+		for (unsigned pn = pn_Cond_false; pn <= pn_Cond_true; ++pn) {
+			ir_node *branch = new_immBlock();
+			add_immBlock_pred(branch, new_Proj(cond, mode_X, pn));
+			mature_immBlock(branch);
+			set_cur_block(branch);
+			build_stmt(depth - 1);
+			add_immBlock_pred(join, new_Jmp());
+		}
+		mature_immBlock(join);
+		set_cur_block(join);
+		return;
+	}
+
+	case 3:
+	case 4: {
+		/* while loop, optionally with an additional exit from the body */
+		ir_node *head = new_immBlock();
+		add_immBlock_pred(head, new_Jmp());
+		set_cur_block(head);
+		ir_node *cond = new_cond();
+		ir_node *exit = new_immBlock();
+		add_immBlock_pred(exit, new_Proj(cond, mode_X, pn_Cond_false));
+		ir_node *body = new_immBlock();
+		add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_true));
+		mature_immBlock(body);
+		set_cur_block(body);
+		build_stmt(depth - 1);
+		if (kind == 4) {
+			ir_node *brk  = new_cond();
+			ir_node *cont = new_immBlock();
+			add_immBlock_pred(exit, new_Proj(brk, mode_X, pn_Cond_true));
+			add_immBlock_pred(cont, new_Proj(brk, mode_X, pn_Cond_false));
+			mature_immBlock(cont);
+			set_cur_block(cont);
+			build_stmt(depth - 1);
+		}
+		add_immBlock_pred(head, new_Jmp());
+		mature_immBlock(head);
+		mature_immBlock(exit);
+		set_cur_block(exit);
+		return;
+	}
+	}
+}
+
+static ir_graph *build_graph(unsigned graph_seed, int depth)
+{
+	char name[32];
+	snprintf(name, sizeof(name), "f%u", graph_seed);
+	ir_type *int_type = new_type_primitive(mode_Is);
+	ir_type *mtp      = new_type_method(1, 0, false, cc_cdecl_set,
+	                                    mtp_no_property);
+	set_method_param_type(mtp, 0, int_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 0);
+	set_current_ir_graph(irg);
+
+	seed     = graph_seed;
+	selector = new_Proj(get_irg_args(irg), mode_Is, 0);
+
+	/* an endless loop only reachable through a condition */
+	ir_node *cond  = new_cond();
+	ir_node *loop  = new_immBlock();
+	ir_node *entry = get_cur_block();
+	add_immBlock_pred(loop, new_Proj(cond, mode_X, pn_Cond_true));
+	set_cur_block(loop);
+	add_immBlock_pred(loop, new_Jmp());
+	mature_immBlock(loop);
+	keep_alive(loop);
+
+	ir_node *body = new_immBlock();
+	add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(body);
+	mature_immBlock(entry);
+	set_cur_block(body);
+	build_stmt(depth);
+
+	ir_node *ret = new_Return(get_store(), 0, NULL);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static double *freqs;
+static unsigned n_freqs;
+static unsigned n_checked;
+
+static void record_freq(ir_node *block, void *env)
+{
+	(void)env;
+	freqs[n_freqs++] = get_block_execfreq(block);
+}
+
+static void check_freq(ir_node *block, void *env)
+{
+	(void)env;
+	double const expected = freqs[n_checked++];
+	double const freq     = get_block_execfreq(block);
+	assert(fabs(freq - expected) <= 1e-6 * fmax(1.0, expected));
+}
+
+static void test_graph(unsigned graph_seed, int depth)
+{
+	ir_graph *irg = build_graph(graph_seed, depth);
+
+	ir_execfreq_dense_limit = UINT_MAX;
+	ir_estimate_execfreq(irg);
+	freqs   = XMALLOCN(double, get_irg_last_idx(irg));
+	n_freqs = 0;
+	irg_block_walk_graph(irg, record_freq, NULL, NULL);
+
+	ir_execfreq_dense_limit = 0;
+	ir_estimate_execfreq(irg);
+	n_checked = 0;
+	irg_block_walk_graph(irg, check_freq, NULL, NULL);
+	assert(n_checked == n_freqs);
+
+	free(freqs);
+}
+
+int main(void)
+{
+	ir_init();
+
+	for (unsigned i = 0; i < 50; ++i) {
+		test_graph(i, 2 + i % 5);
+	}
+
+	return 0;
+}
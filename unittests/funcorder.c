@@ -0,0 +1,265 @@
+/*
+ * Order the functions of a small call graph with a hand-set profile and
+ * check the symbol ordering file written with the funcorder-file option: a hot
+ * callee follows its caller, clusters go in order of decreasing density and
+ * the functions, which are still stubs of a lazily imported binary file,
+ * follow in program order. The assembly must contain the functions in the
+ * same order. libfirm cannot be initialized twice, so the lazy import runs in
+ * a child process: funcorder order <in>
+ */
+#include "firm.h"
+#include "irprofile.h"
+#include "irprog_t.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BINARY_FILE "funcorder.irb"
+#define ORDER_FILE  "funcorder.order"
+
+typedef struct func_t {
+	char const *name;
+	unsigned    entry; /**< profiled invocations */
+	bool        stub;  /**< never read from the file before code generation */
+} func_t;
+
+/* in program order */
+static func_t const funcs[] = {
+	{ "cold_caller", 1,    false },
+	{ "leaf_hot",    1000, false },
+	{ "unused_1",    0,    true  },
+	{ "hot_caller",  100,  false },
+	{ "leaf_cold",   1,    false },
+	{ "unused_2",    0,    true  },
+	{ "lonely",      0,    false },
+};
+#define N_FUNCS (sizeof(funcs) / sizeof(*funcs))
+
+static char const *const expected[] = {
+	"hot_caller", "leaf_hot", "cold_caller", "leaf_cold", "lonely",
+	"unused_1", "unused_2",
+};
+
+static ir_entity *entities[N_FUNCS];
+
+static ir_graph *new_func(size_t i, int n_locals)
+{
+	ir_graph *irg = new_ir_graph(entities[i], n_locals);
+	set_current_ir_graph(irg);
+	return irg;
+}
+
+static ir_node *call(size_t callee, ir_node *arg)
+{
+	ir_node *ptr  = new_Address(entities[callee]);
+	ir_node *res  = new_Call(get_store(), ptr, 1, &arg,
+	                         get_entity_type(entities[callee]));
+	set_store(new_Proj(res, mode_M, pn_Call_M));
+	ir_node *ress = new_Proj(res, mode_T, pn_Call_T_result);
+	return new_Proj(ress, mode_Is, 0);
+}
+
+static void finish_func(ir_node *value)
+{
+	ir_node *ret = new_Return(get_store(), 1, &value);
+	add_immBlock_pred(get_irg_end_block(get_current_ir_graph()), ret);
+	irg_finalize_cons(get_current_ir_graph());
+}
+
+/** int f(int n) { return n <op> c; } or a call of @p callee */
+static void build_simple(size_t i, ir_node *(*op)(ir_node*, ir_node*),
+                         long c, size_t callee)
+{
+	new_func(i, 0);
+	ir_node *n = new_Proj(get_irg_args(get_current_ir_graph()), mode_Is, 0);
+	if (callee != N_FUNCS)
+		n = call(callee, n);
+	finish_func(op(n, new_Const_long(mode_Is, c)));
+}
+
+/** int hot_caller(int n) { int s = 0; for (i < n) s += leaf_hot(i); } */
+static void build_loop(size_t i, size_t callee)
+{
+	ir_graph *irg = new_func(i, 2);
+	ir_node  *n   = new_Proj(get_irg_args(irg), mode_Is, 0);
+	set_value(0, new_Const_long(mode_Is, 0));
+	set_value(1, new_Const_long(mode_Is, 0));
+	ir_node *header = new_immBlock();
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(get_cur_block());
+
+	set_cur_block(header);
+	ir_node *cond = new_Cond(new_Cmp(get_value(0, mode_Is), n,
+	                                 ir_relation_less));
+	ir_node *body = new_immBlock();
+	ir_node *exit = new_immBlock();
+	add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_true));
+	add_immBlock_pred(exit, new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(body);
+	mature_immBlock(exit);
+
+	set_cur_block(body);
+	ir_node *i_val = get_value(0, mode_Is);
+	set_value(1, new_Add(get_value(1, mode_Is), call(callee, i_val)));
+	set_value(0, new_Add(i_val, new_Const_long(mode_Is, 1)));
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(header);
+
+	set_cur_block(exit);
+	finish_func(get_value(1, mode_Is));
+}
+
+static void build_program(void)
+{
+	/* int f(int n) */
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp = new_type_method(1, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	for (size_t i = 0; i < N_FUNCS; ++i) {
+		entities[i] = new_entity(get_glob_type(),
+		                         new_id_from_str(funcs[i].name), mtp);
+	}
+	build_simple(0, new_Add, 1, 4);
+	build_simple(1, new_Mul, 3, N_FUNCS);
+	build_simple(2, new_Sub, 1, N_FUNCS);
+	build_loop(3, 1);
+	build_simple(4, new_Add, 7, N_FUNCS);
+	build_simple(5, new_Eor, 5, N_FUNCS);
+	build_simple(6, new_Mul, 6, N_FUNCS);
+}
+
+static char *read_file(FILE *file)
+{
+	long const size = ftell(file);
+	char      *text = malloc(size + 1);
+	rewind(file);
+	if (fread(text, 1, size, file) != (size_t)size) {
+		free(text);
+		return NULL;
+	}
+	text[size] = '\0';
+	return text;
+}
+
+/** Compares the order of the symbols in @p text, each one following
+ * @p prefix, with the expected order. */
+static bool check_order(char const *what, char const *text, char const *prefix)
+{
+	char const *pos = text;
+	for (size_t i = 0; i < N_FUNCS; ++i) {
+		char const *next = strstr(pos, prefix);
+		size_t      len  = strlen(expected[i]);
+		if (next == NULL) {
+			printf("*** %s ends before %s\n", what, expected[i]);
+			return false;
+		}
+		next += strlen(prefix);
+		if (strncmp(next, expected[i], len) != 0 || next[len] != '\n') {
+			printf("*** %s has %.*s instead of %s\n", what,
+			       (int)strcspn(next, "\n"), next, expected[i]);
+			return false;
+		}
+		pos = next + len;
+	}
+	char const *rest = strstr(pos, prefix);
+	if (rest != NULL && rest[strlen(prefix)] != '\0') {
+		printf("*** %s has too many functions\n", what);
+		return false;
+	}
+	return true;
+}
+
+/** Reads the graphs, which have a profile, and generates code. The stubs
+ * stay unread until the backend gets to them. */
+static int order(char const *in)
+{
+	ir_init();
+	if (!ir_target_set("x86_64-linux-gnu")
+	    || ir_target_option("funcorder-file=" ORDER_FILE) != 1) {
+		printf("*** cannot set target\n");
+		return 1;
+	}
+	ir_target_init();
+	if (ir_import_binary_lazy(in) != 0) {
+		printf("*** import failed\n");
+		return 1;
+	}
+
+	for (size_t i = 0, n = get_irp_n_irgs(); i < n; ++i) {
+		ir_entity *const entity = get_irg_entity(get_irp_irg_or_stub(i));
+		for (size_t f = 0; f < N_FUNCS; ++f) {
+			if (funcs[f].stub
+			    || strcmp(get_entity_name(entity), funcs[f].name) != 0)
+				continue;
+			ir_graph *const irg = get_irp_irg(i);
+			ir_profile_set_block_execcount(get_irg_start_block(irg),
+			                               funcs[f].entry);
+		}
+	}
+
+	FILE *out = tmpfile();
+	be_main(out, "funcorder");
+	char *text = read_file(out);
+	fclose(out);
+	ir_finish();
+	if (text == NULL) {
+		printf("*** cannot read the assembly\n");
+		return 1;
+	}
+
+	bool fine = check_order("the assembly", text, "# -- Begin  ");
+	free(text);
+	return fine ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc == 3)
+		return order(argv[2]);
+
+	ir_init();
+	if (!ir_target_set("x86_64-linux-gnu")) {
+		printf("*** cannot set target\n");
+		return 1;
+	}
+	ir_target_init();
+	build_program();
+	/* the backend reads the stubs of a lowered program one by one */
+	be_lower_for_target();
+	int res = ir_export_binary(BINARY_FILE);
+	ir_finish();
+	if (res != 0) {
+		printf("*** export failed\n");
+		return 1;
+	}
+
+	char cmd[1024];
+	snprintf(cmd, sizeof(cmd), "\"%s\" order " BINARY_FILE, argv[0]);
+	bool fine = system(cmd) == 0;
+
+	FILE *order_file = fopen(ORDER_FILE, "r");
+	char *order      = NULL;
+	if (order_file != NULL) {
+		fseek(order_file, 0, SEEK_END);
+		order = read_file(order_file);
+		fclose(order_file);
+	}
+	if (order == NULL) {
+		printf("*** no symbol ordering file\n");
+		fine = false;
+	} else {
+		/* one symbol per line */
+		size_t const len = strlen(order) + 2;
+		char  *const lines = malloc(len);
+		snprintf(lines, len, "\n%s", order);
+		fine &= check_order("the symbol ordering file", lines, "\n");
+		free(lines);
+		free(order);
+	}
+
+	remove(BINARY_FILE);
+	remove(ORDER_FILE);
+	return fine ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+/*
+ * Stress test for concurrent identifier interning. Several threads intern
+ * the same symbol names in different orders and must all get the same ident
+ * for each name. Then distinct names are interned with one and with several
+ * threads to compare the throughput.
+ * Usage: ident_bench [n_names] [n_threads]
+ */
+#include "firm.h"
+#include "irthread.h"
+#include "xmalloc.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_THREADS 64
+
+typedef struct worker_t {
+	ir_thread_t  thread;
+	unsigned     id;
+	unsigned     n_threads;
+	unsigned     n_names;
+	char const  *prefix;
+	bool         shared;   /**< all threads intern all names */
+	ident      **ids;
+} worker_t;
+
+static void *intern_names(void *data)
+{
+	worker_t *const worker = (worker_t*)data;
+	unsigned  const n      = worker->n_names;
+	if (worker->shared) {
+		/* start at a different name in each thread, mixing both ways of
+		 * creating idents */
+		unsigned const start = (unsigned)((unsigned long)n * worker->id
+		                                  / worker->n_threads);
+		for (unsigned k = 0; k < n; ++k) {
+			unsigned const i = (start + k) % n;
+			if (k % 2 == 0) {
+				worker->ids[i] = new_id_fmt("%s_%u", worker->prefix, i);
+			} else {
+				char buf[64];
+				snprintf(buf, sizeof(buf), "%s_%u", worker->prefix, i);
+				worker->ids[i] = new_id_from_str(buf);
+			}
+		}
+	} else {
+		for (unsigned i = worker->id; i < n; i += worker->n_threads)
+			worker->ids[i] = new_id_fmt("%s_%u", worker->prefix, i);
+	}
+	return NULL;
+}
+
+static void run_workers(worker_t *workers, unsigned n_threads)
+{
+	for (unsigned t = 1; t < n_threads; ++t)
+		ir_thread_create(&workers[t].thread, intern_names, &workers[t]);
+	intern_names(&workers[0]);
+	for (unsigned t = 1; t < n_threads; ++t)
+		ir_thread_join(workers[t].thread);
+}
+
+static bool check_shared(unsigned n_names, unsigned n_threads)
+{
+	worker_t workers[MAX_THREADS];
+	for (unsigned t = 0; t < n_threads; ++t) {
+		workers[t] = (worker_t) {
+			.id = t, .n_threads = n_threads, .n_names = n_names,
+			.prefix = "shared", .shared = true,
+			.ids = XMALLOCNZ(ident*, n_names),
+		};
+	}
+	run_workers(workers, n_threads);
+
+	bool fine = true;
+	for (unsigned i = 0; i < n_names; ++i) {
+		char buf[64];
+		snprintf(buf, sizeof(buf), "shared_%u", i);
+		ident *const id = new_id_from_str(buf);
+		if (strcmp(get_id_str(id), buf) != 0)
+			fine = false;
+		for (unsigned t = 0; t < n_threads; ++t) {
+			if (workers[t].ids[i] != id)
+				fine = false;
+		}
+	}
+	for (unsigned t = 0; t < n_threads; ++t)
+		free(workers[t].ids);
+	return fine;
+}
+
+static int cmp_ident_ptr(void const *a, void const *b)
+{
+	uintptr_t const id_a = (uintptr_t)*(ident *const*)a;
+	uintptr_t const id_b = (uintptr_t)*(ident *const*)b;
+	return id_a < id_b ? -1 : id_a > id_b;
+}
+
+static double bench_distinct(char const *prefix, unsigned n_names,
+                             unsigned n_threads, bool *fine)
+{
+	ident **ids = XMALLOCNZ(ident*, n_names);
+	worker_t workers[MAX_THREADS];
+	for (unsigned t = 0; t < n_threads; ++t) {
+		workers[t] = (worker_t) {
+			.id = t, .n_threads = n_threads, .n_names = n_names,
+			.prefix = prefix, .shared = false, .ids = ids,
+		};
+	}
+	ir_timer_t *const timer = ir_timer_new();
+	ir_timer_start(timer);
+	run_workers(workers, n_threads);
+	ir_timer_stop(timer);
+	double const time = ir_timer_elapsed_sec(timer);
+	ir_timer_free(timer);
+
+	/* distinct names have distinct idents */
+	qsort(ids, n_names, sizeof(*ids), cmp_ident_ptr);
+	for (unsigned i = 1; i < n_names; ++i) {
+		if (ids[i] == ids[i - 1])
+			*fine = false;
+	}
+	free(ids);
+	return time;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned const n_names   = argc > 1 ? (unsigned)atoi(argv[1]) : 1000000;
+	unsigned       n_threads = argc > 2 ? (unsigned)atoi(argv[2]) : 4;
+	if (n_threads < 1)
+		n_threads = 1;
+	if (n_threads > MAX_THREADS)
+		n_threads = MAX_THREADS;
+
+	ir_init();
+
+	bool fine = true;
+	if (!check_shared(n_names, n_threads)) {
+		printf("*** Threads got different idents for the same name\n");
+		fine = false;
+	}
+
+	bool         distinct = true;
+	double const serial   = bench_distinct("serial", n_names, 1, &distinct);
+	double const parallel = bench_distinct("parallel", n_names, n_threads,
+	                                       &distinct);
+	if (!distinct) {
+		printf("*** Distinct names got the same ident\n");
+		fine = false;
+	}
+	printf("interning %u names\n", n_names);
+	printf("  1 thread   %8.1f ns/name\n", serial * 1e9 / n_names);
+	printf("  %u threads  %8.1f ns/name\n", n_threads,
+	       parallel * 1e9 / n_names);
+
+	ir_finish();
+	return fine ? 0 : 1;
+}
@@ -0,0 +1,249 @@
+/*
+ * Check that the explicit stack walkers visit the nodes in the same order as
+ * a recursive reference walker, then compare their speed on large graphs.
+ * A very deep graph checks that walking does not depend on the native stack.
+ * Walks over the graphs of an ir file (text or binary format) are timed as
+ * well if one is given. The graphs are walked once more after compact_graph().
+ * The unittests.irgwalk_bench_split variant is built with the in arrays
+ * behind the nodes instead of in front of them for comparison.
+ * Usage: irgwalk_bench [rounds] [file]
+ */
+#include "firm.h"
+#include "irgraph_t.h"
+#include "irnode_t.h"
+#include "xmalloc.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static unsigned seed;
+
+static unsigned rand_next(void)
+{
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) & 0x7fff;
+}
+
+static ir_graph *new_test_graph(char const *name)
+{
+	ir_type *int_type = new_type_primitive(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1, false, cc_cdecl_set,
+	                                    mtp_no_property);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 0);
+	set_current_ir_graph(irg);
+	return irg;
+}
+
+static void finish_test_graph(ir_graph *irg, ir_node *value)
+{
+	ir_node *ret = new_Return(get_store(), 1, &value);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+}
+
+/** Random DAG of arithmetic with @p n_nodes nodes, some of them kept alive. */
+static ir_graph *build_dag(unsigned graph_seed, unsigned n_nodes)
+{
+	char name[32];
+	snprintf(name, sizeof(name), "dag%u", graph_seed);
+	ir_graph *irg = new_test_graph(name);
+
+	seed = graph_seed;
+	ir_node **vals = XMALLOCN(ir_node*, n_nodes);
+	vals[0] = new_Proj(get_irg_args(irg), mode_Is, 0);
+	for (unsigned i = 1; i < n_nodes; ++i) {
+		/* mostly use recent values to get long dependency chains */
+		unsigned const window = i < 16 ? i : 16;
+		ir_node *const l = vals[i - 1 - rand_next() % window];
+		ir_node *const r = vals[rand_next() % i];
+		switch (rand_next() % 3) {
+		case 0:  vals[i] = new_Add(l, r); break;
+		case 1:  vals[i] = new_Sub(l, r); break;
+		default: vals[i] = new_Eor(l, new_Const_long(mode_Is, i)); break;
+		}
+		if (rand_next() % 64 == 0)
+			keep_alive(vals[i]);
+	}
+	finish_test_graph(irg, vals[n_nodes - 1]);
+	free(vals);
+	return irg;
+}
+
+/** A single chain of @p n_nodes additions. */
+static ir_graph *build_chain(unsigned n_nodes)
+{
+	ir_graph *irg   = new_test_graph("chain");
+	ir_node  *value = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_node  *one   = new_Const_long(mode_Is, 1);
+	for (unsigned i = 0; i < n_nodes; ++i)
+		value = new_Add(value, one);
+	finish_test_graph(irg, value);
+	return irg;
+}
+
+/* The recursive walker the explicit stack version replaced. */
+static void walk_recursive(ir_node *node, irg_walk_func *pre,
+                           irg_walk_func *post, void *env)
+{
+	ir_visited_t const visited = get_irn_irg(node)->visited;
+	set_irn_visited(node, visited);
+	if (pre != NULL)
+		pre(node, env);
+	if (!is_Block(node)) {
+		ir_node *block = get_nodes_block(node);
+		if (block->visited < visited)
+			walk_recursive(block, pre, post, env);
+	}
+	for (int i = get_irn_arity(node); i-- > 0; ) {
+		ir_node *pred = get_irn_n(node, i);
+		if (pred->visited < visited)
+			walk_recursive(pred, pre, post, env);
+	}
+	if (post != NULL)
+		post(node, env);
+}
+
+static void walk_recursive_graph(ir_graph *irg, irg_walk_func *pre,
+                                 irg_walk_func *post, void *env)
+{
+	inc_irg_visited(irg);
+	walk_recursive(get_irg_end(irg), pre, post, env);
+}
+
+typedef struct order_t {
+	ir_node **nodes;
+	unsigned  n;
+} order_t;
+
+static void record(ir_node *node, void *env)
+{
+	order_t *order = (order_t*)env;
+	order->nodes[order->n++] = node;
+}
+
+static void count(ir_node *node, void *env)
+{
+	(void)node;
+	++*(unsigned*)env;
+}
+
+typedef void (*graph_walker)(ir_graph *irg, irg_walk_func *pre,
+                             irg_walk_func *post, void *env);
+
+static void check_order(ir_graph *irg, bool use_pre, bool use_post)
+{
+	unsigned const n_idx = get_irg_last_idx(irg);
+	order_t expected = { XMALLOCN(ir_node*, 2 * n_idx), 0 };
+	order_t actual   = { XMALLOCN(ir_node*, 2 * n_idx), 0 };
+	irg_walk_func *const pre  = use_pre  ? record : NULL;
+	irg_walk_func *const post = use_post ? record : NULL;
+
+	walk_recursive_graph(irg, pre, post, &expected);
+	irg_walk_graph(irg, pre, post, &actual);
+	assert(expected.n == actual.n);
+	for (unsigned i = 0; i < expected.n; ++i)
+		assert(expected.nodes[i] == actual.nodes[i]);
+
+	free(actual.nodes);
+	free(expected.nodes);
+}
+
+static void bench(char const *name, graph_walker walker, ir_graph *irg,
+                  unsigned rounds)
+{
+	unsigned n_visits = 0;
+	clock_t const start = clock();
+	for (unsigned r = 0; r < rounds; ++r)
+		walker(irg, count, NULL, &n_visits);
+	clock_t const end = clock();
+	double const ns = (double)(end - start) / CLOCKS_PER_SEC * 1e9;
+	printf("  %-18s %6.2f ns/node\n", name, ns / n_visits);
+}
+
+static void walk_all_graphs(ir_graph *irg, irg_walk_func *pre,
+                            irg_walk_func *post, void *env)
+{
+	(void)irg;
+	foreach_irp_irg(i, other) {
+		irg_walk_graph(other, pre, post, env);
+	}
+}
+
+static void bench_file(char const *filename, unsigned rounds)
+{
+	size_t const len    = strlen(filename);
+	bool   const binary = len > 4 && strcmp(filename + len - 4, ".irb") == 0;
+	if ((binary ? ir_import_binary(filename) : ir_import(filename)) != 0) {
+		printf("*** could not import %s\n", filename);
+		exit(1);
+	}
+	unsigned n_nodes = 0;
+	foreach_irp_irg(i, irg) {
+		n_nodes += get_irg_last_idx(irg);
+	}
+	printf("walking %u nodes in %zu graphs of %s\n", n_nodes,
+	       get_irp_n_irgs(), filename);
+	bench("explicit stack", walk_all_graphs, NULL, rounds);
+	foreach_irp_irg(i, irg) {
+		compact_graph(irg);
+	}
+	bench("compacted", walk_all_graphs, NULL, rounds);
+}
+
+static void walk_prefetch_graph(ir_graph *irg, irg_walk_func *pre,
+                                irg_walk_func *post, void *env)
+{
+	set_irg_walk_mode(irg_walk_mode_prefetch);
+	irg_walk_graph(irg, pre, post, env);
+	set_irg_walk_mode(irg_walk_mode_default);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned rounds = argc > 1 ? (unsigned)atoi(argv[1]) : 3;
+
+	ir_init();
+	if (argc > 2) {
+		bench_file(argv[2], rounds);
+		ir_finish();
+		return 0;
+	}
+	/* keep the constructed graphs as they are */
+	set_optimize(0);
+
+	for (unsigned i = 0; i < 20; ++i) {
+		ir_graph *irg = build_dag(i, 50 + i * 50);
+		check_order(irg, true,  false);
+		check_order(irg, false, true);
+		check_order(irg, true,  true);
+		set_irg_walk_mode(irg_walk_mode_prefetch);
+		check_order(irg, true,  true);
+		set_irg_walk_mode(irg_walk_mode_default);
+	}
+
+	/* far deeper than the native stack would allow for the recursion */
+	ir_graph *chain    = build_chain(2000000);
+	unsigned  n_chain  = 0;
+	irg_walk_graph(chain, count, NULL, &n_chain);
+	assert(n_chain >= 2000000);
+
+	ir_graph *dag = build_dag(42, 200000);
+	printf("walking %u nodes\n", get_irg_last_idx(dag));
+	bench("recursive", walk_recursive_graph, dag, rounds);
+	bench("explicit stack", irg_walk_graph, dag, rounds);
+	bench("prefetch", walk_prefetch_graph, dag, rounds);
+	compact_graph(dag);
+	bench("compacted", irg_walk_graph, dag, rounds);
+
+	printf("walking a chain of %u nodes\n", n_chain);
+	bench("explicit stack", irg_walk_graph, chain, rounds);
+	bench("prefetch", walk_prefetch_graph, chain, rounds);
+
+	return 0;
+}
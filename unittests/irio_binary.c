@@ -0,0 +1,247 @@
+/*
+ * Export a program in the text and in the binary format, import both again
+ * and check that they describe the same program, by comparing the text
+ * export of the imported programs. libfirm cannot be initialized twice, so
+ * the imports run in child processes: irio_binary (text|binary) <in> <out>
+ * Then the binary file is imported lazily, and only the graphs not removed
+ * by garbage_collect_entities() must be read.
+ */
+#include "firm.h"
+#include "irprog_t.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEXT_FILE   "irio_binary.ir"
+#define BINARY_FILE "irio_binary.irb"
+#define N_CALLERS   20
+
+static ir_type *get_int_type(void)
+{
+	static ir_type *int_type;
+	if (int_type == NULL)
+		int_type = new_type_primitive(mode_Is);
+	return int_type;
+}
+
+static ir_type *new_int_method_type(void)
+{
+	ir_type *mtp = new_type_method(1, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, get_int_type());
+	set_method_res_type(mtp, 0, get_int_type());
+	return mtp;
+}
+
+/** int sum(int n) { int s = 0; for (int i = 0; i < n; ++i) s += i; return s; } */
+static ir_entity *build_sum(ir_type *mtp)
+{
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str("sum"), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 2);
+	set_current_ir_graph(irg);
+
+	ir_node *n = new_Proj(get_irg_args(irg), mode_Is, 0);
+	set_value(0, new_Const_long(mode_Is, 0));
+	set_value(1, new_Const_long(mode_Is, 0));
+	ir_node *start_block = get_cur_block();
+	ir_node *jmp         = new_Jmp();
+	mature_immBlock(start_block);
+
+	ir_node *header = new_immBlock();
+	add_immBlock_pred(header, jmp);
+	set_cur_block(header);
+	ir_node *cmp  = new_Cmp(get_value(1, mode_Is), n, ir_relation_less);
+	ir_node *cond = new_Cond(cmp);
+
+	ir_node *body = new_immBlock();
+	add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_true));
+	mature_immBlock(body);
+	set_cur_block(body);
+	set_value(0, new_Add(get_value(0, mode_Is), get_value(1, mode_Is)));
+	set_value(1, new_Add(get_value(1, mode_Is), new_Const_long(mode_Is, 1)));
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(header);
+
+	ir_node *exit = new_immBlock();
+	add_immBlock_pred(exit, new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(exit);
+	set_cur_block(exit);
+	ir_node *result = get_value(0, mode_Is);
+	ir_node *ret    = new_Return(get_store(), 1, &result);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+
+	irg_finalize_cons(irg);
+	return ent;
+}
+
+/** int caller_i(int x) { return sum(table[i % 3] + x) - i; } */
+static void build_caller(int i, ir_type *mtp, ir_entity *sum,
+                         ir_entity *table)
+{
+	char name[32];
+	snprintf(name, sizeof(name), "caller_%d", i);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 0);
+	set_current_ir_graph(irg);
+
+	ir_node *x      = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_mode *offset_mode = get_reference_offset_mode(mode_P);
+	ir_node *offset = new_Const_long(offset_mode, (i % 3) * 4);
+	ir_node *addr   = new_Add(new_Address(table), offset);
+	ir_node *load   = new_Load(get_store(), addr, mode_Is, get_int_type(),
+	                           cons_none);
+	set_store(new_Proj(load, mode_M, pn_Load_M));
+	ir_node *arg    = new_Add(new_Proj(load, mode_Is, pn_Load_res), x);
+	ir_node *call   = new_Call(get_store(), new_Address(sum), 1, &arg, mtp);
+	set_store(new_Proj(call, mode_M, pn_Call_M));
+	ir_node *results = new_Proj(call, mode_T, pn_Call_T_result);
+	ir_node *value   = new_Sub(new_Proj(results, mode_Is, 0),
+	                           new_Const_long(mode_Is, i));
+	ir_node *ret     = new_Return(get_store(), 1, &value);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+
+	irg_finalize_cons(irg);
+}
+
+static void build_program(void)
+{
+	ir_type *array = new_type_array(get_int_type(), 3);
+	set_type_size(array, 12);
+	set_type_state(array, layout_fixed);
+	ir_entity *table = new_entity(get_glob_type(), new_id_from_str("table"),
+	                              array);
+	set_entity_ld_ident(table, new_id_from_str("table \"with\"\n\tspaces"));
+	ir_initializer_t *init = create_initializer_compound(3);
+	for (int i = 0; i < 3; ++i) {
+		ir_tarval *tv = new_tarval_from_long(i * 10, mode_Is);
+		set_initializer_compound_value(init, i, create_initializer_tarval(tv));
+	}
+	set_entity_initializer(table, init);
+
+	ir_type   *mtp = new_int_method_type();
+	ir_entity *sum = build_sum(mtp);
+	for (int i = 0; i < N_CALLERS; ++i)
+		build_caller(i, mtp, sum, table);
+}
+
+static long file_size(char const *filename)
+{
+	FILE *file = fopen(filename, "rb");
+	if (file == NULL)
+		return -1;
+	fseek(file, 0, SEEK_END);
+	long const size = ftell(file);
+	fclose(file);
+	return size;
+}
+
+static char *read_file(char const *filename)
+{
+	long const size = file_size(filename);
+	FILE      *file = fopen(filename, "rb");
+	if (file == NULL)
+		return NULL;
+	char *data = (char*)malloc(size + 1);
+	size_t const n = fread(data, 1, size, file);
+	data[n] = '\0';
+	fclose(file);
+	return data;
+}
+
+/** Imports a file and writes it back in the text format. */
+static int import_and_export(char const *format, char const *in,
+                             char const *out)
+{
+	ir_init();
+	int res = strcmp(format, "binary") == 0 ? ir_import_binary(in)
+	                                        : ir_import(in);
+	if (res == 0)
+		res = ir_export(out);
+	ir_finish();
+	return res;
+}
+
+/** Imports a file lazily and removes all but one caller. */
+static int import_lazy(char const *in)
+{
+	ir_init();
+	int res = ir_import_binary_lazy(in);
+	if (res == 0 && (get_irp_n_irgs() != N_CALLERS + 1
+	                 || irp->n_stub_irgs != N_CALLERS + 1))
+		res = 1;
+
+	ir_type *const glob = get_glob_type();
+	for (size_t i = 0, n = get_compound_n_members(glob); i < n; ++i) {
+		ir_entity *const ent = get_compound_member(glob, i);
+		if (is_method_entity(ent) && strcmp(get_entity_name(ent), "caller_0")
+		                             != 0)
+			set_entity_visibility(ent, ir_visibility_local);
+	}
+	garbage_collect_entities();
+
+	/* caller_0 and sum are read, the other callers are freed as stubs */
+	if (get_irp_n_irgs() != 2 || irp->n_stub_irgs != 0)
+		res = 1;
+	foreach_irp_irg(i, irg) {
+		if (!irg_verify(irg))
+			res = 1;
+	}
+	ir_finish();
+	return res;
+}
+
+/** Runs this program with the given arguments in a new process. */
+static bool run_self(char const *self, char const *args)
+{
+	char cmd[1024];
+	snprintf(cmd, sizeof(cmd), "\"%s\" %s", self, args);
+	return system(cmd) == 0;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc == 4)
+		return import_and_export(argv[1], argv[2], argv[3]);
+	if (argc == 3)
+		return import_lazy(argv[2]);
+
+	ir_init();
+	build_program();
+	int res = ir_export(TEXT_FILE);
+	res |= ir_export_binary(BINARY_FILE);
+	ir_finish();
+	if (res != 0) {
+		printf("*** export failed\n");
+		return 1;
+	}
+
+	if (!run_self(argv[0], "text " TEXT_FILE " " TEXT_FILE ".text")
+	    || !run_self(argv[0], "binary " BINARY_FILE " " TEXT_FILE ".binary")) {
+		printf("*** import failed\n");
+		return 1;
+	}
+	bool const lazy_ok = run_self(argv[0], "lazy " BINARY_FILE);
+	if (!lazy_ok)
+		printf("*** lazy import failed\n");
+
+	char *from_text   = read_file(TEXT_FILE ".text");
+	char *from_binary = read_file(TEXT_FILE ".binary");
+	bool const same = from_text != NULL && from_binary != NULL
+	                  && strcmp(from_text, from_binary) == 0;
+	if (!same)
+		printf("*** binary import differs from text import\n");
+
+	long const text_size   = file_size(TEXT_FILE);
+	long const binary_size = file_size(BINARY_FILE);
+	printf("text %ld bytes, binary %ld bytes\n", text_size, binary_size);
+
+	free(from_text);
+	free(from_binary);
+	remove(TEXT_FILE);
+	remove(BINARY_FILE);
+	remove(TEXT_FILE ".text");
+	remove(TEXT_FILE ".binary");
+	return same && lazy_ok && binary_size < text_size ? 0 : 1;
+}
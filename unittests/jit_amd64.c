@@ -0,0 +1,277 @@
+/*
+ * JIT compile a few amd64 functions with the binary encoder, load them into
+ * executable memory and check their results: arithmetic, a call of a host
+ * function, a switch and branches around code too large for 8 bit jump
+ * displacements.
+ */
+#include "firm.h"
+#include "jit.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define N_CHAIN 40
+
+static long const switch_cases[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 100, 200, 1000, -5,
+};
+#define N_CASES (sizeof(switch_cases) / sizeof(*switch_cases))
+
+static ir_entity *new_function(char const *name, ir_mode *mode,
+                               size_t n_params)
+{
+	ir_type *type = get_type_for_mode(mode);
+	ir_type *mtp  = new_type_method(n_params, 1, false, cc_cdecl_set,
+	                                mtp_no_property);
+	for (size_t i = 0; i < n_params; ++i)
+		set_method_param_type(mtp, i, type);
+	set_method_res_type(mtp, 0, type);
+	return new_entity(get_glob_type(), new_id_from_str(name), mtp);
+}
+
+static ir_graph *new_graph(ir_entity *entity)
+{
+	ir_graph *irg = new_ir_graph(entity, 1);
+	set_current_ir_graph(irg);
+	return irg;
+}
+
+static ir_node *new_arg(ir_graph *irg, ir_mode *mode, unsigned n)
+{
+	return new_Proj(get_irg_args(irg), mode, n);
+}
+
+static void new_return(ir_node *value)
+{
+	ir_node *ret = new_Return(get_store(), 1, &value);
+	add_immBlock_pred(get_irg_end_block(get_current_ir_graph()), ret);
+}
+
+static void finish_graph(ir_graph *irg)
+{
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+}
+
+static ir_node *new_div(ir_node *a, ir_node *b)
+{
+	ir_node *div = new_Div(get_store(), a, b, false);
+	set_store(new_Proj(div, mode_M, pn_Div_M));
+	return new_Proj(div, get_irn_mode(a), pn_Div_res);
+}
+
+static ir_node *new_mod(ir_node *a, ir_node *b)
+{
+	ir_node *mod = new_Mod(get_store(), a, b, false);
+	set_store(new_Proj(mod, mode_M, pn_Mod_M));
+	return new_Proj(mod, get_irn_mode(a), pn_Mod_res);
+}
+
+/** long arith(long a, long b)
+ * { return a / b * (a % b) + ((a & b) ^ (a << 3 | b >> 1)) + ~b; } */
+static long ref_arith(long a, long b)
+{
+	return a / b * (a % b) + ((a & b) ^ (a << 3 | b >> 1)) + ~b;
+}
+
+static ir_graph *build_arith(void)
+{
+	ir_graph *irg = new_graph(new_function("arith", mode_Ls, 2));
+	ir_node  *a   = new_arg(irg, mode_Ls, 0);
+	ir_node  *b   = new_arg(irg, mode_Ls, 1);
+	ir_node  *one = new_Const_long(mode_Iu, 1);
+	ir_node  *bits = new_Or(new_Shl(a, new_Const_long(mode_Iu, 3)),
+	                        new_Shrs(b, one));
+	ir_node  *res = new_Mul(new_div(a, b), new_mod(a, b));
+	res = new_Add(res, new_Eor(new_And(a, b), bits));
+	new_return(new_Add(res, new_Not(b)));
+	finish_graph(irg);
+	return irg;
+}
+
+static int twice(int x)
+{
+	return 2 * x;
+}
+
+/** int call_twice(int x) { return twice(x) + twice(x + 1); } */
+static ir_graph *build_call(ir_entity *callee)
+{
+	ir_graph *irg = new_graph(new_function("call_twice", mode_Is, 1));
+	ir_node  *x   = new_arg(irg, mode_Is, 0);
+	ir_node  *args[] = { x, new_Add(x, new_Const_long(mode_Is, 1)) };
+	ir_node  *sum = NULL;
+	for (size_t i = 0; i < 2; ++i) {
+		ir_node *call = new_Call(get_store(), new_Address(callee), 1,
+		                         &args[i], get_entity_type(callee));
+		set_store(new_Proj(call, mode_M, pn_Call_M));
+		ir_node *res = new_Proj(new_Proj(call, mode_T, pn_Call_T_result),
+		                        mode_Is, 0);
+		sum = sum == NULL ? res : new_Add(sum, res);
+	}
+	new_return(sum);
+	finish_graph(irg);
+	return irg;
+}
+
+/** int select(int x) returns 7 * (i + 1) + 3 for switch_cases[i], else -1 */
+static ir_graph *build_switch(void)
+{
+	ir_graph        *irg   = new_graph(new_function("select", mode_Is, 1));
+	ir_node         *x     = new_arg(irg, mode_Is, 0);
+	ir_switch_table *table = ir_new_switch_table(irg, N_CASES);
+	for (size_t i = 0; i < N_CASES; ++i) {
+		ir_tarval *tv = new_tarval_from_long(switch_cases[i], mode_Is);
+		ir_switch_table_set(table, i, tv, tv, i + 1);
+	}
+	ir_node *sw = new_Switch(x, N_CASES + 1, table);
+	mature_immBlock(get_cur_block());
+	for (size_t i = 0; i <= N_CASES; ++i) {
+		ir_node *block = new_immBlock();
+		add_immBlock_pred(block, new_Proj(sw, mode_X, i));
+		mature_immBlock(block);
+		set_cur_block(block);
+		new_return(new_Const_long(mode_Is, i == 0 ? -1 : 7 * (long)i + 3));
+	}
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+/** Both branches of x < y compute a long chain v = v * y + i, so the
+ * conditional jump has to skip more than 127 bytes of code. */
+static long ref_far(long x, long y)
+{
+	unsigned long v = x;
+	for (long i = 0; i < N_CHAIN; ++i)
+		v = x < y ? v * y + i : v * x - i;
+	return (long)v;
+}
+
+static ir_node *build_chain(ir_node *v, ir_node *factor, bool add)
+{
+	for (long i = 0; i < N_CHAIN; ++i) {
+		ir_node *c = new_Const_long(mode_Ls, i);
+		v = new_Mul(v, factor);
+		v = add ? new_Add(v, c) : new_Sub(v, c);
+	}
+	return v;
+}
+
+static ir_graph *build_far(void)
+{
+	ir_graph *irg  = new_graph(new_function("far", mode_Ls, 2));
+	ir_node  *x    = new_arg(irg, mode_Ls, 0);
+	ir_node  *y    = new_arg(irg, mode_Ls, 1);
+	ir_node  *cond = new_Cond(new_Cmp(x, y, ir_relation_less));
+	mature_immBlock(get_cur_block());
+
+	ir_node *then_block = new_immBlock();
+	add_immBlock_pred(then_block, new_Proj(cond, mode_X, pn_Cond_true));
+	mature_immBlock(then_block);
+	set_cur_block(then_block);
+	new_return(build_chain(x, y, true));
+
+	ir_node *else_block = new_immBlock();
+	add_immBlock_pred(else_block, new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(else_block);
+	set_cur_block(else_block);
+	new_return(build_chain(x, x, false));
+
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static void *load(ir_jit_segment_t *segment, ir_graph *irg, unsigned *size)
+{
+	ir_jit_function_t *function = be_jit_compile(segment, irg);
+	if (function == NULL)
+		return NULL;
+	*size = be_get_function_size(function);
+	return be_jit_load_function(segment, function);
+}
+
+int main(void)
+{
+	ir_init();
+	if (!ir_target_set("x86_64-linux-gnu")) {
+		printf("*** cannot set target\n");
+		return 1;
+	}
+	ir_target_init();
+
+	ir_entity *twice_entity = new_function("twice", mode_Is, 1);
+	ir_graph  *arith        = build_arith();
+	ir_graph  *call         = build_call(twice_entity);
+	ir_graph  *sel          = build_switch();
+	ir_graph  *far          = build_far();
+	be_lower_for_target();
+
+	int (*twice_func)(int) = twice;
+	void const *twice_addr;
+	memcpy(&twice_addr, &twice_func, sizeof(twice_addr));
+	be_jit_set_entity_addr(twice_entity, twice_addr);
+
+	ir_jit_segment_t *segment = be_new_jit_segment();
+	unsigned sizes[4];
+	void *code[4] = {
+		load(segment, arith, &sizes[0]), load(segment, call, &sizes[1]),
+		load(segment, sel, &sizes[2]), load(segment, far, &sizes[3]),
+	};
+	bool fine = true;
+	for (size_t i = 0; i < 4; ++i) {
+		if (code[i] == NULL) {
+			printf("*** function %zu could not be compiled\n", i);
+			fine = false;
+		}
+	}
+
+	if (fine && sizes[3] < 2 * 128) {
+		printf("*** far has only %u bytes, its jumps need no relaxation\n",
+		       sizes[3]);
+		fine = false;
+	}
+
+	if (fine) {
+		long (*arith_func)(long, long);
+		int  (*call_func)(int);
+		int  (*sel_func)(int);
+		long (*far_func)(long, long);
+		memcpy(&arith_func, &code[0], sizeof(code[0]));
+		memcpy(&call_func,  &code[1], sizeof(code[1]));
+		memcpy(&sel_func,   &code[2], sizeof(code[2]));
+		memcpy(&far_func,   &code[3], sizeof(code[3]));
+
+		long const pairs[][2] = { { 1234567, 89 }, { -100, 7 }, { 5, -3 } };
+		for (size_t i = 0; i < 3; ++i) {
+			long const a = pairs[i][0];
+			long const b = pairs[i][1];
+			if (arith_func(a, b) != ref_arith(a, b)) {
+				printf("*** arith(%ld, %ld) is wrong\n", a, b);
+				fine = false;
+			}
+			if (far_func(a, b) != ref_far(a, b)
+			    || far_func(b, a) != ref_far(b, a)) {
+				printf("*** far(%ld, %ld) is wrong\n", a, b);
+				fine = false;
+			}
+		}
+		if (call_func(20) != 82) {
+			printf("*** call_twice(20) is wrong\n");
+			fine = false;
+		}
+		for (size_t i = 0; i < N_CASES; ++i) {
+			if (sel_func((int)switch_cases[i]) != 7 * (int)(i + 1) + 3) {
+				printf("*** select(%ld) is wrong\n", switch_cases[i]);
+				fine = false;
+			}
+		}
+		if (sel_func(12345) != -1 || sel_func(10) != -1) {
+			printf("*** select misses the default case\n");
+			fine = false;
+		}
+	}
+
+	be_destroy_jit_segment(segment);
+	ir_finish();
+	return fine ? 0 : 1;
+}
@@ -0,0 +1,211 @@
+/*
+ * Vectorize the loop of
+ * void add(int *a, int *b, int *c, int n) { for (i < n) a[i] = b[i] + c[i]; }
+ * and check that vectorize_loops() creates a vector loop, a runtime overlap
+ * guard and keeps the scalar loop for the remaining iterations. The function
+ * is JIT compiled for amd64 and run with trip counts which are not a multiple
+ * of the number of vector elements and with overlapping arrays.
+ */
+#include "firm.h"
+#include "jit.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define N_ELEMS 20
+
+typedef struct counts_t {
+	unsigned vector_loads;
+	unsigned vector_stores;
+	unsigned scalar_loads;
+	unsigned scalar_stores;
+	unsigned overlap_checks;
+} counts_t;
+
+/** void add(int *a, int *b, int *c, int n) */
+static ir_graph *build_add(void)
+{
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *ptr_type = new_type_pointer(int_type);
+	ir_type *mtp = new_type_method(4, 0, false, cc_cdecl_set, mtp_no_property);
+	for (size_t i = 0; i < 3; ++i)
+		set_method_param_type(mtp, i, ptr_type);
+	set_method_param_type(mtp, 3, int_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str("add"), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 1);
+	set_current_ir_graph(irg);
+
+	ir_node *args = get_irg_args(irg);
+	ir_node *a    = new_Proj(args, mode_P, 0);
+	ir_node *b    = new_Proj(args, mode_P, 1);
+	ir_node *c    = new_Proj(args, mode_P, 2);
+	ir_node *n    = new_Proj(args, mode_Is, 3);
+	set_value(0, new_Const_long(mode_Is, 0));
+	ir_node *header = new_immBlock();
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(get_cur_block());
+
+	set_cur_block(header);
+	ir_node *cond = new_Cond(new_Cmp(get_value(0, mode_Is), n,
+	                                 ir_relation_less));
+	ir_node *body = new_immBlock();
+	ir_node *exit = new_immBlock();
+	add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_true));
+	add_immBlock_pred(exit, new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(body);
+	mature_immBlock(exit);
+
+	set_cur_block(body);
+	ir_mode *offset_mode = get_reference_offset_mode(mode_P);
+	ir_node *i      = get_value(0, mode_Is);
+	ir_node *offset = new_Mul(new_Conv(i, offset_mode),
+	                          new_Const_long(offset_mode, 4));
+	ir_node *lb = new_Load(get_store(), new_Add(b, offset), mode_Is, int_type,
+	                       cons_none);
+	set_store(new_Proj(lb, mode_M, pn_Load_M));
+	ir_node *lc = new_Load(get_store(), new_Add(c, offset), mode_Is, int_type,
+	                       cons_none);
+	set_store(new_Proj(lc, mode_M, pn_Load_M));
+	ir_node *sum = new_Add(new_Proj(lb, mode_Is, pn_Load_res),
+	                       new_Proj(lc, mode_Is, pn_Load_res));
+	ir_node *st  = new_Store(get_store(), new_Add(a, offset), sum, int_type,
+	                         cons_none);
+	set_store(new_Proj(st, mode_M, pn_Store_M));
+	set_value(0, new_Add(i, new_Const_long(mode_Is, 1)));
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(header);
+
+	set_cur_block(exit);
+	ir_node *ret = new_Return(get_store(), 0, NULL);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static void count_node(ir_node *node, void *env)
+{
+	counts_t *counts = (counts_t*)env;
+	if (is_Load(node)) {
+		if (mode_is_vector(get_Load_mode(node)))
+			++counts->vector_loads;
+		else
+			++counts->scalar_loads;
+	} else if (is_Store(node)) {
+		if (mode_is_vector(get_irn_mode(get_Store_value(node))))
+			++counts->vector_stores;
+		else
+			++counts->scalar_stores;
+	} else if (is_Cmp(node)) {
+		/* the overlap checks compare the biased distance of two arrays
+		 * unsigned */
+		ir_node *left = get_Cmp_left(node);
+		if (is_Conv(left) && !mode_is_signed(get_irn_mode(left)))
+			++counts->overlap_checks;
+	}
+}
+
+static unsigned count_innermost_loops(ir_loop *loop)
+{
+	unsigned n_loops = 0;
+	for (size_t i = 0, n = get_loop_n_elements(loop); i < n; ++i) {
+		loop_element element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_loop)
+			n_loops += count_innermost_loops(element.son);
+	}
+	return n_loops == 0 ? 1 : n_loops;
+}
+
+static bool check_graph(ir_graph *irg)
+{
+	counts_t counts;
+	memset(&counts, 0, sizeof(counts));
+	irg_walk_graph(irg, count_node, NULL, &counts);
+
+	bool fine = true;
+	if (counts.vector_loads != 2 || counts.vector_stores != 1) {
+		printf("*** no vector loop with 2 vector loads and 1 vector store\n");
+		fine = false;
+	}
+	if (counts.scalar_loads != 2 || counts.scalar_stores != 1) {
+		printf("*** the scalar loop for the remaining iterations is gone\n");
+		fine = false;
+	}
+	/* a overlapping b and a overlapping c */
+	if (counts.overlap_checks != 2) {
+		printf("*** %u instead of 2 runtime overlap checks\n",
+		       counts.overlap_checks);
+		fine = false;
+	}
+
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO);
+	if (count_innermost_loops(get_irg_loop(irg)) != 2) {
+		printf("*** vector loop and scalar loop are not separate loops\n");
+		fine = false;
+	}
+	return fine;
+}
+
+typedef void (*add_func)(int *a, int *b, int *c, int n);
+
+/** Runs the compiled function on arrays which start at the given element of
+ * one buffer and compares the result with the scalar loop. */
+static bool check_run(add_func func, int n, int a_pos, int b_pos)
+{
+	int buffer[2 * N_ELEMS];
+	int expected[2 * N_ELEMS];
+	int c[N_ELEMS];
+	for (int i = 0; i < 2 * N_ELEMS; ++i)
+		buffer[i] = expected[i] = 3 * i + 1;
+	for (int i = 0; i < N_ELEMS; ++i)
+		c[i] = 100 * i;
+	for (int i = 0; i < n; ++i)
+		expected[a_pos + i] = expected[b_pos + i] + c[i];
+
+	func(buffer + a_pos, buffer + b_pos, c, n);
+	if (memcmp(buffer, expected, sizeof(buffer)) != 0) {
+		printf("*** add with n = %d, a = buffer + %d, b = buffer + %d "
+		       "is wrong\n", n, a_pos, b_pos);
+		return false;
+	}
+	return true;
+}
+
+int main(void)
+{
+	ir_init();
+	if (!ir_target_set("x86_64-linux-gnu")) {
+		printf("*** cannot set target\n");
+		return 1;
+	}
+	ir_target_init();
+
+	ir_graph *irg = build_add();
+	vectorize_loops(irg);
+	irg_verify(irg);
+	bool fine = check_graph(irg);
+
+	be_lower_for_target();
+	ir_jit_segment_t  *segment  = be_new_jit_segment();
+	ir_jit_function_t *function = be_jit_compile(segment, irg);
+	if (function == NULL) {
+		printf("*** add could not be compiled\n");
+		fine = false;
+	} else {
+		void    *code = be_jit_load_function(segment, function);
+		add_func func;
+		memcpy(&func, &code, sizeof(code));
+		/* with 4 elements per vector: too few for a vector, one or two
+		 * vectors and a remainder, four vectors */
+		static int const trip_counts[] = { 0, 3, 6, 11, 16 };
+		for (size_t i = 0; i < sizeof(trip_counts) / sizeof(*trip_counts); ++i)
+			fine &= check_run(func, trip_counts[i], 0, N_ELEMS);
+		/* the guard has to keep overlapping arrays in the scalar loop */
+		fine &= check_run(func, 11, 1, 0);
+		fine &= check_run(func, 11, 0, 2);
+		fine &= check_run(func, 11, 5, 5);
+	}
+
+	be_destroy_jit_segment(segment);
+	ir_finish();
+	return fine ? 0 : 1;
+}
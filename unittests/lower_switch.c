@@ -0,0 +1,111 @@
+/*
+ * Check that lower_switch() keeps a jump table for dense cases, tests cases
+ * in a small range with a bit mask and compares sparse cases one by one.
+ */
+#include "firm.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+/** int f(int x) { switch (x) { case values[i]: return pns[i]; } return 0; } */
+static ir_graph *build_switch(char const *name, long const *values,
+                              unsigned const *pns, unsigned n_cases,
+                              unsigned n_outs)
+{
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp = new_type_method(1, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 0);
+	set_current_ir_graph(irg);
+
+	ir_switch_table *table = ir_new_switch_table(irg, n_cases);
+	for (unsigned i = 0; i < n_cases; ++i) {
+		ir_tarval *value = new_tarval_from_long(values[i], mode_Is);
+		ir_switch_table_set(table, i, value, value, pns[i]);
+	}
+	ir_node *selector = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_node *switchn  = new_Switch(selector, n_outs, table);
+	mature_immBlock(get_cur_block());
+
+	for (unsigned pn = 0; pn < n_outs; ++pn) {
+		ir_node *block = new_immBlock();
+		add_immBlock_pred(block, new_Proj(switchn, mode_X, pn));
+		mature_immBlock(block);
+		set_cur_block(block);
+		ir_node *in[] = { new_Const_long(mode_Is, pn) };
+		ir_node *ret  = new_Return(get_store(), ARRAY_SIZE(in), in);
+		add_immBlock_pred(get_irg_end_block(irg), ret);
+	}
+	mature_immBlock(get_irg_end_block(irg));
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+typedef struct counts_t {
+	unsigned n_switches;
+	unsigned n_ands;
+} counts_t;
+
+static void count_nodes(ir_node *node, void *env)
+{
+	counts_t *const counts = (counts_t*)env;
+	if (is_Switch(node))
+		++counts->n_switches;
+	else if (is_And(node))
+		++counts->n_ands;
+}
+
+static bool check(ir_graph *irg, unsigned n_switches, unsigned n_ands)
+{
+	lower_switch(irg, 4, 256, mode_Iu);
+	counts_t counts = { 0, 0 };
+	irg_walk_graph(irg, count_nodes, NULL, &counts);
+	if (counts.n_switches != n_switches || counts.n_ands != n_ands) {
+		ir_printf("*** %+F: %u Switches and %u bit tests instead of %u and "
+		          "%u\n", irg, counts.n_switches, counts.n_ands, n_switches,
+		          n_ands);
+		return false;
+	}
+	if (!irg_verify(irg)) {
+		ir_printf("*** %+F does not verify\n", irg);
+		return false;
+	}
+	return true;
+}
+
+int main(void)
+{
+	ir_init();
+
+	bool fine = true;
+
+	static long const     dense_values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	static unsigned const dense_pns[]    = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+	fine &= check(build_switch("dense", dense_values, dense_pns,
+	                           ARRAY_SIZE(dense_values), 11), 1, 0);
+
+	static long const     odd_values[] = { 1, 3, 5, 7 };
+	static unsigned const odd_pns[]    = { 1, 1, 1, 1 };
+	fine &= check(build_switch("odd", odd_values, odd_pns,
+	                           ARRAY_SIZE(odd_values), 2), 0, 1);
+
+	static long const     sparse_values[] = { -4000, 0, 1000, 2000, 3000 };
+	static unsigned const sparse_pns[]    = { 1, 2, 3, 4, 5 };
+	fine &= check(build_switch("sparse", sparse_values, sparse_pns,
+	                           ARRAY_SIZE(sparse_values), 6), 0, 0);
+
+	/* two dense ranges far apart become two jump tables */
+	static long const     split_values[] = { 0, 1, 2, 3, 4, 5,
+	                                         1000, 1001, 1002, 1003, 1004 };
+	static unsigned const split_pns[]    = { 1, 2, 3, 4, 5, 6,
+	                                         1, 2, 3, 4, 5 };
+	fine &= check(build_switch("split", split_values, split_pns,
+	                           ARRAY_SIZE(split_values), 7), 2, 0);
+
+	ir_finish();
+	return fine ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+/*
+ * Check that out edges stay consistent while many inputs are changed, that
+ * compaction frees the outgrown edge arrays and that reactivated edges do not
+ * see edges of the earlier activation.
+ */
+#include "firm.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define N_USERS  200
+#define N_ROUNDS 50
+
+static ir_node *users[N_USERS];
+
+/** int f(int x, int y) { return (x + 1) + (x + 2) + ... } */
+static ir_graph *build_graph(ir_node **x, ir_node **y)
+{
+	ir_type *int_type = new_type_primitive(mode_Is);
+	ir_type *mtp = new_type_method(2, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_param_type(mtp, 1, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str("f"), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 0);
+	set_current_ir_graph(irg);
+
+	*x = new_Proj(get_irg_args(irg), mode_Is, 0);
+	*y = new_Proj(get_irg_args(irg), mode_Is, 1);
+	/* y gets users later, so it must have its edges from the start */
+	keep_alive(*y);
+	ir_node *sum = NULL;
+	for (int i = 0; i < N_USERS; ++i) {
+		users[i] = new_Add(*x, new_Const_long(mode_Is, i + 1));
+		sum      = sum == NULL ? users[i] : new_Add(sum, users[i]);
+	}
+	ir_node *ret = new_Return(get_store(), 1, &sum);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static int count_out_edges(ir_node const *node)
+{
+	int n = 0;
+	foreach_out_edge(node, edge) {
+		assert(get_irn_n(get_edge_src_irn(edge), get_edge_src_pos(edge))
+		       == node);
+		++n;
+	}
+	return n;
+}
+
+/** Checks the number of users of x and y besides the keep-alive of y. */
+static bool check_counts(ir_node *x, int n_x, ir_node *y, int n_y)
+{
+	++n_y;
+	return get_irn_n_edges(x) == n_x && count_out_edges(x) == n_x
+	    && get_irn_n_edges(y) == n_y && count_out_edges(y) == n_y;
+}
+
+int main(void)
+{
+	ir_init();
+
+	ir_node  *x;
+	ir_node  *y;
+	ir_graph *irg  = build_graph(&x, &y);
+	bool      fine = true;
+
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
+	if (!check_counts(x, N_USERS, y, 0)) {
+		printf("*** wrong number of edges after activation\n");
+		fine = false;
+	}
+
+	/* move every other user while iterating */
+	foreach_out_edge_safe(x, edge) {
+		ir_node *src = get_edge_src_irn(edge);
+		for (int i = 0; i < N_USERS; i += 2) {
+			if (users[i] == src)
+				set_irn_n(src, get_edge_src_pos(edge), y);
+		}
+	}
+	if (!check_counts(x, N_USERS / 2, y, N_USERS / 2) || !edges_verify(irg)) {
+		printf("*** edges broken after moving users\n");
+		fine = false;
+	}
+
+	/* grow the edge arrays of new constants, which leaves the smaller
+	 * arrays behind */
+	for (int r = 0; r < N_ROUNDS; ++r) {
+		ir_node *c = new_r_Const_long(irg, mode_Is, N_USERS + 1 + r);
+		for (int i = 0; i < N_USERS; ++i) {
+			ir_node *old = get_Add_right(users[i]);
+			set_Add_right(users[i], c);
+			if (get_irn_n_edges(old) == 0)
+				kill_node(old);
+		}
+	}
+	size_t const used_before = get_irg_memory_used(irg);
+	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
+	size_t const used_after = get_irg_memory_used(irg);
+	if (!edges_verify(irg)
+	    || !check_counts(x, N_USERS / 2, y, N_USERS / 2)) {
+		printf("*** edges broken after compaction\n");
+		fine = false;
+	}
+	printf("%zu bytes used before and %zu after compaction\n", used_before,
+	       used_after);
+	if (used_after >= used_before) {
+		printf("*** compaction did not free memory\n");
+		fine = false;
+	}
+
+	/* reactivation must not see edges of the earlier activation */
+	edges_deactivate(irg);
+	exchange(users[1], new_r_Const_long(irg, mode_Is, 1));
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
+	if (!check_counts(x, N_USERS / 2 - 1, y, N_USERS / 2)
+	    || !edges_verify(irg)) {
+		printf("*** wrong edges after reactivation\n");
+		fine = false;
+	}
+
+	ir_finish();
+	return fine ? 0 : 1;
+}
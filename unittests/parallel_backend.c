@@ -0,0 +1,192 @@
+/*
+ * Compile a program with many functions serially and with several backend
+ * threads and check that the assembly is the same: the functions share
+ * floating point constants, have jump tables and call each other. libfirm
+ * cannot be initialized twice, so every compilation runs in a child process:
+ * parallel_backend compile <target> <threads> <out>
+ * Verbose assembler comments are disabled, they contain node numbers, which
+ * are handed out to the threads in no particular order.
+ */
+#include "firm.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N_FUNCS 24
+#define N_CASES 4
+
+static ir_entity *entities[N_FUNCS];
+
+static ir_node *call(size_t callee, ir_node *arg)
+{
+	ir_node *ptr  = new_Address(entities[callee]);
+	ir_node *res  = new_Call(get_store(), ptr, 1, &arg,
+	                         get_entity_type(entities[callee]));
+	set_store(new_Proj(res, mode_M, pn_Call_M));
+	ir_node *ress = new_Proj(res, mode_T, pn_Call_T_result);
+	return new_Proj(ress, mode_Is, 0);
+}
+
+static void new_return(ir_graph *irg, ir_node *value)
+{
+	ir_node *ret = new_Return(get_store(), 1, &value);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+}
+
+/**
+ * int f_i(int n) {
+ *     int d = (int)(n * (0.5 + i % 4) + (i + 0.25));
+ *     switch (n) {
+ *     case 0 ... 3: return d + k * i + 1;
+ *     default:      return d + f_{i-1}(n - 1);
+ *     }
+ * }
+ */
+static void build_func(size_t i)
+{
+	ir_graph *irg = new_ir_graph(entities[i], 0);
+	set_current_ir_graph(irg);
+
+	ir_mode *fmode  = ir_target_float_arithmetic_mode();
+	if (fmode == NULL)
+		fmode = mode_D;
+	ir_node *n      = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_node *shared = new_Const(new_tarval_from_double(0.5 + i % 4, fmode));
+	ir_node *own    = new_Const(new_tarval_from_double(i + 0.25, fmode));
+	ir_node *prod   = new_Mul(new_Conv(n, fmode), shared);
+	ir_node *d      = new_Conv(new_Add(prod, own), mode_Is);
+
+	ir_switch_table *table = ir_new_switch_table(irg, N_CASES);
+	for (unsigned k = 0; k < N_CASES; ++k) {
+		ir_tarval *value = new_tarval_from_long(k, mode_Iu);
+		ir_switch_table_set(table, k, value, value, k + 1);
+	}
+	ir_node *switchn = new_Switch(new_Conv(n, mode_Iu), N_CASES + 1, table);
+	mature_immBlock(get_cur_block());
+
+	for (unsigned pn = 0; pn <= N_CASES; ++pn) {
+		ir_node *block = new_immBlock();
+		add_immBlock_pred(block, new_Proj(switchn, mode_X, pn));
+		mature_immBlock(block);
+		set_cur_block(block);
+		ir_node *value;
+		if (pn != pn_Switch_default) {
+			value = new_Const_long(mode_Is, (pn - 1) * i + 1);
+		} else if (i > 0) {
+			ir_node *one = new_Const_long(mode_Is, 1);
+			value = call(i - 1, new_Sub(n, one));
+		} else {
+			value = new_Const_long(mode_Is, 0);
+		}
+		new_return(irg, new_Add(d, value));
+	}
+	irg_finalize_cons(irg);
+}
+
+static void build_program(void)
+{
+	/* int f(int n) */
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp = new_type_method(1, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	for (size_t i = 0; i < N_FUNCS; ++i) {
+		char name[16];
+		snprintf(name, sizeof(name), "f%zu", i);
+		entities[i] = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	}
+	for (size_t i = 0; i < N_FUNCS; ++i)
+		build_func(i);
+}
+
+static int compile(char const *target, char const *threads, char const *out)
+{
+	char option[32];
+	snprintf(option, sizeof(option), "threads=%s", threads);
+	ir_init();
+	if (!ir_target_set(target) || ir_target_option(option) != 1
+	    || ir_target_option("verboseasm=0") != 1) {
+		printf("*** cannot set target %s\n", target);
+		return 1;
+	}
+	ir_target_init();
+	build_program();
+
+	FILE *file = fopen(out, "w");
+	if (file == NULL) {
+		printf("*** cannot write %s\n", out);
+		return 1;
+	}
+	be_main(file, "parallel_backend");
+	fclose(file);
+	ir_finish();
+	return 0;
+}
+
+static char *read_file(char const *name)
+{
+	FILE *file = fopen(name, "r");
+	if (file == NULL)
+		return NULL;
+	fseek(file, 0, SEEK_END);
+	long const size = ftell(file);
+	char      *text = malloc(size + 1);
+	rewind(file);
+	if (fread(text, 1, size, file) != (size_t)size) {
+		free(text);
+		text = NULL;
+	} else {
+		text[size] = '\0';
+	}
+	fclose(file);
+	return text;
+}
+
+/** Compiles the program for @p target with 1 and 4 threads and compares the
+ * assembly. */
+static bool check_target(char const *argv0, char const *target)
+{
+	static char const *const threads[] = { "1", "4" };
+	char *texts[2];
+	bool  fine = true;
+	for (size_t t = 0; t < 2; ++t) {
+		char out[64];
+		char cmd[1024];
+		snprintf(out, sizeof(out), "parallel_backend_%s.s", threads[t]);
+		snprintf(cmd, sizeof(cmd), "\"%s\" compile %s %s %s", argv0, target,
+		         threads[t], out);
+		texts[t] = system(cmd) == 0 ? read_file(out) : NULL;
+		remove(out);
+		if (texts[t] == NULL) {
+			printf("*** %s: compiling with %s threads failed\n", target,
+			       threads[t]);
+			fine = false;
+		}
+	}
+
+	if (fine) {
+		char last[16];
+		snprintf(last, sizeof(last), "f%d:", N_FUNCS - 1);
+		if (strstr(texts[0], last) == NULL) {
+			printf("*** %s: %s is missing\n", target, last);
+			fine = false;
+		} else if (strcmp(texts[0], texts[1]) != 0) {
+			printf("*** %s: the threads change the assembly\n", target);
+			fine = false;
+		}
+	}
+	free(texts[0]);
+	free(texts[1]);
+	return fine;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc == 5 && strcmp(argv[1], "compile") == 0)
+		return compile(argv[2], argv[3], argv[4]);
+
+	bool fine = check_target(argv[0], "x86_64-linux-gnu");
+	fine &= check_target(argv[0], "i686-linux-gnu");
+	return fine ? 0 : 1;
+}
@@ -0,0 +1,157 @@
+/*
+ * Run a pass pipeline over many graphs with several threads and check that
+ * callgraph passes see their callees finished, that program passes run
+ * between the graph stages and that the graphs got optimized.
+ */
+#include "firm.h"
+#include "irthread.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define N_GRAPHS    200
+#define CYCLE_FIRST 50
+#define CYCLE_LAST  52
+
+static ir_graph   *graphs[N_GRAPHS];
+static ir_entity  *entities[N_GRAPHS];
+static int         callees[N_GRAPHS][2];
+static bool        done[N_GRAPHS];
+static unsigned    n_done;
+static unsigned    n_prog_runs;
+static bool        order_ok = true;
+static ir_mutex_t  mutex = IR_MUTEX_INITIALIZER;
+
+static int graph_index(ir_graph const *irg)
+{
+	for (int i = 0; i < N_GRAPHS; ++i) {
+		if (graphs[i] == irg)
+			return i;
+	}
+	assert(false);
+	return -1;
+}
+
+static ir_type *get_method_type(void)
+{
+	static ir_type *mtp;
+	if (mtp == NULL) {
+		ir_type *int_type = new_type_primitive(mode_Is);
+		mtp = new_type_method(1, 1, false, cc_cdecl_set, mtp_no_property);
+		set_method_param_type(mtp, 0, int_type);
+		set_method_res_type(mtp, 0, int_type);
+	}
+	return mtp;
+}
+
+/**
+ * Graph i returns the sum of its callee results and a constant computed at
+ * runtime, which the pipeline has to fold. Graph i calls i+1 and i+7, the
+ * graphs CYCLE_FIRST..CYCLE_LAST call each other in a cycle.
+ */
+static void build_graph(int i)
+{
+	ir_graph *irg = new_ir_graph(entities[i], 0);
+	set_current_ir_graph(irg);
+	graphs[i] = irg;
+
+	callees[i][0] = i == CYCLE_LAST ? CYCLE_FIRST : i + 1;
+	callees[i][1] = i + 7;
+	ir_node *arg   = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_node *value = new_Mul(new_Const_long(mode_Is, i),
+	                         new_Const_long(mode_Is, 3));
+	value = new_Add(value, new_Const_long(mode_Is, 1));
+	for (int c = 0; c < 2; ++c) {
+		if (callees[i][c] >= N_GRAPHS) {
+			callees[i][c] = -1;
+			continue;
+		}
+		ir_node *addr = new_Address(entities[callees[i][c]]);
+		ir_node *call = new_Call(get_store(), addr, 1, &arg,
+		                         get_method_type());
+		set_store(new_Proj(call, mode_M, pn_Call_M));
+		ir_node *results = new_Proj(call, mode_T, pn_Call_T_result);
+		value = new_Add(value, new_Proj(results, mode_Is, 0));
+	}
+
+	ir_node *ret = new_Return(get_store(), 1, &value);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+}
+
+static void check_callees(ir_graph *irg)
+{
+	int const i = graph_index(irg);
+	ir_mutex_lock(&mutex);
+	for (int c = 0; c < 2; ++c) {
+		int const callee = callees[i][c];
+		/* within the cycle only the call closing it sees an unfinished
+		 * callee */
+		if (callee < 0 || (i == CYCLE_LAST && callee == CYCLE_FIRST))
+			continue;
+		if (!done[callee])
+			order_ok = false;
+	}
+	done[i] = true;
+	++n_done;
+	ir_mutex_unlock(&mutex);
+}
+
+static void check_stage_finished(void)
+{
+	assert(n_done == N_GRAPHS);
+	++n_prog_runs;
+	memset(done, 0, sizeof(done));
+	n_done = 0;
+}
+
+static void count_mul(ir_node *node, void *data)
+{
+	if (is_Mul(node))
+		++*(unsigned*)data;
+}
+
+static void run(unsigned n_threads)
+{
+	n_prog_runs = 0;
+	ir_pipeline_t *pipeline = new_ir_pipeline();
+	ir_pipeline_add_graph_pass(pipeline, optimize_graph_df);
+	ir_pipeline_add_callgraph_pass(pipeline, check_callees);
+	ir_pipeline_add_prog_pass(pipeline, check_stage_finished);
+	ir_pipeline_add_callgraph_pass(pipeline, check_callees);
+	ir_pipeline_add_prog_pass(pipeline, check_stage_finished);
+	ir_pipeline_run(pipeline, n_threads);
+	free_ir_pipeline(pipeline);
+
+	assert(order_ok);
+	assert(n_prog_runs == 2);
+	for (int i = 0; i < N_GRAPHS; ++i) {
+		unsigned n_mul = 0;
+		irg_walk_graph(graphs[i], count_mul, NULL, &n_mul);
+		assert(n_mul == 0);
+	}
+}
+
+int main(void)
+{
+	ir_init();
+
+	for (int i = 0; i < N_GRAPHS; ++i) {
+		char name[32];
+		snprintf(name, sizeof(name), "f%d", i);
+		entities[i] = new_entity(get_glob_type(), new_id_from_str(name),
+		                         get_method_type());
+	}
+	/* keep the Muls for the pipeline to fold */
+	set_optimize(0);
+	for (int i = 0; i < N_GRAPHS; ++i)
+		build_graph(i);
+	set_optimize(1);
+
+	run(4);
+	run(1);
+
+	ir_finish();
+	return order_ok ? 0 : 1;
+}
@@ -0,0 +1,361 @@
+/*
+ * Instrument a program for edge and value profiling, write it as an object
+ * file, link it with the libfirmprof runtime and run it. Then read the
+ * profile back and check the block, edge and value counts, and that
+ * profiles with a wrong version or checksum are not used. libfirm cannot be
+ * initialized twice, so every step runs in its own process:
+ * profile_roundtrip (read|badversion|badchecksum) <file>
+ */
+#include "firm.h"
+#include "irprofile.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROFILE_FILE "profile_roundtrip.prof"
+#define BROKEN_FILE  "profile_roundtrip_broken.prof"
+#define OBJECT_FILE  "profile_roundtrip.o"
+#define MAIN_FILE    "profile_roundtrip_main.c"
+#define EXE_FILE     "profile_roundtrip_exe"
+
+/* word offsets in the profile file behind the "firmprof" tag */
+#define VERSION_WORD  1
+#define CHECKSUM_WORD 4
+
+static ir_graph *work, *apply, *inc;
+static ir_node  *header, *body, *odd, *join, *exit_block, *sw, *icall;
+
+static ir_type *get_int_type(void)
+{
+	static ir_type *int_type;
+	if (int_type == NULL)
+		int_type = new_type_primitive(mode_Is);
+	return int_type;
+}
+
+static ir_type *get_unary_type(void)
+{
+	static ir_type *mtp;
+	if (mtp == NULL) {
+		mtp = new_type_method(1, 1, false, cc_cdecl_set, mtp_no_property);
+		set_method_param_type(mtp, 0, get_int_type());
+		set_method_res_type(mtp, 0, get_int_type());
+	}
+	return mtp;
+}
+
+static ir_graph *new_graph(char const *name, ir_type *mtp, int n_locals)
+{
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg = new_ir_graph(ent, n_locals);
+	set_current_ir_graph(irg);
+	return irg;
+}
+
+static void new_return(ir_node *value)
+{
+	ir_node *ret = new_Return(get_store(), 1, &value);
+	add_immBlock_pred(get_irg_end_block(get_current_ir_graph()), ret);
+}
+
+static ir_node *new_block(ir_node *pred)
+{
+	ir_node *block = new_immBlock();
+	add_immBlock_pred(block, pred);
+	set_cur_block(block);
+	return block;
+}
+
+/**
+ * int work(int n, int sel)
+ * {
+ *     int s = 0;
+ *     for (int i = 0; i < n; ++i) {
+ *         if (i & 1) s += i; else s -= 1;
+ *     }
+ *     switch (sel) { case 1: return s + 1; case 2: return s * 2; }
+ *     return s;
+ * }
+ */
+static void build_work(void)
+{
+	ir_type *mtp = new_type_method(2, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, get_int_type());
+	set_method_param_type(mtp, 1, get_int_type());
+	set_method_res_type(mtp, 0, get_int_type());
+	work = new_graph("work", mtp, 2);
+
+	ir_node *n   = new_Proj(get_irg_args(work), mode_Is, 0);
+	ir_node *sel = new_Proj(get_irg_args(work), mode_Is, 1);
+	set_value(0, new_Const_long(mode_Is, 0));
+	set_value(1, new_Const_long(mode_Is, 0));
+	ir_node *entry = new_Jmp();
+	mature_immBlock(get_cur_block());
+
+	header = new_block(entry);
+	ir_node *cmp  = new_Cmp(get_value(1, mode_Is), n, ir_relation_less);
+	ir_node *cond = new_Cond(cmp);
+
+	body = new_block(new_Proj(cond, mode_X, pn_Cond_true));
+	mature_immBlock(body);
+	ir_node *bit   = new_And(get_value(1, mode_Is), new_Const_long(mode_Is, 1));
+	ir_node *cond2 = new_Cond(new_Cmp(bit, new_Const_long(mode_Is, 0),
+	                                  ir_relation_less_greater));
+
+	odd = new_block(new_Proj(cond2, mode_X, pn_Cond_true));
+	mature_immBlock(odd);
+	set_value(0, new_Add(get_value(0, mode_Is), get_value(1, mode_Is)));
+	ir_node *odd_jmp = new_Jmp();
+
+	ir_node *even = new_block(new_Proj(cond2, mode_X, pn_Cond_false));
+	mature_immBlock(even);
+	set_value(0, new_Sub(get_value(0, mode_Is), new_Const_long(mode_Is, 1)));
+	ir_node *even_jmp = new_Jmp();
+
+	join = new_block(odd_jmp);
+	add_immBlock_pred(join, even_jmp);
+	mature_immBlock(join);
+	set_value(1, new_Add(get_value(1, mode_Is), new_Const_long(mode_Is, 1)));
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(header);
+
+	exit_block = new_block(new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(exit_block);
+	ir_node         *s     = get_value(0, mode_Is);
+	ir_switch_table *table = ir_new_switch_table(work, 2);
+	for (unsigned i = 0; i < 2; ++i) {
+		ir_tarval *tv = new_tarval_from_long(i + 1, mode_Is);
+		ir_switch_table_set(table, i, tv, tv, i + 1);
+	}
+	sw = new_Switch(sel, 3, table);
+	ir_node *results[] = {
+		s, new_Add(s, new_Const_long(mode_Is, 1)),
+		new_Mul(s, new_Const_long(mode_Is, 2)),
+	};
+	for (unsigned i = 0; i < 3; ++i) {
+		ir_node *block = new_block(new_Proj(sw, mode_X, i));
+		mature_immBlock(block);
+		new_return(results[i]);
+	}
+	irg_finalize_cons(work);
+}
+
+/** int apply(int (*f)(int), int x) { return f(x); } */
+static void build_apply(void)
+{
+	ir_type *mtp = new_type_method(2, 1, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, new_type_pointer(get_unary_type()));
+	set_method_param_type(mtp, 1, get_int_type());
+	set_method_res_type(mtp, 0, get_int_type());
+	apply = new_graph("apply", mtp, 0);
+
+	ir_node *f = new_Proj(get_irg_args(apply), mode_P, 0);
+	ir_node *x = new_Proj(get_irg_args(apply), mode_Is, 1);
+	icall = new_Call(get_store(), f, 1, &x, get_unary_type());
+	set_store(new_Proj(icall, mode_M, pn_Call_M));
+	new_return(new_Proj(new_Proj(icall, mode_T, pn_Call_T_result), mode_Is,
+	                    0));
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(apply);
+}
+
+/** int inc(int x) { return x + 1; } and dec likewise */
+static ir_graph *build_step(char const *name, long step)
+{
+	ir_graph *irg = new_graph(name, get_unary_type(), 0);
+	ir_node  *x   = new_Proj(get_irg_args(irg), mode_Is, 0);
+	new_return(new_Add(x, new_Const_long(mode_Is, step)));
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static void build_program(void)
+{
+	build_work();
+	build_apply();
+	inc = build_step("inc", 1);
+	build_step("dec", -1);
+}
+
+static bool check_count(char const *what, uint32_t count, uint32_t expected)
+{
+	if (count == expected)
+		return true;
+	printf("*** %s executed %u times instead of %u\n", what, count, expected);
+	return false;
+}
+
+/** Expects the run of main() from write_main(). */
+static bool check_profile(void)
+{
+	bool fine = check_count("work", ir_profile_get_block_execcount(
+	                        get_irg_start_block(work)), 3);
+	fine &= check_count("loop header", ir_profile_get_block_execcount(header),
+	                    33);
+	fine &= check_count("loop body", ir_profile_get_block_execcount(body), 30);
+	fine &= check_count("odd branch", ir_profile_get_block_execcount(odd), 15);
+	fine &= check_count("loop exit", ir_profile_get_block_execcount(exit_block),
+	                    3);
+
+	double freq;
+	int const back = get_Block_n_cfgpreds(header) - 1;
+	if (!ir_profile_get_edge_execfreq(header, back, &freq) || freq != 10.0) {
+		printf("*** the back edge has no frequency of 10 per call\n");
+		fine = false;
+	}
+	if (!ir_profile_get_edge_execfreq(join, 0, &freq) || freq != 5.0) {
+		printf("*** the edge from the odd branch has no frequency of 5\n");
+		fine = false;
+	}
+
+	ir_profile_value_t values[IR_PROFILE_N_VALUES];
+	if (ir_profile_get_values(sw, values) != 1 || values[0].value != 2
+	    || values[0].count != 3) {
+		printf("*** the switch selector profile is wrong\n");
+		fine = false;
+	}
+	if (ir_profile_get_values(icall, values) != 2 || values[0].count != 5
+	    || values[0].callee != get_irg_entity(inc) || values[1].count != 2) {
+		printf("*** the indirect call profile is wrong\n");
+		fine = false;
+	}
+	return fine;
+}
+
+static int read_profile(char const *mode, char const *file)
+{
+	ir_init();
+	build_program();
+	bool const read = ir_profile_read(file);
+	int        res  = 0;
+	if (strcmp(mode, "read") == 0) {
+		res = read && check_profile() ? 0 : 1;
+	} else if (strcmp(mode, "badversion") == 0) {
+		res = read ? 1 : 0;
+	} else {
+		/* the record of work does not match, the other ones are used */
+		res = read && ir_profile_get_block_execcount(header) == 0
+		      && ir_profile_get_block_execcount(get_irg_start_block(inc))
+		         == 5 ? 0 : 1;
+	}
+	ir_finish();
+	return res;
+}
+
+static bool write_main(void)
+{
+	FILE *file = fopen(MAIN_FILE, "w");
+	if (file == NULL)
+		return false;
+	fputs("int work(int, int);\n"
+	      "int apply(int (*)(int), int);\n"
+	      "int inc(int);\n"
+	      "int dec(int);\n"
+	      "int main(void)\n"
+	      "{\n"
+	      "\tint r = 0;\n"
+	      "\tfor (int k = 0; k < 3; ++k)\n"
+	      "\t\tr += work(10, 2);\n"
+	      "\tfor (int k = 0; k < 5; ++k)\n"
+	      "\t\tr += apply(inc, k);\n"
+	      "\tfor (int k = 0; k < 2; ++k)\n"
+	      "\t\tr += apply(dec, k);\n"
+	      "\treturn r == 3 * 40 + 15 - 1 ? 0 : 1;\n"
+	      "}\n", file);
+	fclose(file);
+	return true;
+}
+
+/** Copies the profile with the word at @p word incremented. */
+static bool write_broken(unsigned word)
+{
+	FILE *in  = fopen(PROFILE_FILE, "rb");
+	FILE *out = fopen(BROKEN_FILE, "wb");
+	if (in == NULL || out == NULL)
+		return false;
+	long const offset = 8 + 4 * word;
+	long       pos    = 0;
+	int        c;
+	while ((c = fgetc(in)) != EOF) {
+		if (pos++ == offset)
+			++c;
+		fputc(c, out);
+	}
+	fclose(in);
+	fclose(out);
+	return pos > offset;
+}
+
+/** Runs this program with the given arguments in a new process. */
+static bool run_self(char const *self, char const *args)
+{
+	char cmd[1024];
+	snprintf(cmd, sizeof(cmd), "\"%s\" %s", self, args);
+	return system(cmd) == 0;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc == 3)
+		return read_profile(argv[1], argv[2]);
+
+#ifndef FIRMPROF_SOURCE
+	printf("libfirmprof source unknown, profile not generated\n");
+	return 0;
+#else
+	if (system("cc --version >/dev/null 2>&1") != 0) {
+		printf("no C compiler, profile not generated\n");
+		return 0;
+	}
+
+	ir_init();
+	if (!ir_target_set("x86_64-linux-gnu")) {
+		printf("*** cannot set target\n");
+		return 1;
+	}
+	ir_target_init();
+	build_program();
+	ir_profile_instrument(PROFILE_FILE, ir_profile_edges | ir_profile_values);
+	FILE *output = fopen(OBJECT_FILE, "wb");
+	if (output == NULL || be_main_object(output, "profile_roundtrip.c") != 0) {
+		printf("*** writing the object file failed\n");
+		return 1;
+	}
+	fclose(output);
+	ir_finish();
+
+	remove(PROFILE_FILE);
+	bool fine = write_main()
+	         && system("cc -no-pie -o " EXE_FILE " " MAIN_FILE " " OBJECT_FILE
+	                   " " FIRMPROF_SOURCE) == 0;
+	if (!fine)
+		printf("*** linking the instrumented program failed\n");
+	if (fine && system("./" EXE_FILE) != 0) {
+		printf("*** the instrumented program computed wrong results\n");
+		fine = false;
+	}
+	if (fine && !run_self(argv[0], "read " PROFILE_FILE)) {
+		printf("*** the profile does not match the run\n");
+		fine = false;
+	}
+	if (fine && (!write_broken(VERSION_WORD)
+	             || !run_self(argv[0], "badversion " BROKEN_FILE))) {
+		printf("*** a profile of another version was read\n");
+		fine = false;
+	}
+	if (fine && (!write_broken(CHECKSUM_WORD)
+	             || !run_self(argv[0], "badchecksum " BROKEN_FILE))) {
+		printf("*** a record with a wrong checksum was used\n");
+		fine = false;
+	}
+
+	remove(PROFILE_FILE);
+	remove(BROKEN_FILE);
+	remove(OBJECT_FILE);
+	remove(MAIN_FILE);
+	remove(EXE_FILE);
+	return fine ? 0 : 1;
+#endif
+}
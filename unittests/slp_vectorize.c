@@ -0,0 +1,133 @@
+/*
+ * Check that slp_vectorize() packs the four lanes of
+ * a[k] = a[k] + b[k] * 2.0f into one vector Store and leaves four Stores of
+ * unrelated values alone.
+ */
+#include "firm.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define N_LANES 4
+
+static ir_graph *new_graph(char const *name)
+{
+	ir_type *ptr_type = new_type_pointer(get_type_for_mode(mode_F));
+	ir_type *mtp = new_type_method(2, 0, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, ptr_type);
+	set_method_param_type(mtp, 1, ptr_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 0);
+	set_current_ir_graph(irg);
+	return irg;
+}
+
+static ir_node *new_address(ir_node *base, int lane)
+{
+	ir_mode *mode = get_reference_offset_mode(mode_P);
+	return new_Add(base, new_Const_long(mode, 4 * lane));
+}
+
+static ir_node *new_load(ir_node *base, int lane)
+{
+	ir_type *type = get_type_for_mode(mode_F);
+	ir_node *load = new_Load(get_store(), new_address(base, lane), mode_F,
+	                         type, cons_none);
+	set_store(new_Proj(load, mode_M, pn_Load_M));
+	return new_Proj(load, mode_F, pn_Load_res);
+}
+
+static void new_store(ir_node *base, int lane, ir_node *value)
+{
+	ir_type *type  = get_type_for_mode(mode_F);
+	ir_node *store = new_Store(get_store(), new_address(base, lane), value,
+	                           type, cons_none);
+	set_store(new_Proj(store, mode_M, pn_Store_M));
+}
+
+static ir_graph *finish_graph(ir_graph *irg)
+{
+	ir_node *ret = new_Return(get_store(), 0, NULL);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+/** void axpy(float *a, float *b) { a[k] = a[k] + b[k] * 2.0f; } */
+static ir_graph *build_axpy(void)
+{
+	ir_graph *irg = new_graph("axpy");
+	ir_node  *a   = new_Proj(get_irg_args(irg), mode_P, 0);
+	ir_node  *b   = new_Proj(get_irg_args(irg), mode_P, 1);
+	ir_node  *two = new_Const(new_tarval_from_double(2.0, mode_F));
+	ir_node  *va[N_LANES];
+	ir_node  *vb[N_LANES];
+	for (int k = 0; k < N_LANES; ++k) {
+		va[k] = new_load(a, k);
+		vb[k] = new_load(b, k);
+	}
+	for (int k = 0; k < N_LANES; ++k)
+		new_store(a, k, new_Add(va[k], new_Mul(vb[k], two)));
+	return finish_graph(irg);
+}
+
+/** void spread(float *a, float *b) { a[k] = b[3 * k]; } */
+static ir_graph *build_spread(void)
+{
+	ir_graph *irg = new_graph("spread");
+	ir_node  *a   = new_Proj(get_irg_args(irg), mode_P, 0);
+	ir_node  *b   = new_Proj(get_irg_args(irg), mode_P, 1);
+	ir_node  *v[N_LANES];
+	for (int k = 0; k < N_LANES; ++k)
+		v[k] = new_load(b, 3 * k);
+	for (int k = 0; k < N_LANES; ++k)
+		new_store(a, k, v[k]);
+	return finish_graph(irg);
+}
+
+static void count_stores(ir_node *node, void *env)
+{
+	unsigned *const counts = (unsigned*)env;
+	if (!is_Store(node))
+		return;
+	if (mode_is_vector(get_irn_mode(get_Store_value(node))))
+		++counts[1];
+	else
+		++counts[0];
+}
+
+static bool check(ir_graph *irg, unsigned n_scalar, unsigned n_vector)
+{
+	slp_vectorize(irg);
+	unsigned counts[2] = { 0, 0 };
+	irg_walk_graph(irg, count_stores, NULL, counts);
+	if (counts[0] != n_scalar || counts[1] != n_vector) {
+		ir_printf("*** %+F: %u scalar and %u vector Stores instead of %u and "
+		          "%u\n", irg, counts[0], counts[1], n_scalar, n_vector);
+		return false;
+	}
+	if (!irg_verify(irg)) {
+		ir_printf("*** %+F does not verify\n", irg);
+		return false;
+	}
+	return true;
+}
+
+int main(void)
+{
+	ir_init();
+	if (!ir_target_set("x86_64-linux-gnu")) {
+		printf("*** cannot set target\n");
+		return 1;
+	}
+	ir_target_init();
+
+	bool fine = true;
+	fine &= check(build_axpy(), 0, 1);
+	/* the gathers cost more than the packed Store saves */
+	fine &= check(build_spread(), N_LANES, 0);
+
+	ir_finish();
+	return fine ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+/*
+ * Microbenchmark for the strcalc limb representation.
+ * The results of all operations are checked against native 64bit arithmetic,
+ * then the operations are timed on the same values. This file is built twice:
+ * against libfirm (default SC_BITS) and together with ir/tv/strcalc.c using
+ * SC_BITS=8, so both representations can be compared.
+ * Usage: strcalc_bench [rounds]
+ */
+#include "strcalc.h"
+
+#include "util.h"
+#include "xmalloc.h"
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* same precision as the tarval module uses for its integer values */
+static const unsigned precision = 128;
+static unsigned buflen;
+static bool     fine = true;
+
+/* values from the tarval_calc and strcalc tests: mode limits, single bits,
+ * alternating bit patterns and some arbitrary constants */
+static const uint64_t test_values[] = {
+	0, 1, 2, 4, 8, 16, 42, 2048, 0xCAFEBABE, 0x7FFFFFFFFFFFFFFF,
+	0x8000000000000000, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFE,
+	0x5555555555555555, 0xAAAAAAAAAAAAAAAA,
+	0x7F, 0x80, 0xFF, 0xFFFFFFFFFFFFFF80,
+	0x7FFF, 0x8000, 0xFFFF, 0xFFFFFFFFFFFF8000,
+	0x7FFFFFFF, 0x80000000, 0xFFFFFFFF, 0xFFFFFFFF80000000,
+	0xFFFFFFFFFFFFFFD6, 0x0123456789ABCDEF, 0xFEDCBA9876543210,
+};
+#define N_VALUES ARRAY_SIZE(test_values)
+
+static sc_word *vals[N_VALUES];
+
+static void check(bool ok, const char *op, uint64_t a, uint64_t b)
+{
+	if (ok)
+		return;
+	printf("Failed: %s(0x%"PRIX64", 0x%"PRIX64")\n", op, a, b);
+	fine = false;
+}
+
+/** Construct a sign extended strcalc value from a 64bit number. */
+static void val_from_uint64(uint64_t v, sc_word *buffer)
+{
+	unsigned char bytes[8];
+	for (unsigned i = 0; i < sizeof(bytes); ++i)
+		bytes[i] = (unsigned char)(v >> (i * CHAR_BIT));
+	sc_val_from_bytes(bytes, sizeof(bytes), buffer);
+	sc_sign_extend(buffer, 64);
+}
+
+static int64_t to_signed(uint64_t v)
+{
+	return v > INT64_MAX ? -(int64_t)(~v) - 1 : (int64_t)v;
+}
+
+static uint64_t sar(uint64_t v, unsigned shift)
+{
+	return (int64_t)v < 0 ? ~(~v >> shift) : v >> shift;
+}
+
+static void verify(void)
+{
+	sc_word *res  = XMALLOCN(sc_word, buflen);
+	sc_word *res2 = XMALLOCN(sc_word, buflen);
+	for (unsigned i = 0; i < N_VALUES; ++i) {
+		uint64_t const a = test_values[i];
+		sc_word *const va = vals[i];
+		check(sc_val_to_uint64(va) == a, "conv", a, 0);
+
+		for (unsigned s = 0; s < 64; ++s) {
+			sc_shlI(va, s, res);
+			check(sc_val_to_uint64(res) == a << s, "shl", a, s);
+			memcpy(res2, va, buflen * sizeof(sc_word));
+			sc_zero_extend(res2, 64);
+			sc_shrI(res2, s, res);
+			check(sc_val_to_uint64(res) == a >> s, "shr", a, s);
+			sc_shrsI(va, s, 64, res);
+			check(sc_val_to_uint64(res) == sar(a, s), "shrs", a, s);
+		}
+
+		char buf[64];
+		snprintf(buf, sizeof(buf), "%"PRId64, to_signed(a));
+		char        print_buf[128];
+		char const *p = sc_print_buf(print_buf, sizeof(print_buf), va, 64,
+		                             SC_DEC, true);
+		check(streq(p, buf), "print", a, 0);
+		snprintf(buf, sizeof(buf), "%"PRIX64, a);
+		p = sc_print_buf(print_buf, sizeof(print_buf), va, 64, SC_HEX, false);
+		check(streq(p, buf), "print_hex", a, 0);
+		sc_val_from_str(false, 16, buf, strlen(buf), res);
+		sc_sign_extend(res, 64);
+		check(sc_comp(res, va) == ir_relation_equal, "from_str", a, 0);
+
+		for (unsigned j = 0; j < N_VALUES; ++j) {
+			uint64_t const b  = test_values[j];
+			sc_word *const vb = vals[j];
+			sc_add(va, vb, res);
+			check(sc_val_to_uint64(res) == a + b, "add", a, b);
+			sc_sub(va, vb, res);
+			check(sc_val_to_uint64(res) == a - b, "sub", a, b);
+			sc_mul(va, vb, res);
+			check(sc_val_to_uint64(res) == a * b, "mul", a, b);
+
+			int64_t const sa = to_signed(a);
+			int64_t const sb = to_signed(b);
+			ir_relation const rel = sa < sb ? ir_relation_less
+			                      : sa > sb ? ir_relation_greater
+			                                : ir_relation_equal;
+			check(sc_comp(va, vb) == rel, "comp", a, b);
+
+			if (b == 0 || (sa == INT64_MIN && sb == -1))
+				continue;
+			sc_divmod(va, vb, res, res2);
+			check(sc_val_to_uint64(res) == (uint64_t)(sa / sb), "div", a, b);
+			check(sc_val_to_uint64(res2) == (uint64_t)(sa % sb), "mod", a, b);
+		}
+	}
+	free(res2);
+	free(res);
+}
+
+typedef void (*binop)(const sc_word *v0, const sc_word *v1, sc_word *dest);
+
+static void div_op(const sc_word *v0, const sc_word *v1, sc_word *dest)
+{
+	if (!sc_is_zero(v1, precision))
+		sc_div(v0, v1, dest);
+}
+
+static void shl_op(const sc_word *v0, const sc_word *v1, sc_word *dest)
+{
+	sc_shlI(v0, sc_val_to_uint64(v1) & 63, dest);
+}
+
+static void shrs_op(const sc_word *v0, const sc_word *v1, sc_word *dest)
+{
+	sc_shrsI(v0, sc_val_to_uint64(v1) & 63, 64, dest);
+}
+
+static void print_op(const sc_word *v0, const sc_word *v1, sc_word *dest)
+{
+	(void)v1;
+	char buf[128];
+	char const *p = sc_print_buf(buf, sizeof(buf), v0, 64, SC_DEC, true);
+	dest[0] ^= (sc_word)p[0];
+}
+
+static void bench(const char *name, binop op, unsigned rounds)
+{
+	sc_word *res = XMALLOCNZ(sc_word, buflen);
+	clock_t const start = clock();
+	for (unsigned r = 0; r < rounds; ++r) {
+		for (unsigned i = 0; i < N_VALUES; ++i) {
+			for (unsigned j = 0; j < N_VALUES; ++j)
+				op(vals[i], vals[j], res);
+		}
+	}
+	clock_t const end = clock();
+	double const n_ops = (double)rounds * N_VALUES * N_VALUES;
+	double const ns    = (double)(end - start) / CLOCKS_PER_SEC * 1e9;
+	printf("  %-6s %8.1f ns/op\n", name, ns / n_ops);
+	free(res);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned rounds = argc > 1 ? (unsigned)atoi(argv[1]) : 10;
+
+	init_strcalc(precision);
+	buflen = sc_get_value_length();
+	for (unsigned i = 0; i < N_VALUES; ++i) {
+		vals[i] = XMALLOCN(sc_word, buflen);
+		val_from_uint64(test_values[i], vals[i]);
+	}
+
+	verify();
+	if (!fine) {
+		printf("*** Some tests failed\n");
+		abort();
+	}
+
+	printf("strcalc with %u bit limbs, %u limbs per value\n", SC_BITS, buflen);
+	bench("add",   sc_add,   rounds);
+	bench("sub",   sc_sub,   rounds);
+	bench("mul",   sc_mul,   rounds);
+	bench("div",   div_op,   rounds);
+	bench("shl",   shl_op,   rounds);
+	bench("shrs",  shrs_op,  rounds);
+	bench("print", print_op, rounds);
+
+	for (unsigned i = 0; i < N_VALUES; ++i)
+		free(vals[i]);
+	finish_strcalc();
+	return 0;
+}
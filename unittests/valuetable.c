@@ -0,0 +1,67 @@
+/*
+ * Check the CSE value table, in particular while it migrates entries into
+ * a grown bucket array.
+ */
+#include "irvaluetable.h"
+
+#include "xmalloc.h"
+#include <assert.h>
+#include <stdlib.h>
+
+/* The table only passes nodes to the compare function, so the test uses
+ * numbers disguised as nodes. */
+static int cmp_numbers(const ir_node *a, const ir_node *b)
+{
+	return *(const unsigned*)a != *(const unsigned*)b;
+}
+
+static unsigned *numbers;
+static unsigned *seen;
+
+static void count_visit(ir_node *node, void *env)
+{
+	(void)env;
+	++seen[*(unsigned*)node];
+}
+
+static void check_visit(ir_valuetable_t *table, unsigned n)
+{
+	seen = XMALLOCNZ(unsigned, n);
+	ir_valuetable_visit(table, count_visit, NULL);
+	for (unsigned i = 0; i < n; ++i)
+		assert(seen[i] == 1);
+	free(seen);
+}
+
+int main(void)
+{
+	unsigned const n = 100000;
+	numbers = XMALLOCN(unsigned, 2 * n);
+	for (unsigned i = 0; i < n; ++i) {
+		numbers[i]     = i;
+		numbers[n + i] = i;
+	}
+
+	ir_valuetable_t *table = new_ir_valuetable(cmp_numbers, 0);
+	for (unsigned i = 0; i < n; ++i) {
+		/* few distinct hashes to get long probe sequences */
+		unsigned const hash = i % 4099;
+		ir_node *const node = (ir_node*)&numbers[i];
+		assert(ir_valuetable_insert(table, node, hash) == node);
+		/* an equal value must be found, also while migrating */
+		ir_node *const dup = (ir_node*)&numbers[n + i];
+		assert(ir_valuetable_insert(table, dup, hash) == node);
+		assert(ir_valuetable_size(table) == i + 1);
+		if (i % 1000 == 999)
+			check_visit(table, i + 1);
+	}
+	for (unsigned i = 0; i < n; ++i) {
+		ir_node *const dup = (ir_node*)&numbers[n + i];
+		assert(ir_valuetable_insert(table, dup, i % 4099)
+		       == (ir_node*)&numbers[i]);
+	}
+	check_visit(table, n);
+	del_ir_valuetable(table);
+	free(numbers);
+	return 0;
+}
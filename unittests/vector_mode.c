@@ -0,0 +1,93 @@
+/*
+ * Check the properties of vector modes, that a graph computing with vector
+ * values verifies and that the export writes the vector mode.
+ */
+#include "firm.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define EXPORT_FILE "vector_mode.ir"
+
+/** void f(float *p, float x) { p[0..3] += x; } with a vector load and store */
+static ir_graph *build_graph(ir_mode *vmode)
+{
+	ir_type *ptr_type   = new_type_pointer(get_type_for_mode(mode_F));
+	ir_type *float_type = get_type_for_mode(mode_F);
+	ir_type *mtp = new_type_method(2, 0, false, cc_cdecl_set, mtp_no_property);
+	set_method_param_type(mtp, 0, ptr_type);
+	set_method_param_type(mtp, 1, float_type);
+	ir_entity *ent = new_entity(get_glob_type(), new_id_from_str("f"), mtp);
+	ir_graph  *irg = new_ir_graph(ent, 0);
+	set_current_ir_graph(irg);
+
+	ir_node *p = new_Proj(get_irg_args(irg), mode_P, 0);
+	ir_node *x = new_Proj(get_irg_args(irg), mode_F, 1);
+	ir_node *in[4];
+	for (int i = 0; i < 4; ++i)
+		in[i] = x;
+	ir_node *splat = new_Pack(4, in, vmode);
+	ir_node *load  = new_Load(get_store(), p, vmode, float_type, cons_none);
+	set_store(new_Proj(load, mode_M, pn_Load_M));
+	ir_node *value = new_Proj(load, vmode, pn_Load_res);
+	ir_node *sum   = new_Add(value, splat);
+	ir_node *store = new_Store(get_store(), p, sum, float_type, cons_none);
+	set_store(new_Proj(store, mode_M, pn_Store_M));
+	ir_node *ret = new_Return(get_store(), 0, NULL);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static bool file_contains(char const *name, char const *text)
+{
+	FILE *file = fopen(name, "r");
+	if (file == NULL)
+		return false;
+	char line[256];
+	bool found = false;
+	while (!found && fgets(line, sizeof(line), file) != NULL)
+		found = strstr(line, text) != NULL;
+	fclose(file);
+	return found;
+}
+
+int main(void)
+{
+	ir_init();
+
+	bool     fine  = true;
+	ir_mode *vmode = new_vector_mode("Fx4", mode_F, 4);
+	if (!mode_is_vector(vmode) || mode_is_vector(mode_F)
+	    || get_vector_element_mode(vmode) != mode_F
+	    || get_vector_n_elements(vmode) != 4
+	    || get_mode_size_bits(vmode) != 128
+	    || !mode_is_data(vmode) || mode_is_num(vmode)) {
+		printf("*** wrong properties of the vector mode\n");
+		fine = false;
+	}
+	if (new_vector_mode("Fx4", mode_F, 4) != vmode
+	    || new_vector_mode("Isx4", mode_Is, 4) == vmode) {
+		printf("*** vector modes are not unique\n");
+		fine = false;
+	}
+
+	ir_graph *irg = build_graph(vmode);
+	if (!irg_verify(irg)) {
+		printf("*** graph with vector values does not verify\n");
+		fine = false;
+	}
+
+	if (ir_export(EXPORT_FILE) != 0
+	    || !file_contains(EXPORT_FILE, "vector_mode")) {
+		printf("*** vector mode not exported\n");
+		fine = false;
+	}
+	remove(EXPORT_FILE);
+
+	ir_finish();
+	return fine ? 0 : 1;
+}